@@ -0,0 +1,651 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: chatbuf.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_chatbuf_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_chatbuf_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_chatbuf_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_chatbuf_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_chatbuf_2eproto;
+namespace SyncDemo {
+class ChatMessage;
+struct ChatMessageDefaultTypeInternal;
+extern ChatMessageDefaultTypeInternal _ChatMessage_default_instance_;
+}  // namespace SyncDemo
+PROTOBUF_NAMESPACE_OPEN
+template<> ::SyncDemo::ChatMessage* Arena::CreateMaybeMessage<::SyncDemo::ChatMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace SyncDemo {
+
+enum ChatMessage_ChatMessageType : int {
+  ChatMessage_ChatMessageType_CHAT = 0,
+  ChatMessage_ChatMessageType_HELLO = 1,
+  ChatMessage_ChatMessageType_LEAVE = 2,
+  ChatMessage_ChatMessageType_JOIN = 3,
+  ChatMessage_ChatMessageType_OTHER = 4
+};
+bool ChatMessage_ChatMessageType_IsValid(int value);
+constexpr ChatMessage_ChatMessageType ChatMessage_ChatMessageType_ChatMessageType_MIN = ChatMessage_ChatMessageType_CHAT;
+constexpr ChatMessage_ChatMessageType ChatMessage_ChatMessageType_ChatMessageType_MAX = ChatMessage_ChatMessageType_OTHER;
+constexpr int ChatMessage_ChatMessageType_ChatMessageType_ARRAYSIZE = ChatMessage_ChatMessageType_ChatMessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ChatMessage_ChatMessageType_descriptor();
+template<typename T>
+inline const std::string& ChatMessage_ChatMessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ChatMessage_ChatMessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ChatMessage_ChatMessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ChatMessage_ChatMessageType_descriptor(), enum_t_value);
+}
+inline bool ChatMessage_ChatMessageType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ChatMessage_ChatMessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ChatMessage_ChatMessageType>(
+    ChatMessage_ChatMessageType_descriptor(), name, value);
+}
+// ===================================================================
+
+class ChatMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncDemo.ChatMessage) */ {
+ public:
+  inline ChatMessage() : ChatMessage(nullptr) {}
+  ~ChatMessage() override;
+  explicit PROTOBUF_CONSTEXPR ChatMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChatMessage(const ChatMessage& from);
+  ChatMessage(ChatMessage&& from) noexcept
+    : ChatMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ChatMessage& operator=(const ChatMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChatMessage& operator=(ChatMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChatMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChatMessage* internal_default_instance() {
+    return reinterpret_cast<const ChatMessage*>(
+               &_ChatMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ChatMessage& a, ChatMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChatMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChatMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChatMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChatMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChatMessage& from) {
+    ChatMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChatMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncDemo.ChatMessage";
+  }
+  protected:
+  explicit ChatMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ChatMessage_ChatMessageType ChatMessageType;
+  static constexpr ChatMessageType CHAT =
+    ChatMessage_ChatMessageType_CHAT;
+  static constexpr ChatMessageType HELLO =
+    ChatMessage_ChatMessageType_HELLO;
+  static constexpr ChatMessageType LEAVE =
+    ChatMessage_ChatMessageType_LEAVE;
+  static constexpr ChatMessageType JOIN =
+    ChatMessage_ChatMessageType_JOIN;
+  static constexpr ChatMessageType OTHER =
+    ChatMessage_ChatMessageType_OTHER;
+  static inline bool ChatMessageType_IsValid(int value) {
+    return ChatMessage_ChatMessageType_IsValid(value);
+  }
+  static constexpr ChatMessageType ChatMessageType_MIN =
+    ChatMessage_ChatMessageType_ChatMessageType_MIN;
+  static constexpr ChatMessageType ChatMessageType_MAX =
+    ChatMessage_ChatMessageType_ChatMessageType_MAX;
+  static constexpr int ChatMessageType_ARRAYSIZE =
+    ChatMessage_ChatMessageType_ChatMessageType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ChatMessageType_descriptor() {
+    return ChatMessage_ChatMessageType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ChatMessageType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ChatMessageType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ChatMessageType_Name.");
+    return ChatMessage_ChatMessageType_Name(enum_t_value);
+  }
+  static inline bool ChatMessageType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ChatMessageType* value) {
+    return ChatMessage_ChatMessageType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kToFieldNumber = 1,
+    kFromFieldNumber = 2,
+    kDataFieldNumber = 4,
+    kTypeFieldNumber = 3,
+    kTimestampFieldNumber = 5,
+  };
+  // required string to = 1;
+  bool has_to() const;
+  private:
+  bool _internal_has_to() const;
+  public:
+  void clear_to();
+  const std::string& to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_to();
+  PROTOBUF_NODISCARD std::string* release_to();
+  void set_allocated_to(std::string* to);
+  private:
+  const std::string& _internal_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_to(const std::string& value);
+  std::string* _internal_mutable_to();
+  public:
+
+  // required string from = 2;
+  bool has_from() const;
+  private:
+  bool _internal_has_from() const;
+  public:
+  void clear_from();
+  const std::string& from() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_from(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_from();
+  PROTOBUF_NODISCARD std::string* release_from();
+  void set_allocated_from(std::string* from);
+  private:
+  const std::string& _internal_from() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from(const std::string& value);
+  std::string* _internal_mutable_from();
+  public:
+
+  // optional string data = 4;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // required .SyncDemo.ChatMessage.ChatMessageType type = 3 [default = CHAT];
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::SyncDemo::ChatMessage_ChatMessageType type() const;
+  void set_type(::SyncDemo::ChatMessage_ChatMessageType value);
+  private:
+  ::SyncDemo::ChatMessage_ChatMessageType _internal_type() const;
+  void _internal_set_type(::SyncDemo::ChatMessage_ChatMessageType value);
+  public:
+
+  // required int32 timestamp = 5;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  int32_t timestamp() const;
+  void set_timestamp(int32_t value);
+  private:
+  int32_t _internal_timestamp() const;
+  void _internal_set_timestamp(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncDemo.ChatMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr to_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int type_;
+    int32_t timestamp_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chatbuf_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ChatMessage
+
+// required string to = 1;
+inline bool ChatMessage::_internal_has_to() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChatMessage::has_to() const {
+  return _internal_has_to();
+}
+inline void ChatMessage::clear_to() {
+  _impl_.to_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChatMessage::to() const {
+  // @@protoc_insertion_point(field_get:SyncDemo.ChatMessage.to)
+  return _internal_to();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatMessage::set_to(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.to_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncDemo.ChatMessage.to)
+}
+inline std::string* ChatMessage::mutable_to() {
+  std::string* _s = _internal_mutable_to();
+  // @@protoc_insertion_point(field_mutable:SyncDemo.ChatMessage.to)
+  return _s;
+}
+inline const std::string& ChatMessage::_internal_to() const {
+  return _impl_.to_.Get();
+}
+inline void ChatMessage::_internal_set_to(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.to_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatMessage::_internal_mutable_to() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.to_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatMessage::release_to() {
+  // @@protoc_insertion_point(field_release:SyncDemo.ChatMessage.to)
+  if (!_internal_has_to()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.to_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.to_.IsDefault()) {
+    _impl_.to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChatMessage::set_allocated_to(std::string* to) {
+  if (to != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.to_.SetAllocated(to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.to_.IsDefault()) {
+    _impl_.to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncDemo.ChatMessage.to)
+}
+
+// required string from = 2;
+inline bool ChatMessage::_internal_has_from() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ChatMessage::has_from() const {
+  return _internal_has_from();
+}
+inline void ChatMessage::clear_from() {
+  _impl_.from_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ChatMessage::from() const {
+  // @@protoc_insertion_point(field_get:SyncDemo.ChatMessage.from)
+  return _internal_from();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatMessage::set_from(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.from_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncDemo.ChatMessage.from)
+}
+inline std::string* ChatMessage::mutable_from() {
+  std::string* _s = _internal_mutable_from();
+  // @@protoc_insertion_point(field_mutable:SyncDemo.ChatMessage.from)
+  return _s;
+}
+inline const std::string& ChatMessage::_internal_from() const {
+  return _impl_.from_.Get();
+}
+inline void ChatMessage::_internal_set_from(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.from_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatMessage::_internal_mutable_from() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.from_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatMessage::release_from() {
+  // @@protoc_insertion_point(field_release:SyncDemo.ChatMessage.from)
+  if (!_internal_has_from()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.from_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_.IsDefault()) {
+    _impl_.from_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChatMessage::set_allocated_from(std::string* from) {
+  if (from != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.from_.SetAllocated(from, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_.IsDefault()) {
+    _impl_.from_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncDemo.ChatMessage.from)
+}
+
+// required .SyncDemo.ChatMessage.ChatMessageType type = 3 [default = CHAT];
+inline bool ChatMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ChatMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void ChatMessage::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::SyncDemo::ChatMessage_ChatMessageType ChatMessage::_internal_type() const {
+  return static_cast< ::SyncDemo::ChatMessage_ChatMessageType >(_impl_.type_);
+}
+inline ::SyncDemo::ChatMessage_ChatMessageType ChatMessage::type() const {
+  // @@protoc_insertion_point(field_get:SyncDemo.ChatMessage.type)
+  return _internal_type();
+}
+inline void ChatMessage::_internal_set_type(::SyncDemo::ChatMessage_ChatMessageType value) {
+  assert(::SyncDemo::ChatMessage_ChatMessageType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.type_ = value;
+}
+inline void ChatMessage::set_type(::SyncDemo::ChatMessage_ChatMessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:SyncDemo.ChatMessage.type)
+}
+
+// optional string data = 4;
+inline bool ChatMessage::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ChatMessage::has_data() const {
+  return _internal_has_data();
+}
+inline void ChatMessage::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& ChatMessage::data() const {
+  // @@protoc_insertion_point(field_get:SyncDemo.ChatMessage.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatMessage::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.data_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncDemo.ChatMessage.data)
+}
+inline std::string* ChatMessage::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:SyncDemo.ChatMessage.data)
+  return _s;
+}
+inline const std::string& ChatMessage::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ChatMessage::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatMessage::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatMessage::release_data() {
+  // @@protoc_insertion_point(field_release:SyncDemo.ChatMessage.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChatMessage::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncDemo.ChatMessage.data)
+}
+
+// required int32 timestamp = 5;
+inline bool ChatMessage::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ChatMessage::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline void ChatMessage::clear_timestamp() {
+  _impl_.timestamp_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t ChatMessage::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int32_t ChatMessage::timestamp() const {
+  // @@protoc_insertion_point(field_get:SyncDemo.ChatMessage.timestamp)
+  return _internal_timestamp();
+}
+inline void ChatMessage::_internal_set_timestamp(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.timestamp_ = value;
+}
+inline void ChatMessage::set_timestamp(int32_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:SyncDemo.ChatMessage.timestamp)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace SyncDemo
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::SyncDemo::ChatMessage_ChatMessageType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::SyncDemo::ChatMessage_ChatMessageType>() {
+  return ::SyncDemo::ChatMessage_ChatMessageType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_chatbuf_2eproto
@@ -0,0 +1,2258 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: control-parameters.proto
+
+#include "control-parameters.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ndn_message {
+PROTOBUF_CONSTEXPR ControlParametersTypes_Name::ControlParametersTypes_Name(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.component_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ControlParametersTypes_NameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlParametersTypes_NameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlParametersTypes_NameDefaultTypeInternal() {}
+  union {
+    ControlParametersTypes_Name _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlParametersTypes_NameDefaultTypeInternal _ControlParametersTypes_Name_default_instance_;
+PROTOBUF_CONSTEXPR ControlParametersTypes_Strategy::ControlParametersTypes_Strategy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/nullptr} {}
+struct ControlParametersTypes_StrategyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlParametersTypes_StrategyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlParametersTypes_StrategyDefaultTypeInternal() {}
+  union {
+    ControlParametersTypes_Strategy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlParametersTypes_StrategyDefaultTypeInternal _ControlParametersTypes_Strategy_default_instance_;
+PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParameters::ControlParametersTypes_ControlParameters(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.local_uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/nullptr
+  , /*decltype(_impl_.strategy_)*/nullptr
+  , /*decltype(_impl_.face_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.cost_)*/uint64_t{0u}
+  , /*decltype(_impl_.flags_)*/uint64_t{0u}
+  , /*decltype(_impl_.expiration_period_)*/uint64_t{0u}
+  , /*decltype(_impl_.origin_)*/uint64_t{0u}
+  , /*decltype(_impl_.mask_)*/uint64_t{0u}
+  , /*decltype(_impl_.capacity_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.face_persistency_)*/uint64_t{0u}
+  , /*decltype(_impl_.base_congestion_marking_interval_)*/uint64_t{0u}
+  , /*decltype(_impl_.default_congestion_threshold_)*/uint64_t{0u}
+  , /*decltype(_impl_.mtu_)*/uint64_t{0u}} {}
+struct ControlParametersTypes_ControlParametersDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlParametersTypes_ControlParametersDefaultTypeInternal() {}
+  union {
+    ControlParametersTypes_ControlParameters _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlParametersTypes_ControlParametersDefaultTypeInternal _ControlParametersTypes_ControlParameters_default_instance_;
+PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersResponse::ControlParametersTypes_ControlParametersResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.control_parameters_)*/{}
+  , /*decltype(_impl_.status_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_code_)*/uint64_t{0u}} {}
+struct ControlParametersTypes_ControlParametersResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlParametersTypes_ControlParametersResponseDefaultTypeInternal() {}
+  union {
+    ControlParametersTypes_ControlParametersResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlParametersTypes_ControlParametersResponseDefaultTypeInternal _ControlParametersTypes_ControlParametersResponse_default_instance_;
+PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersMessage::ControlParametersTypes_ControlParametersMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.control_parameters_)*/nullptr} {}
+struct ControlParametersTypes_ControlParametersMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlParametersTypes_ControlParametersMessageDefaultTypeInternal() {}
+  union {
+    ControlParametersTypes_ControlParametersMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlParametersTypes_ControlParametersMessageDefaultTypeInternal _ControlParametersTypes_ControlParametersMessage_default_instance_;
+PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersResponseMessage::ControlParametersTypes_ControlParametersResponseMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.control_response_)*/nullptr} {}
+struct ControlParametersTypes_ControlParametersResponseMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersResponseMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlParametersTypes_ControlParametersResponseMessageDefaultTypeInternal() {}
+  union {
+    ControlParametersTypes_ControlParametersResponseMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlParametersTypes_ControlParametersResponseMessageDefaultTypeInternal _ControlParametersTypes_ControlParametersResponseMessage_default_instance_;
+PROTOBUF_CONSTEXPR ControlParametersTypes::ControlParametersTypes(
+    ::_pbi::ConstantInitialized) {}
+struct ControlParametersTypesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlParametersTypesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlParametersTypesDefaultTypeInternal() {}
+  union {
+    ControlParametersTypes _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlParametersTypesDefaultTypeInternal _ControlParametersTypes_default_instance_;
+}  // namespace ndn_message
+static ::_pb::Metadata file_level_metadata_control_2dparameters_2eproto[7];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_control_2dparameters_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_control_2dparameters_2eproto = nullptr;
+
+const uint32_t TableStruct_control_2dparameters_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_Name, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_Name, _impl_.component_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_Strategy, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_Strategy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_Strategy, _impl_.name_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.face_id_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.uri_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.local_uri_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.origin_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.cost_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.capacity_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.flags_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.mask_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.strategy_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.expiration_period_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.face_persistency_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.base_congestion_marking_interval_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.default_congestion_threshold_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParameters, _impl_.mtu_),
+  2,
+  4,
+  0,
+  1,
+  8,
+  5,
+  10,
+  11,
+  6,
+  9,
+  3,
+  7,
+  12,
+  13,
+  14,
+  15,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponse, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponse, _impl_.status_text_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponse, _impl_.control_parameters_),
+  1,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersMessage, _impl_.control_parameters_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponseMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponseMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes_ControlParametersResponseMessage, _impl_.control_response_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ControlParametersTypes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::ndn_message::ControlParametersTypes_Name)},
+  { 7, 14, -1, sizeof(::ndn_message::ControlParametersTypes_Strategy)},
+  { 15, 37, -1, sizeof(::ndn_message::ControlParametersTypes_ControlParameters)},
+  { 53, 62, -1, sizeof(::ndn_message::ControlParametersTypes_ControlParametersResponse)},
+  { 65, 72, -1, sizeof(::ndn_message::ControlParametersTypes_ControlParametersMessage)},
+  { 73, 80, -1, sizeof(::ndn_message::ControlParametersTypes_ControlParametersResponseMessage)},
+  { 81, -1, -1, sizeof(::ndn_message::ControlParametersTypes)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ndn_message::_ControlParametersTypes_Name_default_instance_._instance,
+  &::ndn_message::_ControlParametersTypes_Strategy_default_instance_._instance,
+  &::ndn_message::_ControlParametersTypes_ControlParameters_default_instance_._instance,
+  &::ndn_message::_ControlParametersTypes_ControlParametersResponse_default_instance_._instance,
+  &::ndn_message::_ControlParametersTypes_ControlParametersMessage_default_instance_._instance,
+  &::ndn_message::_ControlParametersTypes_ControlParametersResponseMessage_default_instance_._instance,
+  &::ndn_message::_ControlParametersTypes_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_control_2dparameters_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030control-parameters.proto\022\013ndn_message\""
+  "\262\007\n\026ControlParametersTypes\032\031\n\004Name\022\021\n\tco"
+  "mponent\030\010 \003(\014\032B\n\010Strategy\0226\n\004name\030\007 \002(\0132"
+  "(.ndn_message.ControlParametersTypes.Nam"
+  "e\032\261\003\n\021ControlParameters\0226\n\004name\030\007 \001(\0132(."
+  "ndn_message.ControlParametersTypes.Name\022"
+  "\017\n\007face_id\030i \001(\004\022\013\n\003uri\030r \001(\t\022\022\n\tlocal_u"
+  "ri\030\201\001 \001(\t\022\016\n\006origin\030o \001(\004\022\014\n\004cost\030j \001(\004\022"
+  "\021\n\010capacity\030\203\001 \001(\004\022\016\n\005count\030\204\001 \001(\004\022\r\n\005fl"
+  "ags\030l \001(\004\022\014\n\004mask\030p \001(\004\022>\n\010strategy\030k \001("
+  "\0132,.ndn_message.ControlParametersTypes.S"
+  "trategy\022\031\n\021expiration_period\030m \001(\004\022\031\n\020fa"
+  "ce_persistency\030\205\001 \001(\004\022)\n base_congestion"
+  "_marking_interval\030\207\001 \001(\004\022%\n\034default_cong"
+  "estion_threshold\030\210\001 \001(\004\022\014\n\003mtu\030\211\001 \001(\004\032\230\001"
+  "\n\031ControlParametersResponse\022\023\n\013status_co"
+  "de\030f \002(\004\022\023\n\013status_text\030g \002(\t\022Q\n\022control"
+  "_parameters\030h \003(\01325.ndn_message.ControlP"
+  "arametersTypes.ControlParameters\032m\n\030Cont"
+  "rolParametersMessage\022Q\n\022control_paramete"
+  "rs\030h \002(\01325.ndn_message.ControlParameters"
+  "Types.ControlParameters\032{\n ControlParame"
+  "tersResponseMessage\022W\n\020control_response\030"
+  "e \002(\0132=.ndn_message.ControlParametersTyp"
+  "es.ControlParametersResponse"
+  ;
+static ::_pbi::once_flag descriptor_table_control_2dparameters_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_control_2dparameters_2eproto = {
+    false, false, 988, descriptor_table_protodef_control_2dparameters_2eproto,
+    "control-parameters.proto",
+    &descriptor_table_control_2dparameters_2eproto_once, nullptr, 0, 7,
+    schemas, file_default_instances, TableStruct_control_2dparameters_2eproto::offsets,
+    file_level_metadata_control_2dparameters_2eproto, file_level_enum_descriptors_control_2dparameters_2eproto,
+    file_level_service_descriptors_control_2dparameters_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_control_2dparameters_2eproto_getter() {
+  return &descriptor_table_control_2dparameters_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_control_2dparameters_2eproto(&descriptor_table_control_2dparameters_2eproto);
+namespace ndn_message {
+
+// ===================================================================
+
+class ControlParametersTypes_Name::_Internal {
+ public:
+};
+
+ControlParametersTypes_Name::ControlParametersTypes_Name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ControlParametersTypes.Name)
+}
+ControlParametersTypes_Name::ControlParametersTypes_Name(const ControlParametersTypes_Name& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlParametersTypes_Name* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){from._impl_.component_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ControlParametersTypes.Name)
+}
+
+inline void ControlParametersTypes_Name::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ControlParametersTypes_Name::~ControlParametersTypes_Name() {
+  // @@protoc_insertion_point(destructor:ndn_message.ControlParametersTypes.Name)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControlParametersTypes_Name::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.component_.~RepeatedPtrField();
+}
+
+void ControlParametersTypes_Name::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControlParametersTypes_Name::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ControlParametersTypes.Name)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.component_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControlParametersTypes_Name::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes component = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_component();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControlParametersTypes_Name::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ControlParametersTypes.Name)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes component = 8;
+  for (int i = 0, n = this->_internal_component_size(); i < n; i++) {
+    const auto& s = this->_internal_component(i);
+    target = stream->WriteBytes(8, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ControlParametersTypes.Name)
+  return target;
+}
+
+size_t ControlParametersTypes_Name::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ControlParametersTypes.Name)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes component = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.component_.size());
+  for (int i = 0, n = _impl_.component_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.component_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlParametersTypes_Name::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlParametersTypes_Name::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlParametersTypes_Name::GetClassData() const { return &_class_data_; }
+
+
+void ControlParametersTypes_Name::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlParametersTypes_Name*>(&to_msg);
+  auto& from = static_cast<const ControlParametersTypes_Name&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ControlParametersTypes.Name)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.component_.MergeFrom(from._impl_.component_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControlParametersTypes_Name::CopyFrom(const ControlParametersTypes_Name& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ControlParametersTypes.Name)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControlParametersTypes_Name::IsInitialized() const {
+  return true;
+}
+
+void ControlParametersTypes_Name::InternalSwap(ControlParametersTypes_Name* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.component_.InternalSwap(&other->_impl_.component_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlParametersTypes_Name::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_control_2dparameters_2eproto_getter, &descriptor_table_control_2dparameters_2eproto_once,
+      file_level_metadata_control_2dparameters_2eproto[0]);
+}
+
+// ===================================================================
+
+class ControlParametersTypes_Strategy::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ControlParametersTypes_Strategy>()._impl_._has_bits_);
+  static const ::ndn_message::ControlParametersTypes_Name& name(const ControlParametersTypes_Strategy* msg);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::ndn_message::ControlParametersTypes_Name&
+ControlParametersTypes_Strategy::_Internal::name(const ControlParametersTypes_Strategy* msg) {
+  return *msg->_impl_.name_;
+}
+ControlParametersTypes_Strategy::ControlParametersTypes_Strategy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ControlParametersTypes.Strategy)
+}
+ControlParametersTypes_Strategy::ControlParametersTypes_Strategy(const ControlParametersTypes_Strategy& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlParametersTypes_Strategy* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_name()) {
+    _this->_impl_.name_ = new ::ndn_message::ControlParametersTypes_Name(*from._impl_.name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ControlParametersTypes.Strategy)
+}
+
+inline void ControlParametersTypes_Strategy::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){nullptr}
+  };
+}
+
+ControlParametersTypes_Strategy::~ControlParametersTypes_Strategy() {
+  // @@protoc_insertion_point(destructor:ndn_message.ControlParametersTypes.Strategy)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControlParametersTypes_Strategy::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.name_;
+}
+
+void ControlParametersTypes_Strategy::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControlParametersTypes_Strategy::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ControlParametersTypes.Strategy)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.name_ != nullptr);
+    _impl_.name_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControlParametersTypes_Strategy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ndn_message.ControlParametersTypes.Name name = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControlParametersTypes_Strategy::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ControlParametersTypes.Strategy)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ndn_message.ControlParametersTypes.Name name = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::name(this),
+        _Internal::name(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ControlParametersTypes.Strategy)
+  return target;
+}
+
+size_t ControlParametersTypes_Strategy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ControlParametersTypes.Strategy)
+  size_t total_size = 0;
+
+  // required .ndn_message.ControlParametersTypes.Name name = 7;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.name_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlParametersTypes_Strategy::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlParametersTypes_Strategy::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlParametersTypes_Strategy::GetClassData() const { return &_class_data_; }
+
+
+void ControlParametersTypes_Strategy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlParametersTypes_Strategy*>(&to_msg);
+  auto& from = static_cast<const ControlParametersTypes_Strategy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ControlParametersTypes.Strategy)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_name()) {
+    _this->_internal_mutable_name()->::ndn_message::ControlParametersTypes_Name::MergeFrom(
+        from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControlParametersTypes_Strategy::CopyFrom(const ControlParametersTypes_Strategy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ControlParametersTypes.Strategy)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControlParametersTypes_Strategy::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ControlParametersTypes_Strategy::InternalSwap(ControlParametersTypes_Strategy* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.name_, other->_impl_.name_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlParametersTypes_Strategy::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_control_2dparameters_2eproto_getter, &descriptor_table_control_2dparameters_2eproto_once,
+      file_level_metadata_control_2dparameters_2eproto[1]);
+}
+
+// ===================================================================
+
+class ControlParametersTypes_ControlParameters::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ControlParametersTypes_ControlParameters>()._impl_._has_bits_);
+  static const ::ndn_message::ControlParametersTypes_Name& name(const ControlParametersTypes_ControlParameters* msg);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_face_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_uri(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_local_uri(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_origin(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_cost(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_capacity(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_mask(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::ndn_message::ControlParametersTypes_Strategy& strategy(const ControlParametersTypes_ControlParameters* msg);
+  static void set_has_strategy(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_expiration_period(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_face_persistency(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_base_congestion_marking_interval(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_default_congestion_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_mtu(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+};
+
+const ::ndn_message::ControlParametersTypes_Name&
+ControlParametersTypes_ControlParameters::_Internal::name(const ControlParametersTypes_ControlParameters* msg) {
+  return *msg->_impl_.name_;
+}
+const ::ndn_message::ControlParametersTypes_Strategy&
+ControlParametersTypes_ControlParameters::_Internal::strategy(const ControlParametersTypes_ControlParameters* msg) {
+  return *msg->_impl_.strategy_;
+}
+ControlParametersTypes_ControlParameters::ControlParametersTypes_ControlParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ControlParametersTypes.ControlParameters)
+}
+ControlParametersTypes_ControlParameters::ControlParametersTypes_ControlParameters(const ControlParametersTypes_ControlParameters& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlParametersTypes_ControlParameters* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uri_){}
+    , decltype(_impl_.local_uri_){}
+    , decltype(_impl_.name_){nullptr}
+    , decltype(_impl_.strategy_){nullptr}
+    , decltype(_impl_.face_id_){}
+    , decltype(_impl_.cost_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.expiration_period_){}
+    , decltype(_impl_.origin_){}
+    , decltype(_impl_.mask_){}
+    , decltype(_impl_.capacity_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.face_persistency_){}
+    , decltype(_impl_.base_congestion_marking_interval_){}
+    , decltype(_impl_.default_congestion_threshold_){}
+    , decltype(_impl_.mtu_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uri()) {
+    _this->_impl_.uri_.Set(from._internal_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_local_uri()) {
+    _this->_impl_.local_uri_.Set(from._internal_local_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_name()) {
+    _this->_impl_.name_ = new ::ndn_message::ControlParametersTypes_Name(*from._impl_.name_);
+  }
+  if (from._internal_has_strategy()) {
+    _this->_impl_.strategy_ = new ::ndn_message::ControlParametersTypes_Strategy(*from._impl_.strategy_);
+  }
+  ::memcpy(&_impl_.face_id_, &from._impl_.face_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.mtu_) -
+    reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.mtu_));
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ControlParametersTypes.ControlParameters)
+}
+
+inline void ControlParametersTypes_ControlParameters::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uri_){}
+    , decltype(_impl_.local_uri_){}
+    , decltype(_impl_.name_){nullptr}
+    , decltype(_impl_.strategy_){nullptr}
+    , decltype(_impl_.face_id_){uint64_t{0u}}
+    , decltype(_impl_.cost_){uint64_t{0u}}
+    , decltype(_impl_.flags_){uint64_t{0u}}
+    , decltype(_impl_.expiration_period_){uint64_t{0u}}
+    , decltype(_impl_.origin_){uint64_t{0u}}
+    , decltype(_impl_.mask_){uint64_t{0u}}
+    , decltype(_impl_.capacity_){uint64_t{0u}}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.face_persistency_){uint64_t{0u}}
+    , decltype(_impl_.base_congestion_marking_interval_){uint64_t{0u}}
+    , decltype(_impl_.default_congestion_threshold_){uint64_t{0u}}
+    , decltype(_impl_.mtu_){uint64_t{0u}}
+  };
+  _impl_.uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ControlParametersTypes_ControlParameters::~ControlParametersTypes_ControlParameters() {
+  // @@protoc_insertion_point(destructor:ndn_message.ControlParametersTypes.ControlParameters)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControlParametersTypes_ControlParameters::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uri_.Destroy();
+  _impl_.local_uri_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.name_;
+  if (this != internal_default_instance()) delete _impl_.strategy_;
+}
+
+void ControlParametersTypes_ControlParameters::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControlParametersTypes_ControlParameters::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ControlParametersTypes.ControlParameters)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.uri_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.local_uri_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.name_ != nullptr);
+      _impl_.name_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.strategy_ != nullptr);
+      _impl_.strategy_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.face_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.expiration_period_) -
+        reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.expiration_period_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.origin_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.mtu_) -
+        reinterpret_cast<char*>(&_impl_.origin_)) + sizeof(_impl_.mtu_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControlParametersTypes_ControlParameters::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .ndn_message.ControlParametersTypes.Name name = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 face_id = 105;
+      case 105:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_face_id(&has_bits);
+          _impl_.face_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 cost = 106;
+      case 106:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_cost(&has_bits);
+          _impl_.cost_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ndn_message.ControlParametersTypes.Strategy strategy = 107;
+      case 107:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_strategy(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 flags = 108;
+      case 108:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 expiration_period = 109;
+      case 109:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_expiration_period(&has_bits);
+          _impl_.expiration_period_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 origin = 111;
+      case 111:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_origin(&has_bits);
+          _impl_.origin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 mask = 112;
+      case 112:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_mask(&has_bits);
+          _impl_.mask_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string uri = 114;
+      case 114:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.ControlParametersTypes.ControlParameters.uri");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string local_uri = 129;
+      case 129:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_local_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.ControlParametersTypes.ControlParameters.local_uri");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 capacity = 131;
+      case 131:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_capacity(&has_bits);
+          _impl_.capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 count = 132;
+      case 132:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 face_persistency = 133;
+      case 133:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_face_persistency(&has_bits);
+          _impl_.face_persistency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 base_congestion_marking_interval = 135;
+      case 135:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_base_congestion_marking_interval(&has_bits);
+          _impl_.base_congestion_marking_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 default_congestion_threshold = 136;
+      case 136:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_default_congestion_threshold(&has_bits);
+          _impl_.default_congestion_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 mtu = 137;
+      case 137:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_mtu(&has_bits);
+          _impl_.mtu_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControlParametersTypes_ControlParameters::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ControlParametersTypes.ControlParameters)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .ndn_message.ControlParametersTypes.Name name = 7;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::name(this),
+        _Internal::name(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 face_id = 105;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(105, this->_internal_face_id(), target);
+  }
+
+  // optional uint64 cost = 106;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(106, this->_internal_cost(), target);
+  }
+
+  // optional .ndn_message.ControlParametersTypes.Strategy strategy = 107;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(107, _Internal::strategy(this),
+        _Internal::strategy(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 flags = 108;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(108, this->_internal_flags(), target);
+  }
+
+  // optional uint64 expiration_period = 109;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(109, this->_internal_expiration_period(), target);
+  }
+
+  // optional uint64 origin = 111;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(111, this->_internal_origin(), target);
+  }
+
+  // optional uint64 mask = 112;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(112, this->_internal_mask(), target);
+  }
+
+  // optional string uri = 114;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_uri().data(), static_cast<int>(this->_internal_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.ControlParametersTypes.ControlParameters.uri");
+    target = stream->WriteStringMaybeAliased(
+        114, this->_internal_uri(), target);
+  }
+
+  // optional string local_uri = 129;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_local_uri().data(), static_cast<int>(this->_internal_local_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.ControlParametersTypes.ControlParameters.local_uri");
+    target = stream->WriteStringMaybeAliased(
+        129, this->_internal_local_uri(), target);
+  }
+
+  // optional uint64 capacity = 131;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(131, this->_internal_capacity(), target);
+  }
+
+  // optional uint64 count = 132;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(132, this->_internal_count(), target);
+  }
+
+  // optional uint64 face_persistency = 133;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(133, this->_internal_face_persistency(), target);
+  }
+
+  // optional uint64 base_congestion_marking_interval = 135;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(135, this->_internal_base_congestion_marking_interval(), target);
+  }
+
+  // optional uint64 default_congestion_threshold = 136;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(136, this->_internal_default_congestion_threshold(), target);
+  }
+
+  // optional uint64 mtu = 137;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(137, this->_internal_mtu(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ControlParametersTypes.ControlParameters)
+  return target;
+}
+
+size_t ControlParametersTypes_ControlParameters::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ControlParametersTypes.ControlParameters)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string uri = 114;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_uri());
+    }
+
+    // optional string local_uri = 129;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_local_uri());
+    }
+
+    // optional .ndn_message.ControlParametersTypes.Name name = 7;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.name_);
+    }
+
+    // optional .ndn_message.ControlParametersTypes.Strategy strategy = 107;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.strategy_);
+    }
+
+    // optional uint64 face_id = 105;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_face_id());
+    }
+
+    // optional uint64 cost = 106;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_cost());
+    }
+
+    // optional uint64 flags = 108;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_flags());
+    }
+
+    // optional uint64 expiration_period = 109;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_expiration_period());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional uint64 origin = 111;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_origin());
+    }
+
+    // optional uint64 mask = 112;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_mask());
+    }
+
+    // optional uint64 capacity = 131;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_capacity());
+    }
+
+    // optional uint64 count = 132;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_count());
+    }
+
+    // optional uint64 face_persistency = 133;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_face_persistency());
+    }
+
+    // optional uint64 base_congestion_marking_interval = 135;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_base_congestion_marking_interval());
+    }
+
+    // optional uint64 default_congestion_threshold = 136;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_default_congestion_threshold());
+    }
+
+    // optional uint64 mtu = 137;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_mtu());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlParametersTypes_ControlParameters::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlParametersTypes_ControlParameters::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlParametersTypes_ControlParameters::GetClassData() const { return &_class_data_; }
+
+
+void ControlParametersTypes_ControlParameters::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlParametersTypes_ControlParameters*>(&to_msg);
+  auto& from = static_cast<const ControlParametersTypes_ControlParameters&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ControlParametersTypes.ControlParameters)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_uri(from._internal_uri());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_local_uri(from._internal_local_uri());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_name()->::ndn_message::ControlParametersTypes_Name::MergeFrom(
+          from._internal_name());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_strategy()->::ndn_message::ControlParametersTypes_Strategy::MergeFrom(
+          from._internal_strategy());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.face_id_ = from._impl_.face_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cost_ = from._impl_.cost_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.expiration_period_ = from._impl_.expiration_period_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.origin_ = from._impl_.origin_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.mask_ = from._impl_.mask_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.capacity_ = from._impl_.capacity_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.face_persistency_ = from._impl_.face_persistency_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.base_congestion_marking_interval_ = from._impl_.base_congestion_marking_interval_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.default_congestion_threshold_ = from._impl_.default_congestion_threshold_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.mtu_ = from._impl_.mtu_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControlParametersTypes_ControlParameters::CopyFrom(const ControlParametersTypes_ControlParameters& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ControlParametersTypes.ControlParameters)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControlParametersTypes_ControlParameters::IsInitialized() const {
+  if (_internal_has_strategy()) {
+    if (!_impl_.strategy_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ControlParametersTypes_ControlParameters::InternalSwap(ControlParametersTypes_ControlParameters* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uri_, lhs_arena,
+      &other->_impl_.uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.local_uri_, lhs_arena,
+      &other->_impl_.local_uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ControlParametersTypes_ControlParameters, _impl_.mtu_)
+      + sizeof(ControlParametersTypes_ControlParameters::_impl_.mtu_)
+      - PROTOBUF_FIELD_OFFSET(ControlParametersTypes_ControlParameters, _impl_.name_)>(
+          reinterpret_cast<char*>(&_impl_.name_),
+          reinterpret_cast<char*>(&other->_impl_.name_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlParametersTypes_ControlParameters::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_control_2dparameters_2eproto_getter, &descriptor_table_control_2dparameters_2eproto_once,
+      file_level_metadata_control_2dparameters_2eproto[2]);
+}
+
+// ===================================================================
+
+class ControlParametersTypes_ControlParametersResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ControlParametersTypes_ControlParametersResponse>()._impl_._has_bits_);
+  static void set_has_status_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_status_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ControlParametersTypes_ControlParametersResponse::ControlParametersTypes_ControlParametersResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ControlParametersTypes.ControlParametersResponse)
+}
+ControlParametersTypes_ControlParametersResponse::ControlParametersTypes_ControlParametersResponse(const ControlParametersTypes_ControlParametersResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlParametersTypes_ControlParametersResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_parameters_){from._impl_.control_parameters_}
+    , decltype(_impl_.status_text_){}
+    , decltype(_impl_.status_code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.status_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_status_text()) {
+    _this->_impl_.status_text_.Set(from._internal_status_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_code_ = from._impl_.status_code_;
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ControlParametersTypes.ControlParametersResponse)
+}
+
+inline void ControlParametersTypes_ControlParametersResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_parameters_){arena}
+    , decltype(_impl_.status_text_){}
+    , decltype(_impl_.status_code_){uint64_t{0u}}
+  };
+  _impl_.status_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ControlParametersTypes_ControlParametersResponse::~ControlParametersTypes_ControlParametersResponse() {
+  // @@protoc_insertion_point(destructor:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControlParametersTypes_ControlParametersResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.control_parameters_.~RepeatedPtrField();
+  _impl_.status_text_.Destroy();
+}
+
+void ControlParametersTypes_ControlParametersResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControlParametersTypes_ControlParametersResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.control_parameters_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.status_text_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_code_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControlParametersTypes_ControlParametersResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 status_code = 102;
+      case 102:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_status_code(&has_bits);
+          _impl_.status_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string status_text = 103;
+      case 103:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_status_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.ControlParametersTypes.ControlParametersResponse.status_text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+      case 104:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_control_parameters(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<834>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControlParametersTypes_ControlParametersResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 status_code = 102;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(102, this->_internal_status_code(), target);
+  }
+
+  // required string status_text = 103;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_status_text().data(), static_cast<int>(this->_internal_status_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.ControlParametersTypes.ControlParametersResponse.status_text");
+    target = stream->WriteStringMaybeAliased(
+        103, this->_internal_status_text(), target);
+  }
+
+  // repeated .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_control_parameters_size()); i < n; i++) {
+    const auto& repfield = this->_internal_control_parameters(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(104, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  return target;
+}
+
+size_t ControlParametersTypes_ControlParametersResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  size_t total_size = 0;
+
+  if (_internal_has_status_text()) {
+    // required string status_text = 103;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status_text());
+  }
+
+  if (_internal_has_status_code()) {
+    // required uint64 status_code = 102;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_status_code());
+  }
+
+  return total_size;
+}
+size_t ControlParametersTypes_ControlParametersResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string status_text = 103;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status_text());
+
+    // required uint64 status_code = 102;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_status_code());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+  total_size += 2UL * this->_internal_control_parameters_size();
+  for (const auto& msg : this->_impl_.control_parameters_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlParametersTypes_ControlParametersResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlParametersTypes_ControlParametersResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlParametersTypes_ControlParametersResponse::GetClassData() const { return &_class_data_; }
+
+
+void ControlParametersTypes_ControlParametersResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlParametersTypes_ControlParametersResponse*>(&to_msg);
+  auto& from = static_cast<const ControlParametersTypes_ControlParametersResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.control_parameters_.MergeFrom(from._impl_.control_parameters_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_status_text(from._internal_status_text());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.status_code_ = from._impl_.status_code_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControlParametersTypes_ControlParametersResponse::CopyFrom(const ControlParametersTypes_ControlParametersResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ControlParametersTypes.ControlParametersResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControlParametersTypes_ControlParametersResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.control_parameters_))
+    return false;
+  return true;
+}
+
+void ControlParametersTypes_ControlParametersResponse::InternalSwap(ControlParametersTypes_ControlParametersResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.control_parameters_.InternalSwap(&other->_impl_.control_parameters_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_text_, lhs_arena,
+      &other->_impl_.status_text_, rhs_arena
+  );
+  swap(_impl_.status_code_, other->_impl_.status_code_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlParametersTypes_ControlParametersResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_control_2dparameters_2eproto_getter, &descriptor_table_control_2dparameters_2eproto_once,
+      file_level_metadata_control_2dparameters_2eproto[3]);
+}
+
+// ===================================================================
+
+class ControlParametersTypes_ControlParametersMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ControlParametersTypes_ControlParametersMessage>()._impl_._has_bits_);
+  static const ::ndn_message::ControlParametersTypes_ControlParameters& control_parameters(const ControlParametersTypes_ControlParametersMessage* msg);
+  static void set_has_control_parameters(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::ndn_message::ControlParametersTypes_ControlParameters&
+ControlParametersTypes_ControlParametersMessage::_Internal::control_parameters(const ControlParametersTypes_ControlParametersMessage* msg) {
+  return *msg->_impl_.control_parameters_;
+}
+ControlParametersTypes_ControlParametersMessage::ControlParametersTypes_ControlParametersMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ControlParametersTypes.ControlParametersMessage)
+}
+ControlParametersTypes_ControlParametersMessage::ControlParametersTypes_ControlParametersMessage(const ControlParametersTypes_ControlParametersMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlParametersTypes_ControlParametersMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_parameters_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_control_parameters()) {
+    _this->_impl_.control_parameters_ = new ::ndn_message::ControlParametersTypes_ControlParameters(*from._impl_.control_parameters_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ControlParametersTypes.ControlParametersMessage)
+}
+
+inline void ControlParametersTypes_ControlParametersMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_parameters_){nullptr}
+  };
+}
+
+ControlParametersTypes_ControlParametersMessage::~ControlParametersTypes_ControlParametersMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.ControlParametersTypes.ControlParametersMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControlParametersTypes_ControlParametersMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.control_parameters_;
+}
+
+void ControlParametersTypes_ControlParametersMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControlParametersTypes_ControlParametersMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ControlParametersTypes.ControlParametersMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.control_parameters_ != nullptr);
+    _impl_.control_parameters_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControlParametersTypes_ControlParametersMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+      case 104:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_control_parameters(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControlParametersTypes_ControlParametersMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ControlParametersTypes.ControlParametersMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(104, _Internal::control_parameters(this),
+        _Internal::control_parameters(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ControlParametersTypes.ControlParametersMessage)
+  return target;
+}
+
+size_t ControlParametersTypes_ControlParametersMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ControlParametersTypes.ControlParametersMessage)
+  size_t total_size = 0;
+
+  // required .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+  if (_internal_has_control_parameters()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.control_parameters_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlParametersTypes_ControlParametersMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlParametersTypes_ControlParametersMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlParametersTypes_ControlParametersMessage::GetClassData() const { return &_class_data_; }
+
+
+void ControlParametersTypes_ControlParametersMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlParametersTypes_ControlParametersMessage*>(&to_msg);
+  auto& from = static_cast<const ControlParametersTypes_ControlParametersMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ControlParametersTypes.ControlParametersMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_control_parameters()) {
+    _this->_internal_mutable_control_parameters()->::ndn_message::ControlParametersTypes_ControlParameters::MergeFrom(
+        from._internal_control_parameters());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControlParametersTypes_ControlParametersMessage::CopyFrom(const ControlParametersTypes_ControlParametersMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ControlParametersTypes.ControlParametersMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControlParametersTypes_ControlParametersMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_control_parameters()) {
+    if (!_impl_.control_parameters_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ControlParametersTypes_ControlParametersMessage::InternalSwap(ControlParametersTypes_ControlParametersMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.control_parameters_, other->_impl_.control_parameters_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlParametersTypes_ControlParametersMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_control_2dparameters_2eproto_getter, &descriptor_table_control_2dparameters_2eproto_once,
+      file_level_metadata_control_2dparameters_2eproto[4]);
+}
+
+// ===================================================================
+
+class ControlParametersTypes_ControlParametersResponseMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ControlParametersTypes_ControlParametersResponseMessage>()._impl_._has_bits_);
+  static const ::ndn_message::ControlParametersTypes_ControlParametersResponse& control_response(const ControlParametersTypes_ControlParametersResponseMessage* msg);
+  static void set_has_control_response(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::ndn_message::ControlParametersTypes_ControlParametersResponse&
+ControlParametersTypes_ControlParametersResponseMessage::_Internal::control_response(const ControlParametersTypes_ControlParametersResponseMessage* msg) {
+  return *msg->_impl_.control_response_;
+}
+ControlParametersTypes_ControlParametersResponseMessage::ControlParametersTypes_ControlParametersResponseMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+}
+ControlParametersTypes_ControlParametersResponseMessage::ControlParametersTypes_ControlParametersResponseMessage(const ControlParametersTypes_ControlParametersResponseMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlParametersTypes_ControlParametersResponseMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_response_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_control_response()) {
+    _this->_impl_.control_response_ = new ::ndn_message::ControlParametersTypes_ControlParametersResponse(*from._impl_.control_response_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+}
+
+inline void ControlParametersTypes_ControlParametersResponseMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_response_){nullptr}
+  };
+}
+
+ControlParametersTypes_ControlParametersResponseMessage::~ControlParametersTypes_ControlParametersResponseMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControlParametersTypes_ControlParametersResponseMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.control_response_;
+}
+
+void ControlParametersTypes_ControlParametersResponseMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControlParametersTypes_ControlParametersResponseMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.control_response_ != nullptr);
+    _impl_.control_response_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControlParametersTypes_ControlParametersResponseMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ndn_message.ControlParametersTypes.ControlParametersResponse control_response = 101;
+      case 101:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_control_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControlParametersTypes_ControlParametersResponseMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ndn_message.ControlParametersTypes.ControlParametersResponse control_response = 101;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(101, _Internal::control_response(this),
+        _Internal::control_response(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+  return target;
+}
+
+size_t ControlParametersTypes_ControlParametersResponseMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+  size_t total_size = 0;
+
+  // required .ndn_message.ControlParametersTypes.ControlParametersResponse control_response = 101;
+  if (_internal_has_control_response()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.control_response_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlParametersTypes_ControlParametersResponseMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlParametersTypes_ControlParametersResponseMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlParametersTypes_ControlParametersResponseMessage::GetClassData() const { return &_class_data_; }
+
+
+void ControlParametersTypes_ControlParametersResponseMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlParametersTypes_ControlParametersResponseMessage*>(&to_msg);
+  auto& from = static_cast<const ControlParametersTypes_ControlParametersResponseMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_control_response()) {
+    _this->_internal_mutable_control_response()->::ndn_message::ControlParametersTypes_ControlParametersResponse::MergeFrom(
+        from._internal_control_response());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControlParametersTypes_ControlParametersResponseMessage::CopyFrom(const ControlParametersTypes_ControlParametersResponseMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControlParametersTypes_ControlParametersResponseMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_control_response()) {
+    if (!_impl_.control_response_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ControlParametersTypes_ControlParametersResponseMessage::InternalSwap(ControlParametersTypes_ControlParametersResponseMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.control_response_, other->_impl_.control_response_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlParametersTypes_ControlParametersResponseMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_control_2dparameters_2eproto_getter, &descriptor_table_control_2dparameters_2eproto_once,
+      file_level_metadata_control_2dparameters_2eproto[5]);
+}
+
+// ===================================================================
+
+class ControlParametersTypes::_Internal {
+ public:
+};
+
+ControlParametersTypes::ControlParametersTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ControlParametersTypes)
+}
+ControlParametersTypes::ControlParametersTypes(const ControlParametersTypes& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  ControlParametersTypes* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ControlParametersTypes)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlParametersTypes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlParametersTypes::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlParametersTypes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_control_2dparameters_2eproto_getter, &descriptor_table_control_2dparameters_2eproto_once,
+      file_level_metadata_control_2dparameters_2eproto[6]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ndn_message::ControlParametersTypes_Name*
+Arena::CreateMaybeMessage< ::ndn_message::ControlParametersTypes_Name >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ControlParametersTypes_Name >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ControlParametersTypes_Strategy*
+Arena::CreateMaybeMessage< ::ndn_message::ControlParametersTypes_Strategy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ControlParametersTypes_Strategy >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ControlParametersTypes_ControlParameters*
+Arena::CreateMaybeMessage< ::ndn_message::ControlParametersTypes_ControlParameters >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ControlParametersTypes_ControlParameters >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ControlParametersTypes_ControlParametersResponse*
+Arena::CreateMaybeMessage< ::ndn_message::ControlParametersTypes_ControlParametersResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ControlParametersTypes_ControlParametersResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ControlParametersTypes_ControlParametersMessage*
+Arena::CreateMaybeMessage< ::ndn_message::ControlParametersTypes_ControlParametersMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ControlParametersTypes_ControlParametersMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ControlParametersTypes_ControlParametersResponseMessage*
+Arena::CreateMaybeMessage< ::ndn_message::ControlParametersTypes_ControlParametersResponseMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ControlParametersTypes_ControlParametersResponseMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ControlParametersTypes*
+Arena::CreateMaybeMessage< ::ndn_message::ControlParametersTypes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ControlParametersTypes >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
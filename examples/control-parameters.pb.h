@@ -0,0 +1,2678 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: control-parameters.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_control_2dparameters_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_control_2dparameters_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_control_2dparameters_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_control_2dparameters_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_control_2dparameters_2eproto;
+namespace ndn_message {
+class ControlParametersTypes;
+struct ControlParametersTypesDefaultTypeInternal;
+extern ControlParametersTypesDefaultTypeInternal _ControlParametersTypes_default_instance_;
+class ControlParametersTypes_ControlParameters;
+struct ControlParametersTypes_ControlParametersDefaultTypeInternal;
+extern ControlParametersTypes_ControlParametersDefaultTypeInternal _ControlParametersTypes_ControlParameters_default_instance_;
+class ControlParametersTypes_ControlParametersMessage;
+struct ControlParametersTypes_ControlParametersMessageDefaultTypeInternal;
+extern ControlParametersTypes_ControlParametersMessageDefaultTypeInternal _ControlParametersTypes_ControlParametersMessage_default_instance_;
+class ControlParametersTypes_ControlParametersResponse;
+struct ControlParametersTypes_ControlParametersResponseDefaultTypeInternal;
+extern ControlParametersTypes_ControlParametersResponseDefaultTypeInternal _ControlParametersTypes_ControlParametersResponse_default_instance_;
+class ControlParametersTypes_ControlParametersResponseMessage;
+struct ControlParametersTypes_ControlParametersResponseMessageDefaultTypeInternal;
+extern ControlParametersTypes_ControlParametersResponseMessageDefaultTypeInternal _ControlParametersTypes_ControlParametersResponseMessage_default_instance_;
+class ControlParametersTypes_Name;
+struct ControlParametersTypes_NameDefaultTypeInternal;
+extern ControlParametersTypes_NameDefaultTypeInternal _ControlParametersTypes_Name_default_instance_;
+class ControlParametersTypes_Strategy;
+struct ControlParametersTypes_StrategyDefaultTypeInternal;
+extern ControlParametersTypes_StrategyDefaultTypeInternal _ControlParametersTypes_Strategy_default_instance_;
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ndn_message::ControlParametersTypes* Arena::CreateMaybeMessage<::ndn_message::ControlParametersTypes>(Arena*);
+template<> ::ndn_message::ControlParametersTypes_ControlParameters* Arena::CreateMaybeMessage<::ndn_message::ControlParametersTypes_ControlParameters>(Arena*);
+template<> ::ndn_message::ControlParametersTypes_ControlParametersMessage* Arena::CreateMaybeMessage<::ndn_message::ControlParametersTypes_ControlParametersMessage>(Arena*);
+template<> ::ndn_message::ControlParametersTypes_ControlParametersResponse* Arena::CreateMaybeMessage<::ndn_message::ControlParametersTypes_ControlParametersResponse>(Arena*);
+template<> ::ndn_message::ControlParametersTypes_ControlParametersResponseMessage* Arena::CreateMaybeMessage<::ndn_message::ControlParametersTypes_ControlParametersResponseMessage>(Arena*);
+template<> ::ndn_message::ControlParametersTypes_Name* Arena::CreateMaybeMessage<::ndn_message::ControlParametersTypes_Name>(Arena*);
+template<> ::ndn_message::ControlParametersTypes_Strategy* Arena::CreateMaybeMessage<::ndn_message::ControlParametersTypes_Strategy>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ndn_message {
+
+// ===================================================================
+
+class ControlParametersTypes_Name final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ControlParametersTypes.Name) */ {
+ public:
+  inline ControlParametersTypes_Name() : ControlParametersTypes_Name(nullptr) {}
+  ~ControlParametersTypes_Name() override;
+  explicit PROTOBUF_CONSTEXPR ControlParametersTypes_Name(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlParametersTypes_Name(const ControlParametersTypes_Name& from);
+  ControlParametersTypes_Name(ControlParametersTypes_Name&& from) noexcept
+    : ControlParametersTypes_Name() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlParametersTypes_Name& operator=(const ControlParametersTypes_Name& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlParametersTypes_Name& operator=(ControlParametersTypes_Name&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlParametersTypes_Name& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlParametersTypes_Name* internal_default_instance() {
+    return reinterpret_cast<const ControlParametersTypes_Name*>(
+               &_ControlParametersTypes_Name_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ControlParametersTypes_Name& a, ControlParametersTypes_Name& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlParametersTypes_Name* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlParametersTypes_Name* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlParametersTypes_Name* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlParametersTypes_Name>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlParametersTypes_Name& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlParametersTypes_Name& from) {
+    ControlParametersTypes_Name::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControlParametersTypes_Name* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ControlParametersTypes.Name";
+  }
+  protected:
+  explicit ControlParametersTypes_Name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComponentFieldNumber = 8,
+  };
+  // repeated bytes component = 8;
+  int component_size() const;
+  private:
+  int _internal_component_size() const;
+  public:
+  void clear_component();
+  const std::string& component(int index) const;
+  std::string* mutable_component(int index);
+  void set_component(int index, const std::string& value);
+  void set_component(int index, std::string&& value);
+  void set_component(int index, const char* value);
+  void set_component(int index, const void* value, size_t size);
+  std::string* add_component();
+  void add_component(const std::string& value);
+  void add_component(std::string&& value);
+  void add_component(const char* value);
+  void add_component(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& component() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_component();
+  private:
+  const std::string& _internal_component(int index) const;
+  std::string* _internal_add_component();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ControlParametersTypes.Name)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> component_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_control_2dparameters_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControlParametersTypes_Strategy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ControlParametersTypes.Strategy) */ {
+ public:
+  inline ControlParametersTypes_Strategy() : ControlParametersTypes_Strategy(nullptr) {}
+  ~ControlParametersTypes_Strategy() override;
+  explicit PROTOBUF_CONSTEXPR ControlParametersTypes_Strategy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlParametersTypes_Strategy(const ControlParametersTypes_Strategy& from);
+  ControlParametersTypes_Strategy(ControlParametersTypes_Strategy&& from) noexcept
+    : ControlParametersTypes_Strategy() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlParametersTypes_Strategy& operator=(const ControlParametersTypes_Strategy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlParametersTypes_Strategy& operator=(ControlParametersTypes_Strategy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlParametersTypes_Strategy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlParametersTypes_Strategy* internal_default_instance() {
+    return reinterpret_cast<const ControlParametersTypes_Strategy*>(
+               &_ControlParametersTypes_Strategy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ControlParametersTypes_Strategy& a, ControlParametersTypes_Strategy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlParametersTypes_Strategy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlParametersTypes_Strategy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlParametersTypes_Strategy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlParametersTypes_Strategy>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlParametersTypes_Strategy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlParametersTypes_Strategy& from) {
+    ControlParametersTypes_Strategy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControlParametersTypes_Strategy* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ControlParametersTypes.Strategy";
+  }
+  protected:
+  explicit ControlParametersTypes_Strategy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 7,
+  };
+  // required .ndn_message.ControlParametersTypes.Name name = 7;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const ::ndn_message::ControlParametersTypes_Name& name() const;
+  PROTOBUF_NODISCARD ::ndn_message::ControlParametersTypes_Name* release_name();
+  ::ndn_message::ControlParametersTypes_Name* mutable_name();
+  void set_allocated_name(::ndn_message::ControlParametersTypes_Name* name);
+  private:
+  const ::ndn_message::ControlParametersTypes_Name& _internal_name() const;
+  ::ndn_message::ControlParametersTypes_Name* _internal_mutable_name();
+  public:
+  void unsafe_arena_set_allocated_name(
+      ::ndn_message::ControlParametersTypes_Name* name);
+  ::ndn_message::ControlParametersTypes_Name* unsafe_arena_release_name();
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ControlParametersTypes.Strategy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ndn_message::ControlParametersTypes_Name* name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_control_2dparameters_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControlParametersTypes_ControlParameters final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ControlParametersTypes.ControlParameters) */ {
+ public:
+  inline ControlParametersTypes_ControlParameters() : ControlParametersTypes_ControlParameters(nullptr) {}
+  ~ControlParametersTypes_ControlParameters() override;
+  explicit PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParameters(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlParametersTypes_ControlParameters(const ControlParametersTypes_ControlParameters& from);
+  ControlParametersTypes_ControlParameters(ControlParametersTypes_ControlParameters&& from) noexcept
+    : ControlParametersTypes_ControlParameters() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlParametersTypes_ControlParameters& operator=(const ControlParametersTypes_ControlParameters& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlParametersTypes_ControlParameters& operator=(ControlParametersTypes_ControlParameters&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlParametersTypes_ControlParameters& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlParametersTypes_ControlParameters* internal_default_instance() {
+    return reinterpret_cast<const ControlParametersTypes_ControlParameters*>(
+               &_ControlParametersTypes_ControlParameters_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ControlParametersTypes_ControlParameters& a, ControlParametersTypes_ControlParameters& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlParametersTypes_ControlParameters* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlParametersTypes_ControlParameters* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlParametersTypes_ControlParameters* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlParametersTypes_ControlParameters>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlParametersTypes_ControlParameters& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlParametersTypes_ControlParameters& from) {
+    ControlParametersTypes_ControlParameters::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControlParametersTypes_ControlParameters* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ControlParametersTypes.ControlParameters";
+  }
+  protected:
+  explicit ControlParametersTypes_ControlParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUriFieldNumber = 114,
+    kLocalUriFieldNumber = 129,
+    kNameFieldNumber = 7,
+    kStrategyFieldNumber = 107,
+    kFaceIdFieldNumber = 105,
+    kCostFieldNumber = 106,
+    kFlagsFieldNumber = 108,
+    kExpirationPeriodFieldNumber = 109,
+    kOriginFieldNumber = 111,
+    kMaskFieldNumber = 112,
+    kCapacityFieldNumber = 131,
+    kCountFieldNumber = 132,
+    kFacePersistencyFieldNumber = 133,
+    kBaseCongestionMarkingIntervalFieldNumber = 135,
+    kDefaultCongestionThresholdFieldNumber = 136,
+    kMtuFieldNumber = 137,
+  };
+  // optional string uri = 114;
+  bool has_uri() const;
+  private:
+  bool _internal_has_uri() const;
+  public:
+  void clear_uri();
+  const std::string& uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri();
+  PROTOBUF_NODISCARD std::string* release_uri();
+  void set_allocated_uri(std::string* uri);
+  private:
+  const std::string& _internal_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri(const std::string& value);
+  std::string* _internal_mutable_uri();
+  public:
+
+  // optional string local_uri = 129;
+  bool has_local_uri() const;
+  private:
+  bool _internal_has_local_uri() const;
+  public:
+  void clear_local_uri();
+  const std::string& local_uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_local_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_local_uri();
+  PROTOBUF_NODISCARD std::string* release_local_uri();
+  void set_allocated_local_uri(std::string* local_uri);
+  private:
+  const std::string& _internal_local_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_local_uri(const std::string& value);
+  std::string* _internal_mutable_local_uri();
+  public:
+
+  // optional .ndn_message.ControlParametersTypes.Name name = 7;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const ::ndn_message::ControlParametersTypes_Name& name() const;
+  PROTOBUF_NODISCARD ::ndn_message::ControlParametersTypes_Name* release_name();
+  ::ndn_message::ControlParametersTypes_Name* mutable_name();
+  void set_allocated_name(::ndn_message::ControlParametersTypes_Name* name);
+  private:
+  const ::ndn_message::ControlParametersTypes_Name& _internal_name() const;
+  ::ndn_message::ControlParametersTypes_Name* _internal_mutable_name();
+  public:
+  void unsafe_arena_set_allocated_name(
+      ::ndn_message::ControlParametersTypes_Name* name);
+  ::ndn_message::ControlParametersTypes_Name* unsafe_arena_release_name();
+
+  // optional .ndn_message.ControlParametersTypes.Strategy strategy = 107;
+  bool has_strategy() const;
+  private:
+  bool _internal_has_strategy() const;
+  public:
+  void clear_strategy();
+  const ::ndn_message::ControlParametersTypes_Strategy& strategy() const;
+  PROTOBUF_NODISCARD ::ndn_message::ControlParametersTypes_Strategy* release_strategy();
+  ::ndn_message::ControlParametersTypes_Strategy* mutable_strategy();
+  void set_allocated_strategy(::ndn_message::ControlParametersTypes_Strategy* strategy);
+  private:
+  const ::ndn_message::ControlParametersTypes_Strategy& _internal_strategy() const;
+  ::ndn_message::ControlParametersTypes_Strategy* _internal_mutable_strategy();
+  public:
+  void unsafe_arena_set_allocated_strategy(
+      ::ndn_message::ControlParametersTypes_Strategy* strategy);
+  ::ndn_message::ControlParametersTypes_Strategy* unsafe_arena_release_strategy();
+
+  // optional uint64 face_id = 105;
+  bool has_face_id() const;
+  private:
+  bool _internal_has_face_id() const;
+  public:
+  void clear_face_id();
+  uint64_t face_id() const;
+  void set_face_id(uint64_t value);
+  private:
+  uint64_t _internal_face_id() const;
+  void _internal_set_face_id(uint64_t value);
+  public:
+
+  // optional uint64 cost = 106;
+  bool has_cost() const;
+  private:
+  bool _internal_has_cost() const;
+  public:
+  void clear_cost();
+  uint64_t cost() const;
+  void set_cost(uint64_t value);
+  private:
+  uint64_t _internal_cost() const;
+  void _internal_set_cost(uint64_t value);
+  public:
+
+  // optional uint64 flags = 108;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  uint64_t flags() const;
+  void set_flags(uint64_t value);
+  private:
+  uint64_t _internal_flags() const;
+  void _internal_set_flags(uint64_t value);
+  public:
+
+  // optional uint64 expiration_period = 109;
+  bool has_expiration_period() const;
+  private:
+  bool _internal_has_expiration_period() const;
+  public:
+  void clear_expiration_period();
+  uint64_t expiration_period() const;
+  void set_expiration_period(uint64_t value);
+  private:
+  uint64_t _internal_expiration_period() const;
+  void _internal_set_expiration_period(uint64_t value);
+  public:
+
+  // optional uint64 origin = 111;
+  bool has_origin() const;
+  private:
+  bool _internal_has_origin() const;
+  public:
+  void clear_origin();
+  uint64_t origin() const;
+  void set_origin(uint64_t value);
+  private:
+  uint64_t _internal_origin() const;
+  void _internal_set_origin(uint64_t value);
+  public:
+
+  // optional uint64 mask = 112;
+  bool has_mask() const;
+  private:
+  bool _internal_has_mask() const;
+  public:
+  void clear_mask();
+  uint64_t mask() const;
+  void set_mask(uint64_t value);
+  private:
+  uint64_t _internal_mask() const;
+  void _internal_set_mask(uint64_t value);
+  public:
+
+  // optional uint64 capacity = 131;
+  bool has_capacity() const;
+  private:
+  bool _internal_has_capacity() const;
+  public:
+  void clear_capacity();
+  uint64_t capacity() const;
+  void set_capacity(uint64_t value);
+  private:
+  uint64_t _internal_capacity() const;
+  void _internal_set_capacity(uint64_t value);
+  public:
+
+  // optional uint64 count = 132;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // optional uint64 face_persistency = 133;
+  bool has_face_persistency() const;
+  private:
+  bool _internal_has_face_persistency() const;
+  public:
+  void clear_face_persistency();
+  uint64_t face_persistency() const;
+  void set_face_persistency(uint64_t value);
+  private:
+  uint64_t _internal_face_persistency() const;
+  void _internal_set_face_persistency(uint64_t value);
+  public:
+
+  // optional uint64 base_congestion_marking_interval = 135;
+  bool has_base_congestion_marking_interval() const;
+  private:
+  bool _internal_has_base_congestion_marking_interval() const;
+  public:
+  void clear_base_congestion_marking_interval();
+  uint64_t base_congestion_marking_interval() const;
+  void set_base_congestion_marking_interval(uint64_t value);
+  private:
+  uint64_t _internal_base_congestion_marking_interval() const;
+  void _internal_set_base_congestion_marking_interval(uint64_t value);
+  public:
+
+  // optional uint64 default_congestion_threshold = 136;
+  bool has_default_congestion_threshold() const;
+  private:
+  bool _internal_has_default_congestion_threshold() const;
+  public:
+  void clear_default_congestion_threshold();
+  uint64_t default_congestion_threshold() const;
+  void set_default_congestion_threshold(uint64_t value);
+  private:
+  uint64_t _internal_default_congestion_threshold() const;
+  void _internal_set_default_congestion_threshold(uint64_t value);
+  public:
+
+  // optional uint64 mtu = 137;
+  bool has_mtu() const;
+  private:
+  bool _internal_has_mtu() const;
+  public:
+  void clear_mtu();
+  uint64_t mtu() const;
+  void set_mtu(uint64_t value);
+  private:
+  uint64_t _internal_mtu() const;
+  void _internal_set_mtu(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ControlParametersTypes.ControlParameters)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr local_uri_;
+    ::ndn_message::ControlParametersTypes_Name* name_;
+    ::ndn_message::ControlParametersTypes_Strategy* strategy_;
+    uint64_t face_id_;
+    uint64_t cost_;
+    uint64_t flags_;
+    uint64_t expiration_period_;
+    uint64_t origin_;
+    uint64_t mask_;
+    uint64_t capacity_;
+    uint64_t count_;
+    uint64_t face_persistency_;
+    uint64_t base_congestion_marking_interval_;
+    uint64_t default_congestion_threshold_;
+    uint64_t mtu_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_control_2dparameters_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControlParametersTypes_ControlParametersResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ControlParametersTypes.ControlParametersResponse) */ {
+ public:
+  inline ControlParametersTypes_ControlParametersResponse() : ControlParametersTypes_ControlParametersResponse(nullptr) {}
+  ~ControlParametersTypes_ControlParametersResponse() override;
+  explicit PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlParametersTypes_ControlParametersResponse(const ControlParametersTypes_ControlParametersResponse& from);
+  ControlParametersTypes_ControlParametersResponse(ControlParametersTypes_ControlParametersResponse&& from) noexcept
+    : ControlParametersTypes_ControlParametersResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlParametersTypes_ControlParametersResponse& operator=(const ControlParametersTypes_ControlParametersResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlParametersTypes_ControlParametersResponse& operator=(ControlParametersTypes_ControlParametersResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlParametersTypes_ControlParametersResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlParametersTypes_ControlParametersResponse* internal_default_instance() {
+    return reinterpret_cast<const ControlParametersTypes_ControlParametersResponse*>(
+               &_ControlParametersTypes_ControlParametersResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ControlParametersTypes_ControlParametersResponse& a, ControlParametersTypes_ControlParametersResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlParametersTypes_ControlParametersResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlParametersTypes_ControlParametersResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlParametersTypes_ControlParametersResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlParametersTypes_ControlParametersResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlParametersTypes_ControlParametersResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlParametersTypes_ControlParametersResponse& from) {
+    ControlParametersTypes_ControlParametersResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControlParametersTypes_ControlParametersResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ControlParametersTypes.ControlParametersResponse";
+  }
+  protected:
+  explicit ControlParametersTypes_ControlParametersResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kControlParametersFieldNumber = 104,
+    kStatusTextFieldNumber = 103,
+    kStatusCodeFieldNumber = 102,
+  };
+  // repeated .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+  int control_parameters_size() const;
+  private:
+  int _internal_control_parameters_size() const;
+  public:
+  void clear_control_parameters();
+  ::ndn_message::ControlParametersTypes_ControlParameters* mutable_control_parameters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ControlParametersTypes_ControlParameters >*
+      mutable_control_parameters();
+  private:
+  const ::ndn_message::ControlParametersTypes_ControlParameters& _internal_control_parameters(int index) const;
+  ::ndn_message::ControlParametersTypes_ControlParameters* _internal_add_control_parameters();
+  public:
+  const ::ndn_message::ControlParametersTypes_ControlParameters& control_parameters(int index) const;
+  ::ndn_message::ControlParametersTypes_ControlParameters* add_control_parameters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ControlParametersTypes_ControlParameters >&
+      control_parameters() const;
+
+  // required string status_text = 103;
+  bool has_status_text() const;
+  private:
+  bool _internal_has_status_text() const;
+  public:
+  void clear_status_text();
+  const std::string& status_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status_text();
+  PROTOBUF_NODISCARD std::string* release_status_text();
+  void set_allocated_status_text(std::string* status_text);
+  private:
+  const std::string& _internal_status_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status_text(const std::string& value);
+  std::string* _internal_mutable_status_text();
+  public:
+
+  // required uint64 status_code = 102;
+  bool has_status_code() const;
+  private:
+  bool _internal_has_status_code() const;
+  public:
+  void clear_status_code();
+  uint64_t status_code() const;
+  void set_status_code(uint64_t value);
+  private:
+  uint64_t _internal_status_code() const;
+  void _internal_set_status_code(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ControlParametersTypes.ControlParametersResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ControlParametersTypes_ControlParameters > control_parameters_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_text_;
+    uint64_t status_code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_control_2dparameters_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControlParametersTypes_ControlParametersMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ControlParametersTypes.ControlParametersMessage) */ {
+ public:
+  inline ControlParametersTypes_ControlParametersMessage() : ControlParametersTypes_ControlParametersMessage(nullptr) {}
+  ~ControlParametersTypes_ControlParametersMessage() override;
+  explicit PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlParametersTypes_ControlParametersMessage(const ControlParametersTypes_ControlParametersMessage& from);
+  ControlParametersTypes_ControlParametersMessage(ControlParametersTypes_ControlParametersMessage&& from) noexcept
+    : ControlParametersTypes_ControlParametersMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlParametersTypes_ControlParametersMessage& operator=(const ControlParametersTypes_ControlParametersMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlParametersTypes_ControlParametersMessage& operator=(ControlParametersTypes_ControlParametersMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlParametersTypes_ControlParametersMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlParametersTypes_ControlParametersMessage* internal_default_instance() {
+    return reinterpret_cast<const ControlParametersTypes_ControlParametersMessage*>(
+               &_ControlParametersTypes_ControlParametersMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ControlParametersTypes_ControlParametersMessage& a, ControlParametersTypes_ControlParametersMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlParametersTypes_ControlParametersMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlParametersTypes_ControlParametersMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlParametersTypes_ControlParametersMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlParametersTypes_ControlParametersMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlParametersTypes_ControlParametersMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlParametersTypes_ControlParametersMessage& from) {
+    ControlParametersTypes_ControlParametersMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControlParametersTypes_ControlParametersMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ControlParametersTypes.ControlParametersMessage";
+  }
+  protected:
+  explicit ControlParametersTypes_ControlParametersMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kControlParametersFieldNumber = 104,
+  };
+  // required .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+  bool has_control_parameters() const;
+  private:
+  bool _internal_has_control_parameters() const;
+  public:
+  void clear_control_parameters();
+  const ::ndn_message::ControlParametersTypes_ControlParameters& control_parameters() const;
+  PROTOBUF_NODISCARD ::ndn_message::ControlParametersTypes_ControlParameters* release_control_parameters();
+  ::ndn_message::ControlParametersTypes_ControlParameters* mutable_control_parameters();
+  void set_allocated_control_parameters(::ndn_message::ControlParametersTypes_ControlParameters* control_parameters);
+  private:
+  const ::ndn_message::ControlParametersTypes_ControlParameters& _internal_control_parameters() const;
+  ::ndn_message::ControlParametersTypes_ControlParameters* _internal_mutable_control_parameters();
+  public:
+  void unsafe_arena_set_allocated_control_parameters(
+      ::ndn_message::ControlParametersTypes_ControlParameters* control_parameters);
+  ::ndn_message::ControlParametersTypes_ControlParameters* unsafe_arena_release_control_parameters();
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ControlParametersTypes.ControlParametersMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ndn_message::ControlParametersTypes_ControlParameters* control_parameters_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_control_2dparameters_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControlParametersTypes_ControlParametersResponseMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ControlParametersTypes.ControlParametersResponseMessage) */ {
+ public:
+  inline ControlParametersTypes_ControlParametersResponseMessage() : ControlParametersTypes_ControlParametersResponseMessage(nullptr) {}
+  ~ControlParametersTypes_ControlParametersResponseMessage() override;
+  explicit PROTOBUF_CONSTEXPR ControlParametersTypes_ControlParametersResponseMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlParametersTypes_ControlParametersResponseMessage(const ControlParametersTypes_ControlParametersResponseMessage& from);
+  ControlParametersTypes_ControlParametersResponseMessage(ControlParametersTypes_ControlParametersResponseMessage&& from) noexcept
+    : ControlParametersTypes_ControlParametersResponseMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlParametersTypes_ControlParametersResponseMessage& operator=(const ControlParametersTypes_ControlParametersResponseMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlParametersTypes_ControlParametersResponseMessage& operator=(ControlParametersTypes_ControlParametersResponseMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlParametersTypes_ControlParametersResponseMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlParametersTypes_ControlParametersResponseMessage* internal_default_instance() {
+    return reinterpret_cast<const ControlParametersTypes_ControlParametersResponseMessage*>(
+               &_ControlParametersTypes_ControlParametersResponseMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ControlParametersTypes_ControlParametersResponseMessage& a, ControlParametersTypes_ControlParametersResponseMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlParametersTypes_ControlParametersResponseMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlParametersTypes_ControlParametersResponseMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlParametersTypes_ControlParametersResponseMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlParametersTypes_ControlParametersResponseMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlParametersTypes_ControlParametersResponseMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlParametersTypes_ControlParametersResponseMessage& from) {
+    ControlParametersTypes_ControlParametersResponseMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControlParametersTypes_ControlParametersResponseMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ControlParametersTypes.ControlParametersResponseMessage";
+  }
+  protected:
+  explicit ControlParametersTypes_ControlParametersResponseMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kControlResponseFieldNumber = 101,
+  };
+  // required .ndn_message.ControlParametersTypes.ControlParametersResponse control_response = 101;
+  bool has_control_response() const;
+  private:
+  bool _internal_has_control_response() const;
+  public:
+  void clear_control_response();
+  const ::ndn_message::ControlParametersTypes_ControlParametersResponse& control_response() const;
+  PROTOBUF_NODISCARD ::ndn_message::ControlParametersTypes_ControlParametersResponse* release_control_response();
+  ::ndn_message::ControlParametersTypes_ControlParametersResponse* mutable_control_response();
+  void set_allocated_control_response(::ndn_message::ControlParametersTypes_ControlParametersResponse* control_response);
+  private:
+  const ::ndn_message::ControlParametersTypes_ControlParametersResponse& _internal_control_response() const;
+  ::ndn_message::ControlParametersTypes_ControlParametersResponse* _internal_mutable_control_response();
+  public:
+  void unsafe_arena_set_allocated_control_response(
+      ::ndn_message::ControlParametersTypes_ControlParametersResponse* control_response);
+  ::ndn_message::ControlParametersTypes_ControlParametersResponse* unsafe_arena_release_control_response();
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ControlParametersTypes.ControlParametersResponseMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ndn_message::ControlParametersTypes_ControlParametersResponse* control_response_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_control_2dparameters_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControlParametersTypes final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ndn_message.ControlParametersTypes) */ {
+ public:
+  inline ControlParametersTypes() : ControlParametersTypes(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ControlParametersTypes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlParametersTypes(const ControlParametersTypes& from);
+  ControlParametersTypes(ControlParametersTypes&& from) noexcept
+    : ControlParametersTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlParametersTypes& operator=(const ControlParametersTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlParametersTypes& operator=(ControlParametersTypes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlParametersTypes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlParametersTypes* internal_default_instance() {
+    return reinterpret_cast<const ControlParametersTypes*>(
+               &_ControlParametersTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ControlParametersTypes& a, ControlParametersTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlParametersTypes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlParametersTypes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlParametersTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlParametersTypes>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ControlParametersTypes& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ControlParametersTypes& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ControlParametersTypes";
+  }
+  protected:
+  explicit ControlParametersTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ControlParametersTypes_Name Name;
+  typedef ControlParametersTypes_Strategy Strategy;
+  typedef ControlParametersTypes_ControlParameters ControlParameters;
+  typedef ControlParametersTypes_ControlParametersResponse ControlParametersResponse;
+  typedef ControlParametersTypes_ControlParametersMessage ControlParametersMessage;
+  typedef ControlParametersTypes_ControlParametersResponseMessage ControlParametersResponseMessage;
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ControlParametersTypes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_control_2dparameters_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ControlParametersTypes_Name
+
+// repeated bytes component = 8;
+inline int ControlParametersTypes_Name::_internal_component_size() const {
+  return _impl_.component_.size();
+}
+inline int ControlParametersTypes_Name::component_size() const {
+  return _internal_component_size();
+}
+inline void ControlParametersTypes_Name::clear_component() {
+  _impl_.component_.Clear();
+}
+inline std::string* ControlParametersTypes_Name::add_component() {
+  std::string* _s = _internal_add_component();
+  // @@protoc_insertion_point(field_add_mutable:ndn_message.ControlParametersTypes.Name.component)
+  return _s;
+}
+inline const std::string& ControlParametersTypes_Name::_internal_component(int index) const {
+  return _impl_.component_.Get(index);
+}
+inline const std::string& ControlParametersTypes_Name::component(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.Name.component)
+  return _internal_component(index);
+}
+inline std::string* ControlParametersTypes_Name::mutable_component(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.Name.component)
+  return _impl_.component_.Mutable(index);
+}
+inline void ControlParametersTypes_Name::set_component(int index, const std::string& value) {
+  _impl_.component_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.Name.component)
+}
+inline void ControlParametersTypes_Name::set_component(int index, std::string&& value) {
+  _impl_.component_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.Name.component)
+}
+inline void ControlParametersTypes_Name::set_component(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.component_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ndn_message.ControlParametersTypes.Name.component)
+}
+inline void ControlParametersTypes_Name::set_component(int index, const void* value, size_t size) {
+  _impl_.component_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ndn_message.ControlParametersTypes.Name.component)
+}
+inline std::string* ControlParametersTypes_Name::_internal_add_component() {
+  return _impl_.component_.Add();
+}
+inline void ControlParametersTypes_Name::add_component(const std::string& value) {
+  _impl_.component_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ndn_message.ControlParametersTypes.Name.component)
+}
+inline void ControlParametersTypes_Name::add_component(std::string&& value) {
+  _impl_.component_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ndn_message.ControlParametersTypes.Name.component)
+}
+inline void ControlParametersTypes_Name::add_component(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.component_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ndn_message.ControlParametersTypes.Name.component)
+}
+inline void ControlParametersTypes_Name::add_component(const void* value, size_t size) {
+  _impl_.component_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ndn_message.ControlParametersTypes.Name.component)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ControlParametersTypes_Name::component() const {
+  // @@protoc_insertion_point(field_list:ndn_message.ControlParametersTypes.Name.component)
+  return _impl_.component_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ControlParametersTypes_Name::mutable_component() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.ControlParametersTypes.Name.component)
+  return &_impl_.component_;
+}
+
+// -------------------------------------------------------------------
+
+// ControlParametersTypes_Strategy
+
+// required .ndn_message.ControlParametersTypes.Name name = 7;
+inline bool ControlParametersTypes_Strategy::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.name_ != nullptr);
+  return value;
+}
+inline bool ControlParametersTypes_Strategy::has_name() const {
+  return _internal_has_name();
+}
+inline void ControlParametersTypes_Strategy::clear_name() {
+  if (_impl_.name_ != nullptr) _impl_.name_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ndn_message::ControlParametersTypes_Name& ControlParametersTypes_Strategy::_internal_name() const {
+  const ::ndn_message::ControlParametersTypes_Name* p = _impl_.name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::ControlParametersTypes_Name&>(
+      ::ndn_message::_ControlParametersTypes_Name_default_instance_);
+}
+inline const ::ndn_message::ControlParametersTypes_Name& ControlParametersTypes_Strategy::name() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.Strategy.name)
+  return _internal_name();
+}
+inline void ControlParametersTypes_Strategy::unsafe_arena_set_allocated_name(
+    ::ndn_message::ControlParametersTypes_Name* name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.name_);
+  }
+  _impl_.name_ = name;
+  if (name) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.ControlParametersTypes.Strategy.name)
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_Strategy::release_name() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ControlParametersTypes_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_Strategy::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.Strategy.name)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ControlParametersTypes_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_Strategy::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::ControlParametersTypes_Name>(GetArenaForAllocation());
+    _impl_.name_ = p;
+  }
+  return _impl_.name_;
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_Strategy::mutable_name() {
+  ::ndn_message::ControlParametersTypes_Name* _msg = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.Strategy.name)
+  return _msg;
+}
+inline void ControlParametersTypes_Strategy::set_allocated_name(::ndn_message::ControlParametersTypes_Name* name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.name_;
+  }
+  if (name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(name);
+    if (message_arena != submessage_arena) {
+      name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, name, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_ = name;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.Strategy.name)
+}
+
+// -------------------------------------------------------------------
+
+// ControlParametersTypes_ControlParameters
+
+// optional .ndn_message.ControlParametersTypes.Name name = 7;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.name_ != nullptr);
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_name() const {
+  return _internal_has_name();
+}
+inline void ControlParametersTypes_ControlParameters::clear_name() {
+  if (_impl_.name_ != nullptr) _impl_.name_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::ndn_message::ControlParametersTypes_Name& ControlParametersTypes_ControlParameters::_internal_name() const {
+  const ::ndn_message::ControlParametersTypes_Name* p = _impl_.name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::ControlParametersTypes_Name&>(
+      ::ndn_message::_ControlParametersTypes_Name_default_instance_);
+}
+inline const ::ndn_message::ControlParametersTypes_Name& ControlParametersTypes_ControlParameters::name() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.name)
+  return _internal_name();
+}
+inline void ControlParametersTypes_ControlParameters::unsafe_arena_set_allocated_name(
+    ::ndn_message::ControlParametersTypes_Name* name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.name_);
+  }
+  _impl_.name_ = name;
+  if (name) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.ControlParametersTypes.ControlParameters.name)
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_ControlParameters::release_name() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ndn_message::ControlParametersTypes_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_ControlParameters::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.ControlParameters.name)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ndn_message::ControlParametersTypes_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_ControlParameters::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::ControlParametersTypes_Name>(GetArenaForAllocation());
+    _impl_.name_ = p;
+  }
+  return _impl_.name_;
+}
+inline ::ndn_message::ControlParametersTypes_Name* ControlParametersTypes_ControlParameters::mutable_name() {
+  ::ndn_message::ControlParametersTypes_Name* _msg = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParameters.name)
+  return _msg;
+}
+inline void ControlParametersTypes_ControlParameters::set_allocated_name(::ndn_message::ControlParametersTypes_Name* name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.name_;
+  }
+  if (name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(name);
+    if (message_arena != submessage_arena) {
+      name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, name, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.name_ = name;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.ControlParameters.name)
+}
+
+// optional uint64 face_id = 105;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_face_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_face_id() const {
+  return _internal_has_face_id();
+}
+inline void ControlParametersTypes_ControlParameters::clear_face_id() {
+  _impl_.face_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_face_id() const {
+  return _impl_.face_id_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::face_id() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.face_id)
+  return _internal_face_id();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_face_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.face_id_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_face_id(uint64_t value) {
+  _internal_set_face_id(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.face_id)
+}
+
+// optional string uri = 114;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_uri() const {
+  return _internal_has_uri();
+}
+inline void ControlParametersTypes_ControlParameters::clear_uri() {
+  _impl_.uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ControlParametersTypes_ControlParameters::uri() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.uri)
+  return _internal_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ControlParametersTypes_ControlParameters::set_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.uri)
+}
+inline std::string* ControlParametersTypes_ControlParameters::mutable_uri() {
+  std::string* _s = _internal_mutable_uri();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParameters.uri)
+  return _s;
+}
+inline const std::string& ControlParametersTypes_ControlParameters::_internal_uri() const {
+  return _impl_.uri_.Get();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ControlParametersTypes_ControlParameters::_internal_mutable_uri() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ControlParametersTypes_ControlParameters::release_uri() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.ControlParameters.uri)
+  if (!_internal_has_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ControlParametersTypes_ControlParameters::set_allocated_uri(std::string* uri) {
+  if (uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.uri_.SetAllocated(uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.ControlParameters.uri)
+}
+
+// optional string local_uri = 129;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_local_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_local_uri() const {
+  return _internal_has_local_uri();
+}
+inline void ControlParametersTypes_ControlParameters::clear_local_uri() {
+  _impl_.local_uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ControlParametersTypes_ControlParameters::local_uri() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.local_uri)
+  return _internal_local_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ControlParametersTypes_ControlParameters::set_local_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.local_uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.local_uri)
+}
+inline std::string* ControlParametersTypes_ControlParameters::mutable_local_uri() {
+  std::string* _s = _internal_mutable_local_uri();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParameters.local_uri)
+  return _s;
+}
+inline const std::string& ControlParametersTypes_ControlParameters::_internal_local_uri() const {
+  return _impl_.local_uri_.Get();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_local_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.local_uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ControlParametersTypes_ControlParameters::_internal_mutable_local_uri() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.local_uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ControlParametersTypes_ControlParameters::release_local_uri() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.ControlParameters.local_uri)
+  if (!_internal_has_local_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.local_uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ControlParametersTypes_ControlParameters::set_allocated_local_uri(std::string* local_uri) {
+  if (local_uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.local_uri_.SetAllocated(local_uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.ControlParameters.local_uri)
+}
+
+// optional uint64 origin = 111;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_origin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_origin() const {
+  return _internal_has_origin();
+}
+inline void ControlParametersTypes_ControlParameters::clear_origin() {
+  _impl_.origin_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_origin() const {
+  return _impl_.origin_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::origin() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.origin)
+  return _internal_origin();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_origin(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.origin_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_origin(uint64_t value) {
+  _internal_set_origin(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.origin)
+}
+
+// optional uint64 cost = 106;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_cost() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_cost() const {
+  return _internal_has_cost();
+}
+inline void ControlParametersTypes_ControlParameters::clear_cost() {
+  _impl_.cost_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_cost() const {
+  return _impl_.cost_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::cost() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.cost)
+  return _internal_cost();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_cost(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cost_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_cost(uint64_t value) {
+  _internal_set_cost(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.cost)
+}
+
+// optional uint64 capacity = 131;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_capacity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_capacity() const {
+  return _internal_has_capacity();
+}
+inline void ControlParametersTypes_ControlParameters::clear_capacity() {
+  _impl_.capacity_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::capacity() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.capacity)
+  return _internal_capacity();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_capacity(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.capacity_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_capacity(uint64_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.capacity)
+}
+
+// optional uint64 count = 132;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_count() const {
+  return _internal_has_count();
+}
+inline void ControlParametersTypes_ControlParameters::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::count() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.count)
+  return _internal_count();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.count_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.count)
+}
+
+// optional uint64 flags = 108;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_flags() const {
+  return _internal_has_flags();
+}
+inline void ControlParametersTypes_ControlParameters::clear_flags() {
+  _impl_.flags_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::flags() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.flags)
+  return _internal_flags();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_flags(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.flags_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_flags(uint64_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.flags)
+}
+
+// optional uint64 mask = 112;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_mask() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_mask() const {
+  return _internal_has_mask();
+}
+inline void ControlParametersTypes_ControlParameters::clear_mask() {
+  _impl_.mask_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_mask() const {
+  return _impl_.mask_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::mask() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.mask)
+  return _internal_mask();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_mask(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.mask_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_mask(uint64_t value) {
+  _internal_set_mask(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.mask)
+}
+
+// optional .ndn_message.ControlParametersTypes.Strategy strategy = 107;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_strategy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.strategy_ != nullptr);
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_strategy() const {
+  return _internal_has_strategy();
+}
+inline void ControlParametersTypes_ControlParameters::clear_strategy() {
+  if (_impl_.strategy_ != nullptr) _impl_.strategy_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::ndn_message::ControlParametersTypes_Strategy& ControlParametersTypes_ControlParameters::_internal_strategy() const {
+  const ::ndn_message::ControlParametersTypes_Strategy* p = _impl_.strategy_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::ControlParametersTypes_Strategy&>(
+      ::ndn_message::_ControlParametersTypes_Strategy_default_instance_);
+}
+inline const ::ndn_message::ControlParametersTypes_Strategy& ControlParametersTypes_ControlParameters::strategy() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.strategy)
+  return _internal_strategy();
+}
+inline void ControlParametersTypes_ControlParameters::unsafe_arena_set_allocated_strategy(
+    ::ndn_message::ControlParametersTypes_Strategy* strategy) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.strategy_);
+  }
+  _impl_.strategy_ = strategy;
+  if (strategy) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.ControlParametersTypes.ControlParameters.strategy)
+}
+inline ::ndn_message::ControlParametersTypes_Strategy* ControlParametersTypes_ControlParameters::release_strategy() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ndn_message::ControlParametersTypes_Strategy* temp = _impl_.strategy_;
+  _impl_.strategy_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_Strategy* ControlParametersTypes_ControlParameters::unsafe_arena_release_strategy() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.ControlParameters.strategy)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ndn_message::ControlParametersTypes_Strategy* temp = _impl_.strategy_;
+  _impl_.strategy_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_Strategy* ControlParametersTypes_ControlParameters::_internal_mutable_strategy() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.strategy_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::ControlParametersTypes_Strategy>(GetArenaForAllocation());
+    _impl_.strategy_ = p;
+  }
+  return _impl_.strategy_;
+}
+inline ::ndn_message::ControlParametersTypes_Strategy* ControlParametersTypes_ControlParameters::mutable_strategy() {
+  ::ndn_message::ControlParametersTypes_Strategy* _msg = _internal_mutable_strategy();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParameters.strategy)
+  return _msg;
+}
+inline void ControlParametersTypes_ControlParameters::set_allocated_strategy(::ndn_message::ControlParametersTypes_Strategy* strategy) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.strategy_;
+  }
+  if (strategy) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(strategy);
+    if (message_arena != submessage_arena) {
+      strategy = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, strategy, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.strategy_ = strategy;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.ControlParameters.strategy)
+}
+
+// optional uint64 expiration_period = 109;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_expiration_period() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_expiration_period() const {
+  return _internal_has_expiration_period();
+}
+inline void ControlParametersTypes_ControlParameters::clear_expiration_period() {
+  _impl_.expiration_period_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_expiration_period() const {
+  return _impl_.expiration_period_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::expiration_period() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.expiration_period)
+  return _internal_expiration_period();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_expiration_period(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.expiration_period_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_expiration_period(uint64_t value) {
+  _internal_set_expiration_period(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.expiration_period)
+}
+
+// optional uint64 face_persistency = 133;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_face_persistency() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_face_persistency() const {
+  return _internal_has_face_persistency();
+}
+inline void ControlParametersTypes_ControlParameters::clear_face_persistency() {
+  _impl_.face_persistency_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_face_persistency() const {
+  return _impl_.face_persistency_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::face_persistency() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.face_persistency)
+  return _internal_face_persistency();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_face_persistency(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.face_persistency_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_face_persistency(uint64_t value) {
+  _internal_set_face_persistency(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.face_persistency)
+}
+
+// optional uint64 base_congestion_marking_interval = 135;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_base_congestion_marking_interval() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_base_congestion_marking_interval() const {
+  return _internal_has_base_congestion_marking_interval();
+}
+inline void ControlParametersTypes_ControlParameters::clear_base_congestion_marking_interval() {
+  _impl_.base_congestion_marking_interval_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_base_congestion_marking_interval() const {
+  return _impl_.base_congestion_marking_interval_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::base_congestion_marking_interval() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.base_congestion_marking_interval)
+  return _internal_base_congestion_marking_interval();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_base_congestion_marking_interval(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.base_congestion_marking_interval_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_base_congestion_marking_interval(uint64_t value) {
+  _internal_set_base_congestion_marking_interval(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.base_congestion_marking_interval)
+}
+
+// optional uint64 default_congestion_threshold = 136;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_default_congestion_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_default_congestion_threshold() const {
+  return _internal_has_default_congestion_threshold();
+}
+inline void ControlParametersTypes_ControlParameters::clear_default_congestion_threshold() {
+  _impl_.default_congestion_threshold_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_default_congestion_threshold() const {
+  return _impl_.default_congestion_threshold_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::default_congestion_threshold() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.default_congestion_threshold)
+  return _internal_default_congestion_threshold();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_default_congestion_threshold(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.default_congestion_threshold_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_default_congestion_threshold(uint64_t value) {
+  _internal_set_default_congestion_threshold(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.default_congestion_threshold)
+}
+
+// optional uint64 mtu = 137;
+inline bool ControlParametersTypes_ControlParameters::_internal_has_mtu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParameters::has_mtu() const {
+  return _internal_has_mtu();
+}
+inline void ControlParametersTypes_ControlParameters::clear_mtu() {
+  _impl_.mtu_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::_internal_mtu() const {
+  return _impl_.mtu_;
+}
+inline uint64_t ControlParametersTypes_ControlParameters::mtu() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParameters.mtu)
+  return _internal_mtu();
+}
+inline void ControlParametersTypes_ControlParameters::_internal_set_mtu(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.mtu_ = value;
+}
+inline void ControlParametersTypes_ControlParameters::set_mtu(uint64_t value) {
+  _internal_set_mtu(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParameters.mtu)
+}
+
+// -------------------------------------------------------------------
+
+// ControlParametersTypes_ControlParametersResponse
+
+// required uint64 status_code = 102;
+inline bool ControlParametersTypes_ControlParametersResponse::_internal_has_status_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParametersResponse::has_status_code() const {
+  return _internal_has_status_code();
+}
+inline void ControlParametersTypes_ControlParametersResponse::clear_status_code() {
+  _impl_.status_code_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ControlParametersTypes_ControlParametersResponse::_internal_status_code() const {
+  return _impl_.status_code_;
+}
+inline uint64_t ControlParametersTypes_ControlParametersResponse::status_code() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParametersResponse.status_code)
+  return _internal_status_code();
+}
+inline void ControlParametersTypes_ControlParametersResponse::_internal_set_status_code(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.status_code_ = value;
+}
+inline void ControlParametersTypes_ControlParametersResponse::set_status_code(uint64_t value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParametersResponse.status_code)
+}
+
+// required string status_text = 103;
+inline bool ControlParametersTypes_ControlParametersResponse::_internal_has_status_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ControlParametersTypes_ControlParametersResponse::has_status_text() const {
+  return _internal_has_status_text();
+}
+inline void ControlParametersTypes_ControlParametersResponse::clear_status_text() {
+  _impl_.status_text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ControlParametersTypes_ControlParametersResponse::status_text() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParametersResponse.status_text)
+  return _internal_status_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ControlParametersTypes_ControlParametersResponse::set_status_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.status_text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.ControlParametersTypes.ControlParametersResponse.status_text)
+}
+inline std::string* ControlParametersTypes_ControlParametersResponse::mutable_status_text() {
+  std::string* _s = _internal_mutable_status_text();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParametersResponse.status_text)
+  return _s;
+}
+inline const std::string& ControlParametersTypes_ControlParametersResponse::_internal_status_text() const {
+  return _impl_.status_text_.Get();
+}
+inline void ControlParametersTypes_ControlParametersResponse::_internal_set_status_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.status_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ControlParametersTypes_ControlParametersResponse::_internal_mutable_status_text() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.status_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ControlParametersTypes_ControlParametersResponse::release_status_text() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.ControlParametersResponse.status_text)
+  if (!_internal_has_status_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.status_text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_text_.IsDefault()) {
+    _impl_.status_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ControlParametersTypes_ControlParametersResponse::set_allocated_status_text(std::string* status_text) {
+  if (status_text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.status_text_.SetAllocated(status_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_text_.IsDefault()) {
+    _impl_.status_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.ControlParametersResponse.status_text)
+}
+
+// repeated .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+inline int ControlParametersTypes_ControlParametersResponse::_internal_control_parameters_size() const {
+  return _impl_.control_parameters_.size();
+}
+inline int ControlParametersTypes_ControlParametersResponse::control_parameters_size() const {
+  return _internal_control_parameters_size();
+}
+inline void ControlParametersTypes_ControlParametersResponse::clear_control_parameters() {
+  _impl_.control_parameters_.Clear();
+}
+inline ::ndn_message::ControlParametersTypes_ControlParameters* ControlParametersTypes_ControlParametersResponse::mutable_control_parameters(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParametersResponse.control_parameters)
+  return _impl_.control_parameters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ControlParametersTypes_ControlParameters >*
+ControlParametersTypes_ControlParametersResponse::mutable_control_parameters() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.ControlParametersTypes.ControlParametersResponse.control_parameters)
+  return &_impl_.control_parameters_;
+}
+inline const ::ndn_message::ControlParametersTypes_ControlParameters& ControlParametersTypes_ControlParametersResponse::_internal_control_parameters(int index) const {
+  return _impl_.control_parameters_.Get(index);
+}
+inline const ::ndn_message::ControlParametersTypes_ControlParameters& ControlParametersTypes_ControlParametersResponse::control_parameters(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParametersResponse.control_parameters)
+  return _internal_control_parameters(index);
+}
+inline ::ndn_message::ControlParametersTypes_ControlParameters* ControlParametersTypes_ControlParametersResponse::_internal_add_control_parameters() {
+  return _impl_.control_parameters_.Add();
+}
+inline ::ndn_message::ControlParametersTypes_ControlParameters* ControlParametersTypes_ControlParametersResponse::add_control_parameters() {
+  ::ndn_message::ControlParametersTypes_ControlParameters* _add = _internal_add_control_parameters();
+  // @@protoc_insertion_point(field_add:ndn_message.ControlParametersTypes.ControlParametersResponse.control_parameters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ControlParametersTypes_ControlParameters >&
+ControlParametersTypes_ControlParametersResponse::control_parameters() const {
+  // @@protoc_insertion_point(field_list:ndn_message.ControlParametersTypes.ControlParametersResponse.control_parameters)
+  return _impl_.control_parameters_;
+}
+
+// -------------------------------------------------------------------
+
+// ControlParametersTypes_ControlParametersMessage
+
+// required .ndn_message.ControlParametersTypes.ControlParameters control_parameters = 104;
+inline bool ControlParametersTypes_ControlParametersMessage::_internal_has_control_parameters() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.control_parameters_ != nullptr);
+  return value;
+}
+inline bool ControlParametersTypes_ControlParametersMessage::has_control_parameters() const {
+  return _internal_has_control_parameters();
+}
+inline void ControlParametersTypes_ControlParametersMessage::clear_control_parameters() {
+  if (_impl_.control_parameters_ != nullptr) _impl_.control_parameters_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ndn_message::ControlParametersTypes_ControlParameters& ControlParametersTypes_ControlParametersMessage::_internal_control_parameters() const {
+  const ::ndn_message::ControlParametersTypes_ControlParameters* p = _impl_.control_parameters_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::ControlParametersTypes_ControlParameters&>(
+      ::ndn_message::_ControlParametersTypes_ControlParameters_default_instance_);
+}
+inline const ::ndn_message::ControlParametersTypes_ControlParameters& ControlParametersTypes_ControlParametersMessage::control_parameters() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParametersMessage.control_parameters)
+  return _internal_control_parameters();
+}
+inline void ControlParametersTypes_ControlParametersMessage::unsafe_arena_set_allocated_control_parameters(
+    ::ndn_message::ControlParametersTypes_ControlParameters* control_parameters) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.control_parameters_);
+  }
+  _impl_.control_parameters_ = control_parameters;
+  if (control_parameters) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.ControlParametersTypes.ControlParametersMessage.control_parameters)
+}
+inline ::ndn_message::ControlParametersTypes_ControlParameters* ControlParametersTypes_ControlParametersMessage::release_control_parameters() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ControlParametersTypes_ControlParameters* temp = _impl_.control_parameters_;
+  _impl_.control_parameters_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_ControlParameters* ControlParametersTypes_ControlParametersMessage::unsafe_arena_release_control_parameters() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.ControlParametersMessage.control_parameters)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ControlParametersTypes_ControlParameters* temp = _impl_.control_parameters_;
+  _impl_.control_parameters_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_ControlParameters* ControlParametersTypes_ControlParametersMessage::_internal_mutable_control_parameters() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.control_parameters_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::ControlParametersTypes_ControlParameters>(GetArenaForAllocation());
+    _impl_.control_parameters_ = p;
+  }
+  return _impl_.control_parameters_;
+}
+inline ::ndn_message::ControlParametersTypes_ControlParameters* ControlParametersTypes_ControlParametersMessage::mutable_control_parameters() {
+  ::ndn_message::ControlParametersTypes_ControlParameters* _msg = _internal_mutable_control_parameters();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParametersMessage.control_parameters)
+  return _msg;
+}
+inline void ControlParametersTypes_ControlParametersMessage::set_allocated_control_parameters(::ndn_message::ControlParametersTypes_ControlParameters* control_parameters) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.control_parameters_;
+  }
+  if (control_parameters) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(control_parameters);
+    if (message_arena != submessage_arena) {
+      control_parameters = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, control_parameters, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.control_parameters_ = control_parameters;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.ControlParametersMessage.control_parameters)
+}
+
+// -------------------------------------------------------------------
+
+// ControlParametersTypes_ControlParametersResponseMessage
+
+// required .ndn_message.ControlParametersTypes.ControlParametersResponse control_response = 101;
+inline bool ControlParametersTypes_ControlParametersResponseMessage::_internal_has_control_response() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.control_response_ != nullptr);
+  return value;
+}
+inline bool ControlParametersTypes_ControlParametersResponseMessage::has_control_response() const {
+  return _internal_has_control_response();
+}
+inline void ControlParametersTypes_ControlParametersResponseMessage::clear_control_response() {
+  if (_impl_.control_response_ != nullptr) _impl_.control_response_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ndn_message::ControlParametersTypes_ControlParametersResponse& ControlParametersTypes_ControlParametersResponseMessage::_internal_control_response() const {
+  const ::ndn_message::ControlParametersTypes_ControlParametersResponse* p = _impl_.control_response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::ControlParametersTypes_ControlParametersResponse&>(
+      ::ndn_message::_ControlParametersTypes_ControlParametersResponse_default_instance_);
+}
+inline const ::ndn_message::ControlParametersTypes_ControlParametersResponse& ControlParametersTypes_ControlParametersResponseMessage::control_response() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ControlParametersTypes.ControlParametersResponseMessage.control_response)
+  return _internal_control_response();
+}
+inline void ControlParametersTypes_ControlParametersResponseMessage::unsafe_arena_set_allocated_control_response(
+    ::ndn_message::ControlParametersTypes_ControlParametersResponse* control_response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.control_response_);
+  }
+  _impl_.control_response_ = control_response;
+  if (control_response) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.ControlParametersTypes.ControlParametersResponseMessage.control_response)
+}
+inline ::ndn_message::ControlParametersTypes_ControlParametersResponse* ControlParametersTypes_ControlParametersResponseMessage::release_control_response() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ControlParametersTypes_ControlParametersResponse* temp = _impl_.control_response_;
+  _impl_.control_response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_ControlParametersResponse* ControlParametersTypes_ControlParametersResponseMessage::unsafe_arena_release_control_response() {
+  // @@protoc_insertion_point(field_release:ndn_message.ControlParametersTypes.ControlParametersResponseMessage.control_response)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ControlParametersTypes_ControlParametersResponse* temp = _impl_.control_response_;
+  _impl_.control_response_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::ControlParametersTypes_ControlParametersResponse* ControlParametersTypes_ControlParametersResponseMessage::_internal_mutable_control_response() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.control_response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::ControlParametersTypes_ControlParametersResponse>(GetArenaForAllocation());
+    _impl_.control_response_ = p;
+  }
+  return _impl_.control_response_;
+}
+inline ::ndn_message::ControlParametersTypes_ControlParametersResponse* ControlParametersTypes_ControlParametersResponseMessage::mutable_control_response() {
+  ::ndn_message::ControlParametersTypes_ControlParametersResponse* _msg = _internal_mutable_control_response();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ControlParametersTypes.ControlParametersResponseMessage.control_response)
+  return _msg;
+}
+inline void ControlParametersTypes_ControlParametersResponseMessage::set_allocated_control_response(::ndn_message::ControlParametersTypes_ControlParametersResponse* control_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.control_response_;
+  }
+  if (control_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(control_response);
+    if (message_arena != submessage_arena) {
+      control_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, control_response, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.control_response_ = control_response;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ControlParametersTypes.ControlParametersResponseMessage.control_response)
+}
+
+// -------------------------------------------------------------------
+
+// ControlParametersTypes
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ndn_message
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_control_2dparameters_2eproto
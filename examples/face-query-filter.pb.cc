@@ -0,0 +1,888 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: face-query-filter.proto
+
+#include "face-query-filter.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ndn_message {
+PROTOBUF_CONSTEXPR FaceQueryFilterMessage_FaceQueryFilter::FaceQueryFilterMessage_FaceQueryFilter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.local_uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uri_scheme_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.face_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.face_scope_)*/0
+  , /*decltype(_impl_.face_persistency_)*/0
+  , /*decltype(_impl_.link_type_)*/0} {}
+struct FaceQueryFilterMessage_FaceQueryFilterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FaceQueryFilterMessage_FaceQueryFilterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FaceQueryFilterMessage_FaceQueryFilterDefaultTypeInternal() {}
+  union {
+    FaceQueryFilterMessage_FaceQueryFilter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FaceQueryFilterMessage_FaceQueryFilterDefaultTypeInternal _FaceQueryFilterMessage_FaceQueryFilter_default_instance_;
+PROTOBUF_CONSTEXPR FaceQueryFilterMessage::FaceQueryFilterMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.face_query_filter_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FaceQueryFilterMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FaceQueryFilterMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FaceQueryFilterMessageDefaultTypeInternal() {}
+  union {
+    FaceQueryFilterMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FaceQueryFilterMessageDefaultTypeInternal _FaceQueryFilterMessage_default_instance_;
+}  // namespace ndn_message
+static ::_pb::Metadata file_level_metadata_face_2dquery_2dfilter_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_face_2dquery_2dfilter_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_face_2dquery_2dfilter_2eproto = nullptr;
+
+const uint32_t TableStruct_face_2dquery_2dfilter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_.face_id_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_.uri_scheme_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_.uri_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_.local_uri_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_.face_scope_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_.face_persistency_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter, _impl_.link_type_),
+  3,
+  2,
+  0,
+  1,
+  4,
+  5,
+  6,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceQueryFilterMessage, _impl_.face_query_filter_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::ndn_message::FaceQueryFilterMessage_FaceQueryFilter)},
+  { 20, -1, -1, sizeof(::ndn_message::FaceQueryFilterMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ndn_message::_FaceQueryFilterMessage_FaceQueryFilter_default_instance_._instance,
+  &::ndn_message::_FaceQueryFilterMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_face_2dquery_2dfilter_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027face-query-filter.proto\022\013ndn_message\"\264"
+  "\004\n\026FaceQueryFilterMessage\022O\n\021face_query_"
+  "filter\030\226\001 \003(\01323.ndn_message.FaceQueryFil"
+  "terMessage.FaceQueryFilter\032\256\002\n\017FaceQuery"
+  "Filter\022\017\n\007face_id\030i \001(\004\022\023\n\nuri_scheme\030\203\001"
+  " \001(\t\022\013\n\003uri\030r \001(\t\022\022\n\tlocal_uri\030\201\001 \001(\t\022B\n"
+  "\nface_scope\030\204\001 \001(\0162-.ndn_message.FaceQue"
+  "ryFilterMessage.FaceScope\022N\n\020face_persis"
+  "tency\030\205\001 \001(\01623.ndn_message.FaceQueryFilt"
+  "erMessage.FacePersistency\022@\n\tlink_type\030\206"
+  "\001 \001(\0162,.ndn_message.FaceQueryFilterMessa"
+  "ge.LinkType\"%\n\tFaceScope\022\r\n\tNON_LOCAL\020\000\022"
+  "\t\n\005LOCAL\020\001\"\?\n\017FacePersistency\022\016\n\nPERSIST"
+  "ENT\020\000\022\r\n\tON_DEMAND\020\001\022\r\n\tPERMANENT\020\002\"0\n\010L"
+  "inkType\022\022\n\016POINT_TO_POINT\020\000\022\020\n\014MULTI_ACC"
+  "ESS\020\001"
+  ;
+static ::_pbi::once_flag descriptor_table_face_2dquery_2dfilter_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_face_2dquery_2dfilter_2eproto = {
+    false, false, 605, descriptor_table_protodef_face_2dquery_2dfilter_2eproto,
+    "face-query-filter.proto",
+    &descriptor_table_face_2dquery_2dfilter_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_face_2dquery_2dfilter_2eproto::offsets,
+    file_level_metadata_face_2dquery_2dfilter_2eproto, file_level_enum_descriptors_face_2dquery_2dfilter_2eproto,
+    file_level_service_descriptors_face_2dquery_2dfilter_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_face_2dquery_2dfilter_2eproto_getter() {
+  return &descriptor_table_face_2dquery_2dfilter_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_face_2dquery_2dfilter_2eproto(&descriptor_table_face_2dquery_2dfilter_2eproto);
+namespace ndn_message {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FaceQueryFilterMessage_FaceScope_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_face_2dquery_2dfilter_2eproto);
+  return file_level_enum_descriptors_face_2dquery_2dfilter_2eproto[0];
+}
+bool FaceQueryFilterMessage_FaceScope_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage::NON_LOCAL;
+constexpr FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage::LOCAL;
+constexpr FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage::FaceScope_MIN;
+constexpr FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage::FaceScope_MAX;
+constexpr int FaceQueryFilterMessage::FaceScope_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FaceQueryFilterMessage_FacePersistency_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_face_2dquery_2dfilter_2eproto);
+  return file_level_enum_descriptors_face_2dquery_2dfilter_2eproto[1];
+}
+bool FaceQueryFilterMessage_FacePersistency_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage::PERSISTENT;
+constexpr FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage::ON_DEMAND;
+constexpr FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage::PERMANENT;
+constexpr FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage::FacePersistency_MIN;
+constexpr FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage::FacePersistency_MAX;
+constexpr int FaceQueryFilterMessage::FacePersistency_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FaceQueryFilterMessage_LinkType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_face_2dquery_2dfilter_2eproto);
+  return file_level_enum_descriptors_face_2dquery_2dfilter_2eproto[2];
+}
+bool FaceQueryFilterMessage_LinkType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr FaceQueryFilterMessage_LinkType FaceQueryFilterMessage::POINT_TO_POINT;
+constexpr FaceQueryFilterMessage_LinkType FaceQueryFilterMessage::MULTI_ACCESS;
+constexpr FaceQueryFilterMessage_LinkType FaceQueryFilterMessage::LinkType_MIN;
+constexpr FaceQueryFilterMessage_LinkType FaceQueryFilterMessage::LinkType_MAX;
+constexpr int FaceQueryFilterMessage::LinkType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class FaceQueryFilterMessage_FaceQueryFilter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FaceQueryFilterMessage_FaceQueryFilter>()._impl_._has_bits_);
+  static void set_has_face_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_uri_scheme(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_uri(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_local_uri(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_face_scope(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_face_persistency(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_link_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+FaceQueryFilterMessage_FaceQueryFilter::FaceQueryFilterMessage_FaceQueryFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+}
+FaceQueryFilterMessage_FaceQueryFilter::FaceQueryFilterMessage_FaceQueryFilter(const FaceQueryFilterMessage_FaceQueryFilter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FaceQueryFilterMessage_FaceQueryFilter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uri_){}
+    , decltype(_impl_.local_uri_){}
+    , decltype(_impl_.uri_scheme_){}
+    , decltype(_impl_.face_id_){}
+    , decltype(_impl_.face_scope_){}
+    , decltype(_impl_.face_persistency_){}
+    , decltype(_impl_.link_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uri()) {
+    _this->_impl_.uri_.Set(from._internal_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_local_uri()) {
+    _this->_impl_.local_uri_.Set(from._internal_local_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.uri_scheme_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_scheme_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uri_scheme()) {
+    _this->_impl_.uri_scheme_.Set(from._internal_uri_scheme(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.face_id_, &from._impl_.face_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.link_type_) -
+    reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.link_type_));
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+}
+
+inline void FaceQueryFilterMessage_FaceQueryFilter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uri_){}
+    , decltype(_impl_.local_uri_){}
+    , decltype(_impl_.uri_scheme_){}
+    , decltype(_impl_.face_id_){uint64_t{0u}}
+    , decltype(_impl_.face_scope_){0}
+    , decltype(_impl_.face_persistency_){0}
+    , decltype(_impl_.link_type_){0}
+  };
+  _impl_.uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.uri_scheme_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_scheme_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FaceQueryFilterMessage_FaceQueryFilter::~FaceQueryFilterMessage_FaceQueryFilter() {
+  // @@protoc_insertion_point(destructor:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FaceQueryFilterMessage_FaceQueryFilter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uri_.Destroy();
+  _impl_.local_uri_.Destroy();
+  _impl_.uri_scheme_.Destroy();
+}
+
+void FaceQueryFilterMessage_FaceQueryFilter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FaceQueryFilterMessage_FaceQueryFilter::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.uri_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.local_uri_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.uri_scheme_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000078u) {
+    ::memset(&_impl_.face_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.link_type_) -
+        reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.link_type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FaceQueryFilterMessage_FaceQueryFilter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 face_id = 105;
+      case 105:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_face_id(&has_bits);
+          _impl_.face_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string uri = 114;
+      case 114:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string local_uri = 129;
+      case 129:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_local_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.FaceQueryFilterMessage.FaceQueryFilter.local_uri");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string uri_scheme = 131;
+      case 131:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_uri_scheme();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri_scheme");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ndn_message.FaceQueryFilterMessage.FaceScope face_scope = 132;
+      case 132:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ndn_message::FaceQueryFilterMessage_FaceScope_IsValid(val))) {
+            _internal_set_face_scope(static_cast<::ndn_message::FaceQueryFilterMessage_FaceScope>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(132, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ndn_message.FaceQueryFilterMessage.FacePersistency face_persistency = 133;
+      case 133:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ndn_message::FaceQueryFilterMessage_FacePersistency_IsValid(val))) {
+            _internal_set_face_persistency(static_cast<::ndn_message::FaceQueryFilterMessage_FacePersistency>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(133, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ndn_message.FaceQueryFilterMessage.LinkType link_type = 134;
+      case 134:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ndn_message::FaceQueryFilterMessage_LinkType_IsValid(val))) {
+            _internal_set_link_type(static_cast<::ndn_message::FaceQueryFilterMessage_LinkType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(134, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FaceQueryFilterMessage_FaceQueryFilter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 face_id = 105;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(105, this->_internal_face_id(), target);
+  }
+
+  // optional string uri = 114;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_uri().data(), static_cast<int>(this->_internal_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri");
+    target = stream->WriteStringMaybeAliased(
+        114, this->_internal_uri(), target);
+  }
+
+  // optional string local_uri = 129;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_local_uri().data(), static_cast<int>(this->_internal_local_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.FaceQueryFilterMessage.FaceQueryFilter.local_uri");
+    target = stream->WriteStringMaybeAliased(
+        129, this->_internal_local_uri(), target);
+  }
+
+  // optional string uri_scheme = 131;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_uri_scheme().data(), static_cast<int>(this->_internal_uri_scheme().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri_scheme");
+    target = stream->WriteStringMaybeAliased(
+        131, this->_internal_uri_scheme(), target);
+  }
+
+  // optional .ndn_message.FaceQueryFilterMessage.FaceScope face_scope = 132;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      132, this->_internal_face_scope(), target);
+  }
+
+  // optional .ndn_message.FaceQueryFilterMessage.FacePersistency face_persistency = 133;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      133, this->_internal_face_persistency(), target);
+  }
+
+  // optional .ndn_message.FaceQueryFilterMessage.LinkType link_type = 134;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      134, this->_internal_link_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+  return target;
+}
+
+size_t FaceQueryFilterMessage_FaceQueryFilter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional string uri = 114;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_uri());
+    }
+
+    // optional string local_uri = 129;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_local_uri());
+    }
+
+    // optional string uri_scheme = 131;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_uri_scheme());
+    }
+
+    // optional uint64 face_id = 105;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_face_id());
+    }
+
+    // optional .ndn_message.FaceQueryFilterMessage.FaceScope face_scope = 132;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_face_scope());
+    }
+
+    // optional .ndn_message.FaceQueryFilterMessage.FacePersistency face_persistency = 133;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_face_persistency());
+    }
+
+    // optional .ndn_message.FaceQueryFilterMessage.LinkType link_type = 134;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_link_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FaceQueryFilterMessage_FaceQueryFilter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FaceQueryFilterMessage_FaceQueryFilter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FaceQueryFilterMessage_FaceQueryFilter::GetClassData() const { return &_class_data_; }
+
+
+void FaceQueryFilterMessage_FaceQueryFilter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FaceQueryFilterMessage_FaceQueryFilter*>(&to_msg);
+  auto& from = static_cast<const FaceQueryFilterMessage_FaceQueryFilter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_uri(from._internal_uri());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_local_uri(from._internal_local_uri());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_uri_scheme(from._internal_uri_scheme());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.face_id_ = from._impl_.face_id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.face_scope_ = from._impl_.face_scope_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.face_persistency_ = from._impl_.face_persistency_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.link_type_ = from._impl_.link_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FaceQueryFilterMessage_FaceQueryFilter::CopyFrom(const FaceQueryFilterMessage_FaceQueryFilter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FaceQueryFilterMessage_FaceQueryFilter::IsInitialized() const {
+  return true;
+}
+
+void FaceQueryFilterMessage_FaceQueryFilter::InternalSwap(FaceQueryFilterMessage_FaceQueryFilter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uri_, lhs_arena,
+      &other->_impl_.uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.local_uri_, lhs_arena,
+      &other->_impl_.local_uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uri_scheme_, lhs_arena,
+      &other->_impl_.uri_scheme_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FaceQueryFilterMessage_FaceQueryFilter, _impl_.link_type_)
+      + sizeof(FaceQueryFilterMessage_FaceQueryFilter::_impl_.link_type_)
+      - PROTOBUF_FIELD_OFFSET(FaceQueryFilterMessage_FaceQueryFilter, _impl_.face_id_)>(
+          reinterpret_cast<char*>(&_impl_.face_id_),
+          reinterpret_cast<char*>(&other->_impl_.face_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FaceQueryFilterMessage_FaceQueryFilter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_face_2dquery_2dfilter_2eproto_getter, &descriptor_table_face_2dquery_2dfilter_2eproto_once,
+      file_level_metadata_face_2dquery_2dfilter_2eproto[0]);
+}
+
+// ===================================================================
+
+class FaceQueryFilterMessage::_Internal {
+ public:
+};
+
+FaceQueryFilterMessage::FaceQueryFilterMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FaceQueryFilterMessage)
+}
+FaceQueryFilterMessage::FaceQueryFilterMessage(const FaceQueryFilterMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FaceQueryFilterMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.face_query_filter_){from._impl_.face_query_filter_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FaceQueryFilterMessage)
+}
+
+inline void FaceQueryFilterMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.face_query_filter_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FaceQueryFilterMessage::~FaceQueryFilterMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.FaceQueryFilterMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FaceQueryFilterMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.face_query_filter_.~RepeatedPtrField();
+}
+
+void FaceQueryFilterMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FaceQueryFilterMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FaceQueryFilterMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.face_query_filter_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FaceQueryFilterMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ndn_message.FaceQueryFilterMessage.FaceQueryFilter face_query_filter = 150;
+      case 150:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_face_query_filter(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<1202>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FaceQueryFilterMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FaceQueryFilterMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.FaceQueryFilterMessage.FaceQueryFilter face_query_filter = 150;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_face_query_filter_size()); i < n; i++) {
+    const auto& repfield = this->_internal_face_query_filter(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(150, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FaceQueryFilterMessage)
+  return target;
+}
+
+size_t FaceQueryFilterMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FaceQueryFilterMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.FaceQueryFilterMessage.FaceQueryFilter face_query_filter = 150;
+  total_size += 2UL * this->_internal_face_query_filter_size();
+  for (const auto& msg : this->_impl_.face_query_filter_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FaceQueryFilterMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FaceQueryFilterMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FaceQueryFilterMessage::GetClassData() const { return &_class_data_; }
+
+
+void FaceQueryFilterMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FaceQueryFilterMessage*>(&to_msg);
+  auto& from = static_cast<const FaceQueryFilterMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FaceQueryFilterMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.face_query_filter_.MergeFrom(from._impl_.face_query_filter_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FaceQueryFilterMessage::CopyFrom(const FaceQueryFilterMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FaceQueryFilterMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FaceQueryFilterMessage::IsInitialized() const {
+  return true;
+}
+
+void FaceQueryFilterMessage::InternalSwap(FaceQueryFilterMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.face_query_filter_.InternalSwap(&other->_impl_.face_query_filter_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FaceQueryFilterMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_face_2dquery_2dfilter_2eproto_getter, &descriptor_table_face_2dquery_2dfilter_2eproto_once,
+      file_level_metadata_face_2dquery_2dfilter_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter*
+Arena::CreateMaybeMessage< ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::FaceQueryFilterMessage*
+Arena::CreateMaybeMessage< ::ndn_message::FaceQueryFilterMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FaceQueryFilterMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1062 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: face-query-filter.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_face_2dquery_2dfilter_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_face_2dquery_2dfilter_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_face_2dquery_2dfilter_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_face_2dquery_2dfilter_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_face_2dquery_2dfilter_2eproto;
+namespace ndn_message {
+class FaceQueryFilterMessage;
+struct FaceQueryFilterMessageDefaultTypeInternal;
+extern FaceQueryFilterMessageDefaultTypeInternal _FaceQueryFilterMessage_default_instance_;
+class FaceQueryFilterMessage_FaceQueryFilter;
+struct FaceQueryFilterMessage_FaceQueryFilterDefaultTypeInternal;
+extern FaceQueryFilterMessage_FaceQueryFilterDefaultTypeInternal _FaceQueryFilterMessage_FaceQueryFilter_default_instance_;
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ndn_message::FaceQueryFilterMessage* Arena::CreateMaybeMessage<::ndn_message::FaceQueryFilterMessage>(Arena*);
+template<> ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* Arena::CreateMaybeMessage<::ndn_message::FaceQueryFilterMessage_FaceQueryFilter>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ndn_message {
+
+enum FaceQueryFilterMessage_FaceScope : int {
+  FaceQueryFilterMessage_FaceScope_NON_LOCAL = 0,
+  FaceQueryFilterMessage_FaceScope_LOCAL = 1
+};
+bool FaceQueryFilterMessage_FaceScope_IsValid(int value);
+constexpr FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage_FaceScope_FaceScope_MIN = FaceQueryFilterMessage_FaceScope_NON_LOCAL;
+constexpr FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage_FaceScope_FaceScope_MAX = FaceQueryFilterMessage_FaceScope_LOCAL;
+constexpr int FaceQueryFilterMessage_FaceScope_FaceScope_ARRAYSIZE = FaceQueryFilterMessage_FaceScope_FaceScope_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FaceQueryFilterMessage_FaceScope_descriptor();
+template<typename T>
+inline const std::string& FaceQueryFilterMessage_FaceScope_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FaceQueryFilterMessage_FaceScope>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FaceQueryFilterMessage_FaceScope_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FaceQueryFilterMessage_FaceScope_descriptor(), enum_t_value);
+}
+inline bool FaceQueryFilterMessage_FaceScope_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FaceQueryFilterMessage_FaceScope* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FaceQueryFilterMessage_FaceScope>(
+    FaceQueryFilterMessage_FaceScope_descriptor(), name, value);
+}
+enum FaceQueryFilterMessage_FacePersistency : int {
+  FaceQueryFilterMessage_FacePersistency_PERSISTENT = 0,
+  FaceQueryFilterMessage_FacePersistency_ON_DEMAND = 1,
+  FaceQueryFilterMessage_FacePersistency_PERMANENT = 2
+};
+bool FaceQueryFilterMessage_FacePersistency_IsValid(int value);
+constexpr FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage_FacePersistency_FacePersistency_MIN = FaceQueryFilterMessage_FacePersistency_PERSISTENT;
+constexpr FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage_FacePersistency_FacePersistency_MAX = FaceQueryFilterMessage_FacePersistency_PERMANENT;
+constexpr int FaceQueryFilterMessage_FacePersistency_FacePersistency_ARRAYSIZE = FaceQueryFilterMessage_FacePersistency_FacePersistency_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FaceQueryFilterMessage_FacePersistency_descriptor();
+template<typename T>
+inline const std::string& FaceQueryFilterMessage_FacePersistency_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FaceQueryFilterMessage_FacePersistency>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FaceQueryFilterMessage_FacePersistency_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FaceQueryFilterMessage_FacePersistency_descriptor(), enum_t_value);
+}
+inline bool FaceQueryFilterMessage_FacePersistency_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FaceQueryFilterMessage_FacePersistency* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FaceQueryFilterMessage_FacePersistency>(
+    FaceQueryFilterMessage_FacePersistency_descriptor(), name, value);
+}
+enum FaceQueryFilterMessage_LinkType : int {
+  FaceQueryFilterMessage_LinkType_POINT_TO_POINT = 0,
+  FaceQueryFilterMessage_LinkType_MULTI_ACCESS = 1
+};
+bool FaceQueryFilterMessage_LinkType_IsValid(int value);
+constexpr FaceQueryFilterMessage_LinkType FaceQueryFilterMessage_LinkType_LinkType_MIN = FaceQueryFilterMessage_LinkType_POINT_TO_POINT;
+constexpr FaceQueryFilterMessage_LinkType FaceQueryFilterMessage_LinkType_LinkType_MAX = FaceQueryFilterMessage_LinkType_MULTI_ACCESS;
+constexpr int FaceQueryFilterMessage_LinkType_LinkType_ARRAYSIZE = FaceQueryFilterMessage_LinkType_LinkType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FaceQueryFilterMessage_LinkType_descriptor();
+template<typename T>
+inline const std::string& FaceQueryFilterMessage_LinkType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FaceQueryFilterMessage_LinkType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FaceQueryFilterMessage_LinkType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FaceQueryFilterMessage_LinkType_descriptor(), enum_t_value);
+}
+inline bool FaceQueryFilterMessage_LinkType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FaceQueryFilterMessage_LinkType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FaceQueryFilterMessage_LinkType>(
+    FaceQueryFilterMessage_LinkType_descriptor(), name, value);
+}
+// ===================================================================
+
+class FaceQueryFilterMessage_FaceQueryFilter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FaceQueryFilterMessage.FaceQueryFilter) */ {
+ public:
+  inline FaceQueryFilterMessage_FaceQueryFilter() : FaceQueryFilterMessage_FaceQueryFilter(nullptr) {}
+  ~FaceQueryFilterMessage_FaceQueryFilter() override;
+  explicit PROTOBUF_CONSTEXPR FaceQueryFilterMessage_FaceQueryFilter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FaceQueryFilterMessage_FaceQueryFilter(const FaceQueryFilterMessage_FaceQueryFilter& from);
+  FaceQueryFilterMessage_FaceQueryFilter(FaceQueryFilterMessage_FaceQueryFilter&& from) noexcept
+    : FaceQueryFilterMessage_FaceQueryFilter() {
+    *this = ::std::move(from);
+  }
+
+  inline FaceQueryFilterMessage_FaceQueryFilter& operator=(const FaceQueryFilterMessage_FaceQueryFilter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FaceQueryFilterMessage_FaceQueryFilter& operator=(FaceQueryFilterMessage_FaceQueryFilter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FaceQueryFilterMessage_FaceQueryFilter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FaceQueryFilterMessage_FaceQueryFilter* internal_default_instance() {
+    return reinterpret_cast<const FaceQueryFilterMessage_FaceQueryFilter*>(
+               &_FaceQueryFilterMessage_FaceQueryFilter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(FaceQueryFilterMessage_FaceQueryFilter& a, FaceQueryFilterMessage_FaceQueryFilter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FaceQueryFilterMessage_FaceQueryFilter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FaceQueryFilterMessage_FaceQueryFilter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FaceQueryFilterMessage_FaceQueryFilter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FaceQueryFilterMessage_FaceQueryFilter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FaceQueryFilterMessage_FaceQueryFilter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FaceQueryFilterMessage_FaceQueryFilter& from) {
+    FaceQueryFilterMessage_FaceQueryFilter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FaceQueryFilterMessage_FaceQueryFilter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FaceQueryFilterMessage.FaceQueryFilter";
+  }
+  protected:
+  explicit FaceQueryFilterMessage_FaceQueryFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUriFieldNumber = 114,
+    kLocalUriFieldNumber = 129,
+    kUriSchemeFieldNumber = 131,
+    kFaceIdFieldNumber = 105,
+    kFaceScopeFieldNumber = 132,
+    kFacePersistencyFieldNumber = 133,
+    kLinkTypeFieldNumber = 134,
+  };
+  // optional string uri = 114;
+  bool has_uri() const;
+  private:
+  bool _internal_has_uri() const;
+  public:
+  void clear_uri();
+  const std::string& uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri();
+  PROTOBUF_NODISCARD std::string* release_uri();
+  void set_allocated_uri(std::string* uri);
+  private:
+  const std::string& _internal_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri(const std::string& value);
+  std::string* _internal_mutable_uri();
+  public:
+
+  // optional string local_uri = 129;
+  bool has_local_uri() const;
+  private:
+  bool _internal_has_local_uri() const;
+  public:
+  void clear_local_uri();
+  const std::string& local_uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_local_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_local_uri();
+  PROTOBUF_NODISCARD std::string* release_local_uri();
+  void set_allocated_local_uri(std::string* local_uri);
+  private:
+  const std::string& _internal_local_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_local_uri(const std::string& value);
+  std::string* _internal_mutable_local_uri();
+  public:
+
+  // optional string uri_scheme = 131;
+  bool has_uri_scheme() const;
+  private:
+  bool _internal_has_uri_scheme() const;
+  public:
+  void clear_uri_scheme();
+  const std::string& uri_scheme() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri_scheme(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri_scheme();
+  PROTOBUF_NODISCARD std::string* release_uri_scheme();
+  void set_allocated_uri_scheme(std::string* uri_scheme);
+  private:
+  const std::string& _internal_uri_scheme() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri_scheme(const std::string& value);
+  std::string* _internal_mutable_uri_scheme();
+  public:
+
+  // optional uint64 face_id = 105;
+  bool has_face_id() const;
+  private:
+  bool _internal_has_face_id() const;
+  public:
+  void clear_face_id();
+  uint64_t face_id() const;
+  void set_face_id(uint64_t value);
+  private:
+  uint64_t _internal_face_id() const;
+  void _internal_set_face_id(uint64_t value);
+  public:
+
+  // optional .ndn_message.FaceQueryFilterMessage.FaceScope face_scope = 132;
+  bool has_face_scope() const;
+  private:
+  bool _internal_has_face_scope() const;
+  public:
+  void clear_face_scope();
+  ::ndn_message::FaceQueryFilterMessage_FaceScope face_scope() const;
+  void set_face_scope(::ndn_message::FaceQueryFilterMessage_FaceScope value);
+  private:
+  ::ndn_message::FaceQueryFilterMessage_FaceScope _internal_face_scope() const;
+  void _internal_set_face_scope(::ndn_message::FaceQueryFilterMessage_FaceScope value);
+  public:
+
+  // optional .ndn_message.FaceQueryFilterMessage.FacePersistency face_persistency = 133;
+  bool has_face_persistency() const;
+  private:
+  bool _internal_has_face_persistency() const;
+  public:
+  void clear_face_persistency();
+  ::ndn_message::FaceQueryFilterMessage_FacePersistency face_persistency() const;
+  void set_face_persistency(::ndn_message::FaceQueryFilterMessage_FacePersistency value);
+  private:
+  ::ndn_message::FaceQueryFilterMessage_FacePersistency _internal_face_persistency() const;
+  void _internal_set_face_persistency(::ndn_message::FaceQueryFilterMessage_FacePersistency value);
+  public:
+
+  // optional .ndn_message.FaceQueryFilterMessage.LinkType link_type = 134;
+  bool has_link_type() const;
+  private:
+  bool _internal_has_link_type() const;
+  public:
+  void clear_link_type();
+  ::ndn_message::FaceQueryFilterMessage_LinkType link_type() const;
+  void set_link_type(::ndn_message::FaceQueryFilterMessage_LinkType value);
+  private:
+  ::ndn_message::FaceQueryFilterMessage_LinkType _internal_link_type() const;
+  void _internal_set_link_type(::ndn_message::FaceQueryFilterMessage_LinkType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FaceQueryFilterMessage.FaceQueryFilter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr local_uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_scheme_;
+    uint64_t face_id_;
+    int face_scope_;
+    int face_persistency_;
+    int link_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_face_2dquery_2dfilter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FaceQueryFilterMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FaceQueryFilterMessage) */ {
+ public:
+  inline FaceQueryFilterMessage() : FaceQueryFilterMessage(nullptr) {}
+  ~FaceQueryFilterMessage() override;
+  explicit PROTOBUF_CONSTEXPR FaceQueryFilterMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FaceQueryFilterMessage(const FaceQueryFilterMessage& from);
+  FaceQueryFilterMessage(FaceQueryFilterMessage&& from) noexcept
+    : FaceQueryFilterMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FaceQueryFilterMessage& operator=(const FaceQueryFilterMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FaceQueryFilterMessage& operator=(FaceQueryFilterMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FaceQueryFilterMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FaceQueryFilterMessage* internal_default_instance() {
+    return reinterpret_cast<const FaceQueryFilterMessage*>(
+               &_FaceQueryFilterMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(FaceQueryFilterMessage& a, FaceQueryFilterMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FaceQueryFilterMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FaceQueryFilterMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FaceQueryFilterMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FaceQueryFilterMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FaceQueryFilterMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FaceQueryFilterMessage& from) {
+    FaceQueryFilterMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FaceQueryFilterMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FaceQueryFilterMessage";
+  }
+  protected:
+  explicit FaceQueryFilterMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef FaceQueryFilterMessage_FaceQueryFilter FaceQueryFilter;
+
+  typedef FaceQueryFilterMessage_FaceScope FaceScope;
+  static constexpr FaceScope NON_LOCAL =
+    FaceQueryFilterMessage_FaceScope_NON_LOCAL;
+  static constexpr FaceScope LOCAL =
+    FaceQueryFilterMessage_FaceScope_LOCAL;
+  static inline bool FaceScope_IsValid(int value) {
+    return FaceQueryFilterMessage_FaceScope_IsValid(value);
+  }
+  static constexpr FaceScope FaceScope_MIN =
+    FaceQueryFilterMessage_FaceScope_FaceScope_MIN;
+  static constexpr FaceScope FaceScope_MAX =
+    FaceQueryFilterMessage_FaceScope_FaceScope_MAX;
+  static constexpr int FaceScope_ARRAYSIZE =
+    FaceQueryFilterMessage_FaceScope_FaceScope_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  FaceScope_descriptor() {
+    return FaceQueryFilterMessage_FaceScope_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& FaceScope_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, FaceScope>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function FaceScope_Name.");
+    return FaceQueryFilterMessage_FaceScope_Name(enum_t_value);
+  }
+  static inline bool FaceScope_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      FaceScope* value) {
+    return FaceQueryFilterMessage_FaceScope_Parse(name, value);
+  }
+
+  typedef FaceQueryFilterMessage_FacePersistency FacePersistency;
+  static constexpr FacePersistency PERSISTENT =
+    FaceQueryFilterMessage_FacePersistency_PERSISTENT;
+  static constexpr FacePersistency ON_DEMAND =
+    FaceQueryFilterMessage_FacePersistency_ON_DEMAND;
+  static constexpr FacePersistency PERMANENT =
+    FaceQueryFilterMessage_FacePersistency_PERMANENT;
+  static inline bool FacePersistency_IsValid(int value) {
+    return FaceQueryFilterMessage_FacePersistency_IsValid(value);
+  }
+  static constexpr FacePersistency FacePersistency_MIN =
+    FaceQueryFilterMessage_FacePersistency_FacePersistency_MIN;
+  static constexpr FacePersistency FacePersistency_MAX =
+    FaceQueryFilterMessage_FacePersistency_FacePersistency_MAX;
+  static constexpr int FacePersistency_ARRAYSIZE =
+    FaceQueryFilterMessage_FacePersistency_FacePersistency_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  FacePersistency_descriptor() {
+    return FaceQueryFilterMessage_FacePersistency_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& FacePersistency_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, FacePersistency>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function FacePersistency_Name.");
+    return FaceQueryFilterMessage_FacePersistency_Name(enum_t_value);
+  }
+  static inline bool FacePersistency_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      FacePersistency* value) {
+    return FaceQueryFilterMessage_FacePersistency_Parse(name, value);
+  }
+
+  typedef FaceQueryFilterMessage_LinkType LinkType;
+  static constexpr LinkType POINT_TO_POINT =
+    FaceQueryFilterMessage_LinkType_POINT_TO_POINT;
+  static constexpr LinkType MULTI_ACCESS =
+    FaceQueryFilterMessage_LinkType_MULTI_ACCESS;
+  static inline bool LinkType_IsValid(int value) {
+    return FaceQueryFilterMessage_LinkType_IsValid(value);
+  }
+  static constexpr LinkType LinkType_MIN =
+    FaceQueryFilterMessage_LinkType_LinkType_MIN;
+  static constexpr LinkType LinkType_MAX =
+    FaceQueryFilterMessage_LinkType_LinkType_MAX;
+  static constexpr int LinkType_ARRAYSIZE =
+    FaceQueryFilterMessage_LinkType_LinkType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  LinkType_descriptor() {
+    return FaceQueryFilterMessage_LinkType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& LinkType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, LinkType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function LinkType_Name.");
+    return FaceQueryFilterMessage_LinkType_Name(enum_t_value);
+  }
+  static inline bool LinkType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      LinkType* value) {
+    return FaceQueryFilterMessage_LinkType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFaceQueryFilterFieldNumber = 150,
+  };
+  // repeated .ndn_message.FaceQueryFilterMessage.FaceQueryFilter face_query_filter = 150;
+  int face_query_filter_size() const;
+  private:
+  int _internal_face_query_filter_size() const;
+  public:
+  void clear_face_query_filter();
+  ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* mutable_face_query_filter(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter >*
+      mutable_face_query_filter();
+  private:
+  const ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter& _internal_face_query_filter(int index) const;
+  ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* _internal_add_face_query_filter();
+  public:
+  const ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter& face_query_filter(int index) const;
+  ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* add_face_query_filter();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter >&
+      face_query_filter() const;
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FaceQueryFilterMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter > face_query_filter_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_face_2dquery_2dfilter_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// FaceQueryFilterMessage_FaceQueryFilter
+
+// optional uint64 face_id = 105;
+inline bool FaceQueryFilterMessage_FaceQueryFilter::_internal_has_face_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool FaceQueryFilterMessage_FaceQueryFilter::has_face_id() const {
+  return _internal_has_face_id();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::clear_face_id() {
+  _impl_.face_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t FaceQueryFilterMessage_FaceQueryFilter::_internal_face_id() const {
+  return _impl_.face_id_;
+}
+inline uint64_t FaceQueryFilterMessage_FaceQueryFilter::face_id() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.face_id)
+  return _internal_face_id();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::_internal_set_face_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.face_id_ = value;
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::set_face_id(uint64_t value) {
+  _internal_set_face_id(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.face_id)
+}
+
+// optional string uri_scheme = 131;
+inline bool FaceQueryFilterMessage_FaceQueryFilter::_internal_has_uri_scheme() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool FaceQueryFilterMessage_FaceQueryFilter::has_uri_scheme() const {
+  return _internal_has_uri_scheme();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::clear_uri_scheme() {
+  _impl_.uri_scheme_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& FaceQueryFilterMessage_FaceQueryFilter::uri_scheme() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri_scheme)
+  return _internal_uri_scheme();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FaceQueryFilterMessage_FaceQueryFilter::set_uri_scheme(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.uri_scheme_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri_scheme)
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::mutable_uri_scheme() {
+  std::string* _s = _internal_mutable_uri_scheme();
+  // @@protoc_insertion_point(field_mutable:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri_scheme)
+  return _s;
+}
+inline const std::string& FaceQueryFilterMessage_FaceQueryFilter::_internal_uri_scheme() const {
+  return _impl_.uri_scheme_.Get();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::_internal_set_uri_scheme(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.uri_scheme_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::_internal_mutable_uri_scheme() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.uri_scheme_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::release_uri_scheme() {
+  // @@protoc_insertion_point(field_release:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri_scheme)
+  if (!_internal_has_uri_scheme()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.uri_scheme_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_scheme_.IsDefault()) {
+    _impl_.uri_scheme_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::set_allocated_uri_scheme(std::string* uri_scheme) {
+  if (uri_scheme != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.uri_scheme_.SetAllocated(uri_scheme, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_scheme_.IsDefault()) {
+    _impl_.uri_scheme_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri_scheme)
+}
+
+// optional string uri = 114;
+inline bool FaceQueryFilterMessage_FaceQueryFilter::_internal_has_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FaceQueryFilterMessage_FaceQueryFilter::has_uri() const {
+  return _internal_has_uri();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::clear_uri() {
+  _impl_.uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& FaceQueryFilterMessage_FaceQueryFilter::uri() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri)
+  return _internal_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FaceQueryFilterMessage_FaceQueryFilter::set_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri)
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::mutable_uri() {
+  std::string* _s = _internal_mutable_uri();
+  // @@protoc_insertion_point(field_mutable:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri)
+  return _s;
+}
+inline const std::string& FaceQueryFilterMessage_FaceQueryFilter::_internal_uri() const {
+  return _impl_.uri_.Get();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::_internal_set_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::_internal_mutable_uri() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::release_uri() {
+  // @@protoc_insertion_point(field_release:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri)
+  if (!_internal_has_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::set_allocated_uri(std::string* uri) {
+  if (uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.uri_.SetAllocated(uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.uri)
+}
+
+// optional string local_uri = 129;
+inline bool FaceQueryFilterMessage_FaceQueryFilter::_internal_has_local_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool FaceQueryFilterMessage_FaceQueryFilter::has_local_uri() const {
+  return _internal_has_local_uri();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::clear_local_uri() {
+  _impl_.local_uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& FaceQueryFilterMessage_FaceQueryFilter::local_uri() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.local_uri)
+  return _internal_local_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FaceQueryFilterMessage_FaceQueryFilter::set_local_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.local_uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.local_uri)
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::mutable_local_uri() {
+  std::string* _s = _internal_mutable_local_uri();
+  // @@protoc_insertion_point(field_mutable:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.local_uri)
+  return _s;
+}
+inline const std::string& FaceQueryFilterMessage_FaceQueryFilter::_internal_local_uri() const {
+  return _impl_.local_uri_.Get();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::_internal_set_local_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.local_uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::_internal_mutable_local_uri() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.local_uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FaceQueryFilterMessage_FaceQueryFilter::release_local_uri() {
+  // @@protoc_insertion_point(field_release:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.local_uri)
+  if (!_internal_has_local_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.local_uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::set_allocated_local_uri(std::string* local_uri) {
+  if (local_uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.local_uri_.SetAllocated(local_uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.local_uri)
+}
+
+// optional .ndn_message.FaceQueryFilterMessage.FaceScope face_scope = 132;
+inline bool FaceQueryFilterMessage_FaceQueryFilter::_internal_has_face_scope() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool FaceQueryFilterMessage_FaceQueryFilter::has_face_scope() const {
+  return _internal_has_face_scope();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::clear_face_scope() {
+  _impl_.face_scope_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::ndn_message::FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage_FaceQueryFilter::_internal_face_scope() const {
+  return static_cast< ::ndn_message::FaceQueryFilterMessage_FaceScope >(_impl_.face_scope_);
+}
+inline ::ndn_message::FaceQueryFilterMessage_FaceScope FaceQueryFilterMessage_FaceQueryFilter::face_scope() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.face_scope)
+  return _internal_face_scope();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::_internal_set_face_scope(::ndn_message::FaceQueryFilterMessage_FaceScope value) {
+  assert(::ndn_message::FaceQueryFilterMessage_FaceScope_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.face_scope_ = value;
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::set_face_scope(::ndn_message::FaceQueryFilterMessage_FaceScope value) {
+  _internal_set_face_scope(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.face_scope)
+}
+
+// optional .ndn_message.FaceQueryFilterMessage.FacePersistency face_persistency = 133;
+inline bool FaceQueryFilterMessage_FaceQueryFilter::_internal_has_face_persistency() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool FaceQueryFilterMessage_FaceQueryFilter::has_face_persistency() const {
+  return _internal_has_face_persistency();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::clear_face_persistency() {
+  _impl_.face_persistency_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::ndn_message::FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage_FaceQueryFilter::_internal_face_persistency() const {
+  return static_cast< ::ndn_message::FaceQueryFilterMessage_FacePersistency >(_impl_.face_persistency_);
+}
+inline ::ndn_message::FaceQueryFilterMessage_FacePersistency FaceQueryFilterMessage_FaceQueryFilter::face_persistency() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.face_persistency)
+  return _internal_face_persistency();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::_internal_set_face_persistency(::ndn_message::FaceQueryFilterMessage_FacePersistency value) {
+  assert(::ndn_message::FaceQueryFilterMessage_FacePersistency_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.face_persistency_ = value;
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::set_face_persistency(::ndn_message::FaceQueryFilterMessage_FacePersistency value) {
+  _internal_set_face_persistency(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.face_persistency)
+}
+
+// optional .ndn_message.FaceQueryFilterMessage.LinkType link_type = 134;
+inline bool FaceQueryFilterMessage_FaceQueryFilter::_internal_has_link_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool FaceQueryFilterMessage_FaceQueryFilter::has_link_type() const {
+  return _internal_has_link_type();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::clear_link_type() {
+  _impl_.link_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::ndn_message::FaceQueryFilterMessage_LinkType FaceQueryFilterMessage_FaceQueryFilter::_internal_link_type() const {
+  return static_cast< ::ndn_message::FaceQueryFilterMessage_LinkType >(_impl_.link_type_);
+}
+inline ::ndn_message::FaceQueryFilterMessage_LinkType FaceQueryFilterMessage_FaceQueryFilter::link_type() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.link_type)
+  return _internal_link_type();
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::_internal_set_link_type(::ndn_message::FaceQueryFilterMessage_LinkType value) {
+  assert(::ndn_message::FaceQueryFilterMessage_LinkType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.link_type_ = value;
+}
+inline void FaceQueryFilterMessage_FaceQueryFilter::set_link_type(::ndn_message::FaceQueryFilterMessage_LinkType value) {
+  _internal_set_link_type(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceQueryFilterMessage.FaceQueryFilter.link_type)
+}
+
+// -------------------------------------------------------------------
+
+// FaceQueryFilterMessage
+
+// repeated .ndn_message.FaceQueryFilterMessage.FaceQueryFilter face_query_filter = 150;
+inline int FaceQueryFilterMessage::_internal_face_query_filter_size() const {
+  return _impl_.face_query_filter_.size();
+}
+inline int FaceQueryFilterMessage::face_query_filter_size() const {
+  return _internal_face_query_filter_size();
+}
+inline void FaceQueryFilterMessage::clear_face_query_filter() {
+  _impl_.face_query_filter_.Clear();
+}
+inline ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* FaceQueryFilterMessage::mutable_face_query_filter(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.FaceQueryFilterMessage.face_query_filter)
+  return _impl_.face_query_filter_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter >*
+FaceQueryFilterMessage::mutable_face_query_filter() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.FaceQueryFilterMessage.face_query_filter)
+  return &_impl_.face_query_filter_;
+}
+inline const ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter& FaceQueryFilterMessage::_internal_face_query_filter(int index) const {
+  return _impl_.face_query_filter_.Get(index);
+}
+inline const ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter& FaceQueryFilterMessage::face_query_filter(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceQueryFilterMessage.face_query_filter)
+  return _internal_face_query_filter(index);
+}
+inline ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* FaceQueryFilterMessage::_internal_add_face_query_filter() {
+  return _impl_.face_query_filter_.Add();
+}
+inline ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* FaceQueryFilterMessage::add_face_query_filter() {
+  ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter* _add = _internal_add_face_query_filter();
+  // @@protoc_insertion_point(field_add:ndn_message.FaceQueryFilterMessage.face_query_filter)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceQueryFilterMessage_FaceQueryFilter >&
+FaceQueryFilterMessage::face_query_filter() const {
+  // @@protoc_insertion_point(field_list:ndn_message.FaceQueryFilterMessage.face_query_filter)
+  return _impl_.face_query_filter_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ndn_message
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ndn_message::FaceQueryFilterMessage_FaceScope> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ndn_message::FaceQueryFilterMessage_FaceScope>() {
+  return ::ndn_message::FaceQueryFilterMessage_FaceScope_descriptor();
+}
+template <> struct is_proto_enum< ::ndn_message::FaceQueryFilterMessage_FacePersistency> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ndn_message::FaceQueryFilterMessage_FacePersistency>() {
+  return ::ndn_message::FaceQueryFilterMessage_FacePersistency_descriptor();
+}
+template <> struct is_proto_enum< ::ndn_message::FaceQueryFilterMessage_LinkType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ndn_message::FaceQueryFilterMessage_LinkType>() {
+  return ::ndn_message::FaceQueryFilterMessage_LinkType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_face_2dquery_2dfilter_2eproto
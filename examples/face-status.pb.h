@@ -0,0 +1,1350 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: face-status.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_face_2dstatus_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_face_2dstatus_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_face_2dstatus_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_face_2dstatus_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_face_2dstatus_2eproto;
+namespace ndn_message {
+class FaceStatusMessage;
+struct FaceStatusMessageDefaultTypeInternal;
+extern FaceStatusMessageDefaultTypeInternal _FaceStatusMessage_default_instance_;
+class FaceStatusMessage_FaceStatus;
+struct FaceStatusMessage_FaceStatusDefaultTypeInternal;
+extern FaceStatusMessage_FaceStatusDefaultTypeInternal _FaceStatusMessage_FaceStatus_default_instance_;
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ndn_message::FaceStatusMessage* Arena::CreateMaybeMessage<::ndn_message::FaceStatusMessage>(Arena*);
+template<> ::ndn_message::FaceStatusMessage_FaceStatus* Arena::CreateMaybeMessage<::ndn_message::FaceStatusMessage_FaceStatus>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ndn_message {
+
+// ===================================================================
+
+class FaceStatusMessage_FaceStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FaceStatusMessage.FaceStatus) */ {
+ public:
+  inline FaceStatusMessage_FaceStatus() : FaceStatusMessage_FaceStatus(nullptr) {}
+  ~FaceStatusMessage_FaceStatus() override;
+  explicit PROTOBUF_CONSTEXPR FaceStatusMessage_FaceStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FaceStatusMessage_FaceStatus(const FaceStatusMessage_FaceStatus& from);
+  FaceStatusMessage_FaceStatus(FaceStatusMessage_FaceStatus&& from) noexcept
+    : FaceStatusMessage_FaceStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline FaceStatusMessage_FaceStatus& operator=(const FaceStatusMessage_FaceStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FaceStatusMessage_FaceStatus& operator=(FaceStatusMessage_FaceStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FaceStatusMessage_FaceStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FaceStatusMessage_FaceStatus* internal_default_instance() {
+    return reinterpret_cast<const FaceStatusMessage_FaceStatus*>(
+               &_FaceStatusMessage_FaceStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(FaceStatusMessage_FaceStatus& a, FaceStatusMessage_FaceStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FaceStatusMessage_FaceStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FaceStatusMessage_FaceStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FaceStatusMessage_FaceStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FaceStatusMessage_FaceStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FaceStatusMessage_FaceStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FaceStatusMessage_FaceStatus& from) {
+    FaceStatusMessage_FaceStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FaceStatusMessage_FaceStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FaceStatusMessage.FaceStatus";
+  }
+  protected:
+  explicit FaceStatusMessage_FaceStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUriFieldNumber = 114,
+    kLocalUriFieldNumber = 129,
+    kFaceIdFieldNumber = 105,
+    kFlagsFieldNumber = 108,
+    kExpirationPeriodFieldNumber = 109,
+    kFaceScopeFieldNumber = 132,
+    kFacePersistencyFieldNumber = 133,
+    kLinkTypeFieldNumber = 134,
+    kBaseCongestionMarkingIntervalFieldNumber = 135,
+    kDefaultCongestionThresholdFieldNumber = 136,
+    kMtuFieldNumber = 137,
+    kNInInterestsFieldNumber = 144,
+    kNInDatasFieldNumber = 145,
+    kNOutInterestsFieldNumber = 146,
+    kNOutDatasFieldNumber = 147,
+    kNInBytesFieldNumber = 148,
+    kNOutBytesFieldNumber = 149,
+    kNInNacksFieldNumber = 151,
+    kNOutNacksFieldNumber = 152,
+  };
+  // required string uri = 114;
+  bool has_uri() const;
+  private:
+  bool _internal_has_uri() const;
+  public:
+  void clear_uri();
+  const std::string& uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri();
+  PROTOBUF_NODISCARD std::string* release_uri();
+  void set_allocated_uri(std::string* uri);
+  private:
+  const std::string& _internal_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri(const std::string& value);
+  std::string* _internal_mutable_uri();
+  public:
+
+  // required string local_uri = 129;
+  bool has_local_uri() const;
+  private:
+  bool _internal_has_local_uri() const;
+  public:
+  void clear_local_uri();
+  const std::string& local_uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_local_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_local_uri();
+  PROTOBUF_NODISCARD std::string* release_local_uri();
+  void set_allocated_local_uri(std::string* local_uri);
+  private:
+  const std::string& _internal_local_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_local_uri(const std::string& value);
+  std::string* _internal_mutable_local_uri();
+  public:
+
+  // required uint64 face_id = 105;
+  bool has_face_id() const;
+  private:
+  bool _internal_has_face_id() const;
+  public:
+  void clear_face_id();
+  uint64_t face_id() const;
+  void set_face_id(uint64_t value);
+  private:
+  uint64_t _internal_face_id() const;
+  void _internal_set_face_id(uint64_t value);
+  public:
+
+  // required uint64 flags = 108;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  uint64_t flags() const;
+  void set_flags(uint64_t value);
+  private:
+  uint64_t _internal_flags() const;
+  void _internal_set_flags(uint64_t value);
+  public:
+
+  // optional uint64 expiration_period = 109;
+  bool has_expiration_period() const;
+  private:
+  bool _internal_has_expiration_period() const;
+  public:
+  void clear_expiration_period();
+  uint64_t expiration_period() const;
+  void set_expiration_period(uint64_t value);
+  private:
+  uint64_t _internal_expiration_period() const;
+  void _internal_set_expiration_period(uint64_t value);
+  public:
+
+  // required uint64 face_scope = 132;
+  bool has_face_scope() const;
+  private:
+  bool _internal_has_face_scope() const;
+  public:
+  void clear_face_scope();
+  uint64_t face_scope() const;
+  void set_face_scope(uint64_t value);
+  private:
+  uint64_t _internal_face_scope() const;
+  void _internal_set_face_scope(uint64_t value);
+  public:
+
+  // required uint64 face_persistency = 133;
+  bool has_face_persistency() const;
+  private:
+  bool _internal_has_face_persistency() const;
+  public:
+  void clear_face_persistency();
+  uint64_t face_persistency() const;
+  void set_face_persistency(uint64_t value);
+  private:
+  uint64_t _internal_face_persistency() const;
+  void _internal_set_face_persistency(uint64_t value);
+  public:
+
+  // required uint64 link_type = 134;
+  bool has_link_type() const;
+  private:
+  bool _internal_has_link_type() const;
+  public:
+  void clear_link_type();
+  uint64_t link_type() const;
+  void set_link_type(uint64_t value);
+  private:
+  uint64_t _internal_link_type() const;
+  void _internal_set_link_type(uint64_t value);
+  public:
+
+  // optional uint64 base_congestion_marking_interval = 135;
+  bool has_base_congestion_marking_interval() const;
+  private:
+  bool _internal_has_base_congestion_marking_interval() const;
+  public:
+  void clear_base_congestion_marking_interval();
+  uint64_t base_congestion_marking_interval() const;
+  void set_base_congestion_marking_interval(uint64_t value);
+  private:
+  uint64_t _internal_base_congestion_marking_interval() const;
+  void _internal_set_base_congestion_marking_interval(uint64_t value);
+  public:
+
+  // optional uint64 default_congestion_threshold = 136;
+  bool has_default_congestion_threshold() const;
+  private:
+  bool _internal_has_default_congestion_threshold() const;
+  public:
+  void clear_default_congestion_threshold();
+  uint64_t default_congestion_threshold() const;
+  void set_default_congestion_threshold(uint64_t value);
+  private:
+  uint64_t _internal_default_congestion_threshold() const;
+  void _internal_set_default_congestion_threshold(uint64_t value);
+  public:
+
+  // optional uint64 mtu = 137;
+  bool has_mtu() const;
+  private:
+  bool _internal_has_mtu() const;
+  public:
+  void clear_mtu();
+  uint64_t mtu() const;
+  void set_mtu(uint64_t value);
+  private:
+  uint64_t _internal_mtu() const;
+  void _internal_set_mtu(uint64_t value);
+  public:
+
+  // required uint64 n_in_interests = 144;
+  bool has_n_in_interests() const;
+  private:
+  bool _internal_has_n_in_interests() const;
+  public:
+  void clear_n_in_interests();
+  uint64_t n_in_interests() const;
+  void set_n_in_interests(uint64_t value);
+  private:
+  uint64_t _internal_n_in_interests() const;
+  void _internal_set_n_in_interests(uint64_t value);
+  public:
+
+  // required uint64 n_in_datas = 145;
+  bool has_n_in_datas() const;
+  private:
+  bool _internal_has_n_in_datas() const;
+  public:
+  void clear_n_in_datas();
+  uint64_t n_in_datas() const;
+  void set_n_in_datas(uint64_t value);
+  private:
+  uint64_t _internal_n_in_datas() const;
+  void _internal_set_n_in_datas(uint64_t value);
+  public:
+
+  // required uint64 n_out_interests = 146;
+  bool has_n_out_interests() const;
+  private:
+  bool _internal_has_n_out_interests() const;
+  public:
+  void clear_n_out_interests();
+  uint64_t n_out_interests() const;
+  void set_n_out_interests(uint64_t value);
+  private:
+  uint64_t _internal_n_out_interests() const;
+  void _internal_set_n_out_interests(uint64_t value);
+  public:
+
+  // required uint64 n_out_datas = 147;
+  bool has_n_out_datas() const;
+  private:
+  bool _internal_has_n_out_datas() const;
+  public:
+  void clear_n_out_datas();
+  uint64_t n_out_datas() const;
+  void set_n_out_datas(uint64_t value);
+  private:
+  uint64_t _internal_n_out_datas() const;
+  void _internal_set_n_out_datas(uint64_t value);
+  public:
+
+  // required uint64 n_in_bytes = 148;
+  bool has_n_in_bytes() const;
+  private:
+  bool _internal_has_n_in_bytes() const;
+  public:
+  void clear_n_in_bytes();
+  uint64_t n_in_bytes() const;
+  void set_n_in_bytes(uint64_t value);
+  private:
+  uint64_t _internal_n_in_bytes() const;
+  void _internal_set_n_in_bytes(uint64_t value);
+  public:
+
+  // required uint64 n_out_bytes = 149;
+  bool has_n_out_bytes() const;
+  private:
+  bool _internal_has_n_out_bytes() const;
+  public:
+  void clear_n_out_bytes();
+  uint64_t n_out_bytes() const;
+  void set_n_out_bytes(uint64_t value);
+  private:
+  uint64_t _internal_n_out_bytes() const;
+  void _internal_set_n_out_bytes(uint64_t value);
+  public:
+
+  // required uint64 n_in_nacks = 151;
+  bool has_n_in_nacks() const;
+  private:
+  bool _internal_has_n_in_nacks() const;
+  public:
+  void clear_n_in_nacks();
+  uint64_t n_in_nacks() const;
+  void set_n_in_nacks(uint64_t value);
+  private:
+  uint64_t _internal_n_in_nacks() const;
+  void _internal_set_n_in_nacks(uint64_t value);
+  public:
+
+  // required uint64 n_out_nacks = 152;
+  bool has_n_out_nacks() const;
+  private:
+  bool _internal_has_n_out_nacks() const;
+  public:
+  void clear_n_out_nacks();
+  uint64_t n_out_nacks() const;
+  void set_n_out_nacks(uint64_t value);
+  private:
+  uint64_t _internal_n_out_nacks() const;
+  void _internal_set_n_out_nacks(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FaceStatusMessage.FaceStatus)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr local_uri_;
+    uint64_t face_id_;
+    uint64_t flags_;
+    uint64_t expiration_period_;
+    uint64_t face_scope_;
+    uint64_t face_persistency_;
+    uint64_t link_type_;
+    uint64_t base_congestion_marking_interval_;
+    uint64_t default_congestion_threshold_;
+    uint64_t mtu_;
+    uint64_t n_in_interests_;
+    uint64_t n_in_datas_;
+    uint64_t n_out_interests_;
+    uint64_t n_out_datas_;
+    uint64_t n_in_bytes_;
+    uint64_t n_out_bytes_;
+    uint64_t n_in_nacks_;
+    uint64_t n_out_nacks_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_face_2dstatus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FaceStatusMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FaceStatusMessage) */ {
+ public:
+  inline FaceStatusMessage() : FaceStatusMessage(nullptr) {}
+  ~FaceStatusMessage() override;
+  explicit PROTOBUF_CONSTEXPR FaceStatusMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FaceStatusMessage(const FaceStatusMessage& from);
+  FaceStatusMessage(FaceStatusMessage&& from) noexcept
+    : FaceStatusMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FaceStatusMessage& operator=(const FaceStatusMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FaceStatusMessage& operator=(FaceStatusMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FaceStatusMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FaceStatusMessage* internal_default_instance() {
+    return reinterpret_cast<const FaceStatusMessage*>(
+               &_FaceStatusMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(FaceStatusMessage& a, FaceStatusMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FaceStatusMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FaceStatusMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FaceStatusMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FaceStatusMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FaceStatusMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FaceStatusMessage& from) {
+    FaceStatusMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FaceStatusMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FaceStatusMessage";
+  }
+  protected:
+  explicit FaceStatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef FaceStatusMessage_FaceStatus FaceStatus;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFaceStatusFieldNumber = 128,
+  };
+  // repeated .ndn_message.FaceStatusMessage.FaceStatus face_status = 128;
+  int face_status_size() const;
+  private:
+  int _internal_face_status_size() const;
+  public:
+  void clear_face_status();
+  ::ndn_message::FaceStatusMessage_FaceStatus* mutable_face_status(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceStatusMessage_FaceStatus >*
+      mutable_face_status();
+  private:
+  const ::ndn_message::FaceStatusMessage_FaceStatus& _internal_face_status(int index) const;
+  ::ndn_message::FaceStatusMessage_FaceStatus* _internal_add_face_status();
+  public:
+  const ::ndn_message::FaceStatusMessage_FaceStatus& face_status(int index) const;
+  ::ndn_message::FaceStatusMessage_FaceStatus* add_face_status();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceStatusMessage_FaceStatus >&
+      face_status() const;
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FaceStatusMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceStatusMessage_FaceStatus > face_status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_face_2dstatus_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// FaceStatusMessage_FaceStatus
+
+// required uint64 face_id = 105;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_face_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_face_id() const {
+  return _internal_has_face_id();
+}
+inline void FaceStatusMessage_FaceStatus::clear_face_id() {
+  _impl_.face_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_face_id() const {
+  return _impl_.face_id_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::face_id() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.face_id)
+  return _internal_face_id();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_face_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.face_id_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_face_id(uint64_t value) {
+  _internal_set_face_id(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.face_id)
+}
+
+// required string uri = 114;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_uri() const {
+  return _internal_has_uri();
+}
+inline void FaceStatusMessage_FaceStatus::clear_uri() {
+  _impl_.uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& FaceStatusMessage_FaceStatus::uri() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.uri)
+  return _internal_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FaceStatusMessage_FaceStatus::set_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.uri)
+}
+inline std::string* FaceStatusMessage_FaceStatus::mutable_uri() {
+  std::string* _s = _internal_mutable_uri();
+  // @@protoc_insertion_point(field_mutable:ndn_message.FaceStatusMessage.FaceStatus.uri)
+  return _s;
+}
+inline const std::string& FaceStatusMessage_FaceStatus::_internal_uri() const {
+  return _impl_.uri_.Get();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FaceStatusMessage_FaceStatus::_internal_mutable_uri() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FaceStatusMessage_FaceStatus::release_uri() {
+  // @@protoc_insertion_point(field_release:ndn_message.FaceStatusMessage.FaceStatus.uri)
+  if (!_internal_has_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void FaceStatusMessage_FaceStatus::set_allocated_uri(std::string* uri) {
+  if (uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.uri_.SetAllocated(uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.FaceStatusMessage.FaceStatus.uri)
+}
+
+// required string local_uri = 129;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_local_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_local_uri() const {
+  return _internal_has_local_uri();
+}
+inline void FaceStatusMessage_FaceStatus::clear_local_uri() {
+  _impl_.local_uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& FaceStatusMessage_FaceStatus::local_uri() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.local_uri)
+  return _internal_local_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FaceStatusMessage_FaceStatus::set_local_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.local_uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.local_uri)
+}
+inline std::string* FaceStatusMessage_FaceStatus::mutable_local_uri() {
+  std::string* _s = _internal_mutable_local_uri();
+  // @@protoc_insertion_point(field_mutable:ndn_message.FaceStatusMessage.FaceStatus.local_uri)
+  return _s;
+}
+inline const std::string& FaceStatusMessage_FaceStatus::_internal_local_uri() const {
+  return _impl_.local_uri_.Get();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_local_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.local_uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FaceStatusMessage_FaceStatus::_internal_mutable_local_uri() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.local_uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FaceStatusMessage_FaceStatus::release_local_uri() {
+  // @@protoc_insertion_point(field_release:ndn_message.FaceStatusMessage.FaceStatus.local_uri)
+  if (!_internal_has_local_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.local_uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void FaceStatusMessage_FaceStatus::set_allocated_local_uri(std::string* local_uri) {
+  if (local_uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.local_uri_.SetAllocated(local_uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.FaceStatusMessage.FaceStatus.local_uri)
+}
+
+// optional uint64 expiration_period = 109;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_expiration_period() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_expiration_period() const {
+  return _internal_has_expiration_period();
+}
+inline void FaceStatusMessage_FaceStatus::clear_expiration_period() {
+  _impl_.expiration_period_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_expiration_period() const {
+  return _impl_.expiration_period_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::expiration_period() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.expiration_period)
+  return _internal_expiration_period();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_expiration_period(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.expiration_period_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_expiration_period(uint64_t value) {
+  _internal_set_expiration_period(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.expiration_period)
+}
+
+// required uint64 face_scope = 132;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_face_scope() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_face_scope() const {
+  return _internal_has_face_scope();
+}
+inline void FaceStatusMessage_FaceStatus::clear_face_scope() {
+  _impl_.face_scope_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_face_scope() const {
+  return _impl_.face_scope_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::face_scope() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.face_scope)
+  return _internal_face_scope();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_face_scope(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.face_scope_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_face_scope(uint64_t value) {
+  _internal_set_face_scope(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.face_scope)
+}
+
+// required uint64 face_persistency = 133;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_face_persistency() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_face_persistency() const {
+  return _internal_has_face_persistency();
+}
+inline void FaceStatusMessage_FaceStatus::clear_face_persistency() {
+  _impl_.face_persistency_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_face_persistency() const {
+  return _impl_.face_persistency_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::face_persistency() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.face_persistency)
+  return _internal_face_persistency();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_face_persistency(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.face_persistency_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_face_persistency(uint64_t value) {
+  _internal_set_face_persistency(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.face_persistency)
+}
+
+// required uint64 link_type = 134;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_link_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_link_type() const {
+  return _internal_has_link_type();
+}
+inline void FaceStatusMessage_FaceStatus::clear_link_type() {
+  _impl_.link_type_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_link_type() const {
+  return _impl_.link_type_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::link_type() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.link_type)
+  return _internal_link_type();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_link_type(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.link_type_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_link_type(uint64_t value) {
+  _internal_set_link_type(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.link_type)
+}
+
+// optional uint64 base_congestion_marking_interval = 135;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_base_congestion_marking_interval() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_base_congestion_marking_interval() const {
+  return _internal_has_base_congestion_marking_interval();
+}
+inline void FaceStatusMessage_FaceStatus::clear_base_congestion_marking_interval() {
+  _impl_.base_congestion_marking_interval_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_base_congestion_marking_interval() const {
+  return _impl_.base_congestion_marking_interval_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::base_congestion_marking_interval() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.base_congestion_marking_interval)
+  return _internal_base_congestion_marking_interval();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_base_congestion_marking_interval(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.base_congestion_marking_interval_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_base_congestion_marking_interval(uint64_t value) {
+  _internal_set_base_congestion_marking_interval(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.base_congestion_marking_interval)
+}
+
+// optional uint64 default_congestion_threshold = 136;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_default_congestion_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_default_congestion_threshold() const {
+  return _internal_has_default_congestion_threshold();
+}
+inline void FaceStatusMessage_FaceStatus::clear_default_congestion_threshold() {
+  _impl_.default_congestion_threshold_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_default_congestion_threshold() const {
+  return _impl_.default_congestion_threshold_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::default_congestion_threshold() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.default_congestion_threshold)
+  return _internal_default_congestion_threshold();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_default_congestion_threshold(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.default_congestion_threshold_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_default_congestion_threshold(uint64_t value) {
+  _internal_set_default_congestion_threshold(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.default_congestion_threshold)
+}
+
+// optional uint64 mtu = 137;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_mtu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_mtu() const {
+  return _internal_has_mtu();
+}
+inline void FaceStatusMessage_FaceStatus::clear_mtu() {
+  _impl_.mtu_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_mtu() const {
+  return _impl_.mtu_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::mtu() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.mtu)
+  return _internal_mtu();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_mtu(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.mtu_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_mtu(uint64_t value) {
+  _internal_set_mtu(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.mtu)
+}
+
+// required uint64 n_in_interests = 144;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_in_interests() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_in_interests() const {
+  return _internal_has_n_in_interests();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_in_interests() {
+  _impl_.n_in_interests_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_in_interests() const {
+  return _impl_.n_in_interests_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_in_interests() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_in_interests)
+  return _internal_n_in_interests();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_in_interests(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.n_in_interests_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_in_interests(uint64_t value) {
+  _internal_set_n_in_interests(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_in_interests)
+}
+
+// required uint64 n_in_datas = 145;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_in_datas() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_in_datas() const {
+  return _internal_has_n_in_datas();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_in_datas() {
+  _impl_.n_in_datas_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_in_datas() const {
+  return _impl_.n_in_datas_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_in_datas() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_in_datas)
+  return _internal_n_in_datas();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_in_datas(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.n_in_datas_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_in_datas(uint64_t value) {
+  _internal_set_n_in_datas(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_in_datas)
+}
+
+// required uint64 n_in_nacks = 151;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_in_nacks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_in_nacks() const {
+  return _internal_has_n_in_nacks();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_in_nacks() {
+  _impl_.n_in_nacks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_in_nacks() const {
+  return _impl_.n_in_nacks_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_in_nacks() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_in_nacks)
+  return _internal_n_in_nacks();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_in_nacks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.n_in_nacks_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_in_nacks(uint64_t value) {
+  _internal_set_n_in_nacks(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_in_nacks)
+}
+
+// required uint64 n_out_interests = 146;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_out_interests() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_out_interests() const {
+  return _internal_has_n_out_interests();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_out_interests() {
+  _impl_.n_out_interests_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_out_interests() const {
+  return _impl_.n_out_interests_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_out_interests() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_out_interests)
+  return _internal_n_out_interests();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_out_interests(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.n_out_interests_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_out_interests(uint64_t value) {
+  _internal_set_n_out_interests(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_out_interests)
+}
+
+// required uint64 n_out_datas = 147;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_out_datas() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_out_datas() const {
+  return _internal_has_n_out_datas();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_out_datas() {
+  _impl_.n_out_datas_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_out_datas() const {
+  return _impl_.n_out_datas_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_out_datas() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_out_datas)
+  return _internal_n_out_datas();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_out_datas(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.n_out_datas_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_out_datas(uint64_t value) {
+  _internal_set_n_out_datas(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_out_datas)
+}
+
+// required uint64 n_out_nacks = 152;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_out_nacks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_out_nacks() const {
+  return _internal_has_n_out_nacks();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_out_nacks() {
+  _impl_.n_out_nacks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_out_nacks() const {
+  return _impl_.n_out_nacks_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_out_nacks() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_out_nacks)
+  return _internal_n_out_nacks();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_out_nacks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.n_out_nacks_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_out_nacks(uint64_t value) {
+  _internal_set_n_out_nacks(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_out_nacks)
+}
+
+// required uint64 n_in_bytes = 148;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_in_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_in_bytes() const {
+  return _internal_has_n_in_bytes();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_in_bytes() {
+  _impl_.n_in_bytes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_in_bytes() const {
+  return _impl_.n_in_bytes_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_in_bytes() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_in_bytes)
+  return _internal_n_in_bytes();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_in_bytes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.n_in_bytes_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_in_bytes(uint64_t value) {
+  _internal_set_n_in_bytes(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_in_bytes)
+}
+
+// required uint64 n_out_bytes = 149;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_n_out_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_n_out_bytes() const {
+  return _internal_has_n_out_bytes();
+}
+inline void FaceStatusMessage_FaceStatus::clear_n_out_bytes() {
+  _impl_.n_out_bytes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_n_out_bytes() const {
+  return _impl_.n_out_bytes_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::n_out_bytes() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.n_out_bytes)
+  return _internal_n_out_bytes();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_n_out_bytes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.n_out_bytes_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_n_out_bytes(uint64_t value) {
+  _internal_set_n_out_bytes(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.n_out_bytes)
+}
+
+// required uint64 flags = 108;
+inline bool FaceStatusMessage_FaceStatus::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool FaceStatusMessage_FaceStatus::has_flags() const {
+  return _internal_has_flags();
+}
+inline void FaceStatusMessage_FaceStatus::clear_flags() {
+  _impl_.flags_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline uint64_t FaceStatusMessage_FaceStatus::flags() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.FaceStatus.flags)
+  return _internal_flags();
+}
+inline void FaceStatusMessage_FaceStatus::_internal_set_flags(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.flags_ = value;
+}
+inline void FaceStatusMessage_FaceStatus::set_flags(uint64_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FaceStatusMessage.FaceStatus.flags)
+}
+
+// -------------------------------------------------------------------
+
+// FaceStatusMessage
+
+// repeated .ndn_message.FaceStatusMessage.FaceStatus face_status = 128;
+inline int FaceStatusMessage::_internal_face_status_size() const {
+  return _impl_.face_status_.size();
+}
+inline int FaceStatusMessage::face_status_size() const {
+  return _internal_face_status_size();
+}
+inline void FaceStatusMessage::clear_face_status() {
+  _impl_.face_status_.Clear();
+}
+inline ::ndn_message::FaceStatusMessage_FaceStatus* FaceStatusMessage::mutable_face_status(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.FaceStatusMessage.face_status)
+  return _impl_.face_status_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceStatusMessage_FaceStatus >*
+FaceStatusMessage::mutable_face_status() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.FaceStatusMessage.face_status)
+  return &_impl_.face_status_;
+}
+inline const ::ndn_message::FaceStatusMessage_FaceStatus& FaceStatusMessage::_internal_face_status(int index) const {
+  return _impl_.face_status_.Get(index);
+}
+inline const ::ndn_message::FaceStatusMessage_FaceStatus& FaceStatusMessage::face_status(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.FaceStatusMessage.face_status)
+  return _internal_face_status(index);
+}
+inline ::ndn_message::FaceStatusMessage_FaceStatus* FaceStatusMessage::_internal_add_face_status() {
+  return _impl_.face_status_.Add();
+}
+inline ::ndn_message::FaceStatusMessage_FaceStatus* FaceStatusMessage::add_face_status() {
+  ::ndn_message::FaceStatusMessage_FaceStatus* _add = _internal_add_face_status();
+  // @@protoc_insertion_point(field_add:ndn_message.FaceStatusMessage.face_status)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FaceStatusMessage_FaceStatus >&
+FaceStatusMessage::face_status() const {
+  // @@protoc_insertion_point(field_list:ndn_message.FaceStatusMessage.face_status)
+  return _impl_.face_status_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ndn_message
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_face_2dstatus_2eproto
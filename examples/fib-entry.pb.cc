@@ -0,0 +1,1088 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: fib-entry.proto
+
+#include "fib-entry.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ndn_message {
+PROTOBUF_CONSTEXPR FibEntryMessage_Name::FibEntryMessage_Name(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.component_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FibEntryMessage_NameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FibEntryMessage_NameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FibEntryMessage_NameDefaultTypeInternal() {}
+  union {
+    FibEntryMessage_Name _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FibEntryMessage_NameDefaultTypeInternal _FibEntryMessage_Name_default_instance_;
+PROTOBUF_CONSTEXPR FibEntryMessage_NextHopRecord::FibEntryMessage_NextHopRecord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.face_id_)*/0u
+  , /*decltype(_impl_.cost_)*/0u} {}
+struct FibEntryMessage_NextHopRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FibEntryMessage_NextHopRecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FibEntryMessage_NextHopRecordDefaultTypeInternal() {}
+  union {
+    FibEntryMessage_NextHopRecord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FibEntryMessage_NextHopRecordDefaultTypeInternal _FibEntryMessage_NextHopRecord_default_instance_;
+PROTOBUF_CONSTEXPR FibEntryMessage_FibEntry::FibEntryMessage_FibEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.next_hop_records_)*/{}
+  , /*decltype(_impl_.name_)*/nullptr} {}
+struct FibEntryMessage_FibEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FibEntryMessage_FibEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FibEntryMessage_FibEntryDefaultTypeInternal() {}
+  union {
+    FibEntryMessage_FibEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FibEntryMessage_FibEntryDefaultTypeInternal _FibEntryMessage_FibEntry_default_instance_;
+PROTOBUF_CONSTEXPR FibEntryMessage::FibEntryMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.fib_entry_)*/nullptr} {}
+struct FibEntryMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FibEntryMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FibEntryMessageDefaultTypeInternal() {}
+  union {
+    FibEntryMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FibEntryMessageDefaultTypeInternal _FibEntryMessage_default_instance_;
+}  // namespace ndn_message
+static ::_pb::Metadata file_level_metadata_fib_2dentry_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_fib_2dentry_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_fib_2dentry_2eproto = nullptr;
+
+const uint32_t TableStruct_fib_2dentry_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_Name, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_Name, _impl_.component_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_NextHopRecord, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_NextHopRecord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_NextHopRecord, _impl_.face_id_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_NextHopRecord, _impl_.cost_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_FibEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_FibEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_FibEntry, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage_FibEntry, _impl_.next_hop_records_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FibEntryMessage, _impl_.fib_entry_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::ndn_message::FibEntryMessage_Name)},
+  { 7, 15, -1, sizeof(::ndn_message::FibEntryMessage_NextHopRecord)},
+  { 17, 25, -1, sizeof(::ndn_message::FibEntryMessage_FibEntry)},
+  { 27, 34, -1, sizeof(::ndn_message::FibEntryMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ndn_message::_FibEntryMessage_Name_default_instance_._instance,
+  &::ndn_message::_FibEntryMessage_NextHopRecord_default_instance_._instance,
+  &::ndn_message::_FibEntryMessage_FibEntry_default_instance_._instance,
+  &::ndn_message::_FibEntryMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_fib_2dentry_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017fib-entry.proto\022\013ndn_message\"\234\002\n\017FibEn"
+  "tryMessage\0229\n\tfib_entry\030\200\001 \002(\0132%.ndn_mes"
+  "sage.FibEntryMessage.FibEntry\032\031\n\004Name\022\021\n"
+  "\tcomponent\030\010 \003(\014\032.\n\rNextHopRecord\022\017\n\007fac"
+  "e_id\030i \002(\r\022\014\n\004cost\030j \002(\r\032\202\001\n\010FibEntry\022/\n"
+  "\004name\030\007 \002(\0132!.ndn_message.FibEntryMessag"
+  "e.Name\022E\n\020next_hop_records\030\201\001 \003(\0132*.ndn_"
+  "message.FibEntryMessage.NextHopRecord"
+  ;
+static ::_pbi::once_flag descriptor_table_fib_2dentry_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_fib_2dentry_2eproto = {
+    false, false, 317, descriptor_table_protodef_fib_2dentry_2eproto,
+    "fib-entry.proto",
+    &descriptor_table_fib_2dentry_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_fib_2dentry_2eproto::offsets,
+    file_level_metadata_fib_2dentry_2eproto, file_level_enum_descriptors_fib_2dentry_2eproto,
+    file_level_service_descriptors_fib_2dentry_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_fib_2dentry_2eproto_getter() {
+  return &descriptor_table_fib_2dentry_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_fib_2dentry_2eproto(&descriptor_table_fib_2dentry_2eproto);
+namespace ndn_message {
+
+// ===================================================================
+
+class FibEntryMessage_Name::_Internal {
+ public:
+};
+
+FibEntryMessage_Name::FibEntryMessage_Name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FibEntryMessage.Name)
+}
+FibEntryMessage_Name::FibEntryMessage_Name(const FibEntryMessage_Name& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FibEntryMessage_Name* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){from._impl_.component_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FibEntryMessage.Name)
+}
+
+inline void FibEntryMessage_Name::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FibEntryMessage_Name::~FibEntryMessage_Name() {
+  // @@protoc_insertion_point(destructor:ndn_message.FibEntryMessage.Name)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FibEntryMessage_Name::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.component_.~RepeatedPtrField();
+}
+
+void FibEntryMessage_Name::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FibEntryMessage_Name::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FibEntryMessage.Name)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.component_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FibEntryMessage_Name::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes component = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_component();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FibEntryMessage_Name::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FibEntryMessage.Name)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes component = 8;
+  for (int i = 0, n = this->_internal_component_size(); i < n; i++) {
+    const auto& s = this->_internal_component(i);
+    target = stream->WriteBytes(8, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FibEntryMessage.Name)
+  return target;
+}
+
+size_t FibEntryMessage_Name::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FibEntryMessage.Name)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes component = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.component_.size());
+  for (int i = 0, n = _impl_.component_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.component_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FibEntryMessage_Name::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FibEntryMessage_Name::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FibEntryMessage_Name::GetClassData() const { return &_class_data_; }
+
+
+void FibEntryMessage_Name::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FibEntryMessage_Name*>(&to_msg);
+  auto& from = static_cast<const FibEntryMessage_Name&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FibEntryMessage.Name)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.component_.MergeFrom(from._impl_.component_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FibEntryMessage_Name::CopyFrom(const FibEntryMessage_Name& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FibEntryMessage.Name)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FibEntryMessage_Name::IsInitialized() const {
+  return true;
+}
+
+void FibEntryMessage_Name::InternalSwap(FibEntryMessage_Name* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.component_.InternalSwap(&other->_impl_.component_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FibEntryMessage_Name::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fib_2dentry_2eproto_getter, &descriptor_table_fib_2dentry_2eproto_once,
+      file_level_metadata_fib_2dentry_2eproto[0]);
+}
+
+// ===================================================================
+
+class FibEntryMessage_NextHopRecord::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FibEntryMessage_NextHopRecord>()._impl_._has_bits_);
+  static void set_has_face_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_cost(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+FibEntryMessage_NextHopRecord::FibEntryMessage_NextHopRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FibEntryMessage.NextHopRecord)
+}
+FibEntryMessage_NextHopRecord::FibEntryMessage_NextHopRecord(const FibEntryMessage_NextHopRecord& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FibEntryMessage_NextHopRecord* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.face_id_){}
+    , decltype(_impl_.cost_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.face_id_, &from._impl_.face_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cost_) -
+    reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.cost_));
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FibEntryMessage.NextHopRecord)
+}
+
+inline void FibEntryMessage_NextHopRecord::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.face_id_){0u}
+    , decltype(_impl_.cost_){0u}
+  };
+}
+
+FibEntryMessage_NextHopRecord::~FibEntryMessage_NextHopRecord() {
+  // @@protoc_insertion_point(destructor:ndn_message.FibEntryMessage.NextHopRecord)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FibEntryMessage_NextHopRecord::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FibEntryMessage_NextHopRecord::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FibEntryMessage_NextHopRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FibEntryMessage.NextHopRecord)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.face_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cost_) -
+        reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.cost_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FibEntryMessage_NextHopRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 face_id = 105;
+      case 105:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_face_id(&has_bits);
+          _impl_.face_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 cost = 106;
+      case 106:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_cost(&has_bits);
+          _impl_.cost_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FibEntryMessage_NextHopRecord::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FibEntryMessage.NextHopRecord)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 face_id = 105;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(105, this->_internal_face_id(), target);
+  }
+
+  // required uint32 cost = 106;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(106, this->_internal_cost(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FibEntryMessage.NextHopRecord)
+  return target;
+}
+
+size_t FibEntryMessage_NextHopRecord::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ndn_message.FibEntryMessage.NextHopRecord)
+  size_t total_size = 0;
+
+  if (_internal_has_face_id()) {
+    // required uint32 face_id = 105;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_face_id());
+  }
+
+  if (_internal_has_cost()) {
+    // required uint32 cost = 106;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_cost());
+  }
+
+  return total_size;
+}
+size_t FibEntryMessage_NextHopRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FibEntryMessage.NextHopRecord)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 face_id = 105;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_face_id());
+
+    // required uint32 cost = 106;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_cost());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FibEntryMessage_NextHopRecord::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FibEntryMessage_NextHopRecord::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FibEntryMessage_NextHopRecord::GetClassData() const { return &_class_data_; }
+
+
+void FibEntryMessage_NextHopRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FibEntryMessage_NextHopRecord*>(&to_msg);
+  auto& from = static_cast<const FibEntryMessage_NextHopRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FibEntryMessage.NextHopRecord)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.face_id_ = from._impl_.face_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.cost_ = from._impl_.cost_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FibEntryMessage_NextHopRecord::CopyFrom(const FibEntryMessage_NextHopRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FibEntryMessage.NextHopRecord)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FibEntryMessage_NextHopRecord::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void FibEntryMessage_NextHopRecord::InternalSwap(FibEntryMessage_NextHopRecord* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FibEntryMessage_NextHopRecord, _impl_.cost_)
+      + sizeof(FibEntryMessage_NextHopRecord::_impl_.cost_)
+      - PROTOBUF_FIELD_OFFSET(FibEntryMessage_NextHopRecord, _impl_.face_id_)>(
+          reinterpret_cast<char*>(&_impl_.face_id_),
+          reinterpret_cast<char*>(&other->_impl_.face_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FibEntryMessage_NextHopRecord::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fib_2dentry_2eproto_getter, &descriptor_table_fib_2dentry_2eproto_once,
+      file_level_metadata_fib_2dentry_2eproto[1]);
+}
+
+// ===================================================================
+
+class FibEntryMessage_FibEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FibEntryMessage_FibEntry>()._impl_._has_bits_);
+  static const ::ndn_message::FibEntryMessage_Name& name(const FibEntryMessage_FibEntry* msg);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::ndn_message::FibEntryMessage_Name&
+FibEntryMessage_FibEntry::_Internal::name(const FibEntryMessage_FibEntry* msg) {
+  return *msg->_impl_.name_;
+}
+FibEntryMessage_FibEntry::FibEntryMessage_FibEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FibEntryMessage.FibEntry)
+}
+FibEntryMessage_FibEntry::FibEntryMessage_FibEntry(const FibEntryMessage_FibEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FibEntryMessage_FibEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.next_hop_records_){from._impl_.next_hop_records_}
+    , decltype(_impl_.name_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_name()) {
+    _this->_impl_.name_ = new ::ndn_message::FibEntryMessage_Name(*from._impl_.name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FibEntryMessage.FibEntry)
+}
+
+inline void FibEntryMessage_FibEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.next_hop_records_){arena}
+    , decltype(_impl_.name_){nullptr}
+  };
+}
+
+FibEntryMessage_FibEntry::~FibEntryMessage_FibEntry() {
+  // @@protoc_insertion_point(destructor:ndn_message.FibEntryMessage.FibEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FibEntryMessage_FibEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.next_hop_records_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.name_;
+}
+
+void FibEntryMessage_FibEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FibEntryMessage_FibEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FibEntryMessage.FibEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.next_hop_records_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.name_ != nullptr);
+    _impl_.name_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FibEntryMessage_FibEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ndn_message.FibEntryMessage.Name name = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ndn_message.FibEntryMessage.NextHopRecord next_hop_records = 129;
+      case 129:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_next_hop_records(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<1034>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FibEntryMessage_FibEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FibEntryMessage.FibEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ndn_message.FibEntryMessage.Name name = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::name(this),
+        _Internal::name(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .ndn_message.FibEntryMessage.NextHopRecord next_hop_records = 129;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_next_hop_records_size()); i < n; i++) {
+    const auto& repfield = this->_internal_next_hop_records(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(129, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FibEntryMessage.FibEntry)
+  return target;
+}
+
+size_t FibEntryMessage_FibEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FibEntryMessage.FibEntry)
+  size_t total_size = 0;
+
+  // required .ndn_message.FibEntryMessage.Name name = 7;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.name_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.FibEntryMessage.NextHopRecord next_hop_records = 129;
+  total_size += 2UL * this->_internal_next_hop_records_size();
+  for (const auto& msg : this->_impl_.next_hop_records_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FibEntryMessage_FibEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FibEntryMessage_FibEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FibEntryMessage_FibEntry::GetClassData() const { return &_class_data_; }
+
+
+void FibEntryMessage_FibEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FibEntryMessage_FibEntry*>(&to_msg);
+  auto& from = static_cast<const FibEntryMessage_FibEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FibEntryMessage.FibEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.next_hop_records_.MergeFrom(from._impl_.next_hop_records_);
+  if (from._internal_has_name()) {
+    _this->_internal_mutable_name()->::ndn_message::FibEntryMessage_Name::MergeFrom(
+        from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FibEntryMessage_FibEntry::CopyFrom(const FibEntryMessage_FibEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FibEntryMessage.FibEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FibEntryMessage_FibEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.next_hop_records_))
+    return false;
+  return true;
+}
+
+void FibEntryMessage_FibEntry::InternalSwap(FibEntryMessage_FibEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.next_hop_records_.InternalSwap(&other->_impl_.next_hop_records_);
+  swap(_impl_.name_, other->_impl_.name_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FibEntryMessage_FibEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fib_2dentry_2eproto_getter, &descriptor_table_fib_2dentry_2eproto_once,
+      file_level_metadata_fib_2dentry_2eproto[2]);
+}
+
+// ===================================================================
+
+class FibEntryMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FibEntryMessage>()._impl_._has_bits_);
+  static const ::ndn_message::FibEntryMessage_FibEntry& fib_entry(const FibEntryMessage* msg);
+  static void set_has_fib_entry(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::ndn_message::FibEntryMessage_FibEntry&
+FibEntryMessage::_Internal::fib_entry(const FibEntryMessage* msg) {
+  return *msg->_impl_.fib_entry_;
+}
+FibEntryMessage::FibEntryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FibEntryMessage)
+}
+FibEntryMessage::FibEntryMessage(const FibEntryMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FibEntryMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.fib_entry_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_fib_entry()) {
+    _this->_impl_.fib_entry_ = new ::ndn_message::FibEntryMessage_FibEntry(*from._impl_.fib_entry_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FibEntryMessage)
+}
+
+inline void FibEntryMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.fib_entry_){nullptr}
+  };
+}
+
+FibEntryMessage::~FibEntryMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.FibEntryMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FibEntryMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.fib_entry_;
+}
+
+void FibEntryMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FibEntryMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FibEntryMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.fib_entry_ != nullptr);
+    _impl_.fib_entry_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FibEntryMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ndn_message.FibEntryMessage.FibEntry fib_entry = 128;
+      case 128:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr = ctx->ParseMessage(_internal_mutable_fib_entry(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FibEntryMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FibEntryMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ndn_message.FibEntryMessage.FibEntry fib_entry = 128;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(128, _Internal::fib_entry(this),
+        _Internal::fib_entry(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FibEntryMessage)
+  return target;
+}
+
+size_t FibEntryMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FibEntryMessage)
+  size_t total_size = 0;
+
+  // required .ndn_message.FibEntryMessage.FibEntry fib_entry = 128;
+  if (_internal_has_fib_entry()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.fib_entry_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FibEntryMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FibEntryMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FibEntryMessage::GetClassData() const { return &_class_data_; }
+
+
+void FibEntryMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FibEntryMessage*>(&to_msg);
+  auto& from = static_cast<const FibEntryMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FibEntryMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_fib_entry()) {
+    _this->_internal_mutable_fib_entry()->::ndn_message::FibEntryMessage_FibEntry::MergeFrom(
+        from._internal_fib_entry());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FibEntryMessage::CopyFrom(const FibEntryMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FibEntryMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FibEntryMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_fib_entry()) {
+    if (!_impl_.fib_entry_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void FibEntryMessage::InternalSwap(FibEntryMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.fib_entry_, other->_impl_.fib_entry_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FibEntryMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fib_2dentry_2eproto_getter, &descriptor_table_fib_2dentry_2eproto_once,
+      file_level_metadata_fib_2dentry_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ndn_message::FibEntryMessage_Name*
+Arena::CreateMaybeMessage< ::ndn_message::FibEntryMessage_Name >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FibEntryMessage_Name >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::FibEntryMessage_NextHopRecord*
+Arena::CreateMaybeMessage< ::ndn_message::FibEntryMessage_NextHopRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FibEntryMessage_NextHopRecord >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::FibEntryMessage_FibEntry*
+Arena::CreateMaybeMessage< ::ndn_message::FibEntryMessage_FibEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FibEntryMessage_FibEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::FibEntryMessage*
+Arena::CreateMaybeMessage< ::ndn_message::FibEntryMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FibEntryMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1162 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: fib-entry.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_fib_2dentry_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_fib_2dentry_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_fib_2dentry_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_fib_2dentry_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_fib_2dentry_2eproto;
+namespace ndn_message {
+class FibEntryMessage;
+struct FibEntryMessageDefaultTypeInternal;
+extern FibEntryMessageDefaultTypeInternal _FibEntryMessage_default_instance_;
+class FibEntryMessage_FibEntry;
+struct FibEntryMessage_FibEntryDefaultTypeInternal;
+extern FibEntryMessage_FibEntryDefaultTypeInternal _FibEntryMessage_FibEntry_default_instance_;
+class FibEntryMessage_Name;
+struct FibEntryMessage_NameDefaultTypeInternal;
+extern FibEntryMessage_NameDefaultTypeInternal _FibEntryMessage_Name_default_instance_;
+class FibEntryMessage_NextHopRecord;
+struct FibEntryMessage_NextHopRecordDefaultTypeInternal;
+extern FibEntryMessage_NextHopRecordDefaultTypeInternal _FibEntryMessage_NextHopRecord_default_instance_;
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ndn_message::FibEntryMessage* Arena::CreateMaybeMessage<::ndn_message::FibEntryMessage>(Arena*);
+template<> ::ndn_message::FibEntryMessage_FibEntry* Arena::CreateMaybeMessage<::ndn_message::FibEntryMessage_FibEntry>(Arena*);
+template<> ::ndn_message::FibEntryMessage_Name* Arena::CreateMaybeMessage<::ndn_message::FibEntryMessage_Name>(Arena*);
+template<> ::ndn_message::FibEntryMessage_NextHopRecord* Arena::CreateMaybeMessage<::ndn_message::FibEntryMessage_NextHopRecord>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ndn_message {
+
+// ===================================================================
+
+class FibEntryMessage_Name final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FibEntryMessage.Name) */ {
+ public:
+  inline FibEntryMessage_Name() : FibEntryMessage_Name(nullptr) {}
+  ~FibEntryMessage_Name() override;
+  explicit PROTOBUF_CONSTEXPR FibEntryMessage_Name(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FibEntryMessage_Name(const FibEntryMessage_Name& from);
+  FibEntryMessage_Name(FibEntryMessage_Name&& from) noexcept
+    : FibEntryMessage_Name() {
+    *this = ::std::move(from);
+  }
+
+  inline FibEntryMessage_Name& operator=(const FibEntryMessage_Name& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FibEntryMessage_Name& operator=(FibEntryMessage_Name&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FibEntryMessage_Name& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FibEntryMessage_Name* internal_default_instance() {
+    return reinterpret_cast<const FibEntryMessage_Name*>(
+               &_FibEntryMessage_Name_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(FibEntryMessage_Name& a, FibEntryMessage_Name& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FibEntryMessage_Name* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FibEntryMessage_Name* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FibEntryMessage_Name* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FibEntryMessage_Name>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FibEntryMessage_Name& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FibEntryMessage_Name& from) {
+    FibEntryMessage_Name::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FibEntryMessage_Name* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FibEntryMessage.Name";
+  }
+  protected:
+  explicit FibEntryMessage_Name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComponentFieldNumber = 8,
+  };
+  // repeated bytes component = 8;
+  int component_size() const;
+  private:
+  int _internal_component_size() const;
+  public:
+  void clear_component();
+  const std::string& component(int index) const;
+  std::string* mutable_component(int index);
+  void set_component(int index, const std::string& value);
+  void set_component(int index, std::string&& value);
+  void set_component(int index, const char* value);
+  void set_component(int index, const void* value, size_t size);
+  std::string* add_component();
+  void add_component(const std::string& value);
+  void add_component(std::string&& value);
+  void add_component(const char* value);
+  void add_component(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& component() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_component();
+  private:
+  const std::string& _internal_component(int index) const;
+  std::string* _internal_add_component();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FibEntryMessage.Name)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> component_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fib_2dentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FibEntryMessage_NextHopRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FibEntryMessage.NextHopRecord) */ {
+ public:
+  inline FibEntryMessage_NextHopRecord() : FibEntryMessage_NextHopRecord(nullptr) {}
+  ~FibEntryMessage_NextHopRecord() override;
+  explicit PROTOBUF_CONSTEXPR FibEntryMessage_NextHopRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FibEntryMessage_NextHopRecord(const FibEntryMessage_NextHopRecord& from);
+  FibEntryMessage_NextHopRecord(FibEntryMessage_NextHopRecord&& from) noexcept
+    : FibEntryMessage_NextHopRecord() {
+    *this = ::std::move(from);
+  }
+
+  inline FibEntryMessage_NextHopRecord& operator=(const FibEntryMessage_NextHopRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FibEntryMessage_NextHopRecord& operator=(FibEntryMessage_NextHopRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FibEntryMessage_NextHopRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FibEntryMessage_NextHopRecord* internal_default_instance() {
+    return reinterpret_cast<const FibEntryMessage_NextHopRecord*>(
+               &_FibEntryMessage_NextHopRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(FibEntryMessage_NextHopRecord& a, FibEntryMessage_NextHopRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FibEntryMessage_NextHopRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FibEntryMessage_NextHopRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FibEntryMessage_NextHopRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FibEntryMessage_NextHopRecord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FibEntryMessage_NextHopRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FibEntryMessage_NextHopRecord& from) {
+    FibEntryMessage_NextHopRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FibEntryMessage_NextHopRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FibEntryMessage.NextHopRecord";
+  }
+  protected:
+  explicit FibEntryMessage_NextHopRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFaceIdFieldNumber = 105,
+    kCostFieldNumber = 106,
+  };
+  // required uint32 face_id = 105;
+  bool has_face_id() const;
+  private:
+  bool _internal_has_face_id() const;
+  public:
+  void clear_face_id();
+  uint32_t face_id() const;
+  void set_face_id(uint32_t value);
+  private:
+  uint32_t _internal_face_id() const;
+  void _internal_set_face_id(uint32_t value);
+  public:
+
+  // required uint32 cost = 106;
+  bool has_cost() const;
+  private:
+  bool _internal_has_cost() const;
+  public:
+  void clear_cost();
+  uint32_t cost() const;
+  void set_cost(uint32_t value);
+  private:
+  uint32_t _internal_cost() const;
+  void _internal_set_cost(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FibEntryMessage.NextHopRecord)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t face_id_;
+    uint32_t cost_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fib_2dentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FibEntryMessage_FibEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FibEntryMessage.FibEntry) */ {
+ public:
+  inline FibEntryMessage_FibEntry() : FibEntryMessage_FibEntry(nullptr) {}
+  ~FibEntryMessage_FibEntry() override;
+  explicit PROTOBUF_CONSTEXPR FibEntryMessage_FibEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FibEntryMessage_FibEntry(const FibEntryMessage_FibEntry& from);
+  FibEntryMessage_FibEntry(FibEntryMessage_FibEntry&& from) noexcept
+    : FibEntryMessage_FibEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline FibEntryMessage_FibEntry& operator=(const FibEntryMessage_FibEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FibEntryMessage_FibEntry& operator=(FibEntryMessage_FibEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FibEntryMessage_FibEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FibEntryMessage_FibEntry* internal_default_instance() {
+    return reinterpret_cast<const FibEntryMessage_FibEntry*>(
+               &_FibEntryMessage_FibEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(FibEntryMessage_FibEntry& a, FibEntryMessage_FibEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FibEntryMessage_FibEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FibEntryMessage_FibEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FibEntryMessage_FibEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FibEntryMessage_FibEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FibEntryMessage_FibEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FibEntryMessage_FibEntry& from) {
+    FibEntryMessage_FibEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FibEntryMessage_FibEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FibEntryMessage.FibEntry";
+  }
+  protected:
+  explicit FibEntryMessage_FibEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNextHopRecordsFieldNumber = 129,
+    kNameFieldNumber = 7,
+  };
+  // repeated .ndn_message.FibEntryMessage.NextHopRecord next_hop_records = 129;
+  int next_hop_records_size() const;
+  private:
+  int _internal_next_hop_records_size() const;
+  public:
+  void clear_next_hop_records();
+  ::ndn_message::FibEntryMessage_NextHopRecord* mutable_next_hop_records(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FibEntryMessage_NextHopRecord >*
+      mutable_next_hop_records();
+  private:
+  const ::ndn_message::FibEntryMessage_NextHopRecord& _internal_next_hop_records(int index) const;
+  ::ndn_message::FibEntryMessage_NextHopRecord* _internal_add_next_hop_records();
+  public:
+  const ::ndn_message::FibEntryMessage_NextHopRecord& next_hop_records(int index) const;
+  ::ndn_message::FibEntryMessage_NextHopRecord* add_next_hop_records();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FibEntryMessage_NextHopRecord >&
+      next_hop_records() const;
+
+  // required .ndn_message.FibEntryMessage.Name name = 7;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const ::ndn_message::FibEntryMessage_Name& name() const;
+  PROTOBUF_NODISCARD ::ndn_message::FibEntryMessage_Name* release_name();
+  ::ndn_message::FibEntryMessage_Name* mutable_name();
+  void set_allocated_name(::ndn_message::FibEntryMessage_Name* name);
+  private:
+  const ::ndn_message::FibEntryMessage_Name& _internal_name() const;
+  ::ndn_message::FibEntryMessage_Name* _internal_mutable_name();
+  public:
+  void unsafe_arena_set_allocated_name(
+      ::ndn_message::FibEntryMessage_Name* name);
+  ::ndn_message::FibEntryMessage_Name* unsafe_arena_release_name();
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FibEntryMessage.FibEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FibEntryMessage_NextHopRecord > next_hop_records_;
+    ::ndn_message::FibEntryMessage_Name* name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fib_2dentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FibEntryMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.FibEntryMessage) */ {
+ public:
+  inline FibEntryMessage() : FibEntryMessage(nullptr) {}
+  ~FibEntryMessage() override;
+  explicit PROTOBUF_CONSTEXPR FibEntryMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FibEntryMessage(const FibEntryMessage& from);
+  FibEntryMessage(FibEntryMessage&& from) noexcept
+    : FibEntryMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FibEntryMessage& operator=(const FibEntryMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FibEntryMessage& operator=(FibEntryMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FibEntryMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FibEntryMessage* internal_default_instance() {
+    return reinterpret_cast<const FibEntryMessage*>(
+               &_FibEntryMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(FibEntryMessage& a, FibEntryMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FibEntryMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FibEntryMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FibEntryMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FibEntryMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FibEntryMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FibEntryMessage& from) {
+    FibEntryMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FibEntryMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.FibEntryMessage";
+  }
+  protected:
+  explicit FibEntryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef FibEntryMessage_Name Name;
+  typedef FibEntryMessage_NextHopRecord NextHopRecord;
+  typedef FibEntryMessage_FibEntry FibEntry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFibEntryFieldNumber = 128,
+  };
+  // required .ndn_message.FibEntryMessage.FibEntry fib_entry = 128;
+  bool has_fib_entry() const;
+  private:
+  bool _internal_has_fib_entry() const;
+  public:
+  void clear_fib_entry();
+  const ::ndn_message::FibEntryMessage_FibEntry& fib_entry() const;
+  PROTOBUF_NODISCARD ::ndn_message::FibEntryMessage_FibEntry* release_fib_entry();
+  ::ndn_message::FibEntryMessage_FibEntry* mutable_fib_entry();
+  void set_allocated_fib_entry(::ndn_message::FibEntryMessage_FibEntry* fib_entry);
+  private:
+  const ::ndn_message::FibEntryMessage_FibEntry& _internal_fib_entry() const;
+  ::ndn_message::FibEntryMessage_FibEntry* _internal_mutable_fib_entry();
+  public:
+  void unsafe_arena_set_allocated_fib_entry(
+      ::ndn_message::FibEntryMessage_FibEntry* fib_entry);
+  ::ndn_message::FibEntryMessage_FibEntry* unsafe_arena_release_fib_entry();
+
+  // @@protoc_insertion_point(class_scope:ndn_message.FibEntryMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ndn_message::FibEntryMessage_FibEntry* fib_entry_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fib_2dentry_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// FibEntryMessage_Name
+
+// repeated bytes component = 8;
+inline int FibEntryMessage_Name::_internal_component_size() const {
+  return _impl_.component_.size();
+}
+inline int FibEntryMessage_Name::component_size() const {
+  return _internal_component_size();
+}
+inline void FibEntryMessage_Name::clear_component() {
+  _impl_.component_.Clear();
+}
+inline std::string* FibEntryMessage_Name::add_component() {
+  std::string* _s = _internal_add_component();
+  // @@protoc_insertion_point(field_add_mutable:ndn_message.FibEntryMessage.Name.component)
+  return _s;
+}
+inline const std::string& FibEntryMessage_Name::_internal_component(int index) const {
+  return _impl_.component_.Get(index);
+}
+inline const std::string& FibEntryMessage_Name::component(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.FibEntryMessage.Name.component)
+  return _internal_component(index);
+}
+inline std::string* FibEntryMessage_Name::mutable_component(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.FibEntryMessage.Name.component)
+  return _impl_.component_.Mutable(index);
+}
+inline void FibEntryMessage_Name::set_component(int index, const std::string& value) {
+  _impl_.component_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FibEntryMessage.Name.component)
+}
+inline void FibEntryMessage_Name::set_component(int index, std::string&& value) {
+  _impl_.component_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ndn_message.FibEntryMessage.Name.component)
+}
+inline void FibEntryMessage_Name::set_component(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.component_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ndn_message.FibEntryMessage.Name.component)
+}
+inline void FibEntryMessage_Name::set_component(int index, const void* value, size_t size) {
+  _impl_.component_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ndn_message.FibEntryMessage.Name.component)
+}
+inline std::string* FibEntryMessage_Name::_internal_add_component() {
+  return _impl_.component_.Add();
+}
+inline void FibEntryMessage_Name::add_component(const std::string& value) {
+  _impl_.component_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ndn_message.FibEntryMessage.Name.component)
+}
+inline void FibEntryMessage_Name::add_component(std::string&& value) {
+  _impl_.component_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ndn_message.FibEntryMessage.Name.component)
+}
+inline void FibEntryMessage_Name::add_component(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.component_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ndn_message.FibEntryMessage.Name.component)
+}
+inline void FibEntryMessage_Name::add_component(const void* value, size_t size) {
+  _impl_.component_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ndn_message.FibEntryMessage.Name.component)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+FibEntryMessage_Name::component() const {
+  // @@protoc_insertion_point(field_list:ndn_message.FibEntryMessage.Name.component)
+  return _impl_.component_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+FibEntryMessage_Name::mutable_component() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.FibEntryMessage.Name.component)
+  return &_impl_.component_;
+}
+
+// -------------------------------------------------------------------
+
+// FibEntryMessage_NextHopRecord
+
+// required uint32 face_id = 105;
+inline bool FibEntryMessage_NextHopRecord::_internal_has_face_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FibEntryMessage_NextHopRecord::has_face_id() const {
+  return _internal_has_face_id();
+}
+inline void FibEntryMessage_NextHopRecord::clear_face_id() {
+  _impl_.face_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t FibEntryMessage_NextHopRecord::_internal_face_id() const {
+  return _impl_.face_id_;
+}
+inline uint32_t FibEntryMessage_NextHopRecord::face_id() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FibEntryMessage.NextHopRecord.face_id)
+  return _internal_face_id();
+}
+inline void FibEntryMessage_NextHopRecord::_internal_set_face_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.face_id_ = value;
+}
+inline void FibEntryMessage_NextHopRecord::set_face_id(uint32_t value) {
+  _internal_set_face_id(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FibEntryMessage.NextHopRecord.face_id)
+}
+
+// required uint32 cost = 106;
+inline bool FibEntryMessage_NextHopRecord::_internal_has_cost() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool FibEntryMessage_NextHopRecord::has_cost() const {
+  return _internal_has_cost();
+}
+inline void FibEntryMessage_NextHopRecord::clear_cost() {
+  _impl_.cost_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t FibEntryMessage_NextHopRecord::_internal_cost() const {
+  return _impl_.cost_;
+}
+inline uint32_t FibEntryMessage_NextHopRecord::cost() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FibEntryMessage.NextHopRecord.cost)
+  return _internal_cost();
+}
+inline void FibEntryMessage_NextHopRecord::_internal_set_cost(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cost_ = value;
+}
+inline void FibEntryMessage_NextHopRecord::set_cost(uint32_t value) {
+  _internal_set_cost(value);
+  // @@protoc_insertion_point(field_set:ndn_message.FibEntryMessage.NextHopRecord.cost)
+}
+
+// -------------------------------------------------------------------
+
+// FibEntryMessage_FibEntry
+
+// required .ndn_message.FibEntryMessage.Name name = 7;
+inline bool FibEntryMessage_FibEntry::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.name_ != nullptr);
+  return value;
+}
+inline bool FibEntryMessage_FibEntry::has_name() const {
+  return _internal_has_name();
+}
+inline void FibEntryMessage_FibEntry::clear_name() {
+  if (_impl_.name_ != nullptr) _impl_.name_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ndn_message::FibEntryMessage_Name& FibEntryMessage_FibEntry::_internal_name() const {
+  const ::ndn_message::FibEntryMessage_Name* p = _impl_.name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::FibEntryMessage_Name&>(
+      ::ndn_message::_FibEntryMessage_Name_default_instance_);
+}
+inline const ::ndn_message::FibEntryMessage_Name& FibEntryMessage_FibEntry::name() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FibEntryMessage.FibEntry.name)
+  return _internal_name();
+}
+inline void FibEntryMessage_FibEntry::unsafe_arena_set_allocated_name(
+    ::ndn_message::FibEntryMessage_Name* name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.name_);
+  }
+  _impl_.name_ = name;
+  if (name) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.FibEntryMessage.FibEntry.name)
+}
+inline ::ndn_message::FibEntryMessage_Name* FibEntryMessage_FibEntry::release_name() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::FibEntryMessage_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::FibEntryMessage_Name* FibEntryMessage_FibEntry::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_release:ndn_message.FibEntryMessage.FibEntry.name)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::FibEntryMessage_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::FibEntryMessage_Name* FibEntryMessage_FibEntry::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::FibEntryMessage_Name>(GetArenaForAllocation());
+    _impl_.name_ = p;
+  }
+  return _impl_.name_;
+}
+inline ::ndn_message::FibEntryMessage_Name* FibEntryMessage_FibEntry::mutable_name() {
+  ::ndn_message::FibEntryMessage_Name* _msg = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ndn_message.FibEntryMessage.FibEntry.name)
+  return _msg;
+}
+inline void FibEntryMessage_FibEntry::set_allocated_name(::ndn_message::FibEntryMessage_Name* name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.name_;
+  }
+  if (name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(name);
+    if (message_arena != submessage_arena) {
+      name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, name, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_ = name;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.FibEntryMessage.FibEntry.name)
+}
+
+// repeated .ndn_message.FibEntryMessage.NextHopRecord next_hop_records = 129;
+inline int FibEntryMessage_FibEntry::_internal_next_hop_records_size() const {
+  return _impl_.next_hop_records_.size();
+}
+inline int FibEntryMessage_FibEntry::next_hop_records_size() const {
+  return _internal_next_hop_records_size();
+}
+inline void FibEntryMessage_FibEntry::clear_next_hop_records() {
+  _impl_.next_hop_records_.Clear();
+}
+inline ::ndn_message::FibEntryMessage_NextHopRecord* FibEntryMessage_FibEntry::mutable_next_hop_records(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.FibEntryMessage.FibEntry.next_hop_records)
+  return _impl_.next_hop_records_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FibEntryMessage_NextHopRecord >*
+FibEntryMessage_FibEntry::mutable_next_hop_records() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.FibEntryMessage.FibEntry.next_hop_records)
+  return &_impl_.next_hop_records_;
+}
+inline const ::ndn_message::FibEntryMessage_NextHopRecord& FibEntryMessage_FibEntry::_internal_next_hop_records(int index) const {
+  return _impl_.next_hop_records_.Get(index);
+}
+inline const ::ndn_message::FibEntryMessage_NextHopRecord& FibEntryMessage_FibEntry::next_hop_records(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.FibEntryMessage.FibEntry.next_hop_records)
+  return _internal_next_hop_records(index);
+}
+inline ::ndn_message::FibEntryMessage_NextHopRecord* FibEntryMessage_FibEntry::_internal_add_next_hop_records() {
+  return _impl_.next_hop_records_.Add();
+}
+inline ::ndn_message::FibEntryMessage_NextHopRecord* FibEntryMessage_FibEntry::add_next_hop_records() {
+  ::ndn_message::FibEntryMessage_NextHopRecord* _add = _internal_add_next_hop_records();
+  // @@protoc_insertion_point(field_add:ndn_message.FibEntryMessage.FibEntry.next_hop_records)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::FibEntryMessage_NextHopRecord >&
+FibEntryMessage_FibEntry::next_hop_records() const {
+  // @@protoc_insertion_point(field_list:ndn_message.FibEntryMessage.FibEntry.next_hop_records)
+  return _impl_.next_hop_records_;
+}
+
+// -------------------------------------------------------------------
+
+// FibEntryMessage
+
+// required .ndn_message.FibEntryMessage.FibEntry fib_entry = 128;
+inline bool FibEntryMessage::_internal_has_fib_entry() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.fib_entry_ != nullptr);
+  return value;
+}
+inline bool FibEntryMessage::has_fib_entry() const {
+  return _internal_has_fib_entry();
+}
+inline void FibEntryMessage::clear_fib_entry() {
+  if (_impl_.fib_entry_ != nullptr) _impl_.fib_entry_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ndn_message::FibEntryMessage_FibEntry& FibEntryMessage::_internal_fib_entry() const {
+  const ::ndn_message::FibEntryMessage_FibEntry* p = _impl_.fib_entry_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::FibEntryMessage_FibEntry&>(
+      ::ndn_message::_FibEntryMessage_FibEntry_default_instance_);
+}
+inline const ::ndn_message::FibEntryMessage_FibEntry& FibEntryMessage::fib_entry() const {
+  // @@protoc_insertion_point(field_get:ndn_message.FibEntryMessage.fib_entry)
+  return _internal_fib_entry();
+}
+inline void FibEntryMessage::unsafe_arena_set_allocated_fib_entry(
+    ::ndn_message::FibEntryMessage_FibEntry* fib_entry) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.fib_entry_);
+  }
+  _impl_.fib_entry_ = fib_entry;
+  if (fib_entry) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.FibEntryMessage.fib_entry)
+}
+inline ::ndn_message::FibEntryMessage_FibEntry* FibEntryMessage::release_fib_entry() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::FibEntryMessage_FibEntry* temp = _impl_.fib_entry_;
+  _impl_.fib_entry_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::FibEntryMessage_FibEntry* FibEntryMessage::unsafe_arena_release_fib_entry() {
+  // @@protoc_insertion_point(field_release:ndn_message.FibEntryMessage.fib_entry)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::FibEntryMessage_FibEntry* temp = _impl_.fib_entry_;
+  _impl_.fib_entry_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::FibEntryMessage_FibEntry* FibEntryMessage::_internal_mutable_fib_entry() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.fib_entry_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::FibEntryMessage_FibEntry>(GetArenaForAllocation());
+    _impl_.fib_entry_ = p;
+  }
+  return _impl_.fib_entry_;
+}
+inline ::ndn_message::FibEntryMessage_FibEntry* FibEntryMessage::mutable_fib_entry() {
+  ::ndn_message::FibEntryMessage_FibEntry* _msg = _internal_mutable_fib_entry();
+  // @@protoc_insertion_point(field_mutable:ndn_message.FibEntryMessage.fib_entry)
+  return _msg;
+}
+inline void FibEntryMessage::set_allocated_fib_entry(::ndn_message::FibEntryMessage_FibEntry* fib_entry) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.fib_entry_;
+  }
+  if (fib_entry) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(fib_entry);
+    if (message_arena != submessage_arena) {
+      fib_entry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, fib_entry, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.fib_entry_ = fib_entry;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.FibEntryMessage.fib_entry)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ndn_message
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_fib_2dentry_2eproto
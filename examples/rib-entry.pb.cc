@@ -0,0 +1,1173 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rib-entry.proto
+
+#include "rib-entry.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ndn_message {
+PROTOBUF_CONSTEXPR RibEntryMessage_Name::RibEntryMessage_Name(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.component_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RibEntryMessage_NameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RibEntryMessage_NameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RibEntryMessage_NameDefaultTypeInternal() {}
+  union {
+    RibEntryMessage_Name _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RibEntryMessage_NameDefaultTypeInternal _RibEntryMessage_Name_default_instance_;
+PROTOBUF_CONSTEXPR RibEntryMessage_Route::RibEntryMessage_Route(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.face_id_)*/0u
+  , /*decltype(_impl_.cost_)*/0u
+  , /*decltype(_impl_.flags_)*/0u
+  , /*decltype(_impl_.expiration_period_)*/0u
+  , /*decltype(_impl_.origin_)*/0u} {}
+struct RibEntryMessage_RouteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RibEntryMessage_RouteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RibEntryMessage_RouteDefaultTypeInternal() {}
+  union {
+    RibEntryMessage_Route _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RibEntryMessage_RouteDefaultTypeInternal _RibEntryMessage_Route_default_instance_;
+PROTOBUF_CONSTEXPR RibEntryMessage_RibEntry::RibEntryMessage_RibEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.routes_)*/{}
+  , /*decltype(_impl_.name_)*/nullptr} {}
+struct RibEntryMessage_RibEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RibEntryMessage_RibEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RibEntryMessage_RibEntryDefaultTypeInternal() {}
+  union {
+    RibEntryMessage_RibEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RibEntryMessage_RibEntryDefaultTypeInternal _RibEntryMessage_RibEntry_default_instance_;
+PROTOBUF_CONSTEXPR RibEntryMessage::RibEntryMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rib_entry_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RibEntryMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RibEntryMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RibEntryMessageDefaultTypeInternal() {}
+  union {
+    RibEntryMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RibEntryMessageDefaultTypeInternal _RibEntryMessage_default_instance_;
+}  // namespace ndn_message
+static ::_pb::Metadata file_level_metadata_rib_2dentry_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rib_2dentry_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rib_2dentry_2eproto = nullptr;
+
+const uint32_t TableStruct_rib_2dentry_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Name, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Name, _impl_.component_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Route, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Route, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Route, _impl_.face_id_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Route, _impl_.origin_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Route, _impl_.cost_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Route, _impl_.flags_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_Route, _impl_.expiration_period_),
+  0,
+  4,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_RibEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_RibEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_RibEntry, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage_RibEntry, _impl_.routes_),
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::RibEntryMessage, _impl_.rib_entry_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::ndn_message::RibEntryMessage_Name)},
+  { 7, 18, -1, sizeof(::ndn_message::RibEntryMessage_Route)},
+  { 23, 31, -1, sizeof(::ndn_message::RibEntryMessage_RibEntry)},
+  { 33, -1, -1, sizeof(::ndn_message::RibEntryMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ndn_message::_RibEntryMessage_Name_default_instance_._instance,
+  &::ndn_message::_RibEntryMessage_Route_default_instance_._instance,
+  &::ndn_message::_RibEntryMessage_RibEntry_default_instance_._instance,
+  &::ndn_message::_RibEntryMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_rib_2dentry_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017rib-entry.proto\022\013ndn_message\"\273\002\n\017RibEn"
+  "tryMessage\0229\n\trib_entry\030\200\001 \003(\0132%.ndn_mes"
+  "sage.RibEntryMessage.RibEntry\032\031\n\004Name\022\021\n"
+  "\tcomponent\030\010 \003(\014\032`\n\005Route\022\017\n\007face_id\030i \002"
+  "(\r\022\016\n\006origin\030o \002(\r\022\014\n\004cost\030j \002(\r\022\r\n\005flag"
+  "s\030l \002(\r\022\031\n\021expiration_period\030m \001(\r\032p\n\010Ri"
+  "bEntry\022/\n\004name\030\007 \002(\0132!.ndn_message.RibEn"
+  "tryMessage.Name\0223\n\006routes\030\201\001 \003(\0132\".ndn_m"
+  "essage.RibEntryMessage.Route"
+  ;
+static ::_pbi::once_flag descriptor_table_rib_2dentry_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rib_2dentry_2eproto = {
+    false, false, 348, descriptor_table_protodef_rib_2dentry_2eproto,
+    "rib-entry.proto",
+    &descriptor_table_rib_2dentry_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_rib_2dentry_2eproto::offsets,
+    file_level_metadata_rib_2dentry_2eproto, file_level_enum_descriptors_rib_2dentry_2eproto,
+    file_level_service_descriptors_rib_2dentry_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rib_2dentry_2eproto_getter() {
+  return &descriptor_table_rib_2dentry_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rib_2dentry_2eproto(&descriptor_table_rib_2dentry_2eproto);
+namespace ndn_message {
+
+// ===================================================================
+
+class RibEntryMessage_Name::_Internal {
+ public:
+};
+
+RibEntryMessage_Name::RibEntryMessage_Name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.RibEntryMessage.Name)
+}
+RibEntryMessage_Name::RibEntryMessage_Name(const RibEntryMessage_Name& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RibEntryMessage_Name* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){from._impl_.component_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.RibEntryMessage.Name)
+}
+
+inline void RibEntryMessage_Name::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RibEntryMessage_Name::~RibEntryMessage_Name() {
+  // @@protoc_insertion_point(destructor:ndn_message.RibEntryMessage.Name)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RibEntryMessage_Name::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.component_.~RepeatedPtrField();
+}
+
+void RibEntryMessage_Name::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RibEntryMessage_Name::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.RibEntryMessage.Name)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.component_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RibEntryMessage_Name::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes component = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_component();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RibEntryMessage_Name::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.RibEntryMessage.Name)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes component = 8;
+  for (int i = 0, n = this->_internal_component_size(); i < n; i++) {
+    const auto& s = this->_internal_component(i);
+    target = stream->WriteBytes(8, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.RibEntryMessage.Name)
+  return target;
+}
+
+size_t RibEntryMessage_Name::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.RibEntryMessage.Name)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes component = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.component_.size());
+  for (int i = 0, n = _impl_.component_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.component_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RibEntryMessage_Name::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RibEntryMessage_Name::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RibEntryMessage_Name::GetClassData() const { return &_class_data_; }
+
+
+void RibEntryMessage_Name::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RibEntryMessage_Name*>(&to_msg);
+  auto& from = static_cast<const RibEntryMessage_Name&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.RibEntryMessage.Name)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.component_.MergeFrom(from._impl_.component_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RibEntryMessage_Name::CopyFrom(const RibEntryMessage_Name& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.RibEntryMessage.Name)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RibEntryMessage_Name::IsInitialized() const {
+  return true;
+}
+
+void RibEntryMessage_Name::InternalSwap(RibEntryMessage_Name* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.component_.InternalSwap(&other->_impl_.component_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RibEntryMessage_Name::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rib_2dentry_2eproto_getter, &descriptor_table_rib_2dentry_2eproto_once,
+      file_level_metadata_rib_2dentry_2eproto[0]);
+}
+
+// ===================================================================
+
+class RibEntryMessage_Route::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RibEntryMessage_Route>()._impl_._has_bits_);
+  static void set_has_face_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_origin(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cost(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_expiration_period(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000017) ^ 0x00000017) != 0;
+  }
+};
+
+RibEntryMessage_Route::RibEntryMessage_Route(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.RibEntryMessage.Route)
+}
+RibEntryMessage_Route::RibEntryMessage_Route(const RibEntryMessage_Route& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RibEntryMessage_Route* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.face_id_){}
+    , decltype(_impl_.cost_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.expiration_period_){}
+    , decltype(_impl_.origin_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.face_id_, &from._impl_.face_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.origin_) -
+    reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.origin_));
+  // @@protoc_insertion_point(copy_constructor:ndn_message.RibEntryMessage.Route)
+}
+
+inline void RibEntryMessage_Route::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.face_id_){0u}
+    , decltype(_impl_.cost_){0u}
+    , decltype(_impl_.flags_){0u}
+    , decltype(_impl_.expiration_period_){0u}
+    , decltype(_impl_.origin_){0u}
+  };
+}
+
+RibEntryMessage_Route::~RibEntryMessage_Route() {
+  // @@protoc_insertion_point(destructor:ndn_message.RibEntryMessage.Route)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RibEntryMessage_Route::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RibEntryMessage_Route::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RibEntryMessage_Route::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.RibEntryMessage.Route)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.face_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.origin_) -
+        reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.origin_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RibEntryMessage_Route::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 face_id = 105;
+      case 105:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_face_id(&has_bits);
+          _impl_.face_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 cost = 106;
+      case 106:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_cost(&has_bits);
+          _impl_.cost_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 flags = 108;
+      case 108:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 expiration_period = 109;
+      case 109:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_expiration_period(&has_bits);
+          _impl_.expiration_period_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 origin = 111;
+      case 111:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_origin(&has_bits);
+          _impl_.origin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RibEntryMessage_Route::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.RibEntryMessage.Route)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 face_id = 105;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(105, this->_internal_face_id(), target);
+  }
+
+  // required uint32 cost = 106;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(106, this->_internal_cost(), target);
+  }
+
+  // required uint32 flags = 108;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(108, this->_internal_flags(), target);
+  }
+
+  // optional uint32 expiration_period = 109;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(109, this->_internal_expiration_period(), target);
+  }
+
+  // required uint32 origin = 111;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(111, this->_internal_origin(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.RibEntryMessage.Route)
+  return target;
+}
+
+size_t RibEntryMessage_Route::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ndn_message.RibEntryMessage.Route)
+  size_t total_size = 0;
+
+  if (_internal_has_face_id()) {
+    // required uint32 face_id = 105;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_face_id());
+  }
+
+  if (_internal_has_cost()) {
+    // required uint32 cost = 106;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_cost());
+  }
+
+  if (_internal_has_flags()) {
+    // required uint32 flags = 108;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_flags());
+  }
+
+  if (_internal_has_origin()) {
+    // required uint32 origin = 111;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_origin());
+  }
+
+  return total_size;
+}
+size_t RibEntryMessage_Route::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.RibEntryMessage.Route)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000017) ^ 0x00000017) == 0) {  // All required fields are present.
+    // required uint32 face_id = 105;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_face_id());
+
+    // required uint32 cost = 106;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_cost());
+
+    // required uint32 flags = 108;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_flags());
+
+    // required uint32 origin = 111;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_origin());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint32 expiration_period = 109;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000008u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_expiration_period());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RibEntryMessage_Route::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RibEntryMessage_Route::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RibEntryMessage_Route::GetClassData() const { return &_class_data_; }
+
+
+void RibEntryMessage_Route::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RibEntryMessage_Route*>(&to_msg);
+  auto& from = static_cast<const RibEntryMessage_Route&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.RibEntryMessage.Route)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.face_id_ = from._impl_.face_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.cost_ = from._impl_.cost_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.expiration_period_ = from._impl_.expiration_period_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.origin_ = from._impl_.origin_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RibEntryMessage_Route::CopyFrom(const RibEntryMessage_Route& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.RibEntryMessage.Route)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RibEntryMessage_Route::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void RibEntryMessage_Route::InternalSwap(RibEntryMessage_Route* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RibEntryMessage_Route, _impl_.origin_)
+      + sizeof(RibEntryMessage_Route::_impl_.origin_)
+      - PROTOBUF_FIELD_OFFSET(RibEntryMessage_Route, _impl_.face_id_)>(
+          reinterpret_cast<char*>(&_impl_.face_id_),
+          reinterpret_cast<char*>(&other->_impl_.face_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RibEntryMessage_Route::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rib_2dentry_2eproto_getter, &descriptor_table_rib_2dentry_2eproto_once,
+      file_level_metadata_rib_2dentry_2eproto[1]);
+}
+
+// ===================================================================
+
+class RibEntryMessage_RibEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RibEntryMessage_RibEntry>()._impl_._has_bits_);
+  static const ::ndn_message::RibEntryMessage_Name& name(const RibEntryMessage_RibEntry* msg);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::ndn_message::RibEntryMessage_Name&
+RibEntryMessage_RibEntry::_Internal::name(const RibEntryMessage_RibEntry* msg) {
+  return *msg->_impl_.name_;
+}
+RibEntryMessage_RibEntry::RibEntryMessage_RibEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.RibEntryMessage.RibEntry)
+}
+RibEntryMessage_RibEntry::RibEntryMessage_RibEntry(const RibEntryMessage_RibEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RibEntryMessage_RibEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.routes_){from._impl_.routes_}
+    , decltype(_impl_.name_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_name()) {
+    _this->_impl_.name_ = new ::ndn_message::RibEntryMessage_Name(*from._impl_.name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.RibEntryMessage.RibEntry)
+}
+
+inline void RibEntryMessage_RibEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.routes_){arena}
+    , decltype(_impl_.name_){nullptr}
+  };
+}
+
+RibEntryMessage_RibEntry::~RibEntryMessage_RibEntry() {
+  // @@protoc_insertion_point(destructor:ndn_message.RibEntryMessage.RibEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RibEntryMessage_RibEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.routes_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.name_;
+}
+
+void RibEntryMessage_RibEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RibEntryMessage_RibEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.RibEntryMessage.RibEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.routes_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.name_ != nullptr);
+    _impl_.name_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RibEntryMessage_RibEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ndn_message.RibEntryMessage.Name name = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ndn_message.RibEntryMessage.Route routes = 129;
+      case 129:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_routes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<1034>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RibEntryMessage_RibEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.RibEntryMessage.RibEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ndn_message.RibEntryMessage.Name name = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::name(this),
+        _Internal::name(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .ndn_message.RibEntryMessage.Route routes = 129;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_routes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_routes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(129, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.RibEntryMessage.RibEntry)
+  return target;
+}
+
+size_t RibEntryMessage_RibEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.RibEntryMessage.RibEntry)
+  size_t total_size = 0;
+
+  // required .ndn_message.RibEntryMessage.Name name = 7;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.name_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.RibEntryMessage.Route routes = 129;
+  total_size += 2UL * this->_internal_routes_size();
+  for (const auto& msg : this->_impl_.routes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RibEntryMessage_RibEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RibEntryMessage_RibEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RibEntryMessage_RibEntry::GetClassData() const { return &_class_data_; }
+
+
+void RibEntryMessage_RibEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RibEntryMessage_RibEntry*>(&to_msg);
+  auto& from = static_cast<const RibEntryMessage_RibEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.RibEntryMessage.RibEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.routes_.MergeFrom(from._impl_.routes_);
+  if (from._internal_has_name()) {
+    _this->_internal_mutable_name()->::ndn_message::RibEntryMessage_Name::MergeFrom(
+        from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RibEntryMessage_RibEntry::CopyFrom(const RibEntryMessage_RibEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.RibEntryMessage.RibEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RibEntryMessage_RibEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.routes_))
+    return false;
+  return true;
+}
+
+void RibEntryMessage_RibEntry::InternalSwap(RibEntryMessage_RibEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.routes_.InternalSwap(&other->_impl_.routes_);
+  swap(_impl_.name_, other->_impl_.name_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RibEntryMessage_RibEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rib_2dentry_2eproto_getter, &descriptor_table_rib_2dentry_2eproto_once,
+      file_level_metadata_rib_2dentry_2eproto[2]);
+}
+
+// ===================================================================
+
+class RibEntryMessage::_Internal {
+ public:
+};
+
+RibEntryMessage::RibEntryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.RibEntryMessage)
+}
+RibEntryMessage::RibEntryMessage(const RibEntryMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RibEntryMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rib_entry_){from._impl_.rib_entry_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.RibEntryMessage)
+}
+
+inline void RibEntryMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rib_entry_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RibEntryMessage::~RibEntryMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.RibEntryMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RibEntryMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rib_entry_.~RepeatedPtrField();
+}
+
+void RibEntryMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RibEntryMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.RibEntryMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rib_entry_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RibEntryMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ndn_message.RibEntryMessage.RibEntry rib_entry = 128;
+      case 128:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_rib_entry(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<1026>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RibEntryMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.RibEntryMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.RibEntryMessage.RibEntry rib_entry = 128;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rib_entry_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rib_entry(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(128, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.RibEntryMessage)
+  return target;
+}
+
+size_t RibEntryMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.RibEntryMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.RibEntryMessage.RibEntry rib_entry = 128;
+  total_size += 2UL * this->_internal_rib_entry_size();
+  for (const auto& msg : this->_impl_.rib_entry_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RibEntryMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RibEntryMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RibEntryMessage::GetClassData() const { return &_class_data_; }
+
+
+void RibEntryMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RibEntryMessage*>(&to_msg);
+  auto& from = static_cast<const RibEntryMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.RibEntryMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rib_entry_.MergeFrom(from._impl_.rib_entry_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RibEntryMessage::CopyFrom(const RibEntryMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.RibEntryMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RibEntryMessage::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.rib_entry_))
+    return false;
+  return true;
+}
+
+void RibEntryMessage::InternalSwap(RibEntryMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rib_entry_.InternalSwap(&other->_impl_.rib_entry_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RibEntryMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rib_2dentry_2eproto_getter, &descriptor_table_rib_2dentry_2eproto_once,
+      file_level_metadata_rib_2dentry_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ndn_message::RibEntryMessage_Name*
+Arena::CreateMaybeMessage< ::ndn_message::RibEntryMessage_Name >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::RibEntryMessage_Name >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::RibEntryMessage_Route*
+Arena::CreateMaybeMessage< ::ndn_message::RibEntryMessage_Route >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::RibEntryMessage_Route >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::RibEntryMessage_RibEntry*
+Arena::CreateMaybeMessage< ::ndn_message::RibEntryMessage_RibEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::RibEntryMessage_RibEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::RibEntryMessage*
+Arena::CreateMaybeMessage< ::ndn_message::RibEntryMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::RibEntryMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
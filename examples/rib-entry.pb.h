@@ -0,0 +1,1240 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rib-entry.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rib_2dentry_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rib_2dentry_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rib_2dentry_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rib_2dentry_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rib_2dentry_2eproto;
+namespace ndn_message {
+class RibEntryMessage;
+struct RibEntryMessageDefaultTypeInternal;
+extern RibEntryMessageDefaultTypeInternal _RibEntryMessage_default_instance_;
+class RibEntryMessage_Name;
+struct RibEntryMessage_NameDefaultTypeInternal;
+extern RibEntryMessage_NameDefaultTypeInternal _RibEntryMessage_Name_default_instance_;
+class RibEntryMessage_RibEntry;
+struct RibEntryMessage_RibEntryDefaultTypeInternal;
+extern RibEntryMessage_RibEntryDefaultTypeInternal _RibEntryMessage_RibEntry_default_instance_;
+class RibEntryMessage_Route;
+struct RibEntryMessage_RouteDefaultTypeInternal;
+extern RibEntryMessage_RouteDefaultTypeInternal _RibEntryMessage_Route_default_instance_;
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ndn_message::RibEntryMessage* Arena::CreateMaybeMessage<::ndn_message::RibEntryMessage>(Arena*);
+template<> ::ndn_message::RibEntryMessage_Name* Arena::CreateMaybeMessage<::ndn_message::RibEntryMessage_Name>(Arena*);
+template<> ::ndn_message::RibEntryMessage_RibEntry* Arena::CreateMaybeMessage<::ndn_message::RibEntryMessage_RibEntry>(Arena*);
+template<> ::ndn_message::RibEntryMessage_Route* Arena::CreateMaybeMessage<::ndn_message::RibEntryMessage_Route>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ndn_message {
+
+// ===================================================================
+
+class RibEntryMessage_Name final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.RibEntryMessage.Name) */ {
+ public:
+  inline RibEntryMessage_Name() : RibEntryMessage_Name(nullptr) {}
+  ~RibEntryMessage_Name() override;
+  explicit PROTOBUF_CONSTEXPR RibEntryMessage_Name(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RibEntryMessage_Name(const RibEntryMessage_Name& from);
+  RibEntryMessage_Name(RibEntryMessage_Name&& from) noexcept
+    : RibEntryMessage_Name() {
+    *this = ::std::move(from);
+  }
+
+  inline RibEntryMessage_Name& operator=(const RibEntryMessage_Name& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RibEntryMessage_Name& operator=(RibEntryMessage_Name&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RibEntryMessage_Name& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RibEntryMessage_Name* internal_default_instance() {
+    return reinterpret_cast<const RibEntryMessage_Name*>(
+               &_RibEntryMessage_Name_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RibEntryMessage_Name& a, RibEntryMessage_Name& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RibEntryMessage_Name* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RibEntryMessage_Name* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RibEntryMessage_Name* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RibEntryMessage_Name>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RibEntryMessage_Name& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RibEntryMessage_Name& from) {
+    RibEntryMessage_Name::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RibEntryMessage_Name* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.RibEntryMessage.Name";
+  }
+  protected:
+  explicit RibEntryMessage_Name(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComponentFieldNumber = 8,
+  };
+  // repeated bytes component = 8;
+  int component_size() const;
+  private:
+  int _internal_component_size() const;
+  public:
+  void clear_component();
+  const std::string& component(int index) const;
+  std::string* mutable_component(int index);
+  void set_component(int index, const std::string& value);
+  void set_component(int index, std::string&& value);
+  void set_component(int index, const char* value);
+  void set_component(int index, const void* value, size_t size);
+  std::string* add_component();
+  void add_component(const std::string& value);
+  void add_component(std::string&& value);
+  void add_component(const char* value);
+  void add_component(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& component() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_component();
+  private:
+  const std::string& _internal_component(int index) const;
+  std::string* _internal_add_component();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.RibEntryMessage.Name)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> component_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rib_2dentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RibEntryMessage_Route final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.RibEntryMessage.Route) */ {
+ public:
+  inline RibEntryMessage_Route() : RibEntryMessage_Route(nullptr) {}
+  ~RibEntryMessage_Route() override;
+  explicit PROTOBUF_CONSTEXPR RibEntryMessage_Route(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RibEntryMessage_Route(const RibEntryMessage_Route& from);
+  RibEntryMessage_Route(RibEntryMessage_Route&& from) noexcept
+    : RibEntryMessage_Route() {
+    *this = ::std::move(from);
+  }
+
+  inline RibEntryMessage_Route& operator=(const RibEntryMessage_Route& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RibEntryMessage_Route& operator=(RibEntryMessage_Route&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RibEntryMessage_Route& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RibEntryMessage_Route* internal_default_instance() {
+    return reinterpret_cast<const RibEntryMessage_Route*>(
+               &_RibEntryMessage_Route_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RibEntryMessage_Route& a, RibEntryMessage_Route& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RibEntryMessage_Route* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RibEntryMessage_Route* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RibEntryMessage_Route* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RibEntryMessage_Route>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RibEntryMessage_Route& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RibEntryMessage_Route& from) {
+    RibEntryMessage_Route::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RibEntryMessage_Route* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.RibEntryMessage.Route";
+  }
+  protected:
+  explicit RibEntryMessage_Route(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFaceIdFieldNumber = 105,
+    kCostFieldNumber = 106,
+    kFlagsFieldNumber = 108,
+    kExpirationPeriodFieldNumber = 109,
+    kOriginFieldNumber = 111,
+  };
+  // required uint32 face_id = 105;
+  bool has_face_id() const;
+  private:
+  bool _internal_has_face_id() const;
+  public:
+  void clear_face_id();
+  uint32_t face_id() const;
+  void set_face_id(uint32_t value);
+  private:
+  uint32_t _internal_face_id() const;
+  void _internal_set_face_id(uint32_t value);
+  public:
+
+  // required uint32 cost = 106;
+  bool has_cost() const;
+  private:
+  bool _internal_has_cost() const;
+  public:
+  void clear_cost();
+  uint32_t cost() const;
+  void set_cost(uint32_t value);
+  private:
+  uint32_t _internal_cost() const;
+  void _internal_set_cost(uint32_t value);
+  public:
+
+  // required uint32 flags = 108;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  uint32_t flags() const;
+  void set_flags(uint32_t value);
+  private:
+  uint32_t _internal_flags() const;
+  void _internal_set_flags(uint32_t value);
+  public:
+
+  // optional uint32 expiration_period = 109;
+  bool has_expiration_period() const;
+  private:
+  bool _internal_has_expiration_period() const;
+  public:
+  void clear_expiration_period();
+  uint32_t expiration_period() const;
+  void set_expiration_period(uint32_t value);
+  private:
+  uint32_t _internal_expiration_period() const;
+  void _internal_set_expiration_period(uint32_t value);
+  public:
+
+  // required uint32 origin = 111;
+  bool has_origin() const;
+  private:
+  bool _internal_has_origin() const;
+  public:
+  void clear_origin();
+  uint32_t origin() const;
+  void set_origin(uint32_t value);
+  private:
+  uint32_t _internal_origin() const;
+  void _internal_set_origin(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.RibEntryMessage.Route)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t face_id_;
+    uint32_t cost_;
+    uint32_t flags_;
+    uint32_t expiration_period_;
+    uint32_t origin_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rib_2dentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RibEntryMessage_RibEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.RibEntryMessage.RibEntry) */ {
+ public:
+  inline RibEntryMessage_RibEntry() : RibEntryMessage_RibEntry(nullptr) {}
+  ~RibEntryMessage_RibEntry() override;
+  explicit PROTOBUF_CONSTEXPR RibEntryMessage_RibEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RibEntryMessage_RibEntry(const RibEntryMessage_RibEntry& from);
+  RibEntryMessage_RibEntry(RibEntryMessage_RibEntry&& from) noexcept
+    : RibEntryMessage_RibEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline RibEntryMessage_RibEntry& operator=(const RibEntryMessage_RibEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RibEntryMessage_RibEntry& operator=(RibEntryMessage_RibEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RibEntryMessage_RibEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RibEntryMessage_RibEntry* internal_default_instance() {
+    return reinterpret_cast<const RibEntryMessage_RibEntry*>(
+               &_RibEntryMessage_RibEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(RibEntryMessage_RibEntry& a, RibEntryMessage_RibEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RibEntryMessage_RibEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RibEntryMessage_RibEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RibEntryMessage_RibEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RibEntryMessage_RibEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RibEntryMessage_RibEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RibEntryMessage_RibEntry& from) {
+    RibEntryMessage_RibEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RibEntryMessage_RibEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.RibEntryMessage.RibEntry";
+  }
+  protected:
+  explicit RibEntryMessage_RibEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoutesFieldNumber = 129,
+    kNameFieldNumber = 7,
+  };
+  // repeated .ndn_message.RibEntryMessage.Route routes = 129;
+  int routes_size() const;
+  private:
+  int _internal_routes_size() const;
+  public:
+  void clear_routes();
+  ::ndn_message::RibEntryMessage_Route* mutable_routes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_Route >*
+      mutable_routes();
+  private:
+  const ::ndn_message::RibEntryMessage_Route& _internal_routes(int index) const;
+  ::ndn_message::RibEntryMessage_Route* _internal_add_routes();
+  public:
+  const ::ndn_message::RibEntryMessage_Route& routes(int index) const;
+  ::ndn_message::RibEntryMessage_Route* add_routes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_Route >&
+      routes() const;
+
+  // required .ndn_message.RibEntryMessage.Name name = 7;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const ::ndn_message::RibEntryMessage_Name& name() const;
+  PROTOBUF_NODISCARD ::ndn_message::RibEntryMessage_Name* release_name();
+  ::ndn_message::RibEntryMessage_Name* mutable_name();
+  void set_allocated_name(::ndn_message::RibEntryMessage_Name* name);
+  private:
+  const ::ndn_message::RibEntryMessage_Name& _internal_name() const;
+  ::ndn_message::RibEntryMessage_Name* _internal_mutable_name();
+  public:
+  void unsafe_arena_set_allocated_name(
+      ::ndn_message::RibEntryMessage_Name* name);
+  ::ndn_message::RibEntryMessage_Name* unsafe_arena_release_name();
+
+  // @@protoc_insertion_point(class_scope:ndn_message.RibEntryMessage.RibEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_Route > routes_;
+    ::ndn_message::RibEntryMessage_Name* name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rib_2dentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RibEntryMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.RibEntryMessage) */ {
+ public:
+  inline RibEntryMessage() : RibEntryMessage(nullptr) {}
+  ~RibEntryMessage() override;
+  explicit PROTOBUF_CONSTEXPR RibEntryMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RibEntryMessage(const RibEntryMessage& from);
+  RibEntryMessage(RibEntryMessage&& from) noexcept
+    : RibEntryMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RibEntryMessage& operator=(const RibEntryMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RibEntryMessage& operator=(RibEntryMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RibEntryMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RibEntryMessage* internal_default_instance() {
+    return reinterpret_cast<const RibEntryMessage*>(
+               &_RibEntryMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RibEntryMessage& a, RibEntryMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RibEntryMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RibEntryMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RibEntryMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RibEntryMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RibEntryMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RibEntryMessage& from) {
+    RibEntryMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RibEntryMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.RibEntryMessage";
+  }
+  protected:
+  explicit RibEntryMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef RibEntryMessage_Name Name;
+  typedef RibEntryMessage_Route Route;
+  typedef RibEntryMessage_RibEntry RibEntry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRibEntryFieldNumber = 128,
+  };
+  // repeated .ndn_message.RibEntryMessage.RibEntry rib_entry = 128;
+  int rib_entry_size() const;
+  private:
+  int _internal_rib_entry_size() const;
+  public:
+  void clear_rib_entry();
+  ::ndn_message::RibEntryMessage_RibEntry* mutable_rib_entry(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_RibEntry >*
+      mutable_rib_entry();
+  private:
+  const ::ndn_message::RibEntryMessage_RibEntry& _internal_rib_entry(int index) const;
+  ::ndn_message::RibEntryMessage_RibEntry* _internal_add_rib_entry();
+  public:
+  const ::ndn_message::RibEntryMessage_RibEntry& rib_entry(int index) const;
+  ::ndn_message::RibEntryMessage_RibEntry* add_rib_entry();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_RibEntry >&
+      rib_entry() const;
+
+  // @@protoc_insertion_point(class_scope:ndn_message.RibEntryMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_RibEntry > rib_entry_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rib_2dentry_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RibEntryMessage_Name
+
+// repeated bytes component = 8;
+inline int RibEntryMessage_Name::_internal_component_size() const {
+  return _impl_.component_.size();
+}
+inline int RibEntryMessage_Name::component_size() const {
+  return _internal_component_size();
+}
+inline void RibEntryMessage_Name::clear_component() {
+  _impl_.component_.Clear();
+}
+inline std::string* RibEntryMessage_Name::add_component() {
+  std::string* _s = _internal_add_component();
+  // @@protoc_insertion_point(field_add_mutable:ndn_message.RibEntryMessage.Name.component)
+  return _s;
+}
+inline const std::string& RibEntryMessage_Name::_internal_component(int index) const {
+  return _impl_.component_.Get(index);
+}
+inline const std::string& RibEntryMessage_Name::component(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.Name.component)
+  return _internal_component(index);
+}
+inline std::string* RibEntryMessage_Name::mutable_component(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.RibEntryMessage.Name.component)
+  return _impl_.component_.Mutable(index);
+}
+inline void RibEntryMessage_Name::set_component(int index, const std::string& value) {
+  _impl_.component_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ndn_message.RibEntryMessage.Name.component)
+}
+inline void RibEntryMessage_Name::set_component(int index, std::string&& value) {
+  _impl_.component_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ndn_message.RibEntryMessage.Name.component)
+}
+inline void RibEntryMessage_Name::set_component(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.component_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ndn_message.RibEntryMessage.Name.component)
+}
+inline void RibEntryMessage_Name::set_component(int index, const void* value, size_t size) {
+  _impl_.component_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ndn_message.RibEntryMessage.Name.component)
+}
+inline std::string* RibEntryMessage_Name::_internal_add_component() {
+  return _impl_.component_.Add();
+}
+inline void RibEntryMessage_Name::add_component(const std::string& value) {
+  _impl_.component_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ndn_message.RibEntryMessage.Name.component)
+}
+inline void RibEntryMessage_Name::add_component(std::string&& value) {
+  _impl_.component_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ndn_message.RibEntryMessage.Name.component)
+}
+inline void RibEntryMessage_Name::add_component(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.component_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ndn_message.RibEntryMessage.Name.component)
+}
+inline void RibEntryMessage_Name::add_component(const void* value, size_t size) {
+  _impl_.component_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ndn_message.RibEntryMessage.Name.component)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+RibEntryMessage_Name::component() const {
+  // @@protoc_insertion_point(field_list:ndn_message.RibEntryMessage.Name.component)
+  return _impl_.component_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+RibEntryMessage_Name::mutable_component() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.RibEntryMessage.Name.component)
+  return &_impl_.component_;
+}
+
+// -------------------------------------------------------------------
+
+// RibEntryMessage_Route
+
+// required uint32 face_id = 105;
+inline bool RibEntryMessage_Route::_internal_has_face_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RibEntryMessage_Route::has_face_id() const {
+  return _internal_has_face_id();
+}
+inline void RibEntryMessage_Route::clear_face_id() {
+  _impl_.face_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t RibEntryMessage_Route::_internal_face_id() const {
+  return _impl_.face_id_;
+}
+inline uint32_t RibEntryMessage_Route::face_id() const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.Route.face_id)
+  return _internal_face_id();
+}
+inline void RibEntryMessage_Route::_internal_set_face_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.face_id_ = value;
+}
+inline void RibEntryMessage_Route::set_face_id(uint32_t value) {
+  _internal_set_face_id(value);
+  // @@protoc_insertion_point(field_set:ndn_message.RibEntryMessage.Route.face_id)
+}
+
+// required uint32 origin = 111;
+inline bool RibEntryMessage_Route::_internal_has_origin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool RibEntryMessage_Route::has_origin() const {
+  return _internal_has_origin();
+}
+inline void RibEntryMessage_Route::clear_origin() {
+  _impl_.origin_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t RibEntryMessage_Route::_internal_origin() const {
+  return _impl_.origin_;
+}
+inline uint32_t RibEntryMessage_Route::origin() const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.Route.origin)
+  return _internal_origin();
+}
+inline void RibEntryMessage_Route::_internal_set_origin(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.origin_ = value;
+}
+inline void RibEntryMessage_Route::set_origin(uint32_t value) {
+  _internal_set_origin(value);
+  // @@protoc_insertion_point(field_set:ndn_message.RibEntryMessage.Route.origin)
+}
+
+// required uint32 cost = 106;
+inline bool RibEntryMessage_Route::_internal_has_cost() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RibEntryMessage_Route::has_cost() const {
+  return _internal_has_cost();
+}
+inline void RibEntryMessage_Route::clear_cost() {
+  _impl_.cost_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t RibEntryMessage_Route::_internal_cost() const {
+  return _impl_.cost_;
+}
+inline uint32_t RibEntryMessage_Route::cost() const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.Route.cost)
+  return _internal_cost();
+}
+inline void RibEntryMessage_Route::_internal_set_cost(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cost_ = value;
+}
+inline void RibEntryMessage_Route::set_cost(uint32_t value) {
+  _internal_set_cost(value);
+  // @@protoc_insertion_point(field_set:ndn_message.RibEntryMessage.Route.cost)
+}
+
+// required uint32 flags = 108;
+inline bool RibEntryMessage_Route::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RibEntryMessage_Route::has_flags() const {
+  return _internal_has_flags();
+}
+inline void RibEntryMessage_Route::clear_flags() {
+  _impl_.flags_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t RibEntryMessage_Route::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline uint32_t RibEntryMessage_Route::flags() const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.Route.flags)
+  return _internal_flags();
+}
+inline void RibEntryMessage_Route::_internal_set_flags(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.flags_ = value;
+}
+inline void RibEntryMessage_Route::set_flags(uint32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:ndn_message.RibEntryMessage.Route.flags)
+}
+
+// optional uint32 expiration_period = 109;
+inline bool RibEntryMessage_Route::_internal_has_expiration_period() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool RibEntryMessage_Route::has_expiration_period() const {
+  return _internal_has_expiration_period();
+}
+inline void RibEntryMessage_Route::clear_expiration_period() {
+  _impl_.expiration_period_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t RibEntryMessage_Route::_internal_expiration_period() const {
+  return _impl_.expiration_period_;
+}
+inline uint32_t RibEntryMessage_Route::expiration_period() const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.Route.expiration_period)
+  return _internal_expiration_period();
+}
+inline void RibEntryMessage_Route::_internal_set_expiration_period(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.expiration_period_ = value;
+}
+inline void RibEntryMessage_Route::set_expiration_period(uint32_t value) {
+  _internal_set_expiration_period(value);
+  // @@protoc_insertion_point(field_set:ndn_message.RibEntryMessage.Route.expiration_period)
+}
+
+// -------------------------------------------------------------------
+
+// RibEntryMessage_RibEntry
+
+// required .ndn_message.RibEntryMessage.Name name = 7;
+inline bool RibEntryMessage_RibEntry::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.name_ != nullptr);
+  return value;
+}
+inline bool RibEntryMessage_RibEntry::has_name() const {
+  return _internal_has_name();
+}
+inline void RibEntryMessage_RibEntry::clear_name() {
+  if (_impl_.name_ != nullptr) _impl_.name_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ndn_message::RibEntryMessage_Name& RibEntryMessage_RibEntry::_internal_name() const {
+  const ::ndn_message::RibEntryMessage_Name* p = _impl_.name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::RibEntryMessage_Name&>(
+      ::ndn_message::_RibEntryMessage_Name_default_instance_);
+}
+inline const ::ndn_message::RibEntryMessage_Name& RibEntryMessage_RibEntry::name() const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.RibEntry.name)
+  return _internal_name();
+}
+inline void RibEntryMessage_RibEntry::unsafe_arena_set_allocated_name(
+    ::ndn_message::RibEntryMessage_Name* name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.name_);
+  }
+  _impl_.name_ = name;
+  if (name) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.RibEntryMessage.RibEntry.name)
+}
+inline ::ndn_message::RibEntryMessage_Name* RibEntryMessage_RibEntry::release_name() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::RibEntryMessage_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::RibEntryMessage_Name* RibEntryMessage_RibEntry::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_release:ndn_message.RibEntryMessage.RibEntry.name)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::RibEntryMessage_Name* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::RibEntryMessage_Name* RibEntryMessage_RibEntry::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::RibEntryMessage_Name>(GetArenaForAllocation());
+    _impl_.name_ = p;
+  }
+  return _impl_.name_;
+}
+inline ::ndn_message::RibEntryMessage_Name* RibEntryMessage_RibEntry::mutable_name() {
+  ::ndn_message::RibEntryMessage_Name* _msg = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ndn_message.RibEntryMessage.RibEntry.name)
+  return _msg;
+}
+inline void RibEntryMessage_RibEntry::set_allocated_name(::ndn_message::RibEntryMessage_Name* name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.name_;
+  }
+  if (name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(name);
+    if (message_arena != submessage_arena) {
+      name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, name, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_ = name;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.RibEntryMessage.RibEntry.name)
+}
+
+// repeated .ndn_message.RibEntryMessage.Route routes = 129;
+inline int RibEntryMessage_RibEntry::_internal_routes_size() const {
+  return _impl_.routes_.size();
+}
+inline int RibEntryMessage_RibEntry::routes_size() const {
+  return _internal_routes_size();
+}
+inline void RibEntryMessage_RibEntry::clear_routes() {
+  _impl_.routes_.Clear();
+}
+inline ::ndn_message::RibEntryMessage_Route* RibEntryMessage_RibEntry::mutable_routes(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.RibEntryMessage.RibEntry.routes)
+  return _impl_.routes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_Route >*
+RibEntryMessage_RibEntry::mutable_routes() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.RibEntryMessage.RibEntry.routes)
+  return &_impl_.routes_;
+}
+inline const ::ndn_message::RibEntryMessage_Route& RibEntryMessage_RibEntry::_internal_routes(int index) const {
+  return _impl_.routes_.Get(index);
+}
+inline const ::ndn_message::RibEntryMessage_Route& RibEntryMessage_RibEntry::routes(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.RibEntry.routes)
+  return _internal_routes(index);
+}
+inline ::ndn_message::RibEntryMessage_Route* RibEntryMessage_RibEntry::_internal_add_routes() {
+  return _impl_.routes_.Add();
+}
+inline ::ndn_message::RibEntryMessage_Route* RibEntryMessage_RibEntry::add_routes() {
+  ::ndn_message::RibEntryMessage_Route* _add = _internal_add_routes();
+  // @@protoc_insertion_point(field_add:ndn_message.RibEntryMessage.RibEntry.routes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_Route >&
+RibEntryMessage_RibEntry::routes() const {
+  // @@protoc_insertion_point(field_list:ndn_message.RibEntryMessage.RibEntry.routes)
+  return _impl_.routes_;
+}
+
+// -------------------------------------------------------------------
+
+// RibEntryMessage
+
+// repeated .ndn_message.RibEntryMessage.RibEntry rib_entry = 128;
+inline int RibEntryMessage::_internal_rib_entry_size() const {
+  return _impl_.rib_entry_.size();
+}
+inline int RibEntryMessage::rib_entry_size() const {
+  return _internal_rib_entry_size();
+}
+inline void RibEntryMessage::clear_rib_entry() {
+  _impl_.rib_entry_.Clear();
+}
+inline ::ndn_message::RibEntryMessage_RibEntry* RibEntryMessage::mutable_rib_entry(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.RibEntryMessage.rib_entry)
+  return _impl_.rib_entry_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_RibEntry >*
+RibEntryMessage::mutable_rib_entry() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.RibEntryMessage.rib_entry)
+  return &_impl_.rib_entry_;
+}
+inline const ::ndn_message::RibEntryMessage_RibEntry& RibEntryMessage::_internal_rib_entry(int index) const {
+  return _impl_.rib_entry_.Get(index);
+}
+inline const ::ndn_message::RibEntryMessage_RibEntry& RibEntryMessage::rib_entry(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.RibEntryMessage.rib_entry)
+  return _internal_rib_entry(index);
+}
+inline ::ndn_message::RibEntryMessage_RibEntry* RibEntryMessage::_internal_add_rib_entry() {
+  return _impl_.rib_entry_.Add();
+}
+inline ::ndn_message::RibEntryMessage_RibEntry* RibEntryMessage::add_rib_entry() {
+  ::ndn_message::RibEntryMessage_RibEntry* _add = _internal_add_rib_entry();
+  // @@protoc_insertion_point(field_add:ndn_message.RibEntryMessage.rib_entry)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::RibEntryMessage_RibEntry >&
+RibEntryMessage::rib_entry() const {
+  // @@protoc_insertion_point(field_list:ndn_message.RibEntryMessage.rib_entry)
+  return _impl_.rib_entry_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ndn_message
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rib_2dentry_2eproto
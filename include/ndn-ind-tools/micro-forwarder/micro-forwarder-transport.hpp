@@ -22,6 +22,8 @@
 #ifndef NDN_MICRO_FORWARDER_TRANSPORT_HPP
 #define NDN_MICRO_FORWARDER_TRANSPORT_HPP
 
+#include <deque>
+#include <mutex>
 #include "micro-forwarder.hpp"
 #include <ndn-ind/lite/util/dynamic-malloc-uint8-array-lite.hpp>
 #include <ndn-ind/lite/encoding/element-reader-lite.hpp>
@@ -32,6 +34,10 @@ namespace ndntools {
 /**
  * A MicroForwarderTransport extends Transport to communicate with a
  * MicroForwarder object. This can be used as the transport in the Face constructor.
+ * The packets from the MicroForwarder are queued and delivered to the Face in
+ * processEvents(), so that the Face callbacks are called in the application's
+ * thread even if the MicroForwarder sends from a face thread (see
+ * MicroForwarder::startFaceThreads).
  */
 class ndn_ind_dll MicroForwarderTransport : public ndn::Transport {
 public:
@@ -111,8 +117,9 @@ public:
   send(const uint8_t *data, size_t dataLength);
 
   /**
-   * This is called by Face.processEvents(). Just call the MicroForwarder's
-   * processEvents() (which will call processEvents() for its Transport objects).
+   * This is called by Face.processEvents(). Call the MicroForwarder's
+   * processEvents() (which will call processEvents() for its Transport objects),
+   * then deliver the queued packets from the MicroForwarder to the Face.
    */
   virtual void
   processEvents();
@@ -180,7 +187,7 @@ private:
     virtual void
     send(const uint8_t *data, size_t dataLength)
     {
-      transport_->elementReader_.onReceivedData(data, dataLength);
+      transport_->receiveFromForwarder(data, dataLength);
     }
 
     virtual void
@@ -197,6 +204,15 @@ private:
     MicroForwarderTransport* transport_;
   };
 
+  /**
+   * This is called by the Endpoint when the MicroForwarder sends a packet to
+   * the application. If isReceiveQueued_, copy the packet to
+   * receivedPackets_ for processEvents(). Otherwise, give it to the
+   * elementReader_ now.
+   */
+  void
+  receiveFromForwarder(const uint8_t *data, size_t dataLength);
+
 private:
   ConnectionInfo connectionInfo_;
   ndn::DynamicMallocUInt8ArrayLite elementBuffer_;
@@ -205,6 +221,9 @@ private:
   bool isLocal_;
   // Set outFaceId_ to specify the only output face for sending packets.
   int outFaceId_;
+  bool isReceiveQueued_;
+  std::mutex receivedPacketsMutex_;
+  std::deque<ndn::Blob> receivedPackets_;
 };
 
 }
@@ -22,30 +22,133 @@
 #ifndef NDN_MICRO_FORWARDER_HPP
 #define NDN_MICRO_FORWARDER_HPP
 
+#include <map>
+#include <list>
+#include <deque>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <condition_variable>
 #include <ndn-ind/interest.hpp>
 #include <ndn-ind/data.hpp>
 #include <ndn-ind/face.hpp>
 #include <ndn-ind/transport/transport.hpp>
+#include <ndn-ind/lite/util/blob-lite.hpp>
 
 namespace ndntools {
 
+class MicroForwarderTransport;
+
 /**
  * A MicroForwarder holds a PIT, FIB and faces to function as a simple NDN
  * forwarder. It has a single instance which you can access with
- * MicroForwarder::get().
+ * MicroForwarder::get(). Interests are forwarded to the next hops in the FIB
+ * according to the forwarding strategy chosen for the name prefix with
+ * setStrategy (multicast by default). If enabled with
+ * setContentStoreCapacity, received Data packets are cached in a Content Store
+ * so that a repeated Interest is answered without forwarding it.
+ * Received packets are not decoded into Interest or Data objects. Instead, the
+ * forwarder peeks at the TLV fields it needs (the name, Nonce, lifetime and
+ * freshness) in the received buffer, and only fully decodes a /localhost
+ * management Interest.
+ * To use multiple cores, create a MicroForwarder with more than one shard and
+ * call startFaceThreads(). The MicroForwarder methods are thread-safe.
  */
 class ndn_ind_dll MicroForwarder {
   class ForwarderFace;
 
 public:
-  MicroForwarder()
-  : minPitEntryLifetime_(std::chrono::minutes(1)),
-    localhostNamePrefix("/localhost"),
-    localhopNamePrefix("/localhop"),
-    registerNamePrefix("/localhost/nfd/rib/register"),
-    broadcastNamePrefix("/ndn/broadcast")
-  {
-  }
+  /**
+   * A QueueCounters holds the counters of the output queue of a face, returned
+   * by getFaceQueueCounters.
+   */
+  class QueueCounters {
+  public:
+    QueueCounters()
+    : nQueuedPackets_(0), nQueuedBytes_(0), nSentPackets_(0),
+      nDroppedPackets_(0), nCongestionMarkedPackets_(0)
+    {
+    }
+
+    /**
+     * Get the number of packets waiting in the output queue.
+     */
+    size_t
+    getNQueuedPackets() const { return nQueuedPackets_; }
+
+    /**
+     * Get the total size in bytes of the packets waiting in the output queue.
+     */
+    size_t
+    getNQueuedBytes() const { return nQueuedBytes_; }
+
+    /**
+     * Get the number of packets sent on the face.
+     */
+    uint64_t
+    getNSentPackets() const { return nSentPackets_; }
+
+    /**
+     * Get the number of packets dropped because the output queue was full.
+     */
+    uint64_t
+    getNDroppedPackets() const { return nDroppedPackets_; }
+
+    /**
+     * Get the number of packets sent with a CongestionMark.
+     */
+    uint64_t
+    getNCongestionMarkedPackets() const { return nCongestionMarkedPackets_; }
+
+    void
+    setNQueuedPackets(size_t nQueuedPackets) { nQueuedPackets_ = nQueuedPackets; }
+
+    void
+    setNQueuedBytes(size_t nQueuedBytes) { nQueuedBytes_ = nQueuedBytes; }
+
+    void
+    setNSentPackets(uint64_t nSentPackets) { nSentPackets_ = nSentPackets; }
+
+    void
+    setNDroppedPackets(uint64_t nDroppedPackets)
+    {
+      nDroppedPackets_ = nDroppedPackets;
+    }
+
+    void
+    setNCongestionMarkedPackets(uint64_t nCongestionMarkedPackets)
+    {
+      nCongestionMarkedPackets_ = nCongestionMarkedPackets;
+    }
+
+  private:
+    size_t nQueuedPackets_;
+    size_t nQueuedBytes_;
+    uint64_t nSentPackets_;
+    uint64_t nDroppedPackets_;
+    uint64_t nCongestionMarkedPackets_;
+  };
+
+  /**
+   * Create a MicroForwarder.
+   * @param nShards (optional) The number of shards of the PIT and Content
+   * Store. An Interest or Data packet is processed in the shard selected by the
+   * hash of the first nShardNameComponents of its name, so that packets in
+   * different shards can be processed in parallel by the face threads (see
+   * startFaceThreads). If omitted, use 1.
+   * @param nShardNameComponents (optional) The number of name components
+   * hashed to select the shard. A larger value spreads the names under a common
+   * prefix such as /ndn over more shards, but a Data packet must also check
+   * the shards of its shorter name prefixes for a pending Interest with
+   * CanBePrefix, and such an Interest is only answered from the Content Store
+   * if the Data is in the same shard. If omitted, use 2.
+   */
+  explicit MicroForwarder(int nShards = 1, int nShardNameComponents = 2);
+
+  ~MicroForwarder();
 
   /**
    * Add a new face to communicate with the given transport. This immediately
@@ -77,7 +180,8 @@ public:
 
   /**
    * Find or create the FIB entry with the given name and add the ForwarderFace
-   * with the given faceId. All routes are multicast by default.
+   * with the given faceId. How the next hops are used is determined by the
+   * forwarding strategy for the name (see setStrategy).
    * @param name The name of the FIB entry.
    * @param faceId The face ID of the face for the route.
    * @param cost (optional) The cost of the next hop for the given face. If a
@@ -98,6 +202,108 @@ public:
     return addRoute(name, faceId, cost);
   }
 
+  /**
+   * Set the forwarding strategy for Interests whose name matches the prefix,
+   * replacing any strategy already set for the same prefix. The strategy with
+   * the longest matching prefix is used. This is also done when a local
+   * application sends a /localhost/nfd/strategy-choice/set command. The
+   * strategy name is /localhost/nfd/strategy/ followed by one of:
+   * "multicast" - Forward to all next hops (the default for all prefixes).
+   * "best-route" - Forward to the next hop with the lowest cost from addRoute.
+   * If an upstream returns a Nack, try the next hop with the next lowest cost.
+   * "round-robin" - Forward to one next hop, rotating through the next hops to
+   * balance the load.
+   * "asf" - Adaptive SRTT-based forwarding. Forward to the next hop with the
+   * lowest smoothed round-trip time, measured when Data returns on each face.
+   * Next hops without a measurement are periodically probed.
+   * A version component after the strategy name is ignored.
+   * @param prefix The name prefix for the strategy.
+   * @param strategyName The strategy name, for example
+   * Name("/localhost/nfd/strategy/best-route").
+   * @return True for success, or false if strategyName is not recognized.
+   */
+  bool
+  setStrategy(const ndn::Name& prefix, const ndn::Name& strategyName);
+
+  /**
+   * Set the capacity of the in-memory Content Store. When a Data packet
+   * satisfies a pending Interest, its wire encoding is cached, and a later
+   * Interest which matches it is answered from the Content Store. A cached Data
+   * packet is fresh until its FreshnessPeriod elapses (or immediately stale if
+   * it has no FreshnessPeriod) and can't satisfy an Interest with MustBeFresh
+   * after that. When the total size is over the capacity, the least recently
+   * used Data packets are evicted.
+   * @param capacity The maximum total size in bytes of the wire encodings of
+   * the cached Data packets. If 0, then disable the Content Store and remove
+   * all cached Data. The Content Store is disabled by default. If there is
+   * more than one shard, each shard gets an equal part of the capacity.
+   */
+  void
+  setContentStoreCapacity(size_t capacity);
+
+  /**
+   * Get the capacity of the Content Store, as set by setContentStoreCapacity.
+   * @return The maximum total size in bytes, or 0 if the Content Store is
+   * disabled.
+   */
+  size_t
+  getContentStoreCapacity() const { return contentStoreCapacity_; }
+
+  /**
+   * Get the total size of the Data packets in the Content Store.
+   * @return The total size in bytes of the wire encodings.
+   */
+  size_t
+  getContentStoreSize();
+
+  /**
+   * Limit the rate of sending on the face with a token bucket. When the face
+   * has a rate limit, outgoing packets wait in an output queue with a separate
+   * queue for each incoming face. The queues are served by deficit round robin,
+   * so that one busy application or upstream can't starve the others. Queued
+   * packets are sent by processEvents() or the face thread (see
+   * startFaceThreads).
+   * @param faceId The face ID of the face.
+   * @param bytesPerSecond The rate at which tokens are added to the bucket, in
+   * bytes per second. If 0, remove the rate limit so that packets are sent
+   * immediately (after sending any queued packets).
+   * @param burstSize (optional) The maximum number of bytes in the token
+   * bucket, which can be sent at once after the face is idle. If omitted, use
+   * the maximum NDN packet size.
+   * @return True for success, or false if can't find the ForwarderFace with
+   * faceId.
+   */
+  bool
+  setFaceRateLimit
+    (int faceId, double bytesPerSecond, size_t burstSize = MAX_NDN_PACKET_SIZE);
+
+  /**
+   * Set the limits of the output queue of the face, which is used when the
+   * face has a rate limit (see setFaceRateLimit).
+   * @param faceId The face ID of the face.
+   * @param maxQueueSize The maximum total size in bytes of the queued packets.
+   * A packet which would exceed this is dropped. If 0, don't limit the queue.
+   * @param congestionMarkThreshold (optional) If the queue size in bytes is at
+   * least this when an Interest or Data packet is queued, send it in an
+   * LpPacket with the CongestionMark header field so that the consumer can
+   * reduce its rate. If omitted or 0, don't set CongestionMark.
+   * @return True for success, or false if can't find the ForwarderFace with
+   * faceId.
+   */
+  bool
+  setFaceQueueLimits
+    (int faceId, size_t maxQueueSize, size_t congestionMarkThreshold = 0);
+
+  /**
+   * Get the counters of the output queue of the face.
+   * @param faceId The face ID of the face.
+   * @param counters Set this to the counters.
+   * @return True for success, or false if can't find the ForwarderFace with
+   * faceId.
+   */
+  bool
+  getFaceQueueCounters(int faceId, QueueCounters& counters);
+
   /**
    * Send a remote register prefix command over face with faceId to the remote
    * forwarder. This allows the remote forwarder to forward interests back to
@@ -128,11 +334,38 @@ public:
    * Call processEvents() for the Transport object in each face. This is
    * normally called by MicroForwarderTransport::processEvents() which is called
    * by the application when it calls Face::processEvents(), so an application
-   * normally doesn't need to call this directly.
+   * normally doesn't need to call this directly. If startFaceThreads() was
+   * called, this does nothing since the face threads process events.
    */
   void
   processEvents();
 
+  /**
+   * Start a thread for each face (including faces added later) which
+   * calls processEvents() for the face's Transport, so that packets received
+   * on different faces are processed in parallel. Processing a packet only
+   * locks the PIT and Content Store shard for its name (see the constructor),
+   * and packets are sent after releasing the lock. The face thread also sends
+   * the packets in the output queue when the rate limit allows (see
+   * setFaceRateLimit). An application Face using a MicroForwarderTransport
+   * still receives its packets and callbacks in the thread which calls its
+   * processEvents().
+   * @param sleepTime (optional) The maximum time to wait between calls to
+   * processEvents() for a Transport which must be polled, such as
+   * TcpTransport. The thread of a MicroForwarderTransport face doesn't poll
+   * and only wakes up when a packet is queued. If omitted, use 1 millisecond.
+   */
+  void
+  startFaceThreads
+    (std::chrono::nanoseconds sleepTime = std::chrono::milliseconds(1));
+
+  /**
+   * Stop the threads started by startFaceThreads() and wait for them to finish.
+   * This is also called by the destructor.
+   */
+  void
+  stopFaceThreads();
+
   /**
    * This is called by the Transport's ElementListener when an entire TLV
    * element is received. If it is an Interest, look in the FIB for forwarding.
@@ -148,17 +381,11 @@ public:
     (ForwarderFace* face, const uint8_t *element, size_t elementLength);
 
   /**
-   * Get a singleton instance of a MicroForwarder.
+   * Get a singleton instance of a MicroForwarder. This is thread-safe.
    * @return The singleton instance.
    */
   static MicroForwarder*
-  get()
-  {
-    if (!instance_)
-      instance_ = new MicroForwarder();
-
-    return instance_;
-  }
+  get();
 
 private:
   /**
@@ -180,11 +407,16 @@ private:
     ForwarderFace
       (MicroForwarder* parent, const std::string uri,
        const ndn::ptr_lib::shared_ptr<ndn::Transport>& transport)
-    : parent_(parent), uri_(uri), transport_(transport)
+    : parent_(parent), uri_(uri), transport_(transport),
+      hasRttMeasurement_(false), nConsecutiveTimeouts_(0), rateLimit_(0),
+      burstSize_(0), tokens_(0), maxQueueSize_(0), congestionMarkThreshold_(0),
+      isQuantumAdded_(false), isSending_(false), isThreadStopping_(false)
     {
       faceId_ = ++lastFaceId_;
     }
 
+    ~ForwarderFace();
+
     const std::string&
     getUri() const { return uri_; }
 
@@ -208,21 +440,91 @@ private:
     disable() { transport_.reset(); };
 
     /**
-     * Send the data buffer to the transport
+     * Send the data buffer to the transport, or add it to the output queue if
+     * the face has a rate limit or another thread is sending. Only one thread
+     * at a time sends to the transport, and it does not hold the lock while
+     * sending, so that an application which receives the packet can send on
+     * another face without a deadlock.
      * @param data A pointer to the buffer of data to send.
      * @param dataLength The number of bytes in data.
+     * @param inFaceId (optional) The face ID of the incoming face of the
+     * packet, to select the queue. If omitted, use 0 for a packet from the
+     * forwarder itself.
+     * @param blob (optional) If this Blob holds data, it is queued without
+     * making a copy.
      */
     void
-    send(const uint8_t *data, size_t dataLength);
+    send
+      (const uint8_t *data, size_t dataLength, int inFaceId = 0,
+       const ndn::Blob& blob = ndn::Blob());
 
     void
     send(const std::vector<uint8_t>& data) { send(&data[0], data.size()); }
 
     /**
-     * Call transport_->processEvents().
+     * Call transport_->processEvents() and send queued packets.
+     */
+    void
+    processEvents()
+    {
+      transport_->processEvents();
+      sendQueuedPackets();
+    }
+
+    /**
+     * Set the token bucket rate limit. See MicroForwarder::setFaceRateLimit.
+     */
+    void
+    setRateLimit(double bytesPerSecond, size_t burstSize);
+
+    /**
+     * Set the output queue limits. See MicroForwarder::setFaceQueueLimits.
      */
     void
-    processEvents() { transport_->processEvents(); }
+    setQueueLimits(size_t maxQueueSize, size_t congestionMarkThreshold)
+    {
+      std::lock_guard<std::mutex> lock(sendMutex_);
+      maxQueueSize_ = maxQueueSize;
+      congestionMarkThreshold_ = congestionMarkThreshold;
+    }
+
+    /**
+     * Get the output queue counters.
+     * @param counters Set this to the counters.
+     */
+    void
+    getQueueCounters(QueueCounters& counters)
+    {
+      std::lock_guard<std::mutex> lock(sendMutex_);
+      counters = queueCounters_;
+    }
+
+    /**
+     * Send the queued packets in deficit round robin order while the token
+     * bucket has tokens.
+     */
+    void
+    sendQueuedPackets();
+
+    /**
+     * Start a thread which calls processEvents() and sends the queued packets
+     * until stopThread() is called. Between calls, the thread waits on a
+     * condition variable until a packet is queued or the token bucket has
+     * a token for a queued packet.
+     * @param sleepTime The maximum time to wait between calls to
+     * processEvents() if isPolled is true.
+     * @param isPolled True if the transport must be polled to receive
+     * packets. If false, don't call transport_->processEvents().
+     */
+    void
+    startThread(std::chrono::nanoseconds sleepTime, bool isPolled);
+
+    /**
+     * Stop the thread started by startThread() and wait for it to finish. If
+     * there is no thread, do nothing.
+     */
+    void
+    stopThread();
 
     /**
      * This overrides ElementListener::onReceivedElement and is called by the
@@ -232,12 +534,359 @@ private:
     void
     onReceivedElement(const uint8_t *element, size_t elementLength) override;
 
+    /**
+     * Update the smoothed round-trip time and its variation with a new
+     * measurement (as in RFC 6298), and reset the count of consecutive
+     * timeouts.
+     * @param rtt The round-trip time from sending an Interest on this face to
+     * receiving the Data.
+     */
+    void
+    addRttMeasurement(std::chrono::nanoseconds rtt);
+
+    /**
+     * Record that an Interest forwarded on this face timed out.
+     */
+    void
+    recordTimeout()
+    {
+      std::lock_guard<std::mutex> lock(rttMutex_);
+      ++nConsecutiveTimeouts_;
+    }
+
+    /**
+     * Check if addRttMeasurement has been called.
+     * @return True if there is an RTT measurement.
+     */
+    bool
+    hasRttMeasurement() const
+    {
+      std::lock_guard<std::mutex> lock(rttMutex_);
+      return hasRttMeasurement_;
+    }
+
+    std::chrono::nanoseconds
+    getSmoothedRtt() const
+    {
+      std::lock_guard<std::mutex> lock(rttMutex_);
+      return smoothedRtt_;
+    }
+
+    std::chrono::nanoseconds
+    getRttVariation() const
+    {
+      std::lock_guard<std::mutex> lock(rttMutex_);
+      return rttVariation_;
+    }
+
+    /**
+     * Get the number of Interests forwarded on this face which timed out since
+     * the last RTT measurement.
+     * @return The number of consecutive timeouts.
+     */
+    int
+    getConsecutiveTimeoutCount() const
+    {
+      std::lock_guard<std::mutex> lock(rttMutex_);
+      return nConsecutiveTimeouts_;
+    }
+
   private:
     MicroForwarder* parent_;
     std::string uri_;
     ndn::ptr_lib::shared_ptr<ndn::Transport> transport_;
     int faceId_;
-    static int lastFaceId_;
+    std::mutex sendMutex_;
+    mutable std::mutex rttMutex_;
+    bool hasRttMeasurement_;
+    std::chrono::nanoseconds smoothedRtt_;
+    std::chrono::nanoseconds rttVariation_;
+    int nConsecutiveTimeouts_;
+    std::thread thread_;
+    // The face thread waits on threadCondition_ with sendMutex_.
+    std::condition_variable threadCondition_;
+    static std::atomic<int> lastFaceId_;
+
+    /**
+     * A FlowQueue holds the queued packets from one incoming face.
+     */
+    class FlowQueue {
+    public:
+      FlowQueue()
+      : deficit_(0)
+      {
+      }
+
+      std::deque<ndn::Blob>&
+      getPackets() { return packets_; }
+
+      size_t
+      getDeficit() { return deficit_; }
+
+      void
+      setDeficit(size_t deficit) { deficit_ = deficit; }
+
+    private:
+      std::deque<ndn::Blob> packets_;
+      size_t deficit_;
+    };
+
+    /**
+     * Send to the transport, catching any exception. The caller must not hold
+     * sendMutex_.
+     */
+    void
+    sendToTransport(const uint8_t *data, size_t dataLength);
+
+    // The following are protected by sendMutex_.
+    double rateLimit_;
+    size_t burstSize_;
+    double tokens_;
+    std::chrono::steady_clock::time_point lastTokenTime_;
+    size_t maxQueueSize_;
+    size_t congestionMarkThreshold_;
+    // The key is the incoming face ID.
+    std::map<int, FlowQueue> flowQueues_;
+    // The incoming face IDs of the non-empty flowQueues_ in round robin order.
+    std::list<int> activeFlows_;
+    // True if the front of activeFlows_ got its quantum in this round.
+    bool isQuantumAdded_;
+    // True while a thread is sending to the transport.
+    bool isSending_;
+    bool isThreadStopping_;
+    QueueCounters queueCounters_;
+  };
+
+  /**
+   * A PacketFields holds the fields of an Interest or Data packet which the
+   * forwarder uses, found by peeking at the TLV wire encoding instead of
+   * decoding the packet into an Interest or Data object. The fields are kept as
+   * offsets into the wire encoding, which is not copied, so the wire encoding
+   * must remain valid while using the fields. Names are compared by their
+   * encoded Name TLV value (the encoded components) so that name matching
+   * doesn't allocate memory. Because each component is a complete TLV, a name
+   * has a prefix if and only if its encoded value starts with the encoded
+   * value of the prefix.
+   */
+  class PacketFields {
+  public:
+    PacketFields()
+    : encoding_(0), encodingLength_(0), isInterest_(false), nameOffset_(0), nameValueOffset_(0),
+      nameValueLength_(0), lastComponentOffset_(0),
+      lastComponentType_(-1), lastComponentValueOffset_(0),
+      lastComponentValueLength_(0), nonceOffset_(0), nonceLength_(0),
+      canBePrefix_(false), mustBeFresh_(false), interestLifetime_(-1),
+      freshnessPeriod_(-1), hasImplicitDigest_(false)
+    {
+    }
+
+    /**
+     * Peek at the wire encoding of an Interest or Data packet to find the
+     * name and the other fields used by the forwarder. This does not allocate
+     * memory. For an Interest in NDN-TLV v0.2 format with Selectors, only
+     * MustBeFresh and MaxSuffixComponents (for CanBePrefix) are used.
+     * @param encoding A pointer to the wire encoding, which must remain valid
+     * while using the fields.
+     * @param encodingLength The length of encoding.
+     * @return 0 for success, else an error code if encoding is not an
+     * Interest or Data packet.
+     */
+    ndn_Error
+    peek(const uint8_t *encoding, size_t encodingLength);
+
+    /**
+     * Set the pointer to the wire encoding, which must have the same bytes as
+     * the encoding given to peek(), for example a copy which is kept longer.
+     * @param encoding A pointer to the wire encoding.
+     */
+    void
+    setEncoding(const uint8_t *encoding) { encoding_ = encoding; }
+
+    const uint8_t*
+    getEncoding() const { return encoding_; }
+
+    size_t
+    getEncodingLength() const { return encodingLength_; }
+
+    bool
+    isInterest() const { return isInterest_; }
+
+    /**
+     * Get the value of the Name TLV, which is the encoded name components.
+     * @return A pointer to the Name TLV value in the wire encoding.
+     */
+    const uint8_t*
+    getNameValue() const { return encoding_ + nameValueOffset_; }
+
+    size_t
+    getNameValueLength() const { return nameValueLength_; }
+
+    /**
+     * Check if the last name component is an implicit SHA-256 digest component.
+     * @return True if the name ends with an implicit digest.
+     */
+    bool
+    endsWithImplicitDigest() const
+    {
+      return lastComponentType_ == ndn_NameComponentType_IMPLICIT_SHA256_DIGEST;
+    }
+
+    /**
+     * Get the length of the Name TLV value without the last component.
+     * @return The length of the encoded name components except the last. If
+     * the name is empty, this is 0.
+     */
+    size_t
+    getNameValueLengthWithoutLastComponent() const { return lastComponentOffset_; }
+
+    /**
+     * Get the Nonce of the Interest.
+     * @return A pointer to the Nonce value in the wire encoding. If there is no
+     * Nonce, getNonceLength() is 0.
+     */
+    const uint8_t*
+    getNonce() const { return encoding_ + nonceOffset_; }
+
+    size_t
+    getNonceLength() const { return nonceLength_; }
+
+    bool
+    getCanBePrefix() const { return canBePrefix_; }
+
+    bool
+    getMustBeFresh() const { return mustBeFresh_; }
+
+    /**
+     * Get the Interest lifetime.
+     * @return The Interest lifetime, or -1 if not specified.
+     */
+    std::chrono::milliseconds
+    getInterestLifetime() const { return interestLifetime_; }
+
+    /**
+     * Get the Data packet's FreshnessPeriod.
+     * @return The freshness period, or -1 if not specified.
+     */
+    std::chrono::milliseconds
+    getFreshnessPeriod() const { return freshnessPeriod_; }
+
+    /**
+     * Check if this name starts with the prefix.
+     * @param prefixValue A pointer to the encoded Name TLV value of the prefix.
+     * @param prefixValueLength The length of prefixValue.
+     * @return True if the prefix matches.
+     */
+    bool
+    nameHasPrefix(const uint8_t *prefixValue, size_t prefixValueLength) const
+    {
+      return prefixValueLength <= nameValueLength_ &&
+        memcmp(getNameValue(), prefixValue, prefixValueLength) == 0;
+    }
+
+    bool
+    nameHasPrefix(const ndn::Blob& prefixValue) const
+    {
+      return nameHasPrefix(prefixValue.buf(), prefixValue.size());
+    }
+
+    /**
+     * Check if this name equals the name in other.
+     * @param other The other PacketFields.
+     * @return True if the names are equal.
+     */
+    bool
+    nameEquals(const PacketFields& other) const
+    {
+      return nameValueLength_ == other.nameValueLength_ &&
+        memcmp(getNameValue(), other.getNameValue(), nameValueLength_) == 0;
+    }
+
+    /**
+     * Check if this Interest can be satisfied by the Data packet, as in
+     * Interest::matchesData but only using the name, CanBePrefix and an
+     * implicit digest component.
+     * @param data The fields of the Data packet. This computes its implicit
+     * digest if needed.
+     * @return True if the Data packet matches.
+     */
+    bool
+    matchesData(PacketFields& data) const;
+
+    /**
+     * Get the SHA-256 digest of the wire encoding, computing it the first
+     * time this is called.
+     * @return A pointer to the digest of size ndn_SHA256_DIGEST_SIZE.
+     */
+    const uint8_t*
+    getImplicitDigest();
+
+    /**
+     * Decode the name. Since this makes a Name object, it should only be used
+     * for logging.
+     * @return The Name.
+     */
+    ndn::Name
+    getName() const;
+
+  private:
+    const uint8_t *encoding_;
+    size_t encodingLength_;
+    bool isInterest_;
+    size_t nameOffset_;
+    size_t nameValueOffset_;
+    size_t nameValueLength_;
+    // lastComponentOffset_ is the offset of the last component TLV in the
+    // Name TLV value, which is also the length of the name without it.
+    size_t lastComponentOffset_;
+    int lastComponentType_;
+    size_t lastComponentValueOffset_;
+    size_t lastComponentValueLength_;
+    size_t nonceOffset_;
+    size_t nonceLength_;
+    bool canBePrefix_;
+    bool mustBeFresh_;
+    std::chrono::milliseconds interestLifetime_;
+    std::chrono::milliseconds freshnessPeriod_;
+    bool hasImplicitDigest_;
+    uint8_t implicitDigest_[ndn_SHA256_DIGEST_SIZE];
+  };
+
+  /**
+   * An OutRecord is used in a PitEntry to record an upstream face where the
+   * Interest was forwarded.
+   */
+  class OutRecord {
+  public:
+    /**
+     * Create an OutRecord with the given values.
+     * @param face The upstream face.
+     * @param sendTime The time when the Interest was sent on the face.
+     */
+    OutRecord(ForwarderFace* face, std::chrono::system_clock::time_point sendTime)
+    : face_(face), sendTime_(sendTime), isNacked_(false)
+    {
+    }
+
+    ForwarderFace*
+    getFace() { return face_; }
+
+    std::chrono::system_clock::time_point
+    getSendTime() { return sendTime_; }
+
+    /**
+     * Check if the upstream face returned a Nack.
+     * @return True if the face returned a Nack.
+     */
+    bool
+    getIsNacked() { return isNacked_; }
+
+    void
+    setIsNacked() { isNacked_ = true; }
+
+  private:
+    ForwarderFace* face_;
+    std::chrono::system_clock::time_point sendTime_;
+    bool isNacked_;
   };
 
   /**
@@ -249,24 +898,33 @@ private:
   public:
     /**
      * Create a PitEntry for the interest and incoming face.
-     * @param interest The pending Interest. This does not make a copy.
+     * @param interestEncoding The wire encoding of the pending Interest. This
+     * does not make a copy.
+     * @param interest The fields of the pending Interest, which were peeked
+     * from the same bytes as interestEncoding.
      * @param inFace The Interest's incoming face (and where the matching Data
      * packet will be sent).
      * @param timeoutEndTime The time when the interest times out.
      * @param entryEndTime The time when this entry should be removed.
      */
     PitEntry
-      (const ndn::ptr_lib::shared_ptr<ndn::Interest>& interest,
+      (const ndn::Blob& interestEncoding, const PacketFields& interest,
        ForwarderFace* inFace,
        std::chrono::system_clock::time_point timeoutEndTime,
        std::chrono::system_clock::time_point entryEndTime)
-    : interest_(interest), inFace_(inFace),
+    : interestEncoding_(interestEncoding), interest_(interest), inFace_(inFace),
       timeoutEndTime_(timeoutEndTime), entryEndTime_(entryEndTime),
-      isRemoved_(false)
+      isRemoved_(false), isShortPrefix_(false)
     {
+      interest_.setEncoding(interestEncoding_.buf());
     }
 
-    ndn::ptr_lib::shared_ptr<ndn::Interest>&
+    /**
+     * Get the fields of the pending Interest.
+     * @return The PacketFields, which refer to the Interest wire encoding kept
+     * by this PitEntry.
+     */
+    const PacketFields&
     getInterest() { return interest_; }
 
     ForwarderFace*
@@ -299,15 +957,76 @@ private:
     void
     setIsRemoved() { isRemoved_ = true; }
 
+    /**
+     * Check if the Interest has CanBePrefix and fewer name components than
+     * are used to select the Shard, so that a matching Data packet can be
+     * processed in another Shard.
+     * @return True if the Interest name is a short prefix.
+     */
+    bool
+    getIsShortPrefix() { return isShortPrefix_; }
+
+    void
+    setIsShortPrefix() { isShortPrefix_ = true; }
+
+    /**
+     * Add an OutRecord for the upstream face where the Interest was sent.
+     * @param face The upstream face.
+     * @param sendTime The time when the Interest was sent on the face.
+     */
+    void
+    addOutRecord(ForwarderFace* face, std::chrono::system_clock::time_point sendTime)
+    {
+      outRecords_.push_back(OutRecord(face, sendTime));
+    }
+
+    /**
+     * Find the OutRecord with the given face.
+     * @param face The upstream face to search for.
+     * @return The OutRecord, or null if not found.
+     */
+    OutRecord*
+    findOutRecord(ForwarderFace* face)
+    {
+      for (size_t i = 0; i < outRecords_.size(); ++i) {
+        if (outRecords_[i].getFace() == face)
+          return &outRecords_[i];
+      }
+
+      return 0;
+    }
+
+    std::vector<OutRecord>&
+    getOutRecords() { return outRecords_; }
+
+    /**
+     * Check if every upstream face where the Interest was sent returned a Nack.
+     * @return True if all OutRecord are Nacked, or false if there is no
+     * OutRecord.
+     */
+    bool
+    isAllNacked()
+    {
+      for (size_t i = 0; i < outRecords_.size(); ++i) {
+        if (!outRecords_[i].getIsNacked())
+          return false;
+      }
+
+      return outRecords_.size() > 0;
+    }
+
   private:
-    ndn::ptr_lib::shared_ptr<ndn::Interest> interest_;
+    ndn::Blob interestEncoding_;
+    PacketFields interest_;
     ForwarderFace* inFace_;
+    std::vector<OutRecord> outRecords_;
     // timeoutEndTime_ is based on the Interest lifetime.
     std::chrono::system_clock::time_point timeoutEndTime_;
     // entryEndTime_ is when this entry should be removed. (The entry is kept
     // around longer than the Interest lifetime to detect a duplicate nonce.)
     std::chrono::system_clock::time_point entryEndTime_;
     bool isRemoved_;
+    bool isShortPrefix_;
   };
 
   /**
@@ -349,15 +1068,24 @@ private:
     /**
      * Create a FibEntry with the given registered name.
      * @param name The registered name for this FIB entry.
+     * @param nameValue The encoded Name TLV value of name, from
+     * encodeNameValue.
      */
-    FibEntry (const ndn::Name& name)
-    : name_(name)
+    FibEntry (const ndn::Name& name, const ndn::Blob& nameValue)
+    : name_(name), nameValue_(nameValue)
     {
     }
 
     ndn::Name&
     getName() { return name_; }
 
+    /**
+     * Get the encoded Name TLV value of the name, to match with
+     * PacketFields::nameHasPrefix.
+     */
+    const ndn::Blob&
+    getNameValue() { return nameValue_; }
+
     /**
      * Get the number of entries in the list of NextHopRecord.
      * @return The number of entries.
@@ -397,16 +1125,456 @@ private:
 
   private:
     ndn::Name name_;
+    ndn::Blob nameValue_;
     std::vector<ndn::ptr_lib::shared_ptr<NextHopRecord> > nextHops_;
   };
 
+  /**
+   * A ForwardingStrategy is the base class for the strategies which decide
+   * which next hops receive an Interest. A strategy object is created for each
+   * prefix given to setStrategy, so that it can keep state for the prefix.
+   */
+  class ForwardingStrategy {
+  public:
+    virtual
+    ~ForwardingStrategy();
+
+    /**
+     * Check if this strategy uses the next hops of all FIB entries which match
+     * the Interest name, or only the FIB entry with the longest matching name.
+     * @return True to use all matching FIB entries. This base class returns
+     * false.
+     */
+    virtual bool
+    usesAllMatchingFibEntries() { return false; }
+
+    /**
+     * Select the faces where a new Interest is forwarded.
+     * @param nextHops The next hops from the FIB entries which match the
+     * Interest name, excluding the Interest's incoming face. This is not empty.
+     * @param now The current time.
+     * @param outFaces Append the selected faces to this list.
+     */
+    virtual void
+    afterReceiveInterest
+      (const std::vector<NextHopRecord*>& nextHops,
+       std::chrono::system_clock::time_point now,
+       std::vector<ForwarderFace*>& outFaces) = 0;
+
+    /**
+     * Select the face to retry an Interest after an upstream returned a Nack.
+     * @param nextHops The next hops from the FIB entries which match the
+     * Interest name, excluding the Interest's incoming face and the faces where
+     * it was already sent. This is not empty.
+     * @return The face to retry, or null to not retry.
+     */
+    virtual ForwarderFace*
+    afterReceiveNack(const std::vector<NextHopRecord*>& nextHops) = 0;
+  };
+
+  /**
+   * A StrategyChoiceEntry holds the forwarding strategy set for a name prefix
+   * with setStrategy.
+   */
+  class StrategyChoiceEntry {
+  public:
+    /**
+     * Create a StrategyChoiceEntry with the given values.
+     * @param prefix The name prefix for the strategy.
+     * @param prefixValue The encoded Name TLV value of prefix, from
+     * encodeNameValue.
+     * @param strategy The strategy for the prefix.
+     */
+    StrategyChoiceEntry
+      (const ndn::Name& prefix, const ndn::Blob& prefixValue,
+       const ndn::ptr_lib::shared_ptr<ForwardingStrategy>& strategy)
+    : prefix_(prefix), prefixValue_(prefixValue), strategy_(strategy)
+    {
+    }
+
+    const ndn::Name&
+    getPrefix() { return prefix_; }
+
+    const ndn::Blob&
+    getPrefixValue() { return prefixValue_; }
+
+    ForwardingStrategy&
+    getStrategy() { return *strategy_; }
+
+    void
+    setStrategy(const ndn::ptr_lib::shared_ptr<ForwardingStrategy>& strategy)
+    {
+      strategy_ = strategy;
+    }
+
+  private:
+    ndn::Name prefix_;
+    ndn::Blob prefixValue_;
+    ndn::ptr_lib::shared_ptr<ForwardingStrategy> strategy_;
+  };
+
+  /**
+   * A ContentStoreEntry holds the wire encoding of a cached Data packet.
+   */
+  class ContentStoreEntry {
+  public:
+    /**
+     * Create a ContentStoreEntry with the given values.
+     * @param encoding The wire encoding of the Data packet, which is sent to
+     * answer an Interest. This does not make a copy.
+     * @param data The fields of the Data packet, which were peeked from the
+     * same bytes as encoding.
+     * @param staleTime The time when the Data packet becomes stale.
+     */
+    ContentStoreEntry
+      (const ndn::Blob& encoding, const PacketFields& data,
+       std::chrono::system_clock::time_point staleTime)
+    : encoding_(encoding), data_(data), staleTime_(staleTime)
+    {
+      data_.setEncoding(encoding_.buf());
+    }
+
+    PacketFields&
+    getData() { return data_; }
+
+    /**
+     * Get the encoded Name TLV value of the Data name, which is the key in the
+     * Shard's Content Store map.
+     */
+    ndn::BlobLite
+    getNameValue()
+    {
+      return ndn::BlobLite(data_.getNameValue(), data_.getNameValueLength());
+    }
+
+    const ndn::Blob&
+    getEncoding() { return encoding_; }
+
+    /**
+     * Check if the Data packet is still fresh.
+     * @param now The current time.
+     * @return True if fresh.
+     */
+    bool
+    isFresh(std::chrono::system_clock::time_point now) { return now < staleTime_; }
+
+  private:
+    ndn::Blob encoding_;
+    PacketFields data_;
+    std::chrono::system_clock::time_point staleTime_;
+  };
+
+  typedef std::list<ndn::ptr_lib::shared_ptr<ContentStoreEntry> > ContentStoreList;
+
+  /**
+   * NameValueLess orders encoded Name TLV values by their bytes, so that all
+   * names with a given prefix follow the prefix in the Content Store map.
+   */
+  struct NameValueLess {
+    bool
+    operator()(const ndn::BlobLite& a, const ndn::BlobLite& b) const
+    {
+      int result = memcmp(a.buf(), b.buf(), std::min(a.size(), b.size()));
+      return result < 0 || (result == 0 && a.size() < b.size());
+    }
+  };
+
+  /**
+   * A Shard holds the part of the PIT and Content Store for the names whose
+   * first components (see the MicroForwarder constructor) hash to the shard. The caller must lock the mutex from
+   * getMutex() while using the Shard.
+   */
+  class Shard {
+  public:
+    Shard()
+    : nShortPrefixPitEntries_(0), contentStoreSize_(0)
+    {
+    }
+
+    std::mutex&
+    getMutex() { return mutex_; }
+
+    std::vector<ndn::ptr_lib::shared_ptr<PitEntry> >&
+    getPit() { return PIT_; }
+
+    /**
+     * Add the PitEntry to PIT_.
+     */
+    void
+    addPitEntry(const ndn::ptr_lib::shared_ptr<PitEntry>& pitEntry)
+    {
+      PIT_.push_back(pitEntry);
+      if (pitEntry->getIsShortPrefix())
+        ++nShortPrefixPitEntries_;
+    }
+
+    /**
+     * Mark the PitEntry at PIT_[i] as removed (in case something references it)
+     * and remove it.
+     */
+    void
+    removePitEntry(int i)
+    {
+      PIT_[i]->setIsRemoved();
+      if (PIT_[i]->getIsShortPrefix())
+        --nShortPrefixPitEntries_;
+      PIT_.erase(PIT_.begin() + i);
+    }
+
+    /**
+     * Check if the PIT has an entry where getIsShortPrefix() is true. This
+     * can be called without locking the mutex.
+     * @return True if there is a short prefix PIT entry.
+     */
+    bool
+    hasShortPrefixPitEntries() const { return nShortPrefixPitEntries_ > 0; }
+
+    /**
+     * Find a Data packet in the Content Store which satisfies the Interest, and
+     * mark it as the most recently used.
+     * @param interest The fields of the Interest to match.
+     * @param now The current time, to check MustBeFresh.
+     * @return The matching ContentStoreEntry, or null if not found.
+     */
+    ContentStoreEntry*
+    findInContentStore
+      (const PacketFields& interest, std::chrono::system_clock::time_point now);
+
+    /**
+     * Add the Data packet to the Content Store, replacing a cached Data packet
+     * with the same name. Then evict the least recently used entries while the
+     * total size is over the capacity.
+     * @param encoding The wire encoding of the Data packet. This does not make
+     * a copy.
+     * @param data The fields of the Data packet, peeked from encoding.
+     * @param capacity The capacity in bytes of this shard's Content Store.
+     * @param now The current time, to compute the stale time.
+     */
+    void
+    insertIntoContentStore
+      (const ndn::Blob& encoding, const PacketFields& data, size_t capacity,
+       std::chrono::system_clock::time_point now);
+
+    /**
+     * Evict the least recently used entries while the total size of the
+     * Content Store is over the capacity.
+     * @param capacity The capacity in bytes of this shard's Content Store.
+     */
+    void
+    evictContentStore(size_t capacity);
+
+    size_t
+    getContentStoreSize() const { return contentStoreSize_; }
+
+  private:
+    /**
+     * Remove the entry with the name from the Content Store, if it exists.
+     * @param nameValue The encoded Name TLV value of the Data name.
+     */
+    void
+    eraseFromContentStore(const ndn::BlobLite& nameValue);
+
+    std::mutex mutex_;
+    std::vector<ndn::ptr_lib::shared_ptr<PitEntry> > PIT_;
+    std::atomic<int> nShortPrefixPitEntries_;
+    // The most recently used entry is at the front.
+    ContentStoreList contentStoreLru_;
+    // The key is the encoded Name TLV value of the Data name, which refers to
+    // the encoding in the ContentStoreEntry.
+    std::map<ndn::BlobLite, ContentStoreList::iterator, NameValueLess> contentStore_;
+    size_t contentStoreSize_;
+  };
+
+  /**
+   * An OutgoingPacket holds a packet to send on a face after the Shard lock is
+   * released. (A MicroForwarderTransport delivers the packet immediately and
+   * the application may send a packet back to the MicroForwarder, so a lock
+   * must not be held while sending.)
+   */
+  class OutgoingPacket {
+  public:
+    /**
+     * Create an OutgoingPacket with the given values.
+     * @param face The face for sending.
+     * @param inFace The face where the packet came from, to select the output
+     * queue, or null if the packet is from the forwarder itself.
+     * @param data A pointer to the buffer of data to send. This does not make
+     * a copy, so the buffer must remain valid until send().
+     * @param dataLength The number of bytes in data.
+     * @param blob (optional) A Blob which holds the buffer, to keep it valid.
+     */
+    OutgoingPacket
+      (ForwarderFace* face, ForwarderFace* inFace, const uint8_t *data,
+       size_t dataLength, const ndn::Blob& blob = ndn::Blob())
+    : face_(face), inFaceId_(inFace ? inFace->getFaceId() : 0), data_(data),
+      dataLength_(dataLength), blob_(blob)
+    {
+    }
+
+    void
+    send() { face_->send(data_, dataLength_, inFaceId_, blob_); }
+
+  private:
+    ForwarderFace* face_;
+    int inFaceId_;
+    const uint8_t *data_;
+    size_t dataLength_;
+    ndn::Blob blob_;
+  };
+
+  class MulticastStrategy;
+  class BestRouteStrategy;
+  class RoundRobinStrategy;
+  class AsfStrategy;
+
   /**
    * This is called by onReceivedElement when it receives an interest starting
-   * with /localhost . Process the localhost command such as register prefix.
+   * with /localhost . Decode the Interest and process the localhost command
+   * such as register prefix.
+   * @param face The face which received the Interest.
+   * @param interest The fields of the received Interest.
+   */
+  void
+  onReceivedLocalhostInterest(ForwarderFace* face, const PacketFields& interest);
+
+  /**
+   * This is called by onReceivedElement when it receives an Interest (which is
+   * not a localhost Interest). Check the PIT and Content Store and select the
+   * next hops with the forwarding strategy.
+   * @param face The face which received the Interest.
+   * @param interest The fields of the received Interest.
+   * @param element The received element with the Interest.
+   * @param elementLength The length of element.
+   * @param microForwarderTransport If the incoming face uses a
+   * MicroForwarderTransport, this is the transport. Otherwise null.
+   * @param now The current time.
+   * @param shard The locked Shard for the Interest name.
+   * @param outgoing Append the packets to send after unlocking the Shard.
    */
   void
-  onReceivedLocalhostInterest
-    (ForwarderFace* face, const ndn::ptr_lib::shared_ptr<ndn::Interest>& interest);
+  onReceivedInterest
+    (ForwarderFace* face, const PacketFields& interest, const uint8_t *element, size_t elementLength,
+     MicroForwarderTransport* microForwarderTransport,
+     std::chrono::system_clock::time_point now, Shard& shard,
+     std::vector<OutgoingPacket>& outgoing);
+
+  /**
+   * This is called by onReceivedElement when it receives a Data packet, for
+   * each Shard which can have a matching PIT entry. Send the Data packet to the
+   * downstream of each matching PIT entry in the Shard.
+   * @param face The face which received the Data packet.
+   * @param data The fields of the received Data packet.
+   * @param element The received element with the Data packet.
+   * @param elementLength The length of element.
+   * @param now The current time.
+   * @param shard The locked Shard.
+   * @param isRttMeasured If false and a matching PIT entry has an OutRecord
+   * for face, add the RTT measurement to face and set this true.
+   * @param outgoing Append the packets to send after unlocking the Shard.
+   * @return True if the Data packet satisfied a PIT entry.
+   */
+  bool
+  onReceivedData
+    (ForwarderFace* face, PacketFields& data, const uint8_t *element, size_t elementLength,
+     std::chrono::system_clock::time_point now, Shard& shard,
+     bool& isRttMeasured, std::vector<OutgoingPacket>& outgoing);
+
+  /**
+   * This is called by onReceivedElement when it receives a Nack for an
+   * Interest. Ask the strategy for another next hop to try. If there is none
+   * and all upstreams have returned a Nack, forward the Nack downstream.
+   * @param face The face which received the Nack.
+   * @param interest The fields of the Interest in the Nack packet.
+   * @param element The received element with the Nack.
+   * @param elementLength The length of element.
+   * @param now The current time.
+   * @param shard The locked Shard for the Interest name.
+   * @param outgoing Append the packets to send after unlocking the Shard.
+   */
+  void
+  onReceivedNack
+    (ForwarderFace* face, const PacketFields& interest,
+     const uint8_t *element, size_t elementLength,
+     std::chrono::system_clock::time_point now, Shard& shard,
+     std::vector<OutgoingPacket>& outgoing);
+
+  /**
+   * Get the next hops in the FIB entries which match the name, keeping the
+   * NextHopRecord with the lowest cost for each face. The caller must hold a
+   * lock on fibMutex_ while using the result.
+   * @param interest The fields of the Interest with the name to match.
+   * @param strategy If strategy.usesAllMatchingFibEntries() is false, only use
+   * the FIB entry with the longest matching name.
+   * @param inFace Exclude this face (where the Interest came from).
+   * @param pitEntry (optional) If not null, exclude the faces which have an
+   * OutRecord in pitEntry.
+   * @param nextHops Set this to the matching next hops.
+   */
+  void
+  getNextHops
+    (const PacketFields& interest, ForwardingStrategy& strategy, ForwarderFace* inFace,
+     PitEntry* pitEntry, std::vector<NextHopRecord*>& nextHops);
+
+  /**
+   * Remove the PIT entries in the shard whose entry lifetime has ended, and
+   * clear the incoming face of the entries whose Interest timed out.
+   * @param shard The locked Shard.
+   * @param now The current time.
+   */
+  static void
+  removeExpiredPitEntries(Shard& shard, std::chrono::system_clock::time_point now);
+
+  /**
+   * Get the Shard for a name prefix, selected by the hash of its encoding.
+   * @param prefixValue A pointer to the encoded Name TLV value of the prefix.
+   * @param prefixValueLength The length of prefixValue.
+   * @return The Shard.
+   */
+  Shard&
+  getShard(const uint8_t *prefixValue, size_t prefixValueLength);
+
+  /**
+   * Get the length of the encoded components of the first nComponents of the
+   * name.
+   * @param nameValue A pointer to the encoded Name TLV value, which was
+   * checked by PacketFields::peek.
+   * @param nameValueLength The length of nameValue.
+   * @param nComponents The number of components in the prefix.
+   * @return The length of the prefix in nameValue, or nameValueLength if the
+   * name has no more than nComponents.
+   */
+  static size_t
+  getPrefixValueLength
+    (const uint8_t *nameValue, size_t nameValueLength, int nComponents);
+
+  /**
+   * Get the strategy for the given name from strategyChoice_, using the
+   * longest matching prefix. The caller must hold a lock on fibMutex_ while
+   * using the result.
+   * @param interest The fields of the Interest with the name to match.
+   * @return The ForwardingStrategy.
+   */
+  ForwardingStrategy&
+  findStrategy(const PacketFields& interest);
+
+  /**
+   * Check if the Transport must be polled by calling processEvents() to
+   * receive packets.
+   * @param transport The Transport of a ForwarderFace.
+   * @return False if the transport is the Endpoint of a MicroForwarderTransport
+   * (which receives a packet when the application sends it), otherwise true.
+   */
+  static bool
+  isPolledTransport(ndn::Transport* transport);
+
+  /**
+   * Encode the name and return the Name TLV value (the encoded components),
+   * to match with PacketFields::nameHasPrefix.
+   * @param name The name to encode.
+   * @return The encoded Name TLV value.
+   */
+  static ndn::Blob
+  encodeNameValue(const ndn::Name& name);
 
   /**
    * Find the face in faces_ with the faceId.
@@ -417,27 +1585,37 @@ private:
   findFace(int faceId);
 
   /**
-   * Mark the PitEntry at PIT_[i] as removed (in case something references it)
-   * and remove it.
+   * Get a copy of faces_, so that the caller can use the faces without holding
+   * facesMutex_.
+   * @param faces Set this to the faces.
    */
   void
-  removePitEntry(int i)
-  {
-    PIT_[i]->setIsRemoved();
-    PIT_.erase(PIT_.begin() + i);
-  }
+  getFaces(std::vector<ndn::ptr_lib::shared_ptr<ForwarderFace> >& faces);
 
-  std::vector<ndn::ptr_lib::shared_ptr<PitEntry> > PIT_;
+  std::vector<ndn::ptr_lib::shared_ptr<Shard> > shards_;
+  int nShardNameComponents_;
+  // fibMutex_ protects FIB_ and strategyChoice_.
+  std::shared_timed_mutex fibMutex_;
   std::vector<ndn::ptr_lib::shared_ptr<FibEntry> > FIB_;
+  // The first entry is for the empty prefix.
+  std::vector<ndn::ptr_lib::shared_ptr<StrategyChoiceEntry> > strategyChoice_;
+  // facesMutex_ protects faces_ and the face thread settings.
+  std::mutex facesMutex_;
   std::vector<ndn::ptr_lib::shared_ptr<ForwarderFace> > faces_;
+  bool isFaceThreadsStarted_;
+  std::chrono::nanoseconds faceThreadSleepTime_;
+  std::atomic<size_t> contentStoreCapacity_;
   std::chrono::nanoseconds minPitEntryLifetime_;
 
   ndn::Name localhostNamePrefix;
   ndn::Name localhopNamePrefix;
   ndn::Name registerNamePrefix;
+  ndn::Name strategyChoiceSetNamePrefix;
+  ndn::Name strategyNamePrefix;
   ndn::Name broadcastNamePrefix;
-
-  static MicroForwarder* instance_;
+  ndn::Blob localhostPrefixValue;
+  ndn::Blob localhopPrefixValue;
+  ndn::Blob broadcastPrefixValue;
 };
 
 }
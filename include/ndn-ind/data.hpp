@@ -187,6 +187,24 @@ public:
   ptr_lib::shared_ptr<Name>
   getFullName(WireFormat& wireFormat = *WireFormat::getDefaultWireFormat()) const;
 
+  /**
+   * Get the full name of each Data packet in a batch, the same as calling
+   * getFullName for each one. This computes the SHA-256 digests of the wire
+   * encodings that are not already cached in one call to
+   * CryptoLite::digestSha256Batch.
+   * @param dataList The list of pointers to the Data packets, which must not be
+   * null.
+   * @param wireFormat A WireFormat object used to encode the Data packets. If
+   * omitted, use WireFormat getDefaultWireFormat().
+   * @return A vector of the same size as dataList where result[i] is the full
+   * name of dataList[i]. You must not change the Name objects - if you need
+   * to change one then make a copy.
+   */
+  static std::vector<ptr_lib::shared_ptr<Name> >
+  getFullNames
+    (const std::vector<const Data*>& dataList,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
+
   /**
    * Return a reference to the defaultWireEncoding, which was encoded with
    * getDefaultWireEncodingFormat().  The SignedBlob may have a null pointer.
@@ -307,6 +325,31 @@ public:
   }
 
 private:
+  /**
+   * Check if the cached defaultFullName_ is valid for the wireFormat.
+   * @param wireFormat The WireFormat for the full name.
+   * @return True if defaultFullName_ can be returned by getFullName.
+   */
+  bool
+  haveDefaultFullName(WireFormat& wireFormat) const
+  {
+    // The default full name depends on the default wire encoding.
+    // A non-null default wire encoding means that the Data packet fields have
+    // not changed.
+    return !getDefaultWireEncoding().isNull() && defaultFullName_ &&
+      getDefaultWireEncodingFormat() == &wireFormat;
+  }
+
+  /**
+   * Make the full name from the name and the digest of the wire encoding, and
+   * cache it as defaultFullName_ if wireFormat is the default wire format.
+   * @param digest The SHA-256 digest of the wire encoding.
+   * @param wireFormat The WireFormat of the wire encoding.
+   * @return The full name.
+   */
+  ptr_lib::shared_ptr<Name>
+  makeFullName(const uint8_t* digest, WireFormat& wireFormat) const;
+
   void
   setDefaultWireEncoding
     (const SignedBlob& defaultWireEncoding,
@@ -314,6 +357,10 @@ private:
   {
     defaultWireEncoding_ = defaultWireEncoding;
     defaultWireEncodingFormat_ = defaultWireEncodingFormat;
+    // The default full name is for the previous wire encoding. Just reset the
+    // pointer, since this is called for every encoding and the full name is
+    // made lazily by getFullName.
+    defaultFullName_.reset();
     // Set getDefaultWireEncodingChangeCount_ so that the next call to
     //   getDefaultWireEncoding() won't clear defaultWireEncoding_.
     getDefaultWireEncodingChangeCount_ = getChangeCount();
@@ -325,6 +372,7 @@ private:
   Blob content_;
   SignedBlob defaultWireEncoding_;
   WireFormat *defaultWireEncodingFormat_;
+  // This is null if the full name of the default wire encoding is not cached.
   ptr_lib::shared_ptr<Name> defaultFullName_;
   uint64_t getDefaultWireEncodingChangeCount_;
   ptr_lib::shared_ptr<LpPacket> lpPacket_;
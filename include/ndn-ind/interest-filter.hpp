@@ -38,6 +38,8 @@
 
 namespace ndn {
 
+class NdnRegexCompiledMatcher;
+
 /**
  * An InterestFilter holds a Name prefix and optional regex match expression for
  * use in Face::setInterestFilter.
@@ -189,9 +191,18 @@ private:
   static std::string
   makePattern(const std::string& regexFilter);
 
+  /**
+   * Compile regexFilterPattern_ into regexFilterMatcher_ so that doesMatch
+   * doesn't parse the regex each time. If it can't be compiled, leave
+   * regexFilterMatcher_ null.
+   */
+  void
+  compileRegexFilter();
+
   Name prefix_;
   std::string regexFilter_;
   std::string regexFilterPattern_;
+  ptr_lib::shared_ptr<NdnRegexCompiledMatcher> regexFilterMatcher_;
 };
 
 }
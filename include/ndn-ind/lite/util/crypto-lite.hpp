@@ -66,6 +66,22 @@ public:
     digestSha256(data.buf(), data.size(), digest);
   }
 
+  /**
+   * Compute the sha-256 digest of each of a batch of input buffers. See
+   * ndn_digestSha256Batch for details.
+   * @param dataList An array of nBuffers pointers to the input byte arrays.
+   * @param dataLengthList An array of nBuffers lengths, where
+   * dataLengthList[i] is the length of dataList[i].
+   * @param nBuffers The number of input buffers.
+   * @param digests A pointer to a buffer of size
+   * nBuffers * ndn_SHA256_DIGEST_SIZE to receive the digests, where the digest
+   * of dataList[i] is at digests + i * ndn_SHA256_DIGEST_SIZE.
+   */
+  static void
+  digestSha256Batch
+    (const uint8_t* const* dataList, const size_t* dataLengthList,
+     size_t nBuffers, uint8_t* digests);
+
   /**
    * Fill the buffer with random bytes.
    * @param buffer Write the random bytes to this buffer.
@@ -42,17 +42,22 @@
 #include "../../ndn-ind-config.h"
 #ifdef NDN_IND_HAVE_SQLITE3
 
+#include <map>
 #include "pib-impl.hpp"
 
 struct sqlite3;
 
 namespace ndn {
 
+class Sqlite3Statement;
+
 /**
  * PibSqlite3 extends PibImpl and is used by the Pib class as an implementation
  * of a PIB based on an SQLite3 database. All the contents in the PIB are stored
  * in an SQLite3 database file. This provides more persistent storage than
- * PibMemory.
+ * PibMemory. The database uses write-ahead logging. Prepared statements are
+ * reused, and the default identity, keys and certificates are cached in
+ * memory until this object changes the database.
  */
 class ndn_ind_dll PibSqlite3 : public PibImpl {
 public:
@@ -320,6 +325,31 @@ public:
   }
 
 private:
+  class CachedStatement;
+
+  /**
+   * Get the prepared statement for the SQL from statements_, or prepare it and
+   * add it to statements_ if it is not there. Use CachedStatement instead of
+   * calling this directly.
+   * @param sql The SQL statement.
+   * @return The prepared statement.
+   * @throws std::domain_error if the SQL statement is bad.
+   */
+  Sqlite3Statement&
+  getStatement(const char* sql) const;
+
+  /**
+   * Clear the in-memory cache of the default identity, keys and certificates.
+   * This is called by every method which changes the database.
+   */
+  void
+  clearDefaultsCache()
+  {
+    defaultIdentity_.reset();
+    defaultKeyOfIdentity_.clear();
+    defaultCertificateOfKey_.clear();
+  }
+
   bool
   hasDefaultIdentity() const;
 
@@ -334,6 +364,13 @@ private:
   PibSqlite3& operator=(const PibSqlite3& other);
 
   struct sqlite3 *database_;
+  // The key is the SQL. The value is the prepared statement to reuse.
+  std::map<std::string, ptr_lib::shared_ptr<Sqlite3Statement> > statements_;
+  // The in-memory read-through cache of the defaults. A null pointer or
+  // missing map entry means that it must be read from the database.
+  ptr_lib::shared_ptr<Name> defaultIdentity_;
+  std::map<Name, Name> defaultKeyOfIdentity_;
+  std::map<Name, ptr_lib::shared_ptr<CertificateV2> > defaultCertificateOfKey_;
 };
 
 }
@@ -37,6 +37,9 @@
 
 #include <float.h>
 #include <map>
+#include <list>
+#include <queue>
+#include <unordered_map>
 #include "../../interest.hpp"
 #include "certificate-v2.hpp"
 
@@ -45,7 +48,8 @@ namespace ndn {
 /**
  * A CertificateCacheV2 holds other user's verified certificates in security v2
  * format CertificateV2. A certificate is removed no later than its NotAfter
- * time, or maxLifetime after it has been added to the cache.
+ * time, or maxLifetime after it has been added to the cache. If a capacity is
+ * set, the least recently used certificate is removed when the cache is full.
  */
 class ndn_ind_dll CertificateCacheV2 {
 public:
@@ -56,6 +60,24 @@ public:
    */
   CertificateCacheV2(std::chrono::nanoseconds maxLifetime = getDefaultLifetime());
 
+  /**
+   * Set the maximum number of certificates in the cache. If the cache is full
+   * when a certificate is inserted, this removes the least recently inserted
+   * or found certificate. If the cache has more certificates than the new
+   * capacity, this removes the least recently used ones now.
+   * @param capacity The maximum number of certificates. If 0 (the default),
+   * the number of certificates is not limited.
+   */
+  void
+  setCapacity(size_t capacity);
+
+  /**
+   * Get the maximum number of certificates in the cache.
+   * @return The capacity, or 0 if the number of certificates is not limited.
+   */
+  size_t
+  getCapacity() const { return capacity_; }
+
   /**
    * Insert the certificate into the cache. The inserted certificate will be
    * removed no later than its NotAfter time, or maxLifetime given
@@ -86,6 +108,16 @@ public:
   ptr_lib::shared_ptr<CertificateV2>
   find(const Interest& interest) const;
 
+  /**
+   * Find the certificate whose name equals the given name. This uses a hash
+   * index instead of searching by prefix.
+   * @param certificateName The full name of the certificate.
+   * @return The found certificate, or null if not found. You must not modify
+   * the returned object. If you need to modify it, then make a copy.
+   */
+  ptr_lib::shared_ptr<CertificateV2>
+  findExact(const Name& certificateName) const;
+
   /**
    * Remove the certificate whose name equals the given name. If no such
    * certificate is in the cache, do nothing.
@@ -139,6 +171,8 @@ public:
 
     ptr_lib::shared_ptr<CertificateV2> certificate_;
     std::chrono::system_clock::time_point removalTime_;
+    // The position of the certificate name in the LRU list.
+    std::list<Name>::iterator lruPosition_;
   };
 
   /**
@@ -153,18 +187,60 @@ public:
   }
 
 private:
+  typedef std::map<Name, Entry>::iterator EntryIterator;
+  typedef std::pair<std::chrono::system_clock::time_point, Name> RemovalEntry;
+
   /**
-   * Remove all outdated certificate entries.
+   * NameHash is the hash function for using a Name as an unordered_map key.
+   */
+  class NameHash {
+  public:
+    size_t
+    operator()(const Name& name) const { return name.hash(); }
+  };
+
+  /**
+   * Remove all outdated certificate entries. This pops the expired entries
+   * from the top of removalQueue_, so that certificates which are not expired
+   * are not checked.
    */
   void
   refresh();
 
+  /**
+   * Remove the entry from certificatesByName_, the hash index and the LRU list.
+   * Any of its entries in removalQueue_ are skipped when they are popped.
+   * @param entry The entry to remove.
+   */
+  void
+  remove(EntryIterator entry);
+
+  /**
+   * Move the entry to the front of the LRU list.
+   * @param entry The entry which was used.
+   */
+  void
+  touch(EntryIterator entry)
+  {
+    lru_.splice(lru_.begin(), lru_, entry->second.lruPosition_);
+  }
+
   // Disable the copy constructor and assignment operator.
   CertificateCacheV2(const CertificateCacheV2& other);
   CertificateCacheV2& operator=(const CertificateCacheV2& other);
 
   std::map<Name, Entry> certificatesByName_;
-  std::chrono::system_clock::time_point nextRefreshTime_;
+  // The hash index of certificatesByName_ for findExact.
+  std::unordered_map<Name, EntryIterator, NameHash> certificatesByExactName_;
+  // A min-heap of the removal time of each inserted certificate. When a
+  // certificate is removed or inserted again, its old entry stays in the heap
+  // and is skipped by refresh() because the removal time doesn't match.
+  std::priority_queue
+    <RemovalEntry, std::vector<RemovalEntry>, std::greater<RemovalEntry> >
+    removalQueue_;
+  // The certificate names from the most recently used to the least.
+  std::list<Name> lru_;
+  size_t capacity_;
   std::chrono::nanoseconds maxLifetime_;
   std::chrono::nanoseconds nowOffset_;
 };
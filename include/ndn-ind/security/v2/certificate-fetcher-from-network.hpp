@@ -35,6 +35,7 @@
 #ifndef NDN_CERTIFICATE_FETCHER_FROM_NETWORK_HPP
 #define NDN_CERTIFICATE_FETCHER_FROM_NETWORK_HPP
 
+#include <map>
 #include "../../face.hpp"
 #include "certificate-fetcher.hpp"
 
@@ -42,7 +43,12 @@ namespace ndn {
 
 /**
  * CertificateFetcherFromNetwork extends CertificateFetcher to fetch missing
- * certificates from the network.
+ * certificates from the network. If a certificate is requested while a fetch
+ * for the same certificate Interest name is in progress, this does not send
+ * another Interest but adds the request to the waiters of the fetch, so that
+ * a burst of Data packets signed by the same uncached key only sends one
+ * Interest. Each waiter still validates the fetched certificate with its own
+ * ValidationState.
  */
 class ndn_ind_dll CertificateFetcherFromNetwork : public CertificateFetcher {
 public:
@@ -54,9 +60,17 @@ public:
   : impl_(new Impl(*this, face))
   {}
 
+  /**
+   * Get the number of certificate Interest names which are being fetched.
+   * @return The number of pending fetches.
+   */
+  size_t
+  getPendingFetchCount() const { return impl_->getPendingFetchCount(); }
+
 protected:
   /**
-   * Implement doFetch to use face_.expressInterest to fetch a certificate.
+   * Implement doFetch to use face_.expressInterest to fetch a certificate. If
+   * a fetch for the same Interest name is pending, just add to its waiters.
    * @param certificateRequest The the request with the Interest for fetching
    * the certificate.
    * @param state The validation state.
@@ -89,7 +103,8 @@ private:
     virtual ~Impl() {}
 
     /**
-     * Implement doFetch to use face_.expressInterest to fetch a certificate.
+     * Implement doFetch to use face_.expressInterest to fetch a certificate,
+     * or add to the waiters of a pending fetch for the same Interest name.
      * @param certificateRequest The the request with the Interest for fetching
      * the certificate.
      * @param state The validation state.
@@ -103,66 +118,91 @@ private:
        const ptr_lib::shared_ptr<ValidationState>& state,
        const ValidationContinuation& continueValidation);
 
+    size_t
+    getPendingFetchCount() const { return pendingFetches_.size(); }
+
   private:
-    /** This is called when a certificate is retrieved.
+    /**
+     * PendingFetch holds the waiters for one certificate Interest name.
+     */
+    class PendingFetch {
+    public:
+      PendingFetch
+        (const ptr_lib::shared_ptr<CertificateRequest>& certificateRequest)
+      : certificateRequest_(certificateRequest)
+      {}
+
+      // The request of the first waiter, which has the retry count.
+      ptr_lib::shared_ptr<CertificateRequest> certificateRequest_;
+      std::vector<std::pair
+        <ptr_lib::shared_ptr<ValidationState>, ValidationContinuation> > waiters_;
+    };
+
+    /**
+     * Remove the pending fetch from pendingFetches_ so that a new request for
+     * the same Interest name sends a new Interest.
+     * @param pendingFetch The PendingFetch to remove.
+     */
+    void
+    removePendingFetch(const ptr_lib::shared_ptr<PendingFetch>& pendingFetch);
+
+    /** This is called when a certificate is retrieved. Call continueValidation
+     * for each waiter, which checks the policy and verifies the certificate
+     * for that waiter.
      * @param interest This is ignored.
      * @param data The data packet of the fetched certificate.
-     * @param state The validation state, from doFetch.
-     * @param continueValidation After fetching, this calls
-     * continueValidation(certificate, state) where certificate is the fetched
-     * certificate and state is the ValidationState.
+     * @param pendingFetch The PendingFetch with the waiters.
      */
     void
     onData
       (const ptr_lib::shared_ptr<const Interest>& interest,
        const ptr_lib::shared_ptr<Data>& data,
-       const ptr_lib::shared_ptr<ValidationState>& state,
-       const CertificateFetcher::ValidationContinuation& continueValidation);
+       const ptr_lib::shared_ptr<PendingFetch>& pendingFetch);
 
     /** This is called when expressing the Interest for a certificate receives a
      * network Nack. It will re-express the interest if
      * certificateRequest.nRetriesLeft_ is greater than zero, otherwise this calls
-     * state.fail() .
+     * state.fail() for each waiter.
      * @param interest This is ignored in favor of the Interest in
      * certificateRequest.
      * @param networkNack The received network Nack.
-     * @param certificateRequest The the request with the Interest for fetching
-     * the certificate, from doFetch.
-     * @param state The validation state, from doFetch.
-     * @param continueValidation After fetching, this calls
-     * continueValidation(certificate, state) where certificate is the fetched
-     * certificate and state is the ValidationState.
+     * @param pendingFetch The PendingFetch with the certificate request and the
+     * waiters.
      */
     void
     onNetworkNack
       (const ptr_lib::shared_ptr<const Interest>& interest,
        const ptr_lib::shared_ptr<NetworkNack>& networkNack,
-       const ptr_lib::shared_ptr<CertificateRequest>& certificateRequest,
-       const ptr_lib::shared_ptr<ValidationState>& state,
-       const CertificateFetcher::ValidationContinuation& continueValidation);
+       const ptr_lib::shared_ptr<PendingFetch>& pendingFetch);
 
     /** This is called when expressing the Interest for a certificate receives a
      * timeout. It will re-express the interest if
      * certificateRequest.nRetriesLeft_ is greater than zero, otherwise this calls
-     * state.fail() .
+     * state.fail() for each waiter.
      * @param interest This is ignored in favor of the Interest in
      * certificateRequest.
-     * @param certificateRequest The the request with the Interest for fetching
-     * the certificate, from doFetch.
-     * @param state The validation state, from doFetch.
-     * @param continueValidation After fetching, this calls
-     * continueValidation(certificate, state) where certificate is the fetched
-     * certificate and state is the ValidationState.
+     * @param pendingFetch The PendingFetch with the certificate request and the
+     * waiters.
      */
     void
     onTimeout
       (const ptr_lib::shared_ptr<const Interest>& interest,
-       const ptr_lib::shared_ptr<CertificateRequest>& certificateRequest,
-       const ptr_lib::shared_ptr<ValidationState>& state,
-       const CertificateFetcher::ValidationContinuation& continueValidation);
+       const ptr_lib::shared_ptr<PendingFetch>& pendingFetch);
+
+    /**
+     * Decrement the retries of the pending fetch and fetch again for each
+     * waiter, or if there are no retries left then call state.fail() for each
+     * waiter.
+     * @param pendingFetch The PendingFetch with the certificate request and the
+     * waiters.
+     */
+    void
+    retryOrFail(const ptr_lib::shared_ptr<PendingFetch>& pendingFetch);
 
     CertificateFetcherFromNetwork& parent_;
     Face& face_;
+    // The key is the Interest name of the certificate request.
+    std::map<Name, ptr_lib::shared_ptr<PendingFetch> > pendingFetches_;
   };
 
   ptr_lib::shared_ptr<Impl> impl_;
@@ -35,6 +35,7 @@
 #ifndef NDN_CERTIFICATE_STORAGE_HPP
 #define NDN_CERTIFICATE_STORAGE_HPP
 
+#include <list>
 #include "certificate-cache-v2.hpp"
 #include "x509-crl-cache.hpp"
 #include "trust-anchor-container.hpp"
@@ -49,7 +50,9 @@ class ndn_ind_dll CertificateStorage {
 public:
   CertificateStorage()
   : verifiedCertificateCache_(std::chrono::hours(1)),
-    unverifiedCertificateCache_(std::chrono::minutes(5))
+    unverifiedCertificateCache_(std::chrono::minutes(5)),
+    validatedDataCacheCapacity_(0),
+    nowOffset_(0)
   {
   }
 
@@ -102,6 +105,20 @@ public:
   const CertificateCacheV2&
   getUnverifiedCertificateCache() const { return unverifiedCertificateCache_; }
 
+  /**
+   * Set the maximum number of certificates in each of the verified and
+   * unverified certificate caches. When a cache is full, it removes the least
+   * recently used certificate. See CertificateCacheV2::setCapacity.
+   * @param capacity The maximum number of certificates in each cache. If 0
+   * (the default), the number of certificates is not limited.
+   */
+  void
+  setCertificateCacheCapacity(size_t capacity)
+  {
+    verifiedCertificateCache_.setCapacity(capacity);
+    unverifiedCertificateCache_.setCapacity(capacity);
+  }
+
   /**
    * Load a static trust anchor. Static trust anchors are permanently associated
    * with the validator and never expire.
@@ -141,7 +158,11 @@ public:
    * Remove any previously loaded static or dynamic trust anchors.
    */
   void
-  resetAnchors() { trustAnchors_.clear(); }
+  resetAnchors()
+  {
+    trustAnchors_.clear();
+    clearValidatedData();
+  }
 
   /**
    * Check if the CRL revoked the certificate and if not then
@@ -168,7 +189,44 @@ public:
    * Remove any cached verified certificates.
    */
   void
-  resetVerifiedCertificates() { verifiedCertificateCache_.clear(); }
+  resetVerifiedCertificates()
+  {
+    verifiedCertificateCache_.clear();
+    clearValidatedData();
+  }
+
+  /**
+   * Set the maximum number of entries in the cache of Data packets which were
+   * successfully validated. When Validator::validate is called for a Data
+   * packet with the same implicit SHA-256 digest as a cached entry, it calls
+   * the success callback without checking the policy and certificate chain
+   * again. An entry is removed when a certificate in its chain expires, when
+   * cacheVerifiedCrl revokes a certificate in its chain, when the verified
+   * certificate which its chain started from is no longer in the verified
+   * certificate cache, or after one hour the same as the verified certificate
+   * cache. The cache is cleared by
+   * resetAnchors and resetVerifiedCertificates. If the cache is full, this
+   * removes the least recently used entry.
+   * @param capacity The maximum number of entries. If 0 (the default), don't
+   * cache validated Data packets.
+   */
+  void
+  setValidatedDataCacheCapacity(size_t capacity);
+
+  /**
+   * Get the maximum number of entries in the validated Data cache.
+   * @return The capacity, or 0 if Data packets are not cached.
+   */
+  size_t
+  getValidatedDataCacheCapacity() const { return validatedDataCacheCapacity_; }
+
+  /**
+   * Get the number of entries in the validated Data cache, which may include
+   * expired entries which have not been removed yet.
+   * @return The number of entries.
+   */
+  size_t
+  getValidatedDataCacheSize() const { return validatedData_.size(); }
 
   /**
    * Set the offset when the cache insert() and refresh() get the current time,
@@ -180,6 +238,7 @@ public:
   {
     verifiedCertificateCache_.setNowOffset_(nowOffset);
     unverifiedCertificateCache_.setNowOffset_(nowOffset);
+    nowOffset_ = nowOffset;
   }
 
   /**
@@ -201,10 +260,80 @@ private:
   CertificateStorage& operator=(const CertificateStorage& other);
 
 protected:
+  /**
+   * Check if the validated Data cache has an entry for the Data packet which
+   * has not expired, and make it the most recently used.
+   * @param digest The implicit SHA-256 digest component of the Data packet.
+   * @return True if the Data packet was already validated.
+   */
+  bool
+  findValidatedData(const Name::Component& digest);
+
+  /**
+   * Add the validated Data packet to the validated Data cache, if the capacity
+   * is not 0.
+   * @param digest The implicit SHA-256 digest component of the Data packet.
+   * @param certificates The certificates which were used to validate the Data
+   * packet, including the trusted certificate. If the Data packet is itself a
+   * certificate, this should also include it so that it is removed from the
+   * cache if it is revoked.
+   * @param verifiedCertificateName If the trusted certificate was found in the
+   * verified certificate cache, this is its name. The certificates above it in
+   * its chain are not in certificates, so the entry is only valid while this
+   * certificate is still in the verified certificate cache. If the trusted
+   * certificate is a trust anchor, this is an empty Name.
+   */
+  void
+  cacheValidatedData
+    (const Name::Component& digest,
+     const std::vector<ptr_lib::shared_ptr<CertificateV2> >& certificates,
+     const Name& verifiedCertificateName);
+
   TrustAnchorContainer trustAnchors_;
   CertificateCacheV2 verifiedCertificateCache_;
   CertificateCacheV2 unverifiedCertificateCache_;
   X509CrlCache verifiedCrlCache_;
+
+private:
+  /**
+   * ValidatedDataEntry is the value in validatedData_ for a Data packet which
+   * was successfully validated.
+   */
+  class ValidatedDataEntry {
+  public:
+    // The issuer name and X.509 serial number of each certificate which was
+    // used to validate the Data packet.
+    std::vector<std::pair<Name, Blob> > certificates_;
+    // The name of the trusted certificate from verifiedCertificateCache_, or
+    // an empty Name if it is a trust anchor.
+    Name verifiedCertificateName_;
+    std::chrono::system_clock::time_point removalTime_;
+    // The position of the digest in validatedDataLru_.
+    std::list<Name::Component>::iterator lruPosition_;
+  };
+
+  void
+  clearValidatedData()
+  {
+    validatedData_.clear();
+    validatedDataLru_.clear();
+  }
+
+  void
+  removeValidatedData
+    (std::map<Name::Component, ValidatedDataEntry>::iterator entry)
+  {
+    validatedDataLru_.erase(entry->second.lruPosition_);
+    validatedData_.erase(entry);
+  }
+
+  // The key is the implicit SHA-256 digest component of the Data packet.
+  std::map<Name::Component, ValidatedDataEntry> validatedData_;
+  // The digests in validatedData_ with the most recently used at the front.
+  std::list<Name::Component> validatedDataLru_;
+  size_t validatedDataCacheCapacity_;
+  // nowOffset_ is only used for testing.
+  std::chrono::nanoseconds nowOffset_;
 };
 
 }
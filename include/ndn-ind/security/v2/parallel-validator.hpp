@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_PARALLEL_VALIDATOR_HPP
+#define NDN_PARALLEL_VALIDATOR_HPP
+
+// Only compile if ndn-ind-config.h defines NDN_IND_HAVE_BOOST_ASIO.
+#include "../../ndn-ind-config.h"
+#ifdef NDN_IND_HAVE_BOOST_ASIO
+
+#include <thread>
+#include <map>
+#include <boost/asio.hpp>
+#include "validator.hpp"
+
+namespace ndn {
+
+/**
+ * ParallelValidator extends Validator to verify signatures in a pool of worker
+ * threads. The validation policy, the certificate caches and the certificate
+ * fetcher are still used on the thread of the application's asio io_service,
+ * for example the thread of a ThreadsafeFace. When the certificate chain of a
+ * packet reaches a trusted certificate, the chain and the packet are encoded
+ * on the io_service thread and only the immutable encodings, signature values
+ * and public keys are given to a worker thread to verify. The result is
+ * posted to the io_service which caches the verified certificates and calls
+ * the success or failure callback. Therefore validate must be called on the
+ * io_service thread, and the callbacks are called later on that thread.
+ */
+class ndn_ind_dll ParallelValidator : public Validator {
+public:
+  /**
+   * Create a ParallelValidator with the policy and fetcher, and start the
+   * worker threads.
+   * @param policy The validation policy to be associated with this validator.
+   * @param certificateFetcher The certificate fetcher implementation, for
+   * example a CertificateFetcherFromNetwork with a ThreadsafeFace which uses
+   * ioService.
+   * @param ioService The asio io_service of the thread which calls validate.
+   * This posts the results of the worker threads to ioService. It is the
+   * responsibility of the application to run the service.
+   * @param nThreads (optional) The number of worker threads. If omitted or 0,
+   * use std::thread::hardware_concurrency(), or 1 if that is unknown.
+   */
+  ParallelValidator
+    (const ptr_lib::shared_ptr<ValidationPolicy>& policy,
+     const ptr_lib::shared_ptr<CertificateFetcher>& certificateFetcher,
+     boost::asio::io_service& ioService, size_t nThreads = 0);
+
+  /**
+   * Stop and join the worker threads. Verifications which have not finished
+   * do not call their callbacks. This should be called on the io_service
+   * thread, or after the io_service is stopped.
+   */
+  ~ParallelValidator();
+
+  /**
+   * Get the number of worker threads.
+   * @return The number of worker threads.
+   */
+  size_t
+  getThreadCount() const { return threads_.size(); }
+
+protected:
+  /**
+   * Override to call makeSignatureChecks on this thread, call verifySignatures
+   * in a worker thread and post the result to the io_service to call
+   * onSignaturesVerified.
+   */
+  virtual void
+  verifyFromTrustedCertificate
+    (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+     const ptr_lib::shared_ptr<ValidationState>& state);
+
+private:
+  /**
+   * A PendingVerification holds the objects of a verification in a worker
+   * thread, which are only used on the ioService_ thread.
+   */
+  class PendingVerification {
+  public:
+    PendingVerification
+      (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+       const ptr_lib::shared_ptr<ValidationState>& state)
+    : trustedCertificate_(trustedCertificate), state_(state)
+    {
+    }
+
+    ptr_lib::shared_ptr<CertificateV2> trustedCertificate_;
+    ptr_lib::shared_ptr<ValidationState> state_;
+  };
+
+  /**
+   * This is called in a worker thread to call verifySignatures and post the
+   * result to ioService_. This only uses the SignatureCheck objects, and not
+   * the packets or certificates.
+   * @param isAlive The weak_ptr to isAlive_ for onVerifiedInWorker. (Don't
+   * access isAlive_ in the worker thread.)
+   * @param verificationId The key in pendingVerifications_.
+   * @param signatureChecks The SignatureCheck objects from makeSignatureChecks.
+   */
+  void
+  verifyInWorker
+    (const ptr_lib::weak_ptr<ParallelValidator*>& isAlive,
+     uint64_t verificationId,
+     const ptr_lib::shared_ptr<const std::vector<ValidationState::SignatureCheck> >&
+       signatureChecks);
+
+  /**
+   * This is called on the ioService_ thread with the result of verifyInWorker.
+   * If isAlive is expired then this ParallelValidator was destroyed, so do
+   * nothing. Otherwise remove the entry from pendingVerifications_ and call
+   * onSignaturesVerified.
+   */
+  static void
+  onVerifiedInWorker
+    (const ptr_lib::weak_ptr<ParallelValidator*>& isAlive,
+     uint64_t verificationId, size_t nVerifiedCertificates,
+     bool isOriginalSignatureValid);
+
+  // Disable the copy constructor and assignment operator.
+  ParallelValidator(const ParallelValidator& other);
+  ParallelValidator& operator=(const ParallelValidator& other);
+
+  boost::asio::io_service& ioService_;
+  // The worker threads run workService_.
+  boost::asio::io_service workService_;
+  ptr_lib::shared_ptr<boost::asio::io_service::work> work_;
+  std::vector<std::thread> threads_;
+  // The key is the verification ID. This is only used on the ioService_
+  // thread.
+  std::map<uint64_t, PendingVerification> pendingVerifications_;
+  uint64_t lastVerificationId_;
+  // Handlers posted to ioService_ hold a weak_ptr to this, which the
+  // destructor resets.
+  ptr_lib::shared_ptr<ParallelValidator*> isAlive_;
+};
+
+}
+
+#endif // NDN_IND_HAVE_BOOST_ASIO
+
+#endif
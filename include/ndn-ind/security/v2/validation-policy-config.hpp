@@ -35,6 +35,7 @@
 #ifndef NDN_VALIDATION_POLICY_CONFIG_HPP
 #define NDN_VALIDATION_POLICY_CONFIG_HPP
 
+#include <map>
 #include "validation-policy.hpp"
 #include "validator-config/config-rule.hpp"
 
@@ -122,6 +123,30 @@ private:
   static std::chrono::nanoseconds
   getRefreshPeriod(const BoostInfoTree& configSection);
 
+  typedef std::map<Name, std::vector<size_t> > RuleIndex;
+
+  /**
+   * Add the rule's match prefixes to the ruleIndex.
+   * @param rule The rule from load.
+   * @param ruleNo The index of the rule in dataRules_ or interestRules_.
+   * @param ruleIndex The rule index to update.
+   */
+  static void
+  addToRuleIndex(const ConfigRule& rule, size_t ruleNo, RuleIndex& ruleIndex);
+
+  /**
+   * Get the rules which can match the packet name because the packet name has
+   * one of their match prefixes.
+   * @param ruleIndex The rule index from addToRuleIndex.
+   * @param packetName The packet name.
+   * @param ruleNos Set this to the rule indexes in increasing order so that
+   * the first rule which matches is the same as checking all the rules.
+   */
+  static void
+  getCandidateRules
+    (const RuleIndex& ruleIndex, const Name& packetName,
+     std::vector<size_t>& ruleNos);
+
   /** shouldBypass_ is set to true when 'any' is specified as a trust anchor,
    * causing all packets to bypass validation.
    */
@@ -129,6 +154,10 @@ private:
   bool isConfigured_;
   std::vector<ptr_lib::shared_ptr<ConfigRule>> dataRules_;
   std::vector<ptr_lib::shared_ptr<ConfigRule>> interestRules_;
+  // The key is a match prefix of the rules in the value, so that checkPolicy
+  // only calls ConfigRule::match for a rule which can match the packet name.
+  RuleIndex dataRuleIndex_;
+  RuleIndex interestRuleIndex_;
 };
 
 }
@@ -92,6 +92,44 @@ class CertificateStorage;
  */
 class ndn_ind_dll ValidationState {
 public:
+  /**
+   * A SignatureCheck has the signed encoding, signature value and public key
+   * DER to verify one signature. The Blob buffers are immutable, so a
+   * SignatureCheck can be verified in a worker thread while the packets and
+   * certificates are still used (and possibly re-encoded) on the validator
+   * thread.
+   */
+  class SignatureCheck {
+  public:
+    /**
+     * Create a SignatureCheck which always fails, for example when the packet
+     * can't be encoded.
+     */
+    SignatureCheck() {}
+
+    SignatureCheck
+      (const SignedBlob& signedEncoding, const Blob& signatureValue,
+       const Blob& publicKeyDer)
+    : signedEncoding_(signedEncoding), signatureValue_(signatureValue),
+      publicKeyDer_(publicKeyDer)
+    {
+    }
+
+    /**
+     * Verify the signature. This only reads the immutable buffers, so it can
+     * be called in any thread.
+     * @return True if the signature is valid, false if it is invalid or the
+     * key type is not supported.
+     */
+    bool
+    verify() const;
+
+  private:
+    SignedBlob signedEncoding_;
+    Blob signatureValue_;
+    Blob publicKeyDer_;
+  };
+
   ValidationState()
   : hasOutcome_(false)
   {
@@ -178,17 +216,27 @@ private:
   friend class Validator;
 
   /**
-   * Verify the signature of the original packet. This is only called by the
-   * Validator class.
-   * @param trustedCertificate The certificate that signs the original packet.
+   * Encode the original packet and make the SignatureCheck for its signature.
+   * This is only called by the Validator class, on the validator thread.
+   * @param signingCertificate The certificate that signs the original packet.
+   * @return The SignatureCheck.
+   */
+  virtual SignatureCheck
+  makeOriginalPacketSignatureCheck
+    (const CertificateV2& signingCertificate) const = 0;
+
+  /**
+   * Finish verifying the original packet with the result of its
+   * SignatureCheck, and call the success or failure callback.
+   * This is only called by the Validator class.
+   * @param isSignatureValid The result of the SignatureCheck.
    * @param certificateStorage If not null and the original packet is a
    * CertificateV2, call certificateStorage.findRevokedCertificate to check if
    * the original packet is revoked.
    */
   virtual void
-  verifyOriginalPacket
-    (const CertificateV2& trustedCertificate,
-     const CertificateStorage* certificateStorage) = 0;
+  onOriginalPacketVerified
+    (bool isSignatureValid, const CertificateStorage* certificateStorage) = 0;
 
   /**
    * Call the success callback of the original packet without signature
@@ -198,12 +246,31 @@ private:
   bypassValidation() = 0;
 
   /**
-   * Verify signatures of certificates in the certificate chain. On return, the
-   * certificate chain contains a list of certificates successfully verified by
+   * Encode the certificates in the certificate chain and the original packet,
+   * and make a SignatureCheck for each signature. This is only called by the
+   * Validator class, on the validator thread.
+   * @param trustedCertificate The certificate which signs the first
+   * certificate in the chain.
+   * @param signatureChecks Append a SignatureCheck for each certificate in the
+   * chain, followed by the SignatureCheck for the original packet.
+   */
+  void
+  makeSignatureChecks
+    (const CertificateV2& trustedCertificate,
+     std::vector<SignatureCheck>& signatureChecks) const;
+
+  /**
+   * Finish verifying the certificate chain with the result of the
+   * SignatureCheck objects. On return, the certificate chain
+   * contains a list of certificates successfully verified by
    * trustedCertificate.
    * When the certificate chain cannot be verified, this method will call
    * fail() with the INVALID_SIGNATURE error code and the appropriate message.
    * This is only called by the Validator class.
+   * @param trustedCertificate The certificate which signs the first
+   * certificate in the chain.
+   * @param nVerifiedCertificates The number of certificates at the start of
+   * the chain which have a valid signature.
    * @return The certificate to validate the original data packet, either the
    * last entry in the certificate chain or trustedCertificate if the
    * certificate chain is empty. However, return null if the signature of at
@@ -212,7 +279,8 @@ private:
    */
   ptr_lib::shared_ptr<CertificateV2>
   verifyCertificateChain
-    (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate);
+    (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+     size_t nVerifiedCertificates);
 
   // Disable the copy constructor and assignment operator.
   ValidationState(const ValidationState& other);
@@ -259,10 +327,13 @@ public:
   getOriginalData() const { return *data_; }
 
 private:
+  virtual SignatureCheck
+  makeOriginalPacketSignatureCheck
+    (const CertificateV2& signingCertificate) const;
+
   virtual void
-  verifyOriginalPacket
-    (const CertificateV2& trustedCertificate,
-     const CertificateStorage* certificateStorage);
+  onOriginalPacketVerified
+    (bool isSignatureValid, const CertificateStorage* certificateStorage);
 
   virtual void
   bypassValidation();
@@ -314,10 +385,13 @@ public:
   }
 
 private:
+  virtual SignatureCheck
+  makeOriginalPacketSignatureCheck
+    (const CertificateV2& signingCertificate) const;
+
   virtual void
-  verifyOriginalPacket
-    (const CertificateV2& trustedCertificate,
-     const CertificateStorage* certificateStorage);
+  onOriginalPacketVerified
+    (bool isSignatureValid, const CertificateStorage* certificateStorage);
 
   virtual void
   bypassValidation();
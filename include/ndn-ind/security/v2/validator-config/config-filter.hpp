@@ -66,6 +66,15 @@ public:
   bool
   match(bool isForInterest, const Name& packetName);
 
+  /**
+   * Get the name prefix which a packet name must have to match this filter,
+   * so that ValidationPolicyConfig only checks the rules which can match.
+   * @return The name prefix. This base implementation returns an empty Name,
+   * which every packet name has.
+   */
+  virtual Name
+  getMatchPrefix() const;
+
   /**
    * Create a filter from the configuration section.
    * @param configSection The section containing the definition of the filter,
@@ -129,6 +138,14 @@ public:
   {
   }
 
+  /**
+   * Get the relation name, which is a prefix of every packet name in the
+   * relation.
+   * @return The relation name.
+   */
+  virtual Name
+  getMatchPrefix() const;
+
 private:
   /**
    * Implementation of the check for match.
@@ -162,6 +179,15 @@ public:
    */
   ConfigRegexNameFilter(const std::string& regexString);
 
+  /**
+   * Get the name prefix from the literal components at the start of a regex
+   * which begins with "^", for example /ndn/edu for "^<ndn><edu><>*".
+   * @return The name prefix, or an empty Name if the regex doesn't start with
+   * "^" and a literal component.
+   */
+  virtual Name
+  getMatchPrefix() const { return matchPrefix_; }
+
 private:
   /**
    * Implementation of the check for match.
@@ -173,7 +199,14 @@ private:
   matchName(const Name& packetName);
 
 private:
+  /**
+   * Get the literal name prefix of the regex string. See getMatchPrefix.
+   */
+  static Name
+  getLiteralPrefix(const std::string& regexString);
+
   ptr_lib::shared_ptr<NdnRegexTopMatcher> regex_;
+  Name matchPrefix_;
 };
 
 }
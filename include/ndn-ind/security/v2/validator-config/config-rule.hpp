@@ -109,6 +109,15 @@ public:
   bool
   match(bool isForInterest, const Name& packetName);
 
+  /**
+   * Get the name prefixes from ConfigFilter::getMatchPrefix for the filters. A
+   * packet name which matches the rule has at least one of the prefixes.
+   * @param prefixes Append the prefixes to this list. If the rule has no
+   * filters, this appends an empty Name since the rule matches everything.
+   */
+  void
+  getMatchPrefixes(std::vector<Name>& prefixes) const;
+
   /**
    * Check if the packet satisfies the rule's condition.
    * @param isForInterest True if packetName is for an Interest, false if for a
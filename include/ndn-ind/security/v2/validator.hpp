@@ -134,6 +134,72 @@ public:
      const InterestValidationSuccessCallback& successCallback,
      const InterestValidationFailureCallback& failureCallback);
 
+protected:
+  /**
+   * Verify the certificate chain in the state starting from the trusted
+   * certificate, cache the verified certificates and verify the original
+   * packet. This calls makeSignatureChecks, verifySignatures and
+   * onSignaturesVerified. A subclass can override this to call
+   * verifySignatures in another thread.
+   * @param trustedCertificate The trust anchor or verified certificate which
+   * signs the first certificate in the chain.
+   * @param state The current validation state.
+   */
+  virtual void
+  verifyFromTrustedCertificate
+    (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+     const ptr_lib::shared_ptr<ValidationState>& state);
+
+  /**
+   * Encode the certificate chain in the state and the original packet, and
+   * make the SignatureCheck objects for verifySignatures. This must be called
+   * on the same thread as validate, since encoding can update the cached
+   * encoding of a packet or a shared trusted certificate.
+   * @param trustedCertificate The trust anchor or verified certificate which
+   * signs the first certificate in the chain.
+   * @param state The current validation state.
+   * @param signatureChecks Append the SignatureCheck objects.
+   */
+  static void
+  makeSignatureChecks
+    (const CertificateV2& trustedCertificate, const ValidationState& state,
+     std::vector<ValidationState::SignatureCheck>& signatureChecks)
+  {
+    state.makeSignatureChecks(trustedCertificate, signatureChecks);
+  }
+
+  /**
+   * Verify the signatures of the certificate chain and the original packet
+   * from makeSignatureChecks. This only reads the immutable buffers in the
+   * SignatureCheck objects, so it can be called in a worker thread.
+   * @param signatureChecks The SignatureCheck objects from makeSignatureChecks.
+   * @param nVerifiedCertificates Set this to the number of certificates at the
+   * start of the chain which have a valid signature.
+   * @return True if the signature of the original packet is valid, or false if
+   * it is invalid or was not checked because a certificate is invalid.
+   */
+  static bool
+  verifySignatures
+    (const std::vector<ValidationState::SignatureCheck>& signatureChecks,
+     size_t& nVerifiedCertificates);
+
+  /**
+   * Finish verifyFromTrustedCertificate with the result of verifySignatures.
+   * Cache the verified certificates and call the success or failure callback
+   * of the state. This must be called on the same thread as validate.
+   * @param trustedCertificate The trust anchor or verified certificate which
+   * signs the first certificate in the chain.
+   * @param state The current validation state.
+   * @param nVerifiedCertificates The nVerifiedCertificates from
+   * verifySignatures.
+   * @param isOriginalSignatureValid The return value of verifySignatures.
+   */
+  void
+  onSignaturesVerified
+    (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+     const ptr_lib::shared_ptr<ValidationState>& state,
+     size_t nVerifiedCertificates, bool isOriginalSignatureValid);
+
 private:
   /**
    * Recursively validate the certificates in the certification chain.
@@ -23,6 +23,7 @@
 
 #include <float.h>
 #include <map>
+#include <unordered_map>
 #include "../../interest.hpp"
 #include "../certificate/x509-crl-info.hpp"
 
@@ -64,33 +65,73 @@ public:
   ptr_lib::shared_ptr<X509CrlInfo>
   find(const Name& issuerName) const;
 
+  /**
+   * Find the first entry in the CRL for issuerName where the entry's serial
+   * number matches the given serial number. This uses the index of serial
+   * numbers which is built when the CRL is inserted, instead of searching the
+   * list of revoked certificates.
+   * @param issuerName The encapsulated X.509 issuer name.
+   * @param serialNumber The serial number to match as a Blob with the bytes of
+   * the integer. If serialNumber.size() == 0, this does not match it.
+   * @return The matching RevokedCertificate entry, or null if not found. The
+   * pointer to the entry becomes invalid if the CRL is removed from the cache,
+   * so make a copy if you need it long-term.
+   */
+  const X509CrlInfo::RevokedCertificate*
+  findRevokedCertificate(const Name& issuerName, const Blob& serialNumber) const;
+
   /**
    * Clear all CRLs from the cache.
    */
   void
   clear();
 
+  /**
+   * BlobHash is the hash function for using a serial number Blob as an
+   * unordered_map key.
+   */
+  class BlobHash {
+  public:
+    size_t
+    operator()(const Blob& blob) const { return blob.hash(); }
+  };
+
+  /**
+   * BlobEqual compares the bytes of two serial number Blob keys, since the
+   * Blob == operator only compares the pointers.
+   */
+  class BlobEqual {
+  public:
+    bool
+    operator()(const Blob& blob1, const Blob& blob2) const
+    {
+      return blob1.equals(blob2);
+    }
+  };
+
   /**
    * X509CrlCache::Entry is the value of the crlsByName_ map.
    */
   class Entry {
   public:
     /**
-     * Create a new X509CrlCache::Entry with the given values.
+     * Create a new X509CrlCache::Entry with the given values, and index the
+     * serial numbers of the revoked certificates in the CRL.
      * @param crlInfo The X509CrlInfo.
      * @param removalTime The removal time for this entry.
      */
     Entry
       (const ptr_lib::shared_ptr<X509CrlInfo>& crlInfo,
-       std::chrono::system_clock::time_point removalTime)
-    : crlInfo_(crlInfo), removalTime_(removalTime)
-    {}
+       std::chrono::system_clock::time_point removalTime);
 
     Entry()
     {}
 
     ptr_lib::shared_ptr<X509CrlInfo> crlInfo_;
     std::chrono::system_clock::time_point removalTime_;
+    // The key is the serial number. The value is the index in crlInfo_ of the
+    // first RevokedCertificate with the serial number.
+    std::unordered_map<Blob, size_t, BlobHash, BlobEqual> revokedSerialNumbers_;
   };
 
 private:
@@ -196,6 +196,71 @@ public:
       (data, certificate.getPublicKey(), digestAlgorithm, wireFormat);
   }
 
+  /**
+   * Verify a batch of Data packets which are signed by the same key, such as
+   * the segments of a segmented object. This decodes the public key once and
+   * uses it for each Data packet, instead of decoding it again for each call
+   * to verifyDataSignature. This does not check the type of public key or
+   * digest algorithm against the type of SignatureInfo in each Data packet.
+   * @param dataList The list of pointers to the Data packets to verify. If a
+   * Data packet is a CertificateV2, then call getSignedEncoding() and
+   * getSignatureValue(). A null pointer is not verified.
+   * @param publicKey The object containing the public key.
+   * @param digestAlgorithm (optional) The digest algorithm. If omitted, use SHA256.
+   * @param wireFormat (optional) A WireFormat object used to encode the Data
+   * packets. If omitted, use WireFormat getDefaultWireFormat().
+   * @return A vector of the same size as dataList where result[i] is true if
+   * verification of dataList[i] succeeds, false if it fails. If the public key
+   * can't be decoded, every result is false.
+   * @throws invalid_argument for an invalid public key type or digestAlgorithm.
+   */
+  static std::vector<bool>
+  verifyDataSignatures
+    (const std::vector<const Data*>& dataList, const PublicKey& publicKey,
+     DigestAlgorithm digestAlgorithm = DIGEST_ALGORITHM_SHA256,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
+
+  /**
+   * Verify a batch of Data packets which are signed by the same key. See
+   * verifyDataSignatures with a PublicKey for details.
+   * @param dataList The list of pointers to the Data packets to verify.
+   * @param publicKeyDer The DER-encoded public key.
+   * @param digestAlgorithm (optional) The digest algorithm. If omitted, use SHA256.
+   * @param wireFormat (optional) A WireFormat object used to encode the Data
+   * packets. If omitted, use WireFormat getDefaultWireFormat().
+   * @return A vector of the same size as dataList where result[i] is true if
+   * verification of dataList[i] succeeds, false if it fails. If the public key
+   * can't be decoded, every result is false.
+   * @throws invalid_argument for an invalid public key type or digestAlgorithm.
+   */
+  static std::vector<bool>
+  verifyDataSignatures
+    (const std::vector<const Data*>& dataList, const Blob& publicKeyDer,
+     DigestAlgorithm digestAlgorithm = DIGEST_ALGORITHM_SHA256,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
+
+  /**
+   * Verify a batch of Data packets using the public key in the certificate.
+   * See verifyDataSignatures with a PublicKey for details.
+   * @param dataList The list of pointers to the Data packets to verify.
+   * @param certificate The certificate containing the public key.
+   * @param digestAlgorithm (optional) The digest algorithm. If omitted, use SHA256.
+   * @param wireFormat (optional) A WireFormat object used to encode the Data
+   * packets. If omitted, use WireFormat getDefaultWireFormat().
+   * @return A vector of the same size as dataList where result[i] is true if
+   * verification of dataList[i] succeeds, false if it fails.
+   * @throws invalid_argument for an invalid public key type or digestAlgorithm.
+   */
+  static std::vector<bool>
+  verifyDataSignatures
+    (const std::vector<const Data*>& dataList, const CertificateV2& certificate,
+     DigestAlgorithm digestAlgorithm = DIGEST_ALGORITHM_SHA256,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
+  {
+    return verifyDataSignatures
+      (dataList, certificate.getPublicKey(), digestAlgorithm, wireFormat);
+  }
+
   /**
    * Verify the Interest packet using the public key, where the last two name
    * components are the SignatureInfo and signature bytes. This does not check
@@ -314,6 +379,26 @@ public:
     (const Data& data, DigestAlgorithm digestAlgorithm,
      WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
 
+  /**
+   * Verify a batch of Data packets using the digest algorithm, the same as
+   * calling verifyDataDigest for each one. This computes the digests of the
+   * signed portions in one call to CryptoLite::digestSha256Batch. This does not
+   * check the digest algorithm against the type of SignatureInfo in each Data
+   * packet such as DigestSha256Signature.
+   * @param dataList The list of pointers to the Data packets to verify. A null
+   * pointer is not verified.
+   * @param digestAlgorithm The digest algorithm, such as DIGEST_ALGORITHM_SHA256.
+   * @param wireFormat (optional) A WireFormat object used to encode the Data
+   * packets. If omitted, use WireFormat getDefaultWireFormat().
+   * @return A vector of the same size as dataList where result[i] is true if
+   * verification of dataList[i] succeeds, false if it fails.
+   * @throws invalid_argument for an invalid digestAlgorithm.
+   */
+  static std::vector<bool>
+  verifyDataDigests
+    (const std::vector<const Data*>& dataList, DigestAlgorithm digestAlgorithm,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
+
   /**
    * Verify the Interest packet using the digest algorithm, where the last two
    * name components are the SignatureInfo and signature bytes. This does not
@@ -332,7 +417,41 @@ public:
     (const Interest& interest, DigestAlgorithm digestAlgorithm,
      WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
 
+  /**
+   * Get the signed encoding and signature value of the Data packet to verify.
+   * These share the immutable buffer of the encoding, so they can be verified
+   * in another thread while the Data packet is used (and possibly re-encoded).
+   * @param data The Data packet. If this is a CertificateV2, then call
+   * getSignedEncoding() and getSignatureValue().
+   * @param wireFormat The WireFormat used to encode the Data packet.
+   * @param signedEncoding Set this to the signed encoding.
+   * @param signatureValue Set this to the signature value.
+   * @return True for success, false if the Data packet can't be encoded.
+   */
+  static bool
+  getDataSignedEncoding
+    (const Data& data, WireFormat& wireFormat, SignedBlob& signedEncoding,
+     Blob& signatureValue);
+
+  /**
+   * Get the signed encoding and signature value of the signed Interest to
+   * verify, where the last two name components are the SignatureInfo and
+   * signature bytes. See getDataSignedEncoding.
+   * @param interest The Interest packet.
+   * @param wireFormat The WireFormat used to encode the Interest and decode
+   * the signature.
+   * @param signedEncoding Set this to the signed encoding.
+   * @param signatureValue Set this to the signature value.
+   * @return True for success, false if the Interest can't be encoded or the
+   * signature can't be decoded.
+   */
+  static bool
+  getInterestSignedEncoding
+    (const Interest& interest, WireFormat& wireFormat,
+     SignedBlob& signedEncoding, Blob& signatureValue);
+
 private:
+
   /**
    * Extract the signature information from the interest name.
    * @param interest The interest whose signature is needed.
@@ -36,6 +36,8 @@
 #define NDN_CHRONO_SYNC2013_HPP
 
 #include <vector>
+#include <deque>
+#include <unordered_map>
 #include "../face.hpp"
 #include "../security/key-chain.hpp"
 #include "../util/memory-content-cache.hpp"
@@ -47,6 +49,13 @@ namespace Sync { class SyncState; }
 namespace ndn {
 
 class DigestTree;
+class SyncStateStorage;
+
+/**
+ * The default maximum number of entries in the ChronoSync2013 digest log. See
+ * ChronoSync2013::setMaxDigestLogSize.
+ */
+const size_t DEFAULT_MAX_DIGEST_LOG_SIZE = 1000;
 
 /**
  * ChronoSync2013 implements the NDN ChronoSync protocol as described in the
@@ -116,6 +125,22 @@ public:
    * number for the same applicationDataPrefix and sessionNo. This can be used
    * by the application to restore the state from a previous use. If omitted,
    * this uses -1 so that the next published sequence number is 0.
+   * @param useHashTreeRootDigest (optional) If true, compute the root digest of
+   * the digest tree as a balanced binary hash tree over the participants, so
+   * that a new sequence number re-hashes only O(log N) digests instead of all
+   * N. This root digest is not compatible with other ChronoSync
+   * implementations, so all participants in the sync group must use the same
+   * setting. If omitted or false, use the root digest of the ChronoSync
+   * protocol.
+   * @param stateStorage (optional) The SyncStateStorage to save the sequence
+   * number of each producer in the digest tree, such as a SyncStateSqlite3. If
+   * there are stored sequence numbers for the applicationBroadcastPrefix, this
+   * restores the digest tree and our own sequence number from them and sends a
+   * sync interest with the restored root digest, so that the other
+   * participants only need to send the changes since the restart. If that
+   * times out, this falls back to the initial interest for the full state. In
+   * either case, this calls onInitialized() when done. If omitted, don't save
+   * the sequence numbers.
    */
   ChronoSync2013
     (const OnReceivedSyncState& onReceivedSyncState,
@@ -123,11 +148,14 @@ public:
      const Name& applicationBroadcastPrefix, int sessionNo,
      Face& face, KeyChain& keyChain, const Name& certificateName,
      std::chrono::nanoseconds syncLifetime, const OnRegisterFailed& onRegisterFailed,
-     int previousSequenceNumber = -1)
+     int previousSequenceNumber = -1, bool useHashTreeRootDigest = false,
+     const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage =
+       ptr_lib::shared_ptr<SyncStateStorage>())
   : impl_(new Impl
       (onReceivedSyncState, onInitialized, applicationDataPrefix,
        applicationBroadcastPrefix, sessionNo, face, keyChain, certificateName,
-       syncLifetime, previousSequenceNumber))
+       syncLifetime, previousSequenceNumber, useHashTreeRootDigest,
+       stateStorage))
   {
     impl_->initialize(onRegisterFailed);
   }
@@ -279,6 +307,31 @@ public:
     return impl_->getSequenceNo();
   }
 
+  /**
+   * Get the maximum number of entries in the digest log.
+   * @return The maximum number of entries.
+   */
+  size_t
+  getMaxDigestLogSize() const { return impl_->getMaxDigestLogSize(); }
+
+  /**
+   * Set the maximum number of entries in the digest log, which records the sync
+   * state message for each root digest so that we can reply to a sync interest
+   * with an older root digest. When the log is full, the oldest entry is
+   * removed. If a sync interest has a root digest which was removed, this
+   * sends a recovery interest as for an unknown digest, and the reply has the
+   * full state. If you don't call this, the maximum is
+   * DEFAULT_MAX_DIGEST_LOG_SIZE.
+   * @param maxDigestLogSize The maximum number of entries. This must be at
+   * least 1 so that the log has the entry for the current root digest.
+   * @throws runtime_error if maxDigestLogSize is 0.
+   */
+  void
+  setMaxDigestLogSize(size_t maxDigestLogSize)
+  {
+    impl_->setMaxDigestLogSize(maxDigestLogSize);
+  }
+
   /**
    * Unregister callbacks so that this does not respond to interests anymore.
    * If you will delete this ChronoSync2013 object while your application is
@@ -330,12 +383,16 @@ private:
        const OnInitialized& onInitialized, const Name& applicationDataPrefix,
        const Name& applicationBroadcastPrefix, int sessionNo,
        Face& face, KeyChain& keyChain, const Name& certificateName,
-       std::chrono::nanoseconds syncLifetime, int previousSequenceNumber);
+       std::chrono::nanoseconds syncLifetime, int previousSequenceNumber,
+       bool useHashTreeRootDigest,
+       const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage);
 
     /**
      * Initialize the digest log with a digest of "00" and and empty content.
      * Register the applicationBroadcastPrefix to receive interests for sync
      * state messages and express an interest for the initial root digest "00".
+     * However, if stateStorage_ has stored sequence numbers, restore the digest
+     * tree and express an interest for the restored root digest.
      * You must call this after creating this Impl and making it belong to
      * a shared_ptr. This is a separate method from the constructor because
      * we need to call shared_from_this(), but in the constructor this object
@@ -368,6 +425,15 @@ private:
     int
     getSequenceNo() const { return sequenceNo_; }
 
+    size_t
+    getMaxDigestLogSize() const { return maxDigestLogSize_; }
+
+    /**
+     * See ChronoSync2013::setMaxDigestLogSize.
+     */
+    void
+    setMaxDigestLogSize(size_t maxDigestLogSize);
+
     /**
      * See ChronoSync2013::shutdown.
      */
@@ -400,7 +466,20 @@ private:
     bool
     update(const google::protobuf::RepeatedPtrField<Sync::SyncState >& content);
 
-    // Search the digest log by digest.
+    /**
+     * Add an entry to the end of the digest log and to digestLogIndex_. Then
+     * remove the oldest entries until the log has maxDigestLogSize_ entries.
+     */
+    void
+    logAdd
+      (const std::string& digest,
+       const google::protobuf::RepeatedPtrField<Sync::SyncState>& data);
+
+    /**
+     * Search the digest log by digest.
+     * @return The index in digestLog_, or -1 if not found (or removed because
+     * the log is full).
+     */
     int
     logFind(const std::string& digest) const;
 
@@ -426,6 +505,23 @@ private:
     void
     initialTimeOut(const ptr_lib::shared_ptr<const Interest>& interest);
 
+    /**
+     * The interest for the restored root digest timed out. Express the initial
+     * interest for "00" to get the full state. If that also timed out, there
+     * are no other publishers, so call finishRestore and express a sync
+     * interest.
+     */
+    void
+    restoreTimeOut(const ptr_lib::shared_ptr<const Interest>& interest);
+
+    /**
+     * Clear isRestoring_. If our own data prefix and session are not in the
+     * restored digest tree, add them with the next sequence number. Then call
+     * onInitialized_.
+     */
+    void
+    finishRestore();
+
     void
     processRecoveryInterest
       (const Interest& interest, const std::string& syncDigest, Face& face);
@@ -476,7 +572,7 @@ private:
     std::chrono::nanoseconds syncLifetime_;
     OnReceivedSyncState onReceivedSyncState_;
     OnInitialized onInitialized_;
-    std::vector<ptr_lib::shared_ptr<DigestLogEntry> > digestLog_;
+    std::deque<ptr_lib::shared_ptr<DigestLogEntry> > digestLog_;
     ptr_lib::shared_ptr<DigestTree> digestTree_;
     std::string applicationDataPrefixUri_;
     const Name applicationBroadcastPrefix_;
@@ -485,6 +581,18 @@ private:
     int sequenceNo_;
     MemoryContentCache contentCache_;
     bool enabled_;
+    // The key is the digest. The value is the position of the entry counting
+    // from the first entry ever added, so that removing the oldest entry
+    // doesn't change the other values. The index in digestLog_ is the value
+    // minus nRemovedLogEntries_.
+    std::unordered_map<std::string, uint64_t> digestLogIndex_;
+    uint64_t nRemovedLogEntries_;
+    size_t maxDigestLogSize_;
+    // stateStorage_ may be null.
+    ptr_lib::shared_ptr<SyncStateStorage> stateStorage_;
+    // True from restoring the digest tree from stateStorage_ until the first
+    // sync data or the timeout of the initial interest.
+    bool isRestoring_;
   };
 
   ptr_lib::shared_ptr<Impl> impl_;
@@ -83,18 +83,27 @@ public:
    * Data packet. If omitted, use FullPSync2017::DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD.
    * @param signingInfo (optional) The SigningInfo for signing Data packets,
    * which is copied. If omitted, use the default SigningInfo().
+   * @param stateStorage (optional) The SyncStateStorage to save the names of
+   * the user prefixes and sequence numbers, such as a SyncStateSqlite3. When
+   * this is created, it restores the sequence numbers from the stored names
+   * for the syncPrefix, so that getSequenceNo and publishName continue from
+   * before a restart and only the changed sequence numbers are synced. See the
+   * FullPSync2017 constructor. If omitted, don't save the names.
    */
   FullPSync2017WithUsers
     (size_t expectedNEntries, Face& face, const Name& syncPrefix,
      const Name& userPrefix, const OnUpdate& onUpdate, KeyChain& keyChain,
      std::chrono::nanoseconds syncInterestLifetime = DEFAULT_SYNC_INTEREST_LIFETIME,
      std::chrono::nanoseconds syncReplyFreshnessPeriod = DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD,
-     const SigningInfo& signingInfo = SigningInfo())
+     const SigningInfo& signingInfo = SigningInfo(),
+     const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage =
+       ptr_lib::shared_ptr<SyncStateStorage>())
   : impl_(new Impl(onUpdate))
   {
     impl_->initialize
       (expectedNEntries, face, syncPrefix, userPrefix, keyChain,
-       syncInterestLifetime, syncReplyFreshnessPeriod, signingInfo);
+       syncInterestLifetime, syncReplyFreshnessPeriod, signingInfo,
+       stateStorage);
   }
 
   /**
@@ -146,6 +155,49 @@ public:
     impl_->publishName(prefix, sequenceNo);
   }
 
+  /**
+   * Publish the sequence numbers for a list of prefix Names to inform the
+   * others. This is the same as calling publishName for each prefix, except
+   * that all the updates are applied to the IBLT first and then pending sync
+   * Interests are satisfied once, so that each gets one reply with all the new
+   * sequence numbers. A prefix which was not added with addUserNode is logged
+   * and skipped.
+   * @param updates The list of pairs of the prefix Name and the sequence
+   * number. If the sequence number is -1, then the existing sequence number is
+   * incremented by 1.
+   */
+  void
+  publishNames(const std::vector<std::pair<Name, int> >& updates)
+  {
+    impl_->publishNames(updates);
+  }
+
+  /**
+   * Set the zlib compression level used to encode our IBLT in sync Interests.
+   * See FullPSync2017::setIbltCompressionLevel.
+   * @param compressionLevel The compression level from 0 (no compression) to 9
+   * (best compression). The default is 9.
+   * @throws runtime_error if compressionLevel is not from 0 to 9.
+   */
+  void
+  setIbltCompressionLevel(int compressionLevel)
+  {
+    impl_->setIbltCompressionLevel(compressionLevel);
+  }
+
+  /**
+   * Set whether to hash the TLV wire encoding of each name for the IBLT instead
+   * of its URI. All nodes in the sync group must agree on this setting.
+   * See FullPSync2017::setHashNameWireEncoding.
+   * @param hashNameWireEncoding True to hash the wire encoding, false to hash
+   * the URI (the default).
+   */
+  void
+  setHashNameWireEncoding(bool hashNameWireEncoding)
+  {
+    impl_->setHashNameWireEncoding(hashNameWireEncoding);
+  }
+
 private:
   /**
    * FullPSync2017WithUsers::Impl does the work of FullPSync2017WithUsers. It is a
@@ -171,7 +223,8 @@ private:
        const Name& userPrefix, KeyChain& keyChain, 
        std::chrono::nanoseconds syncInterestLifetime, 
        std::chrono::nanoseconds syncReplyFreshnessPeriod,
-       const SigningInfo& signingInfo);
+       const SigningInfo& signingInfo,
+       const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage);
 
     int
     getSequenceNo(const Name& prefix) const;
@@ -185,6 +238,22 @@ private:
     void
     publishName(const Name& prefix, int sequenceNo);
 
+    void
+    publishNames(const std::vector<std::pair<Name, int> >& updates);
+
+    void
+    setIbltCompressionLevel(int compressionLevel)
+    {
+      fullPSync_->setIbltCompressionLevel(compressionLevel);
+    }
+
+    void
+    setHashNameWireEncoding(bool hashNameWireEncoding)
+    {
+      hashNameWireEncoding_ = hashNameWireEncoding;
+      fullPSync_->setHashNameWireEncoding(hashNameWireEncoding);
+    }
+
   private:
     /**
      * This is called when new names are received to check if the name can be
@@ -230,6 +299,10 @@ private:
     OnUpdate onUpdate_;
     ptr_lib::shared_ptr<FullPSync2017> fullPSync_;
     ptr_lib::shared_ptr<PSyncUserPrefixes> prefixes_;
+    bool hashNameWireEncoding_;
+    // The names for canAddReceivedName to remove from the IBLT when fullPSync_
+    // is not yet assigned.
+    std::vector<Name> constructionRemovedNames_;
   };
 
   ptr_lib::shared_ptr<Impl> impl_;
@@ -42,12 +42,8 @@
 
 namespace ndn {
 
-const std::chrono::nanoseconds DEFAULT_SYNC_INTEREST_LIFETIME =
-  std::chrono::seconds(1);
-const std::chrono::nanoseconds DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD =
-  std::chrono::seconds(1);
-
 class PSyncSegmentPublisher;
+class SyncStateStorage;
 
 /**
  * FullPSync2017 implements the full sync logic of PSync to synchronize with
@@ -99,6 +95,20 @@ public:
    * then this does not add to the IBLT or report to the application with
    * onNamesUpdate. However, if canAddReceivedName is omitted or null, then each
    * name is added.
+   * @param nPartitions (optional) If greater than 1, split the names into this
+   * many partitions by name hash, each with its own IBLT of
+   * expectedNEntries / nPartitions entries. The sync Interest then carries a
+   * digest of each partition instead of the IBLT, and only the partitions with
+   * a different digest are reconciled with a sync Interest for the partition
+   * IBLT. If decoding a partition difference fails, only the names in that
+   * partition are sent. All nodes in the sync group must use the same
+   * nPartitions. If omitted or 1, use the original PSync protocol with one IBLT.
+   * @param stateStorage (optional) The SyncStateStorage to save each name
+   * which is added to or removed from the IBLT, such as a SyncStateSqlite3.
+   * When this is created, it loads the stored names for the syncPrefix into
+   * the IBLT so that a restarted node only needs to sync the names which
+   * changed while it was stopped. The loaded names are not reported with
+   * onNamesUpdate. If omitted, don't save the names.
    */
   FullPSync2017
     (size_t expectedNEntries, Face& face, const Name& syncPrefix,
@@ -107,11 +117,14 @@ public:
      std::chrono::nanoseconds syncReplyFreshnessPeriod = DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD,
      const SigningInfo& signingInfo = SigningInfo(),
      const CanAddToSyncData& canAddToSyncData = CanAddToSyncData(),
-     const CanAddReceivedName& canAddReceivedName = CanAddReceivedName())
+     const CanAddReceivedName& canAddReceivedName = CanAddReceivedName(),
+     size_t nPartitions = 1,
+     const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage =
+       ptr_lib::shared_ptr<SyncStateStorage>())
   : impl_(new Impl
           (expectedNEntries, face, syncPrefix, onNamesUpdate, keyChain,
            syncInterestLifetime, syncReplyFreshnessPeriod, signingInfo,
-           canAddToSyncData, canAddReceivedName))
+           canAddToSyncData, canAddReceivedName, nPartitions, stateStorage))
   {
     impl_->initialize();
   }
@@ -127,6 +140,20 @@ public:
     impl_->publishName(name);
   }
 
+  /**
+   * Publish each Name in the list to inform the others, skipping a Name which
+   * has already been published. This is the same as calling publishName for
+   * each Name, except that pending sync Interests are satisfied once after all
+   * the names are added to the IBLT, so that each gets one reply with all the
+   * new names.
+   * @param names The list of Names to publish.
+   */
+  void
+  publishNames(const std::vector<Name>& names)
+  {
+    impl_->publishNames(names);
+  }
+
   /**
    * Remove the Name from the IBLT so that it won't be announced to other users.
    * @param name The Name to remove.
@@ -137,6 +164,37 @@ public:
     impl_->removeName(name);
   }
 
+  /**
+   * Set the zlib compression level used to encode our IBLT in sync Interests.
+   * The IBLT encoding is cached until the next change, but a large sync group
+   * can still spend much of its time in compression, so a lower level trades
+   * a longer sync Interest name for less CPU. Other nodes decode an IBLT made
+   * with any level.
+   * @param compressionLevel The compression level from 0 (no compression) to 9
+   * (best compression). The default is 9.
+   * @throws runtime_error if compressionLevel is not from 0 to 9.
+   */
+  void
+  setIbltCompressionLevel(int compressionLevel)
+  {
+    impl_->setIbltCompressionLevel(compressionLevel);
+  }
+
+  /**
+   * Set whether to hash the TLV wire encoding of each name for the IBLT instead
+   * of its URI, which avoids formatting a URI for each published and received
+   * name. The original PSync protocol hashes the URI, so all nodes in the sync
+   * group must agree on this setting, for example by configuring it along with
+   * the sync prefix. Any names already in the IBLT are rehashed.
+   * @param hashNameWireEncoding True to hash the wire encoding, false to hash
+   * the URI (the default).
+   */
+  void
+  setHashNameWireEncoding(bool hashNameWireEncoding)
+  {
+    impl_->setHashNameWireEncoding(hashNameWireEncoding);
+  }
+
 private:
   /**
    * FullPSync2017::Impl does the work of FullPSync2017. It is a separate class
@@ -156,7 +214,8 @@ private:
        std::chrono::nanoseconds syncInterestLifetime, 
        std::chrono::nanoseconds syncReplyFreshnessPeriod,
        const SigningInfo& signingInfo, const CanAddToSyncData& canAddToSyncData,
-       const CanAddReceivedName& canAddReceivedName);
+       const CanAddReceivedName& canAddReceivedName, size_t nPartitions,
+       const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage);
 
     /**
      * Complete the work of the constructor. This is needed because we can't
@@ -169,28 +228,128 @@ private:
     publishName(const Name& name);
 
     void
-    removeName(const Name& name) { removeFromIblt(name); }
+    publishNames(const std::vector<Name>& names);
+
+    void
+    removeName(const Name& name);
+
+    using PSyncProducerBase::setIbltCompressionLevel;
+
+    using PSyncProducerBase::setHashNameWireEncoding;
 
   private:
     class PendingEntryInfoFull {
     public:
+      /**
+       * Create a PendingEntryInfoFull for a sync Interest with an IBLT.
+       * @param iblt The IBLT from the sync Interest.
+       * @param partition The partition of the IBLT, or -1 for the IBLT of all
+       * names.
+       */
       PendingEntryInfoFull
-        (const ptr_lib::shared_ptr<InvertibleBloomLookupTable> iblt)
-      : iblt_(iblt), isRemoved_(false)
+        (const ptr_lib::shared_ptr<InvertibleBloomLookupTable> iblt,
+         int partition = -1)
+      : iblt_(iblt), partition_(partition), isRemoved_(false)
+      {}
+
+      /**
+       * Create a PendingEntryInfoFull for a sync Interest with partition
+       * digests.
+       * @param partitionDigests The encoded partition digests from the sync
+       * Interest.
+       */
+      PendingEntryInfoFull(const Blob& partitionDigests)
+      : partitionDigests_(partitionDigests), partition_(-1), isRemoved_(false)
       {}
 
+      // iblt_ is null for a sync Interest with partition digests.
       ptr_lib::shared_ptr<InvertibleBloomLookupTable> iblt_;
+      Blob partitionDigests_;
+      int partition_;
       bool isRemoved_;
     };
 
     /**
      * Send the sync interest for full synchronization. This forms the interest
-     * name: /<sync-prefix>/<own-IBLT>. This cancels any pending sync interest
-     * we sent earlier on the face.
+     * name: /<sync-prefix>/<own-IBLT>, or /<sync-prefix>/<partition-digests>
+     * if nPartitions_ > 1. This cancels any pending sync interest we sent
+     * earlier on the face. This schedules onSyncInterestTimer to send the next
+     * sync Interest and increments syncInterestGeneration_ so that the timer
+     * from an earlier call doesn't also send one.
      */
     void
     sendSyncInterest();
 
+    /**
+     * This is called by the timer from sendSyncInterest. If generation is
+     * still syncInterestGeneration_ (sendSyncInterest was not called since),
+     * then call sendSyncInterest. Otherwise do nothing so that there is only
+     * one chain of periodic sync Interests.
+     * @param generation The value of syncInterestGeneration_ when the timer
+     * was scheduled.
+     */
+    void
+    onSyncInterestTimer(uint64_t generation);
+
+    /**
+     * Send the sync interest for one partition with the interest name
+     * /<sync-prefix>/<partition>/<own-partition-IBLT>. The reply is processed
+     * by onPartitionSyncData. This increments nPendingPartitionFetches_.
+     * @param partition The partition index.
+     */
+    void
+    sendPartitionSyncInterest(size_t partition);
+
+    /**
+     * Encode partitionCounts_ and partitionCheckSums_ as 8 bytes for each
+     * partition, each value in little endian.
+     * @return The encoded partition digests.
+     */
+    Blob
+    encodePartitionDigests() const;
+
+    /**
+     * Reply to the sync Interest with the names in our own IBLT which are not
+     * in the received IBLT. If there are none, add the Interest to
+     * pendingEntries_. If the difference cannot be decoded and is larger than
+     * the threshold, reply with all the names (in the partition).
+     * @param interest The received sync Interest.
+     * @param interestName The sync Interest name without a version and segment.
+     * @param iblt The IBLT decoded from the sync Interest.
+     * @param partition The partition of the IBLT, or -1 for the IBLT of all
+     * names.
+     */
+    void
+    processSyncIblt
+      (const ptr_lib::shared_ptr<const Interest>& interest,
+       const Name& interestName,
+       const ptr_lib::shared_ptr<InvertibleBloomLookupTable>& iblt,
+       int partition);
+
+    /**
+     * Process a sync Interest with partition digests. If our partition digests
+     * are different, reply with them. Otherwise add the Interest to
+     * pendingEntries_ to reply when our names change.
+     * @param interest The received sync Interest.
+     * @param partitionDigests The encoded partition digests from the Interest.
+     */
+    void
+    processSyncDigests
+      (const ptr_lib::shared_ptr<const Interest>& interest,
+       const Blob& partitionDigests);
+
+    /**
+     * Process the partition digests Data which replies to our sync Interest
+     * with partition digests. For each partition whose digest is different
+     * from ours, call sendPartitionSyncInterest. The sync Interest with
+     * partition digests is renewed once by finishPartitionFetch after all the
+     * partition fetches finish.
+     * @param encodedContent The encoded partition digests.
+     * @param interest The Interest for which we got the data.
+     */
+    void
+    onSyncDigestsData(Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest);
+
     /**
      * Process a sync interest received from another party.
      * This gets the difference between our IBLT and the IBLT in the other sync
@@ -239,11 +398,48 @@ private:
     void
     onSyncData(Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest);
 
+    /**
+     * Process the sync data for one partition like onSyncData, but instead of
+     * calling sendSyncInterest, call finishPartitionFetch.
+     * @param encodedContent The encoded sync data content that was assembled by
+     * the SegmentFetcher.
+     * @param interest The Interest for which we got the data.
+     */
+    void
+    onPartitionSyncData
+      (Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest);
+
+    /**
+     * Log the error from fetching the sync data for one partition and call
+     * finishPartitionFetch.
+     */
+    void
+    onPartitionError
+      (SegmentFetcher::ErrorCode errorCode, const std::string& message);
+
+    /**
+     * Decrement nPendingPartitionFetches_. If it is zero and a partition fetch
+     * added new names, then call sendSyncInterest to renew the sync Interest
+     * with partition digests once for the round.
+     */
+    void
+    finishPartitionFetch();
+
+    /**
+     * Do the work of onSyncData except for renewing the sync Interest.
+     * @param encodedContent The encoded sync data content.
+     * @param interest The Interest for which we got the data.
+     * @return True if new names were added.
+     */
+    bool
+    processSyncData(Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest);
+
     /**
      * Satisfy pending sync Interests. For a pending sync interests, if the
      * IBLT of the sync Interest has any difference from our own IBLT, then
      * send a Data back. If we can't decode the difference from the stored IBLT,
-     * then delete it.
+     * then delete it. For a pending sync Interest with partition digests, if
+     * our partition digests are now different, then reply with them.
      */
     void
     satisfyPendingInterests();
@@ -279,6 +475,18 @@ private:
     CanAddReceivedName canAddReceivedName_;
     Name outstandingInterestName_;
     uint64_t registeredPrefix_;
+    // Incremented by sendSyncInterest so that only the latest timer renews.
+    uint64_t syncInterestGeneration_;
+    // The number of partition sync Interests which are still being fetched.
+    size_t nPendingPartitionFetches_;
+    // True if a partition fetch since the last renewal added new names.
+    bool havePartitionUpdates_;
+    // Scratch storage reused by each IBLT difference to avoid allocating.
+    ptr_lib::shared_ptr<InvertibleBloomLookupTable> differenceIblt_;
+    std::vector<uint32_t> positive_;
+    std::vector<uint32_t> negative_;
+    // stateStorage_ may be null.
+    ptr_lib::shared_ptr<SyncStateStorage> stateStorage_;
   };
 
   ptr_lib::shared_ptr<Impl> impl_;
@@ -0,0 +1,294 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_PARTIAL_PSYNC2017_CONSUMER_HPP
+#define NDN_PARTIAL_PSYNC2017_CONSUMER_HPP
+
+#include <map>
+#include "../face.hpp"
+#include "../util/segment-fetcher.hpp"
+#include "psync-producer-base.hpp"
+#include "psync-missing-data-info.hpp"
+
+namespace ndn {
+
+const std::chrono::nanoseconds DEFAULT_HELLO_INTEREST_LIFETIME =
+  std::chrono::seconds(1);
+
+class BloomFilter;
+
+/**
+ * PartialPSync2017Consumer implements the consumer side of the partial sync
+ * logic of PSync. It subscribes to a subset of the user prefixes of a
+ * PartialPSync2017Producer and only receives the sequence number updates for
+ * those prefixes, so it does not need to keep the IBLT of all the names. First
+ * call sendHelloInterest to get the list of user prefixes with their latest
+ * sequence numbers, which is passed to onReceiveHelloData. Then call
+ * addSubscription for each prefix of interest and call sendSyncInterest. The
+ * consumer keeps a sync Interest outstanding and calls onUpdate when a
+ * subscribed prefix has a new sequence number. See PartialPSync2017Producer
+ * for details on the protocol.
+ */
+class ndn_ind_dll PartialPSync2017Consumer {
+public:
+  typedef func_lib::function<void
+    (const ptr_lib::shared_ptr<std::map<Name, int> >& availableSubscriptions)>
+      OnReceiveHelloData;
+  typedef func_lib::function<void
+    (const ptr_lib::shared_ptr<std::vector<ptr_lib::shared_ptr<PSyncMissingDataInfo>>>& updates)> OnUpdate;
+
+  /**
+   * Create a PartialPSync2017Consumer.
+   * @param syncPrefix The prefix Name of the sync group, which is copied.
+   * @param face The application's Face.
+   * @param onReceiveHelloData When the reply to a hello Interest is received,
+   * this calls onReceiveHelloData(availableSubscriptions) where
+   * availableSubscriptions is a map of each user prefix of the producer to its
+   * latest sequence number.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param onUpdate When there is new data for a subscribed prefix, this calls
+   * onUdate(updates) where updates is a list of PSyncMissingDataInfo.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param expectedNEntries The expected number of subscriptions in the Bloom
+   * filter.
+   * @param falsePositiveProbability The false positive probability of the
+   * Bloom filter, which is rounded to a multiple of 0.001. A false positive
+   * only causes the producer to send an update which the consumer ignores.
+   * @param helloInterestLifetime (optional) The Interest lifetime for the hello
+   * Interests. If omitted, use DEFAULT_HELLO_INTEREST_LIFETIME.
+   * @param syncInterestLifetime (optional) The Interest lifetime for the sync
+   * Interests. If omitted, use DEFAULT_SYNC_INTEREST_LIFETIME.
+   * @throws runtime_error if expectedNEntries or falsePositiveProbability is
+   * not valid for the Bloom filter.
+   */
+  PartialPSync2017Consumer
+    (const Name& syncPrefix, Face& face,
+     const OnReceiveHelloData& onReceiveHelloData, const OnUpdate& onUpdate,
+     size_t expectedNEntries, double falsePositiveProbability,
+     std::chrono::nanoseconds helloInterestLifetime = DEFAULT_HELLO_INTEREST_LIFETIME,
+     std::chrono::nanoseconds syncInterestLifetime = DEFAULT_SYNC_INTEREST_LIFETIME)
+  : impl_(new Impl
+          (syncPrefix, face, onReceiveHelloData, onUpdate, expectedNEntries,
+           falsePositiveProbability, helloInterestLifetime, syncInterestLifetime))
+  {
+  }
+
+  /**
+   * Send the hello Interest /<sync-prefix>/hello to get the user prefixes and
+   * sequence numbers of the producer, which are passed to onReceiveHelloData.
+   */
+  void
+  sendHelloInterest() { impl_->sendHelloInterest(); }
+
+  /**
+   * Send the sync Interest /<sync-prefix>/sync/<Bloom filter>/<IBLT> with the
+   * subscriptions and the IBLT from the last reply of the producer. When the
+   * reply is received, this calls onUpdate and sends the next sync Interest.
+   * This should be called after the reply to the first hello Interest. Calling
+   * this while a sync Interest is outstanding replaces it, so that there is
+   * still only one sync Interest loop.
+   */
+  void
+  sendSyncInterest() { impl_->sendSyncInterest(); }
+
+  /**
+   * Add the prefix to the subscriptions and the Bloom filter. The new
+   * subscription is sent with the next sync Interest.
+   * @param prefix The user prefix to subscribe to.
+   * @param sequenceNo (optional) The latest sequence number that the
+   * application already has for the prefix, for example from
+   * onReceiveHelloData. If omitted, use 0.
+   * @return True if the subscription was added, false if the prefix is already
+   * subscribed.
+   */
+  bool
+  addSubscription(const Name& prefix, int sequenceNo = 0)
+  {
+    return impl_->addSubscription(prefix, sequenceNo);
+  }
+
+  /**
+   * Remove the prefix from the subscriptions. Since a Bloom filter cannot
+   * remove an entry, this rebuilds the Bloom filter from the remaining
+   * subscriptions.
+   * @param prefix The user prefix to unsubscribe.
+   * @return True if the subscription was removed, false if the prefix is not
+   * subscribed.
+   */
+  bool
+  removeSubscription(const Name& prefix)
+  {
+    return impl_->removeSubscription(prefix);
+  }
+
+  /**
+   * Check if the prefix is subscribed.
+   * @param prefix The user prefix to check.
+   * @return True if the prefix is subscribed.
+   */
+  bool
+  isSubscribed(const Name& prefix) const { return impl_->isSubscribed(prefix); }
+
+  /**
+   * Return the latest sequence number received for the subscribed prefix.
+   * @param prefix The user prefix for the sequence number.
+   * @return The sequence number, or -1 if the prefix is not subscribed.
+   */
+  int
+  getSequenceNo(const Name& prefix) const
+  {
+    return impl_->getSequenceNo(prefix);
+  }
+
+private:
+  /**
+   * PartialPSync2017Consumer::Impl does the work of PartialPSync2017Consumer.
+   * It is a separate class so that PartialPSync2017Consumer can create an
+   * instance in a shared_ptr to use in callbacks.
+   */
+  class Impl : public ptr_lib::enable_shared_from_this<Impl> {
+  public:
+    /**
+     * Create a new Impl, which should belong to a shared_ptr. See the
+     * PartialPSync2017Consumer constructor for parameter documentation.
+     */
+    Impl
+      (const Name& syncPrefix, Face& face,
+       const OnReceiveHelloData& onReceiveHelloData, const OnUpdate& onUpdate,
+       size_t expectedNEntries, double falsePositiveProbability,
+       std::chrono::nanoseconds helloInterestLifetime,
+       std::chrono::nanoseconds syncInterestLifetime);
+
+    void
+    sendHelloInterest();
+
+    void
+    sendSyncInterest();
+
+    bool
+    addSubscription(const Name& prefix, int sequenceNo);
+
+    bool
+    removeSubscription(const Name& prefix);
+
+    bool
+    isSubscribed(const Name& prefix) const
+    {
+      return subscriptions_.find(prefix) != subscriptions_.end();
+    }
+
+    int
+    getSequenceNo(const Name& prefix) const;
+
+  private:
+    /**
+     * FetchInfo holds the state of one hello or sync fetch for the
+     * SegmentFetcher callbacks.
+     */
+    class FetchInfo {
+    public:
+      FetchInfo(uint64_t generation)
+      : generation_(generation), isNack_(false)
+      {}
+
+      // The name of the last received Data packet.
+      Name dataName_;
+      uint64_t generation_;
+      bool isNack_;
+    };
+
+    /**
+     * This is the SegmentFetcher VerifySegment callback. Save the Data name in
+     * fetchInfo, and check for an application Nack.
+     * @return False if the Data is an application Nack, which stops the
+     * SegmentFetcher, otherwise true.
+     */
+    static bool
+    verifySegment
+      (const ptr_lib::shared_ptr<Data>& data,
+       const ptr_lib::shared_ptr<FetchInfo>& fetchInfo);
+
+    /**
+     * Process the hello Data. Save the IBLT from the Data name and call
+     * onReceiveHelloData_. However, if recovering from an application Nack,
+     * instead call onUpdate_ for the subscriptions and send a sync Interest.
+     */
+    void
+    onHelloData
+      (const Blob& encodedContent, const ptr_lib::shared_ptr<FetchInfo>& fetchInfo);
+
+    /**
+     * Process the sync Data. Save the IBLT from the Data name, call onUpdate_
+     * for each subscribed prefix with a new sequence number and send the next
+     * sync Interest.
+     */
+    void
+    onSyncData
+      (const Blob& encodedContent, const ptr_lib::shared_ptr<FetchInfo>& fetchInfo);
+
+    void
+    onHelloError
+      (SegmentFetcher::ErrorCode errorCode, const std::string& message,
+       const ptr_lib::shared_ptr<FetchInfo>& fetchInfo);
+
+    void
+    onSyncError
+      (SegmentFetcher::ErrorCode errorCode, const std::string& message,
+       const ptr_lib::shared_ptr<FetchInfo>& fetchInfo);
+
+    /**
+     * For each name prefix/sequenceNo in the PSyncState content where the
+     * prefix is subscribed and the sequenceNo is newer, update subscriptions_
+     * and call onUpdate_.
+     * @param encodedContent The encoded PSyncState.
+     */
+    void
+    processUpdates(const Blob& encodedContent);
+
+    Name syncPrefix_;
+    Face& face_;
+    OnReceiveHelloData onReceiveHelloData_;
+    OnUpdate onUpdate_;
+    ptr_lib::shared_ptr<BloomFilter> bloomFilter_;
+    std::chrono::nanoseconds helloInterestLifetime_;
+    std::chrono::nanoseconds syncInterestLifetime_;
+    // The key is the subscribed prefix. The value is the latest sequence number.
+    std::map<Name, int> subscriptions_;
+    // The IBLT from the name of the last hello or sync Data.
+    Name::Component iblt_;
+    bool haveIblt_;
+    // Set when an application Nack is received so that the next hello Data
+    // resumes syncing instead of calling onReceiveHelloData_.
+    bool isRecoveringFromNack_;
+    // Incremented by each sendSyncInterest so that the callbacks of an earlier
+    // sync Interest do not start a second sync Interest loop.
+    uint64_t syncGeneration_;
+  };
+
+  ptr_lib::shared_ptr<Impl> impl_;
+};
+
+}
+
+#endif
@@ -0,0 +1,271 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_PARTIAL_PSYNC2017_PRODUCER_HPP
+#define NDN_PARTIAL_PSYNC2017_PRODUCER_HPP
+
+#include "../face.hpp"
+#include "../security/key-chain.hpp"
+#include "psync-producer-base.hpp"
+
+namespace ndn {
+
+const std::chrono::nanoseconds DEFAULT_HELLO_REPLY_FRESHNESS_PERIOD =
+  std::chrono::seconds(1);
+
+class PSyncSegmentPublisher;
+class PSyncUserPrefixes;
+class BloomFilter;
+
+/**
+ * PartialPSync2017Producer implements the producer side of the partial sync
+ * logic of PSync, where a PartialPSync2017Consumer subscribes to a subset of
+ * the user prefixes of the producer and only receives the sequence number
+ * updates for those prefixes. The application should call publishName whenever
+ * it wants to let consumers know that new data with a new sequence number is
+ * available for the user prefix. Multiple user prefixes can be added by using
+ * addUserNode. Currently, fetching and publishing the data (named by the user
+ * prefix plus the sequence number) needs to be handled by the application.
+ *
+ * The producer answers two kinds of Interest under the sync prefix. A hello
+ * Interest /<sync-prefix>/hello is answered with the latest sequence number of
+ * every user prefix. A sync Interest
+ * /<sync-prefix>/sync/<Bloom filter>/<old IBLT> carries the Bloom filter of the
+ * consumer's subscriptions and the IBLT from its last reply. The producer
+ * answers with the newer names whose prefix is in the Bloom filter, and holds
+ * the Interest until a subscribed prefix is published if there are none. Each
+ * reply name has the producer's current IBLT so that the consumer can send it
+ * in the next sync Interest. If the IBLT difference cannot be decoded, the
+ * producer replies with an application Nack (a Data packet with ContentType
+ * NACK) and the consumer sends a new hello Interest. The Partial PSync protocol
+ * is described in Section F "Partial-Data Synchronization" of:
+ * https://named-data.net/wp-content/uploads/2017/05/scalable_name-based_data_synchronization.pdf
+ */
+class ndn_ind_dll PartialPSync2017Producer {
+public:
+  /**
+   * Create a PartialPSync2017Producer.
+   * @param expectedNEntries The expected number of entries in the IBLT.
+   * @param face The application's Face.
+   * @param syncPrefix The prefix Name of the sync group, which is copied.
+   * @param userPrefix The prefix Name of the first user in the group, which is
+   * copied. However, if this Name is empty, it is not added and you must call
+   * addUserNode.
+   * @param keyChain The KeyChain for signing Data packets.
+   * @param helloReplyFreshnessPeriod (optional) The freshness period of the
+   * hello Data packet. If omitted, use DEFAULT_HELLO_REPLY_FRESHNESS_PERIOD.
+   * @param syncReplyFreshnessPeriod (optional) The freshness period of the sync
+   * Data packet. If omitted, use DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD.
+   * @param signingInfo (optional) The SigningInfo for signing Data packets,
+   * which is copied. If omitted, use the default SigningInfo().
+   */
+  PartialPSync2017Producer
+    (size_t expectedNEntries, Face& face, const Name& syncPrefix,
+     const Name& userPrefix, KeyChain& keyChain,
+     std::chrono::nanoseconds helloReplyFreshnessPeriod = DEFAULT_HELLO_REPLY_FRESHNESS_PERIOD,
+     std::chrono::nanoseconds syncReplyFreshnessPeriod = DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD,
+     const SigningInfo& signingInfo = SigningInfo())
+  : impl_(new Impl
+          (expectedNEntries, face, syncPrefix, keyChain,
+           helloReplyFreshnessPeriod, syncReplyFreshnessPeriod, signingInfo))
+  {
+    impl_->initialize(userPrefix);
+  }
+
+  /**
+   * Return the current sequence number of the given user prefix.
+   * @param prefix The user prefix for the sequence number.
+   * @return The sequence number for the user prefix, or -1 if not found.
+   */
+  int
+  getSequenceNo(const Name& prefix) const
+  {
+    return impl_->getSequenceNo(prefix);
+  }
+
+  /**
+   * Add a user node for synchronization based on the prefix Name, and
+   * initialize the sequence number to zero. However, if the prefix Name already
+   * exists, then do nothing and return false.
+   * @param prefix The prefix Name of the user node to be added.
+   * @return True if the user node with the prefix Name was added, false if the
+   * prefix Name already exists.
+   */
+  bool
+  addUserNode(const Name& prefix) { return impl_->addUserNode(prefix); }
+
+  /**
+   * Remove the user node from the synchronization. This erases the prefix from
+   * the IBLT and other tables.
+   * @param prefix The prefix Name of the user node to be removed. If there is
+   * no user node with this prefix, do nothing.
+   */
+  void
+  removeUserNode(const Name& prefix) { impl_->removeUserNode(prefix); }
+
+  /**
+   * Publish the sequence number for the prefix Name to inform the subscribed
+   * consumers. (addUserNode needs to be called before this to add the prefix,
+   * if it was not already added via the constructor.) This replies to each
+   * pending sync Interest whose Bloom filter contains the prefix.
+   * @param prefix the prefix Name to be updated.
+   * @param sequenceNo (optional) The sequence number of the user prefix to be
+   * set in the IBLT. However, if sequenceNo is omitted or -1, then the existing
+   * sequence number is incremented by 1.
+   */
+  void
+  publishName(const Name& prefix, int sequenceNo = -1)
+  {
+    impl_->publishName(prefix, sequenceNo);
+  }
+
+private:
+  /**
+   * PartialPSync2017Producer::Impl does the work of PartialPSync2017Producer.
+   * It is a separate class so that PartialPSync2017Producer can create an
+   * instance in a shared_ptr to use in callbacks.
+   */
+  class Impl : public PSyncProducerBase {
+  public:
+    /**
+     * Create a new Impl, which should belong to a shared_ptr. Then you must
+     * call initialize(). See the PartialPSync2017Producer constructor for
+     * parameter documentation.
+     */
+    Impl
+      (size_t expectedNEntries, Face& face, const Name& syncPrefix,
+       KeyChain& keyChain, std::chrono::nanoseconds helloReplyFreshnessPeriod,
+       std::chrono::nanoseconds syncReplyFreshnessPeriod,
+       const SigningInfo& signingInfo);
+
+    /**
+     * Complete the work of the constructor. This is needed because we can't
+     * call shared_from_this() in the constructor.
+     * @param userPrefix The prefix Name of the first user, or an empty Name.
+     */
+    void
+    initialize(const Name& userPrefix);
+
+    int
+    getSequenceNo(const Name& prefix) const;
+
+    bool
+    addUserNode(const Name& prefix);
+
+    void
+    removeUserNode(const Name& prefix);
+
+    void
+    publishName(const Name& prefix, int sequenceNo);
+
+  private:
+    class PendingEntryInfo {
+    public:
+      PendingEntryInfo(const ptr_lib::shared_ptr<BloomFilter>& bloomFilter)
+      : bloomFilter_(bloomFilter), isRemoved_(false)
+      {}
+
+      ptr_lib::shared_ptr<BloomFilter> bloomFilter_;
+      bool isRemoved_;
+    };
+
+    /**
+     * Process an Interest under the sync prefix by calling onHelloInterest or
+     * onSyncInterest.
+     */
+    void
+    onInterest
+      (const ptr_lib::shared_ptr<const Name>& prefixName,
+       const ptr_lib::shared_ptr<const Interest>& interest, Face& face,
+       uint64_t interestFilterId,
+       const ptr_lib::shared_ptr<const InterestFilter>& filter);
+
+    /**
+     * Reply to the hello Interest with the latest sequence number of every user
+     * prefix. The Data name is the Interest name plus our IBLT.
+     * @param interest The hello Interest.
+     * @param interestName The hello Interest name without a version and segment.
+     */
+    void
+    onHelloInterest
+      (const ptr_lib::shared_ptr<const Interest>& interest,
+       const Name& interestName);
+
+    /**
+     * Reply to the sync Interest with the names in our own IBLT which are not in
+     * the IBLT of the Interest and whose prefix is in the Interest's Bloom
+     * filter. If there are none, add the Interest to pendingEntries_. If the
+     * IBLT difference cannot be decoded, send an application Nack.
+     * @param interest The sync Interest.
+     * @param interestName The sync Interest name without a version and segment.
+     */
+    void
+    onSyncInterest
+      (const ptr_lib::shared_ptr<const Interest>& interest,
+       const Name& interestName);
+
+    /**
+     * Reply to each pending sync Interest whose Bloom filter contains the
+     * prefix with the new sequence number of the prefix.
+     * @param prefix The user prefix which was just published.
+     */
+    void
+    satisfyPendingInterests(const Name& prefix);
+
+    /**
+     * Send an application Nack, which is a Data packet with the Interest name
+     * and ContentType NACK, to tell the consumer to send a new hello Interest.
+     * @param interest The sync Interest.
+     */
+    void
+    sendApplicationNack(const ptr_lib::shared_ptr<const Interest>& interest);
+
+    /**
+     * Remove the entry from pendingEntries_ which has the name. However, if
+     * entry->isRemoved_ is true, do nothing. Therefore, if an entry is
+     * directly removed from pendingEntries_, it should set isRemoved_.
+     * @param name The key in the pendingEntries_ map for the entry to remove.
+     * @param entry A (possibly earlier and removed) entry from when it was
+     * inserted into the pendingEntries_ map.
+     */
+    void
+    delayedRemovePendingEntry
+      (const Name& name, const ptr_lib::shared_ptr<PendingEntryInfo>& entry);
+
+    Face& face_;
+    KeyChain& keyChain_;
+    std::chrono::nanoseconds helloReplyFreshnessPeriod_;
+    SigningInfo signingInfo_;
+    ptr_lib::shared_ptr<PSyncSegmentPublisher> segmentPublisher_;
+    ptr_lib::shared_ptr<PSyncUserPrefixes> prefixes_;
+    std::map<Name, ptr_lib::shared_ptr<PendingEntryInfo> > pendingEntries_;
+    uint64_t registeredPrefix_;
+    // Scratch storage reused by each IBLT difference to avoid allocating.
+    ptr_lib::shared_ptr<InvertibleBloomLookupTable> differenceIblt_;
+    std::vector<uint32_t> positive_;
+    std::vector<uint32_t> negative_;
+  };
+
+  ptr_lib::shared_ptr<Impl> impl_;
+};
+
+}
+
+#endif
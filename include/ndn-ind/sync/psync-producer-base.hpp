@@ -36,31 +36,52 @@
 #define NDN_PSYNC_PRODUCER_BASE_HPP
 
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include "../name.hpp"
 
 namespace ndn {
 
+const std::chrono::nanoseconds DEFAULT_SYNC_INTEREST_LIFETIME =
+  std::chrono::seconds(1);
+const std::chrono::nanoseconds DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD =
+  std::chrono::seconds(1);
+
 class InvertibleBloomLookupTable;
 
 /**
- * PSyncProducerBase is a base class for PsyncPartialProducer::Impl and
+ * PSyncProducerBase is a base class for PartialPSync2017Producer::Impl and
  * FullPSync2017::Impl.
  */
 class ndn_ind_dll PSyncProducerBase : public ptr_lib::enable_shared_from_this<PSyncProducerBase> {
+public:
+  /**
+   * Compute the hash of the name which is inserted into the IBLT.
+   * @param name The Name to hash.
+   * @param hashNameWireEncoding If true, hash the TLV wire encoding of the name.
+   * If false, hash the URI of the name as in the original PSync protocol.
+   * @return The 32-bit hash.
+   */
+  static uint32_t
+  computeNameHash(const Name& name, bool hashNameWireEncoding);
+
 protected:
   /**
    * Create a PSyncProducerBase.
    * @param expectedNEntries The expected number of entries in the IBLT.
    * @param syncPrefix The prefix Name of the sync group, which is copied.
    * @param syncReplyFreshnessPeriod The freshness period of the sync Data packet.
+   * @param nPartitions (optional) The number of partitions to split the names
+   * into by name hash, each with its own IBLT of expectedNEntries / nPartitions
+   * entries. If omitted or 1, use the single iblt_.
    */
   PSyncProducerBase
     (size_t expectedNEntries, const Name& syncPrefix,
-     std::chrono::nanoseconds syncReplyFreshnessPeriod);
+     std::chrono::nanoseconds syncReplyFreshnessPeriod, size_t nPartitions = 1);
 
   /**
-   * Insert the URI of the name into the iblt_, and update nameToHash_ and
-   * hashToName_.
+   * Insert the hash of the name into the iblt_, and update nameToHash_ and
+   * hashToName_. See setHashNameWireEncoding.
    * @param name The Name to insert.
    */
   void
@@ -75,28 +96,91 @@ protected:
   void
   removeFromIblt(const Name& name);
 
+  /**
+   * Set the zlib compression level used to encode iblt_ for sync Interests.
+   * @param compressionLevel The compression level from 0 (no compression) to 9
+   * (best compression).
+   * @throws runtime_error if compressionLevel is not from 0 to 9.
+   */
+  void
+  setIbltCompressionLevel(int compressionLevel);
+
+  /**
+   * Get the partition of the name hash.
+   * @param hash The name hash.
+   * @return The partition index from 0 to nPartitions_ - 1.
+   */
+  size_t
+  getPartition(uint32_t hash) const { return hash % nPartitions_; }
+
+  /**
+   * Set whether to hash the TLV wire encoding of each name instead of its URI.
+   * Hashing the wire encoding avoids formatting the URI, but the hashes in the
+   * IBLT no longer match a node which hashes the URI, so all nodes in the sync
+   * group must use the same setting. This rehashes any names already in the
+   * IBLT.
+   * @param hashNameWireEncoding True to hash the wire encoding, false to hash
+   * the URI (the default).
+   */
+  void
+  setHashNameWireEncoding(bool hashNameWireEncoding);
+
   /**
    * This is called when registerPrefix fails to log an error message.
    */
   static void
   onRegisterFailed(const ptr_lib::shared_ptr<const Name>& prefix);
 
+  // If nPartitions_ > 1, then iblt_ is not updated and partitionIblts_ is used.
   ptr_lib::shared_ptr<InvertibleBloomLookupTable> iblt_;
   size_t expectedNEntries_;
   // threshold_ is used to check if an IBLT difference is greater than the
   // threshold, and whether we need to update the other IBLT.
   size_t threshold_;
 
+  /**
+   * NameHash is the hash function for using a Name as an unordered_map key.
+   */
+  class NameHash {
+  public:
+    size_t
+    operator()(const Name& name) const { return name.hash(); }
+  };
+
   // nameToHash_ and hashToName_ are just for looking up the hash more quickly
   // (instead of calculating it again).
   // The key is the Name. The value is the hash.
-  std::map<Name, uint32_t> nameToHash_;
+  std::unordered_map<Name, uint32_t, NameHash> nameToHash_;
   // The key is the hash. The value is the Name.
-  std::map<uint32_t, Name> hashToName_;
-
+  std::unordered_map<uint32_t, Name> hashToName_;
   Name syncPrefix_;
 
   std::chrono::nanoseconds syncReplyFreshnessPeriod_;
+  bool hashNameWireEncoding_;
+
+  size_t nPartitions_;
+  // The following are only used if nPartitions_ > 1. For each partition, this
+  // has the IBLT of the names, the number of names, and the XOR of the check
+  // hash of the names. The count and check sum are the partition digest.
+  std::vector<ptr_lib::shared_ptr<InvertibleBloomLookupTable> > partitionIblts_;
+  std::vector<uint32_t> partitionCounts_;
+  std::vector<uint32_t> partitionCheckSums_;
+  // expectedNEntries_ and threshold_ for the IBLT of one partition.
+  size_t partitionExpectedNEntries_;
+  size_t partitionThreshold_;
+
+private:
+  /**
+   * Insert the name hash into iblt_, or into its partition if nPartitions_ > 1.
+   */
+  void
+  insertHash(uint32_t hash);
+
+  /**
+   * Erase the name hash from iblt_, or from its partition if nPartitions_ > 1.
+   */
+  void
+  eraseHash(uint32_t hash);
 };
 
 }
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_SYNC_STATE_SQLITE3_HPP
+#define NDN_SYNC_STATE_SQLITE3_HPP
+
+// Only compile if ndn-ind-config.h defines NDN_IND_HAVE_SQLITE3.
+#include "../ndn-ind-config.h"
+#ifdef NDN_IND_HAVE_SQLITE3
+
+#include "sync-state-storage.hpp"
+
+struct sqlite3;
+
+namespace ndn {
+
+/**
+ * SyncStateSqlite3 extends SyncStateStorage to store the sync state in an
+ * SQLite3 database file. The database uses write-ahead logging so that each
+ * change is appended to the log, and SQLite regularly checkpoints the log into
+ * the database file.
+ */
+class ndn_ind_dll SyncStateSqlite3 : public SyncStateStorage {
+public:
+  /**
+   * Create a new SyncStateSqlite3 to work with an SQLite3 file.
+   * @param databaseDirectoryPath (optional) The directory where the
+   * database file is located. If omitted, use $HOME/.ndn . If the directory
+   * does not exist, create it.
+   * @param databaseFilename (optional) The name if the database file in the
+   * databaseDirectoryPath. If omitted, use "sync-state.db".
+   * @throws runtime_error if the database cannot be opened or initialized.
+   */
+  SyncStateSqlite3
+    (const std::string& databaseDirectoryPath = "",
+     const std::string& databaseFilename = "sync-state.db");
+
+  virtual
+  ~SyncStateSqlite3();
+
+  virtual void
+  addPSyncNames(const Name& syncPrefix, const std::vector<Name>& names);
+
+  virtual void
+  removePSyncName(const Name& syncPrefix, const Name& name);
+
+  virtual void
+  getPSyncNames(const Name& syncPrefix, std::vector<Name>& names);
+
+  virtual void
+  setChronoSyncSequenceNos
+    (const Name& broadcastPrefix,
+     const std::vector<ChronoSync2013::SyncState>& syncStates);
+
+  virtual void
+  getChronoSyncSequenceNos
+    (const Name& broadcastPrefix,
+     std::vector<ChronoSync2013::SyncState>& syncStates);
+
+private:
+  // Disable the copy constructor and assignment operator.
+  SyncStateSqlite3(const SyncStateSqlite3& other);
+  SyncStateSqlite3& operator=(const SyncStateSqlite3& other);
+
+  sqlite3* database_;
+};
+
+}
+
+#endif // NDN_IND_HAVE_SQLITE3
+
+#endif
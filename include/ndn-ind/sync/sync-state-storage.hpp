@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_SYNC_STATE_STORAGE_HPP
+#define NDN_SYNC_STATE_STORAGE_HPP
+
+#include <vector>
+#include "chrono-sync2013.hpp"
+
+namespace ndn {
+
+/**
+ * SyncStateStorage is an abstract base class for the persistent storage of the
+ * state of FullPSync2017 and ChronoSync2013, so that a restarted node can
+ * reload its last known state and only reconcile the changes with the other
+ * nodes instead of fetching the full state. One storage can be shared by
+ * several sync objects, which are identified by their sync prefix or broadcast
+ * prefix. See SyncStateSqlite3.
+ */
+class ndn_ind_dll SyncStateStorage {
+public:
+  virtual
+  ~SyncStateStorage();
+
+  /**
+   * Add the names to the stored names of the PSync group. If a name is already
+   * stored, do nothing for it.
+   * @param syncPrefix The sync prefix of the PSync group.
+   * @param names The names which were added to the IBLT.
+   */
+  virtual void
+  addPSyncNames(const Name& syncPrefix, const std::vector<Name>& names) = 0;
+
+  /**
+   * Remove the name from the stored names of the PSync group. If the name is
+   * not stored, do nothing.
+   * @param syncPrefix The sync prefix of the PSync group.
+   * @param name The name which was removed from the IBLT.
+   */
+  virtual void
+  removePSyncName(const Name& syncPrefix, const Name& name) = 0;
+
+  /**
+   * Get the stored names of the PSync group.
+   * @param syncPrefix The sync prefix of the PSync group.
+   * @param names This clears the vector and adds each stored name.
+   */
+  virtual void
+  getPSyncNames(const Name& syncPrefix, std::vector<Name>& names) = 0;
+
+  /**
+   * Store the sequence numbers of the producers in the ChronoSync group,
+   * replacing any stored sequence number for the same data prefix and session
+   * number. If syncStates has more than one entry for the same producer, the
+   * last one is stored.
+   * @param broadcastPrefix The broadcast prefix of the ChronoSync group.
+   * @param syncStates The SyncState of each updated producer. The application
+   * info is ignored.
+   */
+  virtual void
+  setChronoSyncSequenceNos
+    (const Name& broadcastPrefix,
+     const std::vector<ChronoSync2013::SyncState>& syncStates) = 0;
+
+  /**
+   * Get the stored sequence numbers of the producers in the ChronoSync group.
+   * @param broadcastPrefix The broadcast prefix of the ChronoSync group.
+   * @param syncStates This clears the vector and adds a SyncState for each
+   * stored producer, where the application info is an isNull Blob.
+   */
+  virtual void
+  getChronoSyncSequenceNos
+    (const Name& broadcastPrefix,
+     std::vector<ChronoSync2013::SyncState>& syncStates) = 0;
+};
+
+}
+
+#endif
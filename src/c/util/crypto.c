@@ -61,6 +61,33 @@ ndn_digestSha256(const uint8_t *data, size_t dataLength, uint8_t *digest)
   SHA256_Final(digest, &sha256);
 }
 
+void
+ndn_digestSha256Batch
+  (const uint8_t * const *dataList, const size_t *dataLengthList,
+   size_t nBuffers, uint8_t *digests)
+{
+  size_t i;
+  EVP_MD_CTX *context = EVP_MD_CTX_create();
+  const EVP_MD *sha256 = EVP_sha256();
+
+  if (!context) {
+    // Fall back to one buffer at a time.
+    for (i = 0; i < nBuffers; ++i)
+      ndn_digestSha256
+        (dataList[i], dataLengthList[i], digests + i * ndn_SHA256_DIGEST_SIZE);
+    return;
+  }
+
+  // Reuse the digest context for each buffer.
+  for (i = 0; i < nBuffers; ++i) {
+    EVP_DigestInit_ex(context, sha256, NULL);
+    EVP_DigestUpdate(context, dataList[i], dataLengthList[i]);
+    EVP_DigestFinal_ex(context, digests + i * ndn_SHA256_DIGEST_SIZE, NULL);
+  }
+
+  EVP_MD_CTX_destroy(context);
+}
+
 ndn_Error
 ndn_generateRandomBytes(uint8_t *buffer, size_t bufferLength)
 {
@@ -134,6 +161,21 @@ ndn_digestSha256(const uint8_t *data, size_t dataLength, uint8_t *digest)
   SHA256_Final(digest, &sha256);
 }
 
+void
+ndn_digestSha256Batch
+  (const uint8_t * const *dataList, const size_t *dataLengthList,
+   size_t nBuffers, uint8_t *digests)
+{
+  size_t i;
+  SHA256_CTX sha256;
+
+  for (i = 0; i < nBuffers; ++i) {
+    SHA256_Init(&sha256);
+    SHA256_Update(&sha256, dataList[i], dataLengthList[i]);
+    SHA256_Final(digests + i * ndn_SHA256_DIGEST_SIZE, &sha256);
+  }
+}
+
 static int didRandomSeed = 0;
 ndn_Error
 ndn_generateRandomBytes(uint8_t *buffer, size_t bufferLength)
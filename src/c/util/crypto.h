@@ -59,6 +59,24 @@ struct ndn_EcKeyInfo {
  */
 void ndn_digestSha256(const uint8_t *data, size_t dataLength, uint8_t *digest);
 
+/**
+ * Compute the sha-256 digest of each of a batch of input buffers. With
+ * OpenSSL, this uses one digest context for the batch and the SHA-256 block
+ * function which OpenSSL selects for the CPU at run time, such as the SHA
+ * extensions or AVX2. Otherwise this uses the portable code in contrib.
+ * @param dataList An array of nBuffers pointers to the input byte arrays.
+ * @param dataLengthList An array of nBuffers lengths, where dataLengthList[i]
+ * is the length of dataList[i].
+ * @param nBuffers The number of input buffers.
+ * @param digests A pointer to a buffer of size
+ * nBuffers * ndn_SHA256_DIGEST_SIZE to receive the digests, where the digest
+ * of dataList[i] is at digests + i * ndn_SHA256_DIGEST_SIZE.
+ */
+void
+ndn_digestSha256Batch
+  (const uint8_t * const *dataList, const size_t *dataLengthList,
+   size_t nBuffers, uint8_t *digests);
+
 /**
  * Fill the buffer with random bytes.
  * @param buffer Write the random bytes to this buffer.
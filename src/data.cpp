@@ -51,7 +51,6 @@ namespace ndn {
 Data::Data()
 : signature_(new Sha256WithRsaSignature()),
   changeCount_(0),
-  defaultFullName_(new Name()),
   getDefaultWireEncodingChangeCount_(0)
 {
 }
@@ -60,7 +59,6 @@ Data::Data(const Name& name)
 : name_(name),
   signature_(new Sha256WithRsaSignature()),
   changeCount_(0),
-  defaultFullName_(new Name()),
   getDefaultWireEncodingChangeCount_(0)
 {
 }
@@ -69,7 +67,6 @@ Data::Data(const Data& data)
 : name_(data.name_),
   metaInfo_(data.metaInfo_),
   content_(data.content_),
-  defaultFullName_(new Name(*data.defaultFullName_)),
   changeCount_(0)
 {
   if (data.signature_.get()) {
@@ -78,6 +75,8 @@ Data::Data(const Data& data)
   }
   setDefaultWireEncoding
     (data.getDefaultWireEncoding(), data.defaultWireEncodingFormat_);
+  // The full name for the copied wire encoding. (It is not modified.)
+  defaultFullName_ = data.defaultFullName_;
 }
 
 Data::~Data()
@@ -95,7 +94,8 @@ Data& Data::operator=(const Data& data)
   setMetaInfo(data.metaInfo_.get());
   setContent(data.content_);
   setDefaultWireEncoding
-    (data.defaultWireEncoding_, data.defaultWireEncodingFormat_);
+    (data.getDefaultWireEncoding(), data.defaultWireEncodingFormat_);
+  defaultFullName_ = data.defaultFullName_;
 
   return *this;
 }
@@ -123,20 +123,56 @@ Data::getCongestionMark() const
 ptr_lib::shared_ptr<Name>
 Data::getFullName(WireFormat& wireFormat) const
 {
-  // The default full name depends on the default wire encoding.
-  if (!getDefaultWireEncoding().isNull() && defaultFullName_->size() > 0 &&
-      getDefaultWireEncodingFormat() == &wireFormat)
-    // We already have a full name. A non-null default wire encoding means
-    // that the Data packet fields have not changed.
+  if (haveDefaultFullName(wireFormat))
+    // We already have a full name.
     return defaultFullName_;
 
-  ptr_lib::shared_ptr<Name> fullName(new Name(getName()));
-  // Start with a vector shared_ptr so that we don't have to copy the buffer.
-  ptr_lib::shared_ptr<vector<uint8_t> > digest
-    (new vector<uint8_t>(ndn_SHA256_DIGEST_SIZE));
+  uint8_t digest[ndn_SHA256_DIGEST_SIZE];
   // wireEncode will use the cached encoding if possible.
-  CryptoLite::digestSha256(wireEncode(wireFormat), &digest->front());
-  fullName->appendImplicitSha256Digest(Blob(digest, false));
+  CryptoLite::digestSha256(wireEncode(wireFormat), digest);
+  return makeFullName(digest, wireFormat);
+}
+
+vector<ptr_lib::shared_ptr<Name> >
+Data::getFullNames(const vector<const Data*>& dataList, WireFormat& wireFormat)
+{
+  vector<ptr_lib::shared_ptr<Name> > result(dataList.size());
+
+  // Get the wire encoding of each Data packet without a cached full name.
+  vector<size_t> toDigest;
+  vector<Blob> encodings;
+  vector<const uint8_t*> buffers;
+  vector<size_t> bufferLengths;
+  for (size_t i = 0; i < dataList.size(); ++i) {
+    if (dataList[i]->haveDefaultFullName(wireFormat))
+      result[i] = dataList[i]->defaultFullName_;
+    else {
+      // wireEncode will use the cached encoding if possible.
+      encodings.push_back(dataList[i]->wireEncode(wireFormat));
+      toDigest.push_back(i);
+      buffers.push_back(encodings.back().buf());
+      bufferLengths.push_back(encodings.back().size());
+    }
+  }
+
+  if (toDigest.size() == 0)
+    return result;
+
+  vector<uint8_t> digests(toDigest.size() * ndn_SHA256_DIGEST_SIZE);
+  CryptoLite::digestSha256Batch
+    (&buffers.front(), &bufferLengths.front(), toDigest.size(), &digests.front());
+  for (size_t j = 0; j < toDigest.size(); ++j)
+    result[toDigest[j]] = dataList[toDigest[j]]->makeFullName
+      (&digests[j * ndn_SHA256_DIGEST_SIZE], wireFormat);
+
+  return result;
+}
+
+ptr_lib::shared_ptr<Name>
+Data::makeFullName(const uint8_t* digest, WireFormat& wireFormat) const
+{
+  ptr_lib::shared_ptr<Name> fullName(new Name(getName()));
+  fullName->appendImplicitSha256Digest(Blob(digest, ndn_SHA256_DIGEST_SIZE));
 
   if (&wireFormat == WireFormat::getDefaultWireFormat())
     // wireEncode has already set defaultWireEncodingFormat_.
@@ -33,6 +33,7 @@
 
 #include <stdexcept>
 #include "util/regex/ndn-regex-top-matcher.hpp"
+#include "util/regex/ndn-regex-compiled-matcher.hpp"
 #include <ndn-ind/interest-filter.hpp>
 
 using namespace std;
@@ -47,36 +48,54 @@ InterestFilter::InterestFilter(const Name& prefix, const string& regexFilter)
 : prefix_(prefix), regexFilter_(regexFilter),
   regexFilterPattern_(makePattern(regexFilter))
 {
+  compileRegexFilter();
 }
 
 InterestFilter::InterestFilter(const Name& prefix, const char* regexFilter)
 : prefix_(prefix), regexFilter_(regexFilter),
   regexFilterPattern_(makePattern(regexFilter))
 {
+  compileRegexFilter();
 }
 
 InterestFilter::InterestFilter(const string& prefixUri, const string& regexFilter)
 : prefix_(prefixUri), regexFilter_(regexFilter),
   regexFilterPattern_(makePattern(regexFilter))
 {
+  compileRegexFilter();
 }
 
 InterestFilter::InterestFilter(const char* prefixUri, const string& regexFilter)
 : prefix_(prefixUri), regexFilter_(regexFilter),
   regexFilterPattern_(makePattern(regexFilter))
 {
+  compileRegexFilter();
 }
 
 InterestFilter::InterestFilter(const string& prefixUri, const char* regexFilter)
 : prefix_(prefixUri), regexFilter_(regexFilter),
   regexFilterPattern_(makePattern(regexFilter))
 {
+  compileRegexFilter();
 }
 
 InterestFilter::InterestFilter(const char* prefixUri, const char* regexFilter)
 : prefix_(prefixUri), regexFilter_(regexFilter),
   regexFilterPattern_(makePattern(regexFilter))
 {
+  compileRegexFilter();
+}
+
+void
+InterestFilter::compileRegexFilter()
+{
+  // makePattern added ^ and $, so match the pattern list between them.
+  try {
+    regexFilterMatcher_ = ptr_lib::make_shared<NdnRegexCompiledMatcher>
+      (regexFilterPattern_.substr(1, regexFilterPattern_.size() - 2));
+  } catch (const std::exception&) {
+    // doesMatch will use NdnRegexTopMatcher.
+  }
 }
 
 #endif
@@ -94,8 +113,11 @@ InterestFilter::doesMatch(const Name& name) const
     if (!prefix_.match(name))
       return false;
 
-    return NdnRegexTopMatcher(regexFilterPattern_).match
-      (name.getSubName(prefix_.size()));
+    if (regexFilterMatcher_)
+      return regexFilterMatcher_->match(name.getSubName(prefix_.size()));
+    else
+      return NdnRegexTopMatcher(regexFilterPattern_).match
+        (name.getSubName(prefix_.size()));
 #else
     // We should not reach this point because the constructors for regexFilter
     // don't compile.
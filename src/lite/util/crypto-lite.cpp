@@ -43,6 +43,14 @@ CryptoLite::digestSha256(const uint8_t *data, size_t dataLength, uint8_t *digest
   ndn_digestSha256(data, dataLength, digest);
 }
 
+void
+CryptoLite::digestSha256Batch
+  (const uint8_t* const* dataList, const size_t* dataLengthList,
+   size_t nBuffers, uint8_t* digests)
+{
+  ndn_digestSha256Batch(dataList, dataLengthList, nBuffers, digests);
+}
+
 ndn_Error
 CryptoLite::generateRandomBytes(uint8_t *buffer, size_t bufferLength)
 {
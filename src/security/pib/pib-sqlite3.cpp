@@ -207,6 +207,32 @@ CREATE TRIGGER IF NOT EXISTS                       \n\
   END;                                             \n\
 ";
 
+/**
+ * A CachedStatement gets the prepared statement for the SQL from the
+ * statement cache of the PibSqlite3. The destructor resets the statement and
+ * clears its bindings so that it can be reused, and so that an unfinished
+ * SELECT does not keep a read transaction open.
+ */
+class PibSqlite3::CachedStatement {
+public:
+  CachedStatement(const PibSqlite3& pib, const char* sql)
+  : statement_(pib.getStatement(sql))
+  {
+  }
+
+  ~CachedStatement()
+  {
+    statement_.reset();
+    statement_.clearBindings();
+  }
+
+  Sqlite3Statement*
+  operator->() { return &statement_; }
+
+private:
+  Sqlite3Statement& statement_;
+};
+
 PibSqlite3::PibSqlite3
   (const string& databaseDirectoryPathIn, const string& databaseFilename)
 {
@@ -251,6 +277,7 @@ PibSqlite3::PibSqlite3
 
   // Enable foreign keys.
   sqlite3_exec(database_, "PRAGMA foreign_keys=ON", NULL, NULL, NULL);
+  Sqlite3Statement::setWriteAheadLogging(database_);
 
   // Initialize the PIB tables.
   char* errorMessage = 0;
@@ -264,6 +291,8 @@ PibSqlite3::PibSqlite3
 
 PibSqlite3::~PibSqlite3()
 {
+  // Finalize the prepared statements before closing.
+  statements_.clear();
   sqlite3_close(database_);
 }
 
@@ -273,26 +302,26 @@ PibSqlite3::getScheme() { return NDN_PIB_SQLITE3_SCHEME; }
 void
 PibSqlite3::setTpmLocator(const string& tpmLocator)
 {
-  Sqlite3Statement statement(database_, "UPDATE tpmInfo SET tpm_locator=?");
-  statement.bind(1, tpmLocator);
-  statement.step();
+  CachedStatement statement(*this, "UPDATE tpmInfo SET tpm_locator=?");
+  statement->bind(1, tpmLocator);
+  statement->step();
 
   if (sqlite3_changes(database_) == 0) {
     // No row was updated, so tpmLocator does not exist. Insert it directly.
-    Sqlite3Statement insertStatement
-      (database_, "INSERT INTO tpmInfo (tpm_locator) values (?)");
-    insertStatement.bind(1, tpmLocator);
-    insertStatement.step();
+    CachedStatement insertStatement
+      (*this, "INSERT INTO tpmInfo (tpm_locator) values (?)");
+    insertStatement->bind(1, tpmLocator);
+    insertStatement->step();
   }
 }
 
 string
 PibSqlite3::getTpmLocator() const
 {
-  Sqlite3Statement statement(database_, "SELECT tpm_locator FROM tpmInfo");
-  int res = statement.step();
+  CachedStatement statement(*this, "SELECT tpm_locator FROM tpmInfo");
+  int res = statement->step();
   if (res == SQLITE_ROW)
-    return statement.getString(0);
+    return statement->getString(0);
   else
     return "";
 }
@@ -300,20 +329,21 @@ PibSqlite3::getTpmLocator() const
 bool
 PibSqlite3::hasIdentity(const Name& identityName) const
 {
-  Sqlite3Statement statement
-    (database_, "SELECT id FROM identities WHERE identity=?");
-  statement.bind(1, identityName.wireEncode());
-  return (statement.step() == SQLITE_ROW);
+  CachedStatement statement
+    (*this, "SELECT id FROM identities WHERE identity=?");
+  statement->bind(1, identityName.wireEncode());
+  return (statement->step() == SQLITE_ROW);
 }
 
 void
 PibSqlite3::addIdentity(const Name& identityName)
 {
+  clearDefaultsCache();
   if (!hasIdentity(identityName)) {
-    Sqlite3Statement statement
-      (database_, "INSERT INTO identities (identity) values (?)");
-    statement.bind(1, identityName.wireEncode());
-    statement.step();
+    CachedStatement statement
+      (*this, "INSERT INTO identities (identity) values (?)");
+    statement->bind(1, identityName.wireEncode());
+    statement->step();
   }
 
   if (!hasDefaultIdentity())
@@ -323,27 +353,29 @@ PibSqlite3::addIdentity(const Name& identityName)
 void
 PibSqlite3::removeIdentity(const Name& identityName)
 {
-  Sqlite3Statement statement(database_, "DELETE FROM identities WHERE identity=?");
-  statement.bind(1, identityName.wireEncode());
-  statement.step();
+  clearDefaultsCache();
+  CachedStatement statement(*this, "DELETE FROM identities WHERE identity=?");
+  statement->bind(1, identityName.wireEncode());
+  statement->step();
 }
 
 void
 PibSqlite3::clearIdentities()
 {
-  Sqlite3Statement statement(database_, "DELETE FROM identities");
-  statement.step();
+  clearDefaultsCache();
+  CachedStatement statement(*this, "DELETE FROM identities");
+  statement->step();
 }
 
 set<Name>
 PibSqlite3::getIdentities() const
 {
   set<Name> identities;
-  Sqlite3Statement statement(database_, "SELECT identity FROM identities");
+  CachedStatement statement(*this, "SELECT identity FROM identities");
 
-  while (statement.step() == SQLITE_ROW) {
+  while (statement->step() == SQLITE_ROW) {
     Name name;
-    name.wireDecode(statement.getBuf(0), statement.getSize(0));
+    name.wireDecode(statement->getBuf(0), statement->getSize(0));
     identities.insert(name);
   }
 
@@ -353,29 +385,34 @@ PibSqlite3::getIdentities() const
 void
 PibSqlite3::setDefaultIdentity(const Name& identityName)
 {
+  clearDefaultsCache();
   if (!hasIdentity(identityName)) {
-    Sqlite3Statement statement
-      (database_, "INSERT INTO identities (identity) values (?)");
-    statement.bind(1, identityName.wireEncode());
-    statement.step();
+    CachedStatement statement
+      (*this, "INSERT INTO identities (identity) values (?)");
+    statement->bind(1, identityName.wireEncode());
+    statement->step();
   }
 
-  Sqlite3Statement statement
-    (database_, "UPDATE identities SET is_default=1 WHERE identity=?");
-  statement.bind(1, identityName.wireEncode());
-  statement.step();
+  CachedStatement statement
+    (*this, "UPDATE identities SET is_default=1 WHERE identity=?");
+  statement->bind(1, identityName.wireEncode());
+  statement->step();
 }
 
 Name
 PibSqlite3::getDefaultIdentity() const
 {
-  Sqlite3Statement statement
-    (database_, "SELECT identity FROM identities WHERE is_default=1");
+  if (defaultIdentity_)
+    return *defaultIdentity_;
 
-  if (statement.step() == SQLITE_ROW) {
-    Name name;
-    name.wireDecode(statement.getBuf(0), statement.getSize(0));
-    return name;
+  CachedStatement statement
+    (*this, "SELECT identity FROM identities WHERE is_default=1");
+
+  if (statement->step() == SQLITE_ROW) {
+    ptr_lib::shared_ptr<Name> name(new Name());
+    name->wireDecode(statement->getBuf(0), statement->getSize(0));
+    const_cast<PibSqlite3*>(this)->defaultIdentity_ = name;
+    return *name;
   }
   else
     throw Pib::Error("No default identity");
@@ -384,10 +421,10 @@ PibSqlite3::getDefaultIdentity() const
 bool
 PibSqlite3::hasKey(const Name& keyName) const
 {
-  Sqlite3Statement statement(database_, "SELECT id FROM keys WHERE key_name=?");
-  statement.bind(1, keyName.wireEncode());
+  CachedStatement statement(*this, "SELECT id FROM keys WHERE key_name=?");
+  statement->bind(1, keyName.wireEncode());
 
-  return (statement.step() == SQLITE_ROW);
+  return (statement->step() == SQLITE_ROW);
 }
 
 void
@@ -395,24 +432,25 @@ PibSqlite3::addKey
   (const Name& identityName, const Name& keyName, const uint8_t* key,
    size_t keyLength)
 {
+  clearDefaultsCache();
   // Ensure the identity exists.
   addIdentity(identityName);
 
   if (!hasKey(keyName)) {
-    Sqlite3Statement statement(database_,
+    CachedStatement statement(*this,
 "INSERT INTO keys (identity_id, key_name, key_bits) \
 VALUES ((SELECT id FROM identities WHERE identity=?), ?, ?)");
-    statement.bind(1, identityName.wireEncode());
-    statement.bind(2, keyName.wireEncode());
-    statement.bind(3, key, keyLength, SQLITE_STATIC);
-    statement.step();
+    statement->bind(1, identityName.wireEncode());
+    statement->bind(2, keyName.wireEncode());
+    statement->bind(3, key, keyLength, SQLITE_STATIC);
+    statement->step();
   }
   else {
-    Sqlite3Statement statement
-      (database_, "UPDATE keys SET key_bits=? WHERE key_name=?");
-    statement.bind(1, key, keyLength, SQLITE_STATIC);
-    statement.bind(2, keyName.wireEncode());
-    statement.step();
+    CachedStatement statement
+      (*this, "UPDATE keys SET key_bits=? WHERE key_name=?");
+    statement->bind(1, key, keyLength, SQLITE_STATIC);
+    statement->bind(2, keyName.wireEncode());
+    statement->step();
   }
 
   if (!hasDefaultKeyOfIdentity(identityName))
@@ -422,20 +460,21 @@ VALUES ((SELECT id FROM identities WHERE identity=?), ?, ?)");
 void
 PibSqlite3::removeKey(const Name& keyName)
 {
-  Sqlite3Statement statement(database_, "DELETE FROM keys WHERE key_name=?");
-  statement.bind(1, keyName.wireEncode());
-  statement.step();
+  clearDefaultsCache();
+  CachedStatement statement(*this, "DELETE FROM keys WHERE key_name=?");
+  statement->bind(1, keyName.wireEncode());
+  statement->step();
 }
 
 Blob
 PibSqlite3::getKeyBits(const Name& keyName) const
 {
-  Sqlite3Statement statement
-    (database_, "SELECT key_bits FROM keys WHERE key_name=?");
-  statement.bind(1, keyName.wireEncode());
+  CachedStatement statement
+    (*this, "SELECT key_bits FROM keys WHERE key_name=?");
+  statement->bind(1, keyName.wireEncode());
 
-  if (statement.step() == SQLITE_ROW)
-    return statement.getBlob(0);
+  if (statement->step() == SQLITE_ROW)
+    return statement->getBlob(0);
   else
     throw Pib::Error("Key `" + keyName.toUri() + "` does not exist");
 }
@@ -445,15 +484,15 @@ PibSqlite3::getKeysOfIdentity(const Name& identityName) const
 {
   set<Name> keyNames;
 
-  Sqlite3Statement statement(database_,
+  CachedStatement statement(*this,
 "SELECT key_name \
 FROM keys JOIN identities ON keys.identity_id=identities.id \
 WHERE identities.identity=?");
-  statement.bind(1, identityName.wireEncode());
+  statement->bind(1, identityName.wireEncode());
 
-  while (statement.step() == SQLITE_ROW) {
+  while (statement->step() == SQLITE_ROW) {
     Name name;
-    name.wireDecode(statement.getBuf(0), statement.getSize(0));
+    name.wireDecode(statement->getBuf(0), statement->getSize(0));
     keyNames.insert(name);
   }
 
@@ -464,30 +503,37 @@ void
 PibSqlite3::setDefaultKeyOfIdentity
   (const Name& identityName, const Name& keyName)
 {
+  clearDefaultsCache();
   if (!hasKey(keyName))
     throw Pib::Error("Key `" + keyName.toUri() + "` does not exist");
 
-  Sqlite3Statement statement
-    (database_, "UPDATE keys SET is_default=1 WHERE key_name=?");
-  statement.bind(1, keyName.wireEncode());
-  statement.step();
+  CachedStatement statement
+    (*this, "UPDATE keys SET is_default=1 WHERE key_name=?");
+  statement->bind(1, keyName.wireEncode());
+  statement->step();
 }
 
 Name
 PibSqlite3::getDefaultKeyOfIdentity(const Name& identityName) const
 {
+  map<Name, Name>::const_iterator cached =
+    defaultKeyOfIdentity_.find(identityName);
+  if (cached != defaultKeyOfIdentity_.end())
+    return cached->second;
+
   if (!hasIdentity(identityName))
     throw Pib::Error("Identity `" + identityName.toUri() + "` does not exist");
 
-  Sqlite3Statement statement(database_,
+  CachedStatement statement(*this,
 "SELECT key_name \
 FROM keys JOIN identities ON keys.identity_id=identities.id \
 WHERE identities.identity=? AND keys.is_default=1");
-  statement.bind(1, identityName.wireEncode());
+  statement->bind(1, identityName.wireEncode());
 
-  if (statement.step() == SQLITE_ROW) {
+  if (statement->step() == SQLITE_ROW) {
     Name name;
-    name.wireDecode(statement.getBuf(0), statement.getSize(0));
+    name.wireDecode(statement->getBuf(0), statement->getSize(0));
+    const_cast<PibSqlite3*>(this)->defaultKeyOfIdentity_[identityName] = name;
     return name;
   }
   else
@@ -497,15 +543,16 @@ WHERE identities.identity=? AND keys.is_default=1");
 bool
 PibSqlite3::hasCertificate(const Name& certificateName) const
 {
-  Sqlite3Statement statement
-    (database_, "SELECT id FROM certificates WHERE certificate_name=?");
-  statement.bind(1, certificateName.wireEncode());
-  return (statement.step() == SQLITE_ROW);
+  CachedStatement statement
+    (*this, "SELECT id FROM certificates WHERE certificate_name=?");
+  statement->bind(1, certificateName.wireEncode());
+  return (statement->step() == SQLITE_ROW);
 }
 
 void
 PibSqlite3::addCertificate(const CertificateV2& certificate)
 {
+  clearDefaultsCache();
   // Ensure the key exists.
   const Blob& publicKey = certificate.getPublicKey();
   addKey
@@ -513,23 +560,23 @@ PibSqlite3::addCertificate(const CertificateV2& certificate)
      publicKey.buf(), publicKey.size());
 
   if (!hasCertificate(certificate.getName())) {
-    Sqlite3Statement statement(database_,
+    CachedStatement statement(*this,
 "INSERT INTO certificates \
 (key_id, certificate_name, certificate_data) \
 VALUES ((SELECT id FROM keys WHERE key_name=?), ?, ?)");
-    statement.bind(1, certificate.getKeyName().wireEncode());
-    statement.bind(2, certificate.getName().wireEncode());
+    statement->bind(1, certificate.getKeyName().wireEncode());
+    statement->bind(2, certificate.getName().wireEncode());
     // The wire encoding Blob stays in the certificate, so it is static.
-    statement.bind(3, certificate.wireEncode(), true);
-    statement.step();
+    statement->bind(3, certificate.wireEncode(), true);
+    statement->step();
   }
   else {
-    Sqlite3Statement statement
-      (database_,
+    CachedStatement statement
+      (*this,
        "UPDATE certificates SET certificate_data=? WHERE certificate_name=?");
-    statement.bind(1, certificate.wireEncode(), true);
-    statement.bind(2, certificate.getName().wireEncode());
-    statement.step();
+    statement->bind(1, certificate.wireEncode(), true);
+    statement->bind(2, certificate.getName().wireEncode());
+    statement->step();
   }
 
   if (!hasDefaultCertificateOfKey(certificate.getKeyName()))
@@ -539,23 +586,24 @@ VALUES ((SELECT id FROM keys WHERE key_name=?), ?, ?)");
 void
 PibSqlite3::removeCertificate(const Name& certificateName)
 {
-  Sqlite3Statement statement
-    (database_, "DELETE FROM certificates WHERE certificate_name=?");
-  statement.bind(1, certificateName.wireEncode());
-  statement.step();
+  clearDefaultsCache();
+  CachedStatement statement
+    (*this, "DELETE FROM certificates WHERE certificate_name=?");
+  statement->bind(1, certificateName.wireEncode());
+  statement->step();
 }
 
 ptr_lib::shared_ptr<CertificateV2>
 PibSqlite3::getCertificate(const Name& certificateName) const
 {
-  Sqlite3Statement statement
-    (database_,
+  CachedStatement statement
+    (*this,
      "SELECT certificate_data FROM certificates WHERE certificate_name=?");
-  statement.bind(1, certificateName.wireEncode());
+  statement->bind(1, certificateName.wireEncode());
 
-  if (statement.step() == SQLITE_ROW) {
+  if (statement->step() == SQLITE_ROW) {
     ptr_lib::shared_ptr<CertificateV2> certificate(new CertificateV2());
-    certificate->wireDecode(statement.getBuf(0), statement.getSize(0));
+    certificate->wireDecode(statement->getBuf(0), statement->getSize(0));
     return certificate;
   }
   else
@@ -567,15 +615,15 @@ PibSqlite3::getCertificatesOfKey(const Name& keyName) const
 {
   set<Name> certNames;
 
-  Sqlite3Statement statement(database_,
+  CachedStatement statement(*this,
 "SELECT certificate_name \
 FROM certificates JOIN keys ON certificates.key_id=keys.id \
 WHERE keys.key_name=?");
-  statement.bind(1, keyName.wireEncode());
+  statement->bind(1, keyName.wireEncode());
 
-  while (statement.step() == SQLITE_ROW) {
+  while (statement->step() == SQLITE_ROW) {
     Name name;
-    name.wireDecode(statement.getBuf(0), statement.getSize(0));
+    name.wireDecode(statement->getBuf(0), statement->getSize(0));
     certNames.insert(name);
   }
 
@@ -586,27 +634,36 @@ void
 PibSqlite3::setDefaultCertificateOfKey
   (const Name& keyName, const Name& certificateName)
 {
+  clearDefaultsCache();
   if (!hasCertificate(certificateName))
     throw Pib::Error("Certificate `" + certificateName.toUri() + "` does not exist");
 
-  Sqlite3Statement statement
-    (database_, "UPDATE certificates SET is_default=1 WHERE certificate_name=?");
-  statement.bind(1, certificateName.wireEncode());
-  statement.step();
+  CachedStatement statement
+    (*this, "UPDATE certificates SET is_default=1 WHERE certificate_name=?");
+  statement->bind(1, certificateName.wireEncode());
+  statement->step();
 }
 
 ptr_lib::shared_ptr<CertificateV2>
 PibSqlite3::getDefaultCertificateOfKey(const Name& keyName) const
 {
-  Sqlite3Statement statement(database_,
+  map<Name, ptr_lib::shared_ptr<CertificateV2> >::const_iterator cached =
+    defaultCertificateOfKey_.find(keyName);
+  if (cached != defaultCertificateOfKey_.end())
+    // Return a copy so that the caller can't change the cached certificate.
+    return ptr_lib::make_shared<CertificateV2>(*cached->second);
+
+  CachedStatement statement(*this,
 "SELECT certificate_data \
 FROM certificates JOIN keys ON certificates.key_id=keys.id \
 WHERE certificates.is_default=1 AND keys.key_name=?");
-  statement.bind(1, keyName.wireEncode());
+  statement->bind(1, keyName.wireEncode());
 
-  if (statement.step() == SQLITE_ROW) {
+  if (statement->step() == SQLITE_ROW) {
     ptr_lib::shared_ptr<CertificateV2> certificate(new CertificateV2());
-    certificate->wireDecode(statement.getBuf(0), statement.getSize(0));
+    certificate->wireDecode(statement->getBuf(0), statement->getSize(0));
+    const_cast<PibSqlite3*>(this)->defaultCertificateOfKey_[keyName] =
+      ptr_lib::make_shared<CertificateV2>(*certificate);
     return certificate;
   }
   else
@@ -637,38 +694,55 @@ PibSqlite3::getDefaultDatabaseDirectoryPath()
   return homeDir + '/' + ".ndn";
 }
 
+Sqlite3Statement&
+PibSqlite3::getStatement(const char* sql) const
+{
+  map<string, ptr_lib::shared_ptr<Sqlite3Statement> >& statements =
+    const_cast<PibSqlite3*>(this)->statements_;
+
+  map<string, ptr_lib::shared_ptr<Sqlite3Statement> >::iterator statement =
+    statements.find(sql);
+  if (statement != statements.end())
+    return *statement->second;
+
+  ptr_lib::shared_ptr<Sqlite3Statement> newStatement
+    (new Sqlite3Statement(database_, sql));
+  statements[sql] = newStatement;
+  return *newStatement;
+}
+
 bool
 PibSqlite3::hasDefaultIdentity() const
 {
-  Sqlite3Statement statement
-    (database_, "SELECT identity FROM identities WHERE is_default=1");
-  return (statement.step() == SQLITE_ROW);
+  CachedStatement statement
+    (*this, "SELECT identity FROM identities WHERE is_default=1");
+  return (statement->step() == SQLITE_ROW);
 }
 
 bool
 PibSqlite3::hasDefaultKeyOfIdentity(const Name& identityName) const
 {
-  Sqlite3Statement statement(database_,
+  CachedStatement statement(*this,
 "SELECT key_name \
 FROM keys JOIN identities ON keys.identity_id=identities.id \
 WHERE identities.identity=? AND keys.is_default=1");
   Blob encoding = identityName.wireEncode();
-  statement.bind(1, encoding);
+  statement->bind(1, encoding);
 
-  return (statement.step() == SQLITE_ROW);
+  return (statement->step() == SQLITE_ROW);
 }
 
 bool
 PibSqlite3::hasDefaultCertificateOfKey(const Name& keyName) const
 {
-  Sqlite3Statement statement(database_,
+  CachedStatement statement(*this,
 "SELECT certificate_data \
 FROM certificates JOIN keys ON certificates.key_id=keys.id \
 WHERE certificates.is_default=1 AND keys.key_name=?");
   Blob encoding = keyName.wireEncode();
-  statement.bind(1, encoding);
+  statement->bind(1, encoding);
 
-  return (statement.step() == SQLITE_ROW);
+  return (statement->step() == SQLITE_ROW);
 }
 
 }
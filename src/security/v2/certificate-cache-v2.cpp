@@ -44,12 +44,23 @@ INIT_LOGGER("ndn.CertificateCacheV2");
 namespace ndn {
 
 CertificateCacheV2::CertificateCacheV2(nanoseconds maxLifetime)
-: maxLifetime_(maxLifetime),
-  nextRefreshTime_(system_clock::time_point::max()),
+: capacity_(0),
+  maxLifetime_(maxLifetime),
   nowOffset_(0)
 {
 }
 
+void
+CertificateCacheV2::setCapacity(size_t capacity)
+{
+  capacity_ = capacity;
+  if (capacity_ == 0)
+    return;
+
+  while (certificatesByName_.size() > capacity_)
+    remove(certificatesByName_.find(lru_.back()));
+}
+
 void
 CertificateCacheV2::insert(const CertificateV2& certificate)
 {
@@ -64,16 +75,38 @@ CertificateCacheV2::insert(const CertificateV2& certificate)
 
   auto removalTime =
     min(notAfterTime, now + duration_cast<system_clock::duration>(maxLifetime_));
-  if (removalTime < nextRefreshTime_)
-    // We need to run refresh() sooner.)
-    nextRefreshTime_ = removalTime;
 
   auto removalHours = duration_cast<hours>(removalTime - now).count();
   _LOG_DEBUG("Adding " << certificate.getName().toUri() << ", will remove in "
     << removalHours << " hours");
   ptr_lib::shared_ptr<CertificateV2> certificateCopy(new CertificateV2(certificate));
-  certificatesByName_[certificateCopy->getName()] =
-    Entry(certificateCopy, removalTime);
+  const Name& certificateName = certificateCopy->getName();
+
+  auto exactEntry = certificatesByExactName_.find(certificateName);
+  if (exactEntry != certificatesByExactName_.end())
+    // Replace the existing certificate.
+    remove(exactEntry->second);
+  else if (capacity_ > 0 && certificatesByName_.size() >= capacity_) {
+    _LOG_DEBUG("The cache is full. Removing the least recently used " <<
+      lru_.back().toUri());
+    remove(certificatesByName_.find(lru_.back()));
+  }
+
+  lru_.push_front(certificateName);
+  EntryIterator entry = certificatesByName_.insert
+    (make_pair(certificateName, Entry(certificateCopy, removalTime))).first;
+  entry->second.lruPosition_ = lru_.begin();
+  certificatesByExactName_[certificateName] = entry;
+
+  if (removalQueue_.size() > 2 * certificatesByName_.size() + 16) {
+    // Too many removal times are for certificates which were removed or
+    // replaced, so rebuild the heap.
+    removalQueue_ = decltype(removalQueue_)();
+    for (auto i = certificatesByName_.begin(); i != certificatesByName_.end(); ++i)
+      removalQueue_.push(RemovalEntry(i->second.removalTime_, i->first));
+  }
+  else
+    removalQueue_.push(RemovalEntry(removalTime, certificateName));
 }
 
 ptr_lib::shared_ptr<CertificateV2>
@@ -83,13 +116,15 @@ CertificateCacheV2::find(const Name& certificatePrefix) const
       certificatePrefix[-1].isImplicitSha256Digest())
     _LOG_DEBUG("Certificate search using a name with an implicit digest is not yet supported");
 
-  const_cast<CertificateCacheV2*>(this)->refresh();
+  CertificateCacheV2* self = const_cast<CertificateCacheV2*>(this);
+  self->refresh();
 
-  map<Name, Entry>::const_iterator itr =
-    certificatesByName_.lower_bound(certificatePrefix);
+  EntryIterator itr = self->certificatesByName_.lower_bound(certificatePrefix);
   if (itr == certificatesByName_.end() ||
       !certificatePrefix.isPrefixOf(itr->second.certificate_->getName()))
     return ptr_lib::shared_ptr<CertificateV2>();
+
+  self->touch(itr);
   return itr->second.certificate_;
 }
 
@@ -103,33 +138,52 @@ CertificateCacheV2::find(const Interest& interest) const
       interest.getName()[-1].isImplicitSha256Digest())
     _LOG_DEBUG("Certificate search using a name with an implicit digest is not yet supported");
 
-  const_cast<CertificateCacheV2*>(this)->refresh();
+  CertificateCacheV2* self = const_cast<CertificateCacheV2*>(this);
+  self->refresh();
 
-  for (map<Name, Entry>::const_iterator i =
-         certificatesByName_.lower_bound(interest.getName());
+  for (EntryIterator i = self->certificatesByName_.lower_bound(interest.getName());
        i != certificatesByName_.end() &&
          interest.getName().isPrefixOf(i->second.certificate_->getName());
        ++i) {
-    if (interest.matchesData(*i->second.certificate_))
+    if (interest.matchesData(*i->second.certificate_)) {
+      self->touch(i);
       return i->second.certificate_;
+    }
   }
 
   return ptr_lib::shared_ptr<CertificateV2>();
 }
 
+ptr_lib::shared_ptr<CertificateV2>
+CertificateCacheV2::findExact(const Name& certificateName) const
+{
+  CertificateCacheV2* self = const_cast<CertificateCacheV2*>(this);
+  self->refresh();
+
+  auto exactEntry = self->certificatesByExactName_.find(certificateName);
+  if (exactEntry == certificatesByExactName_.end())
+    return ptr_lib::shared_ptr<CertificateV2>();
+
+  self->touch(exactEntry->second);
+  return exactEntry->second->second.certificate_;
+}
+
 void
 CertificateCacheV2::deleteCertificate(const Name& certificateName)
 {
-  certificatesByName_.erase(certificateName);
-  // This may be the certificate to be removed at nextRefreshTime_ by refresh(),
-  // but just allow refresh() to run instead of update nextRefreshTime_ now.
+  auto exactEntry = certificatesByExactName_.find(certificateName);
+  if (exactEntry != certificatesByExactName_.end())
+    // Its entry in removalQueue_ is skipped by refresh().
+    remove(exactEntry->second);
 }
 
 void
 CertificateCacheV2::clear()
 {
   certificatesByName_.clear();
-  nextRefreshTime_ = system_clock::time_point::max();
+  certificatesByExactName_.clear();
+  removalQueue_ = decltype(removalQueue_)();
+  lru_.clear();
 }
 
 void
@@ -137,25 +191,25 @@ CertificateCacheV2::refresh()
 {
   // nowOffset_ is only used for testing.
   auto now = system_clock::now() + duration_cast<system_clock::duration>(nowOffset_);
-  if (now < nextRefreshTime_)
-    return;
 
-  // We recompute nextRefreshTime_.
-  auto nextRefreshTime = system_clock::time_point::max();
-  // Keep a separate list of entries to erase since we can't erase while iterating.
-  vector<Name> namesToErase;
-  for (map<Name, Entry>::const_iterator i = certificatesByName_.begin();
-       i != certificatesByName_.end(); ++i) {
-    if (i->second.removalTime_ <= now)
-      namesToErase.push_back(i->first);
-    else
-      nextRefreshTime = min(nextRefreshTime, i->second.removalTime_);
+  while (!removalQueue_.empty() && removalQueue_.top().first <= now) {
+    auto exactEntry = certificatesByExactName_.find(removalQueue_.top().second);
+    if (exactEntry != certificatesByExactName_.end() &&
+        exactEntry->second->second.removalTime_ == removalQueue_.top().first)
+      remove(exactEntry->second);
+    // Otherwise, the certificate was already removed or inserted again with
+    // a new removal time.
+
+    removalQueue_.pop();
   }
+}
 
-  nextRefreshTime_ = nextRefreshTime;
-  // Now actually erase.
-  for (int i = 0; i < namesToErase.size(); ++i)
-    certificatesByName_.erase(namesToErase[i]);
+void
+CertificateCacheV2::remove(EntryIterator entry)
+{
+  lru_.erase(entry->second.lruPosition_);
+  certificatesByExactName_.erase(entry->first);
+  certificatesByName_.erase(entry);
 }
 
 }
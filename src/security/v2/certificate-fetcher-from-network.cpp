@@ -49,76 +49,122 @@ CertificateFetcherFromNetwork::Impl::doFetch
    const ptr_lib::shared_ptr<ValidationState>& state,
    const ValidationContinuation& continueValidation)
 {
+  const Name& interestName = certificateRequest->interest_.getName();
+  map<Name, ptr_lib::shared_ptr<PendingFetch> >::iterator found =
+    pendingFetches_.find(interestName);
+  if (found != pendingFetches_.end()) {
+    _LOG_TRACE("Waiting for the pending fetch of certificate " << interestName);
+    found->second->waiters_.push_back(make_pair(state, continueValidation));
+    return;
+  }
+
+  ptr_lib::shared_ptr<PendingFetch> pendingFetch
+    (new PendingFetch(certificateRequest));
+  pendingFetch->waiters_.push_back(make_pair(state, continueValidation));
+  pendingFetches_[interestName] = pendingFetch;
+
   face_.expressInterest
     (certificateRequest->interest_,
      bind(&CertificateFetcherFromNetwork::Impl::onData, shared_from_this(),
-          _1, _2, state, continueValidation),
+          _1, _2, pendingFetch),
      bind(&CertificateFetcherFromNetwork::Impl::onTimeout, shared_from_this(),
-          _1, certificateRequest, state, continueValidation),
+          _1, pendingFetch),
      bind(&CertificateFetcherFromNetwork::Impl::onNetworkNack, shared_from_this(),
-          _1, _2, certificateRequest, state, continueValidation));
+          _1, _2, pendingFetch));
+}
+
+void
+CertificateFetcherFromNetwork::Impl::removePendingFetch
+  (const ptr_lib::shared_ptr<PendingFetch>& pendingFetch)
+{
+  map<Name, ptr_lib::shared_ptr<PendingFetch> >::iterator found =
+    pendingFetches_.find(pendingFetch->certificateRequest_->interest_.getName());
+  if (found != pendingFetches_.end() && found->second == pendingFetch)
+    pendingFetches_.erase(found);
 }
 
 void
 CertificateFetcherFromNetwork::Impl::onData
   (const ptr_lib::shared_ptr<const Interest>& interest,
    const ptr_lib::shared_ptr<Data>& data,
-   const ptr_lib::shared_ptr<ValidationState>& state,
-   const CertificateFetcher::ValidationContinuation& continueValidation)
+   const ptr_lib::shared_ptr<PendingFetch>& pendingFetch)
 {
   _LOG_TRACE("Fetched certificate from network " << data->getName().toUri());
 
+  // Remove the pending fetch before calling the continuations, which may
+  // request another certificate.
+  removePendingFetch(pendingFetch);
+
   ptr_lib::shared_ptr<CertificateV2> certificate;
   try {
     certificate.reset(new CertificateV2(*data));
   } catch (const std::exception& ex) {
-    state->fail(ValidationError(ValidationError::MALFORMED_CERTIFICATE,
-      "Fetched a malformed certificate `" + data->getName().toUri() +
-      "` (" + ex.what() + ")"));
+    for (size_t i = 0; i < pendingFetch->waiters_.size(); ++i)
+      pendingFetch->waiters_[i].first->fail(ValidationError
+        (ValidationError::MALFORMED_CERTIFICATE,
+         "Fetched a malformed certificate `" + data->getName().toUri() +
+         "` (" + ex.what() + ")"));
     return;
   }
 
-  continueValidation(certificate, state);
+  // Only the Interest is shared. Each waiter validates the fetched certificate
+  // itself, which checks the certificate policy again and verifies the
+  // signature in its own chain. This is required because the depth limit and
+  // loop detection depend on the certificates already in each waiter's
+  // ValidationState, and the policy gets each waiter's state, so a result for
+  // one waiter can't be used for another.
+  for (size_t i = 0; i < pendingFetch->waiters_.size(); ++i)
+    pendingFetch->waiters_[i].second(certificate, pendingFetch->waiters_[i].first);
 }
 
 void
 CertificateFetcherFromNetwork::Impl::onNetworkNack
   (const ptr_lib::shared_ptr<const Interest>& interest,
    const ptr_lib::shared_ptr<NetworkNack>& networkNack,
-   const ptr_lib::shared_ptr<CertificateRequest>& certificateRequest,
-   const ptr_lib::shared_ptr<ValidationState>& state,
-   const CertificateFetcher::ValidationContinuation& continueValidation)
+   const ptr_lib::shared_ptr<PendingFetch>& pendingFetch)
 {
   _LOG_TRACE("NACK (" << networkNack->getReason() <<
     ") while fetching certificate " <<
-    certificateRequest->interest_.getName().toUri());
+    pendingFetch->certificateRequest_->interest_.getName().toUri());
 
-  --certificateRequest->nRetriesLeft_;
-  if (certificateRequest->nRetriesLeft_ >= 0)
-    parent_.fetch(certificateRequest, state, continueValidation);
-  else
-    state->fail(ValidationError(ValidationError::CANNOT_RETRIEVE_CERTIFICATE,
-      "Cannot fetch certificate after all retries `" +
-      certificateRequest->interest_.getName().toUri() + "`"));
+  retryOrFail(pendingFetch);
 }
 
 void
 CertificateFetcherFromNetwork::Impl::onTimeout
   (const ptr_lib::shared_ptr<const Interest>& interest,
-   const ptr_lib::shared_ptr<CertificateRequest>& certificateRequest,
-   const ptr_lib::shared_ptr<ValidationState>& state,
-   const CertificateFetcher::ValidationContinuation& continueValidation)
+   const ptr_lib::shared_ptr<PendingFetch>& pendingFetch)
 {
   _LOG_TRACE("Timeout while fetching certificate " <<
-    certificateRequest->interest_.getName().toUri() << ", retrying");
+    pendingFetch->certificateRequest_->interest_.getName().toUri() <<
+    ", retrying");
+
+  retryOrFail(pendingFetch);
+}
 
+void
+CertificateFetcherFromNetwork::Impl::retryOrFail
+  (const ptr_lib::shared_ptr<PendingFetch>& pendingFetch)
+{
+  const ptr_lib::shared_ptr<CertificateRequest>& certificateRequest =
+    pendingFetch->certificateRequest_;
   --certificateRequest->nRetriesLeft_;
-  if (certificateRequest->nRetriesLeft_ >= 0)
-    parent_.fetch(certificateRequest, state, continueValidation);
-  else
-    state->fail(ValidationError(ValidationError::CANNOT_RETRIEVE_CERTIFICATE,
-      "Cannot fetch certificate after all retries `" +
-      certificateRequest->interest_.getName().toUri() + "`"));
+  removePendingFetch(pendingFetch);
+  if (certificateRequest->nRetriesLeft_ >= 0) {
+    // Fetch again for each waiter. The first creates a new pending fetch with
+    // the same certificate request and the others wait for it.
+    for (size_t i = 0; i < pendingFetch->waiters_.size(); ++i)
+      parent_.fetch
+        (certificateRequest, pendingFetch->waiters_[i].first,
+         pendingFetch->waiters_[i].second);
+  }
+  else {
+    for (size_t i = 0; i < pendingFetch->waiters_.size(); ++i)
+      pendingFetch->waiters_[i].first->fail(ValidationError
+        (ValidationError::CANNOT_RETRIEVE_CERTIFICATE,
+         "Cannot fetch certificate after all retries `" +
+         certificateRequest->interest_.getName().toUri() + "`"));
+  }
 }
 
 }
@@ -36,6 +36,7 @@
 #include <ndn-ind/security/v2/certificate-storage.hpp>
 
 using namespace std;
+using namespace std::chrono;
 
 INIT_LOGGER("ndn.CertificateStorage");
 
@@ -113,28 +114,106 @@ CertificateStorage::cacheVerifiedCrl(const X509CrlInfo& crlInfo)
   // Now remove the revoked certificates.
   for (size_t i = 0; i < certificatesToRemove.size(); ++i)
     verifiedCertificateCache_.deleteCertificate(certificatesToRemove[i]);
+
+  // Remove validated Data which used a revoked certificate.
+  for (auto dataEntry = validatedData_.begin();
+       dataEntry != validatedData_.end();) {
+    const vector<pair<Name, Blob> >& dataCertificates =
+      dataEntry->second.certificates_;
+    bool isRevoked = false;
+    for (size_t i = 0; i < dataCertificates.size(); ++i) {
+      if (dataCertificates[i].first.equals(crlInfo.getIssuerName()) &&
+          findRevokedCertificate
+            (dataCertificates[i].first, dataCertificates[i].second)) {
+        isRevoked = true;
+        break;
+      }
+    }
+
+    if (isRevoked)
+      removeValidatedData(dataEntry++);
+    else
+      ++dataEntry;
+  }
+}
+
+void
+CertificateStorage::setValidatedDataCacheCapacity(size_t capacity)
+{
+  validatedDataCacheCapacity_ = capacity;
+  while (validatedData_.size() > validatedDataCacheCapacity_)
+    removeValidatedData(validatedData_.find(validatedDataLru_.back()));
+}
+
+bool
+CertificateStorage::findValidatedData(const Name::Component& digest)
+{
+  auto entry = validatedData_.find(digest);
+  if (entry == validatedData_.end())
+    return false;
+
+  auto now = system_clock::now() + duration_cast<system_clock::duration>(nowOffset_);
+  if (now >= entry->second.removalTime_) {
+    // A certificate expired or the entry is older than the maximum lifetime.
+    removeValidatedData(entry);
+    return false;
+  }
+  if (entry->second.verifiedCertificateName_.size() > 0 &&
+      !verifiedCertificateCache_.findExact
+        (entry->second.verifiedCertificateName_)) {
+    // The chain started from a verified certificate which was removed from
+    // the cache (for example, it expired or was revoked), and we don't know
+    // the certificates above it.
+    removeValidatedData(entry);
+    return false;
+  }
+
+  validatedDataLru_.splice
+    (validatedDataLru_.begin(), validatedDataLru_, entry->second.lruPosition_);
+  return true;
+}
+
+void
+CertificateStorage::cacheValidatedData
+  (const Name::Component& digest,
+   const vector<ptr_lib::shared_ptr<CertificateV2> >& certificates,
+   const Name& verifiedCertificateName)
+{
+  if (validatedDataCacheCapacity_ == 0)
+    return;
+
+  // Use the same maximum lifetime as verifiedCertificateCache_.
+  auto now = system_clock::now() + duration_cast<system_clock::duration>(nowOffset_);
+  auto removalTime = now + duration_cast<system_clock::duration>(hours(1));
+  ValidatedDataEntry newEntry;
+  for (size_t i = 0; i < certificates.size(); ++i) {
+    removalTime = min
+      (removalTime, certificates[i]->getValidityPeriod().getNotAfter());
+    newEntry.certificates_.push_back(make_pair
+      (certificates[i]->getIssuerName(),
+       certificates[i]->getX509SerialNumber()));
+  }
+  if (removalTime <= now)
+    return;
+  newEntry.removalTime_ = removalTime;
+  newEntry.verifiedCertificateName_ = verifiedCertificateName;
+
+  auto entry = validatedData_.find(digest);
+  if (entry != validatedData_.end())
+    removeValidatedData(entry);
+  else if (validatedData_.size() >= validatedDataCacheCapacity_)
+    removeValidatedData(validatedData_.find(validatedDataLru_.back()));
+
+  validatedDataLru_.push_front(digest);
+  newEntry.lruPosition_ = validatedDataLru_.begin();
+  validatedData_[digest] = newEntry;
 }
 
 const X509CrlInfo::RevokedCertificate*
 CertificateStorage::findRevokedCertificate
   (const Name& issuerName, const Blob& serialNumber) const
 {
-  if (serialNumber.size() == 0)
-    // This can happen by calling getX509SerialNumber() on a non-X.509 certificate.
-    return 0;
-
-  ptr_lib::shared_ptr<X509CrlInfo> crlInfo = verifiedCrlCache_.find(issuerName);
-  if (!crlInfo)
-    return 0;
-
-  for (size_t i = 0; i < crlInfo->getRevokedCertificateCount(); ++i) {
-    const X509CrlInfo::RevokedCertificate& entry =
-      crlInfo->getRevokedCertificate(i);
-    if (entry.getSerialNumber().equals(serialNumber))
-      return &entry;
-  }
-
-  return 0;
+  return verifiedCrlCache_.findRevokedCertificate(issuerName, serialNumber);
 }
 
 }
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+// Only compile if ndn-ind-config.h defines NDN_IND_HAVE_BOOST_ASIO.
+#include <ndn-ind/ndn-ind-config.h>
+#ifdef NDN_IND_HAVE_BOOST_ASIO
+
+#include <ndn-ind/util/logging.hpp>
+#include <ndn-ind/security/v2/parallel-validator.hpp>
+
+INIT_LOGGER("ndn.ParallelValidator");
+
+using namespace std;
+using namespace ndn::func_lib;
+
+namespace ndn {
+
+ParallelValidator::ParallelValidator
+  (const ptr_lib::shared_ptr<ValidationPolicy>& policy,
+   const ptr_lib::shared_ptr<CertificateFetcher>& certificateFetcher,
+   boost::asio::io_service& ioService, size_t nThreads)
+: Validator(policy, certificateFetcher),
+  ioService_(ioService),
+  work_(new boost::asio::io_service::work(workService_)),
+  lastVerificationId_(0),
+  isAlive_(new ParallelValidator*(this))
+{
+  if (nThreads == 0)
+    nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+  for (size_t i = 0; i < nThreads; ++i)
+    threads_.push_back(std::thread
+      (bind(static_cast<size_t (boost::asio::io_service::*)()>
+            (&boost::asio::io_service::run), &workService_)));
+}
+
+ParallelValidator::~ParallelValidator()
+{
+  isAlive_.reset();
+  work_.reset();
+  workService_.stop();
+  for (size_t i = 0; i < threads_.size(); ++i)
+    threads_[i].join();
+}
+
+void
+ParallelValidator::verifyFromTrustedCertificate
+  (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+   const ptr_lib::shared_ptr<ValidationState>& state)
+{
+  // Encoding can update the cached encoding of the packet or of the shared
+  // trusted certificate, so do it on this thread. The worker only gets the
+  // immutable buffers.
+  ptr_lib::shared_ptr<vector<ValidationState::SignatureCheck> > signatureChecks
+    (new vector<ValidationState::SignatureCheck>());
+  makeSignatureChecks(*trustedCertificate, *state, *signatureChecks);
+
+  // Keep the certificate and state on this thread until the result is posted
+  // back, so that they are not shared with (or destroyed in) the worker.
+  uint64_t verificationId = ++lastVerificationId_;
+  pendingVerifications_.insert(make_pair
+    (verificationId, PendingVerification(trustedCertificate, state)));
+
+  workService_.post(bind
+    (&ParallelValidator::verifyInWorker, this,
+     ptr_lib::weak_ptr<ParallelValidator*>(isAlive_), verificationId,
+     ptr_lib::shared_ptr<const vector<ValidationState::SignatureCheck> >
+       (signatureChecks)));
+}
+
+void
+ParallelValidator::verifyInWorker
+  (const ptr_lib::weak_ptr<ParallelValidator*>& isAlive,
+   uint64_t verificationId,
+   const ptr_lib::shared_ptr<const vector<ValidationState::SignatureCheck> >&
+     signatureChecks)
+{
+  size_t nVerifiedCertificates;
+  bool isOriginalSignatureValid = verifySignatures
+    (*signatureChecks, nVerifiedCertificates);
+
+  ioService_.post(bind
+    (&ParallelValidator::onVerifiedInWorker, isAlive, verificationId,
+     nVerifiedCertificates, isOriginalSignatureValid));
+}
+
+void
+ParallelValidator::onVerifiedInWorker
+  (const ptr_lib::weak_ptr<ParallelValidator*>& isAlive,
+   uint64_t verificationId, size_t nVerifiedCertificates,
+   bool isOriginalSignatureValid)
+{
+  ptr_lib::shared_ptr<ParallelValidator*> validator = isAlive.lock();
+  if (!validator) {
+    _LOG_DEBUG("The ParallelValidator was destroyed before the verification finished");
+    return;
+  }
+
+  map<uint64_t, PendingVerification>::iterator pending =
+    (*validator)->pendingVerifications_.find(verificationId);
+  if (pending == (*validator)->pendingVerifications_.end())
+    // We don't expect this.
+    return;
+  PendingVerification verification = pending->second;
+  (*validator)->pendingVerifications_.erase(pending);
+
+  (*validator)->onSignaturesVerified
+    (verification.trustedCertificate_, verification.state_,
+     nVerifiedCertificates, isOriginalSignatureValid);
+}
+
+}
+
+#endif // NDN_IND_HAVE_BOOST_ASIO
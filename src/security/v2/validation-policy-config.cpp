@@ -40,6 +40,7 @@
 
 #include <stdlib.h>
 #include <stdexcept>
+#include <algorithm>
 #include "../../util/boost-info-parser.hpp"
 #include <ndn-ind/encoding/base64.hpp>
 #include <ndn-ind/security/validator-config-error.hpp>
@@ -76,6 +77,8 @@ ValidationPolicyConfig::load
     shouldBypass_ = false;
     dataRules_.clear();
     interestRules_.clear();
+    dataRuleIndex_.clear();
+    interestRuleIndex_.clear();
 
     validator_->resetAnchors();
     validator_->resetVerifiedCertificates();
@@ -92,10 +95,14 @@ ValidationPolicyConfig::load
   vector<const BoostInfoTree*> ruleList = validatorSection["rule"];
   for (size_t i = 0; i < ruleList.size(); ++i) {
     ptr_lib::shared_ptr<ConfigRule> rule = ConfigRule::create(*ruleList[i]);
-    if (rule->getIsForInterest())
+    if (rule->getIsForInterest()) {
+      addToRuleIndex(*rule, interestRules_.size(), interestRuleIndex_);
       interestRules_.push_back(rule);
-    else
+    }
+    else {
+      addToRuleIndex(*rule, dataRules_.size(), dataRuleIndex_);
       dataRules_.push_back(rule);
+    }
   }
 
   // Get the trust anchors.
@@ -123,8 +130,10 @@ ValidationPolicyConfig::checkPolicy
     // Already called state.fail() .
     return;
 
-  for (size_t i = 0; i < dataRules_.size(); ++i) {
-    ConfigRule& rule = *dataRules_[i];
+  vector<size_t> ruleNos;
+  getCandidateRules(dataRuleIndex_, data.getName(), ruleNos);
+  for (size_t i = 0; i < ruleNos.size(); ++i) {
+    ConfigRule& rule = *dataRules_[ruleNos[i]];
 
     if (rule.match(false, data.getName())) {
       if (rule.check(false, data.getName(), keyLocatorName, state)) {
@@ -162,8 +171,10 @@ ValidationPolicyConfig::checkPolicy
     // Already called state.fail() .
     return;
 
-  for (size_t i = 0; i < interestRules_.size(); ++i) {
-    ConfigRule& rule = *interestRules_[i];
+  vector<size_t> ruleNos;
+  getCandidateRules(interestRuleIndex_, interest.getName(), ruleNos);
+  for (size_t i = 0; i < ruleNos.size(); ++i) {
+    ConfigRule& rule = *interestRules_[ruleNos[i]];
 
     if (rule.match(true, interest.getName())) {
       if (rule.check(true, interest.getName(), keyLocatorName, state)) {
@@ -236,6 +247,47 @@ ValidationPolicyConfig::processConfigTrustAnchor
     throw ValidatorConfigError("Unsupported trust-anchor.type");
 }
 
+void
+ValidationPolicyConfig::addToRuleIndex
+  (const ConfigRule& rule, size_t ruleNo, RuleIndex& ruleIndex)
+{
+  vector<Name> prefixes;
+  rule.getMatchPrefixes(prefixes);
+  for (size_t i = 0; i < prefixes.size(); ++i) {
+    vector<size_t>& ruleNos = ruleIndex[prefixes[i]];
+    // A rule can have more than one filter with the same prefix.
+    if (ruleNos.size() == 0 || ruleNos.back() != ruleNo)
+      ruleNos.push_back(ruleNo);
+  }
+}
+
+void
+ValidationPolicyConfig::getCandidateRules
+  (const RuleIndex& ruleIndex, const Name& packetName, vector<size_t>& ruleNos)
+{
+  ruleNos.clear();
+
+  // Check each prefix of the packet name, including the empty Name.
+  Name prefix;
+  size_t nPrefixesFound = 0;
+  for (size_t i = 0; i <= packetName.size(); ++i) {
+    if (i > 0)
+      prefix.append(packetName.get(i - 1));
+
+    RuleIndex::const_iterator entry = ruleIndex.find(prefix);
+    if (entry != ruleIndex.end()) {
+      ruleNos.insert(ruleNos.end(), entry->second.begin(), entry->second.end());
+      ++nPrefixesFound;
+    }
+  }
+
+  if (nPrefixesFound > 1) {
+    // Restore the rule order, and remove a rule found for more than one prefix.
+    sort(ruleNos.begin(), ruleNos.end());
+    ruleNos.erase(unique(ruleNos.begin(), ruleNos.end()), ruleNos.end());
+  }
+}
+
 nanoseconds
 ValidationPolicyConfig::getRefreshPeriod(const BoostInfoTree& configSection)
 {
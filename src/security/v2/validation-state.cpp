@@ -55,31 +55,79 @@ ValidationState::setOutcome(bool outcome)
   outcome_ = outcome;
 }
 
+bool
+ValidationState::SignatureCheck::verify() const
+{
+  if (signedEncoding_.isNull() || signatureValue_.isNull())
+    return false;
+
+  try {
+    return VerificationHelpers::verifySignature
+      (signedEncoding_.signedBuf(), signedEncoding_.signedSize(),
+       signatureValue_.buf(), signatureValue_.size(), publicKeyDer_);
+  } catch (const std::exception&) {
+    // An unsupported key type.
+    return false;
+  }
+}
+
+/**
+ * Make the SignatureCheck for the Data packet or certificate.
+ * @param data The Data packet to encode.
+ * @param signingCertificate The certificate with the public key.
+ * @return The SignatureCheck, which fails if the Data can't be encoded.
+ */
+static ValidationState::SignatureCheck
+makeDataSignatureCheck
+  (const Data& data, const CertificateV2& signingCertificate)
+{
+  SignedBlob signedEncoding;
+  Blob signatureValue;
+  if (!VerificationHelpers::getDataSignedEncoding
+      (data, *WireFormat::getDefaultWireFormat(), signedEncoding, signatureValue))
+    return ValidationState::SignatureCheck();
+
+  return ValidationState::SignatureCheck
+    (signedEncoding, signatureValue, signingCertificate.getPublicKey());
+}
+
+void
+ValidationState::makeSignatureChecks
+  (const CertificateV2& trustedCertificate,
+   vector<SignatureCheck>& signatureChecks) const
+{
+  const CertificateV2* signingCertificate = &trustedCertificate;
+  for (size_t i = 0; i < certificateChain_.size(); ++i) {
+    signatureChecks.push_back
+      (makeDataSignatureCheck(*certificateChain_[i], *signingCertificate));
+    signingCertificate = certificateChain_[i].get();
+  }
+
+  signatureChecks.push_back
+    (makeOriginalPacketSignatureCheck(*signingCertificate));
+}
+
 ptr_lib::shared_ptr<CertificateV2>
 ValidationState::verifyCertificateChain
-  (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate)
+  (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+   size_t nVerifiedCertificates)
 {
-  ptr_lib::shared_ptr<CertificateV2> validatedCertificate = trustedCertificate;
-  for (size_t i = 0; i < certificateChain_.size(); ++i) {
-    ptr_lib::shared_ptr<CertificateV2> certificateToValidate =
-      certificateChain_[i];
-
-    if (!VerificationHelpers::verifyDataSignature
-        (*certificateToValidate, *validatedCertificate)) {
-      fail(ValidationError(ValidationError::INVALID_SIGNATURE,
-           "Invalid signature of certificate `" +
-           certificateToValidate->getName().toUri() + "`"));
-      certificateChain_.erase
-        (certificateChain_.begin() + i, certificateChain_.end());
-      return ptr_lib::shared_ptr<CertificateV2>();
-    }
-    else {
-      _LOG_TRACE("OK signature for certificate `" << certificateToValidate->getName() << "`");
-      validatedCertificate = certificateToValidate;
-    }
+  for (size_t i = 0; i < nVerifiedCertificates; ++i)
+    _LOG_TRACE("OK signature for certificate `" << certificateChain_[i]->getName() << "`");
+
+  if (nVerifiedCertificates < certificateChain_.size()) {
+    fail(ValidationError(ValidationError::INVALID_SIGNATURE,
+         "Invalid signature of certificate `" +
+         certificateChain_[nVerifiedCertificates]->getName().toUri() + "`"));
+    certificateChain_.erase
+      (certificateChain_.begin() + nVerifiedCertificates, certificateChain_.end());
+    return ptr_lib::shared_ptr<CertificateV2>();
   }
 
-  return validatedCertificate;
+  if (certificateChain_.size() == 0)
+    return trustedCertificate;
+  else
+    return certificateChain_.back();
 }
 
 DataValidationState::DataValidationState
@@ -100,12 +148,18 @@ DataValidationState::DataValidationState
     throw runtime_error("The failureCallback is null");
 }
 
+ValidationState::SignatureCheck
+DataValidationState::makeOriginalPacketSignatureCheck
+  (const CertificateV2& signingCertificate) const
+{
+  return makeDataSignatureCheck(*data_, signingCertificate);
+}
+
 void
-DataValidationState::verifyOriginalPacket
-  (const CertificateV2& trustedCertificate,
-   const CertificateStorage* certificateStorage)
+DataValidationState::onOriginalPacketVerified
+  (bool isSignatureValid, const CertificateStorage* certificateStorage)
 {
-  if (VerificationHelpers::verifyDataSignature(*data_, trustedCertificate)) {
+  if (isSignatureValid) {
     CertificateV2* originalCertificate = dynamic_cast<CertificateV2*>(data_.get());
     if (certificateStorage && originalCertificate) {
       // The original packet is a certificate. Check if the issuer has revoked it.
@@ -180,12 +234,26 @@ InterestValidationState::InterestValidationState
     throw runtime_error("The failureCallback is null");
 }
 
+ValidationState::SignatureCheck
+InterestValidationState::makeOriginalPacketSignatureCheck
+  (const CertificateV2& signingCertificate) const
+{
+  SignedBlob signedEncoding;
+  Blob signatureValue;
+  if (!VerificationHelpers::getInterestSignedEncoding
+      (interest_, *WireFormat::getDefaultWireFormat(), signedEncoding,
+       signatureValue))
+    return SignatureCheck();
+
+  return SignatureCheck
+    (signedEncoding, signatureValue, signingCertificate.getPublicKey());
+}
+
 void
-InterestValidationState::verifyOriginalPacket
-  (const CertificateV2& trustedCertificate,
-   const CertificateStorage* certificateStorage)
+InterestValidationState::onOriginalPacketVerified
+  (bool isSignatureValid, const CertificateStorage* certificateStorage)
 {
-  if (VerificationHelpers::verifyInterestSignature(interest_, trustedCertificate)) {
+  if (isSignatureValid) {
     _LOG_TRACE("OK signature for interest `" << interest_.getName() << "`");
     for (size_t i = 0; i < successCallbacks_.size(); ++i) {
       try {
@@ -36,10 +36,12 @@
 // Only compile if we set NDN_IND_HAVE_REGEX_LIB in ndn-regex-matcher-base.hpp.
 #if NDN_IND_HAVE_REGEX_LIB
 
+#include <string.h>
 #include <ndn-ind/security/validator-config-error.hpp>
 #include <ndn-ind/security/v2/validator-config/config-name-relation.hpp>
 #include "../../../util/boost-info-parser.hpp"
 #include "../../../util/regex/ndn-regex-top-matcher.hpp"
+#include "../../../util/regex/ndn-regex-compiled-matcher.hpp"
 #include <ndn-ind/security/v2/validator-config/config-filter.hpp>
 
 using namespace std;
@@ -64,6 +66,9 @@ ConfigFilter::match(bool isForInterest, const Name& packetName)
     return matchName(packetName);
 }
 
+Name
+ConfigFilter::getMatchPrefix() const { return Name(); }
+
 ptr_lib::shared_ptr<ConfigFilter>
 ConfigFilter::create(const BoostInfoTree& configSection)
 {
@@ -115,8 +120,12 @@ ConfigRelationNameFilter::matchName(const Name& packetName)
   return ConfigNameRelation::checkNameRelation(relation_, name_, packetName);
 }
 
+Name
+ConfigRelationNameFilter::getMatchPrefix() const { return name_; }
+
 ConfigRegexNameFilter::ConfigRegexNameFilter(const string& regexString)
-: regex_(new NdnRegexTopMatcher(regexString))
+: regex_(new NdnRegexTopMatcher(regexString)),
+  matchPrefix_(getLiteralPrefix(regexString))
 {
 }
 
@@ -126,6 +135,44 @@ ConfigRegexNameFilter::matchName(const Name& packetName)
   return regex_->match(packetName);
 }
 
+Name
+ConfigRegexNameFilter::getLiteralPrefix(const string& regexString)
+{
+  Name prefix;
+  if (regexString.size() == 0 || regexString[0] != '^')
+    // The regex can match after any components.
+    return prefix;
+
+  size_t index = 1;
+  while (index < regexString.size() && regexString[index] == '<') {
+    size_t end = regexString.find('>', index);
+    if (end == string::npos)
+      break;
+    if (end + 1 < regexString.size() &&
+        ::strchr("?*+{", regexString[end + 1]))
+      // The component has a repetition.
+      break;
+
+    string literal;
+    if (!NdnRegexCompiledMatcher::getLiteral
+        (regexString.substr(index + 1, end - index - 1), literal) ||
+        literal.size() == 0)
+      break;
+
+    // The component regex matches the escaped string, so make sure that the
+    // literal is the escaped string of exactly one component.
+    Name literalName("/" + literal);
+    if (literalName.size() != 1 ||
+        literalName.get(0).toEscapedString() != literal)
+      break;
+
+    prefix.append(literalName.get(0));
+    index = end + 1;
+  }
+
+  return prefix;
+}
+
 }
 
 #endif // NDN_IND_HAVE_REGEX_LIB
@@ -71,6 +71,18 @@ ConfigRule::match(bool isForInterest, const Name& packetName)
   return result;
 }
 
+void
+ConfigRule::getMatchPrefixes(vector<Name>& prefixes) const
+{
+  if (filters_.size() == 0) {
+    prefixes.push_back(Name());
+    return;
+  }
+
+  for (size_t i = 0; i < filters_.size(); ++i)
+    prefixes.push_back(filters_[i]->getMatchPrefix());
+}
+
 bool
 ConfigRule::check
   (bool isForInterest, const Name& packetName, const Name& keyLocatorName,
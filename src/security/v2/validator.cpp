@@ -65,6 +65,19 @@ Validator::validate
    const DataValidationSuccessCallback& successCallback,
    const DataValidationFailureCallback& failureCallback)
 {
+  if (getValidatedDataCacheCapacity() > 0 &&
+      findValidatedData(data.getFullName()->get(-1))) {
+    _LOG_TRACE("Found validated data in the cache " << data.getName());
+    try {
+      successCallback(data);
+    } catch (const std::exception& ex) {
+      _LOG_ERROR("Error in successCallback: " << ex.what());
+    } catch (...) {
+      _LOG_ERROR("Error in successCallback.");
+    }
+    return;
+  }
+
   ptr_lib::shared_ptr<DataValidationState> state
     (new DataValidationState(data, successCallback, failureCallback));
   _LOG_TRACE("Start validating data " << data.getName());
@@ -128,26 +141,11 @@ Validator::requestCertificate
 
   _LOG_TRACE("Retrieving " << certificateRequest->interest_.getName());
 
-  ptr_lib::shared_ptr<CertificateV2> certificate = findTrustedCertificate
+  ptr_lib::shared_ptr<CertificateV2> trustedCertificate = findTrustedCertificate
     (certificateRequest->interest_);
-  if (certificate) {
-    _LOG_TRACE("Found trusted certificate " << certificate->getName());
-
-    certificate = state->verifyCertificateChain(certificate);
-    if (certificate) {
-      for (size_t i = 0; i < state->certificateChain_.size(); ++i) {
-        if (!cacheVerifiedCertificate(*state->certificateChain_[i])) {
-          state->fail(ValidationError(ValidationError::REVOKED,
-            "The certificate with serial number " +
-            state->certificateChain_[i]->getX509SerialNumber().toHex() +
-            " is revoked: `" + state->certificateChain_[i]->getName().toUri() + "`"));
-          return;
-        }
-      }
-
-      state->verifyOriginalPacket(*certificate, this);
-    }
-
+  if (trustedCertificate) {
+    _LOG_TRACE("Found trusted certificate " << trustedCertificate->getName());
+    verifyFromTrustedCertificate(trustedCertificate, state);
     return;
   }
 
@@ -156,4 +154,83 @@ Validator::requestCertificate
      bind(&Validator::validateCertificate, this, _1, _2));
 }
 
+void
+Validator::verifyFromTrustedCertificate
+  (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+   const ptr_lib::shared_ptr<ValidationState>& state)
+{
+  vector<ValidationState::SignatureCheck> signatureChecks;
+  makeSignatureChecks(*trustedCertificate, *state, signatureChecks);
+  size_t nVerifiedCertificates;
+  bool isOriginalSignatureValid = verifySignatures
+    (signatureChecks, nVerifiedCertificates);
+  onSignaturesVerified
+    (trustedCertificate, state, nVerifiedCertificates, isOriginalSignatureValid);
+}
+
+bool
+Validator::verifySignatures
+  (const vector<ValidationState::SignatureCheck>& signatureChecks,
+   size_t& nVerifiedCertificates)
+{
+  // The last SignatureCheck is for the original packet.
+  size_t nCertificates = signatureChecks.size() - 1;
+  for (nVerifiedCertificates = 0; nVerifiedCertificates < nCertificates;
+       ++nVerifiedCertificates) {
+    if (!signatureChecks[nVerifiedCertificates].verify())
+      return false;
+  }
+
+  return signatureChecks.back().verify();
+}
+
+void
+Validator::onSignaturesVerified
+  (const ptr_lib::shared_ptr<CertificateV2>& trustedCertificate,
+   const ptr_lib::shared_ptr<ValidationState>& state,
+   size_t nVerifiedCertificates, bool isOriginalSignatureValid)
+{
+  ptr_lib::shared_ptr<CertificateV2> certificate =
+    state->verifyCertificateChain(trustedCertificate, nVerifiedCertificates);
+  if (certificate) {
+    for (size_t i = 0; i < state->certificateChain_.size(); ++i) {
+      if (!cacheVerifiedCertificate(*state->certificateChain_[i])) {
+        state->fail(ValidationError(ValidationError::REVOKED,
+          "The certificate with serial number " +
+          state->certificateChain_[i]->getX509SerialNumber().toHex() +
+          " is revoked: `" + state->certificateChain_[i]->getName().toUri() + "`"));
+        return;
+      }
+    }
+
+    state->onOriginalPacketVerified(isOriginalSignatureValid, this);
+
+    DataValidationState* dataState =
+      dynamic_cast<DataValidationState*>(state.get());
+    if (dataState && state->isOutcomeSuccess() &&
+        getValidatedDataCacheCapacity() > 0) {
+      vector<ptr_lib::shared_ptr<CertificateV2> > certificates
+        (state->certificateChain_);
+      certificates.push_back(trustedCertificate);
+      const CertificateV2* dataCertificate =
+        dynamic_cast<const CertificateV2*>(&dataState->getOriginalData());
+      if (dataCertificate)
+        // Also remove the cache entry if the Data packet itself is revoked.
+        certificates.push_back
+          (ptr_lib::make_shared<CertificateV2>(*dataCertificate));
+
+      // If the trusted certificate is from the verified certificate cache
+      // (not a trust anchor), the entry depends on it staying in the cache.
+      Name verifiedCertificateName;
+      if (verifiedCertificateCache_.findExact(trustedCertificate->getName()) ==
+          trustedCertificate)
+        verifiedCertificateName = trustedCertificate->getName();
+
+      cacheValidatedData
+        (dataState->getOriginalData().getFullName()->get(-1), certificates,
+         verifiedCertificateName);
+    }
+  }
+}
+
 }
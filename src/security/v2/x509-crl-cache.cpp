@@ -87,6 +87,26 @@ X509CrlCache::find(const Name& issuerName) const
   return itr->second.crlInfo_;
 }
 
+const X509CrlInfo::RevokedCertificate*
+X509CrlCache::findRevokedCertificate
+  (const Name& issuerName, const Blob& serialNumber) const
+{
+  if (serialNumber.size() == 0)
+    // This can happen by calling getX509SerialNumber() on a non-X.509 certificate.
+    return 0;
+
+  const_cast<X509CrlCache*>(this)->refresh();
+
+  map<Name, Entry>::const_iterator itr = crlsByName_.find(issuerName);
+  if (itr == crlsByName_.end())
+    return 0;
+
+  auto revoked = itr->second.revokedSerialNumbers_.find(serialNumber);
+  if (revoked == itr->second.revokedSerialNumbers_.end())
+    return 0;
+  return &itr->second.crlInfo_->getRevokedCertificate(revoked->second);
+}
+
 void
 X509CrlCache::clear()
 {
@@ -94,6 +114,18 @@ X509CrlCache::clear()
   nextRefreshTime_ = system_clock::time_point::max();
 }
 
+X509CrlCache::Entry::Entry
+  (const ptr_lib::shared_ptr<X509CrlInfo>& crlInfo,
+   system_clock::time_point removalTime)
+: crlInfo_(crlInfo), removalTime_(removalTime)
+{
+  revokedSerialNumbers_.reserve(crlInfo_->getRevokedCertificateCount());
+  for (size_t i = 0; i < crlInfo_->getRevokedCertificateCount(); ++i)
+    // emplace doesn't replace an existing key, so this keeps the first entry.
+    revokedSerialNumbers_.emplace
+      (crlInfo_->getRevokedCertificate(i).getSerialNumber(), i);
+}
+
 void
 X509CrlCache::refresh()
 {
@@ -33,6 +33,7 @@
  */
 
 #include <stdexcept>
+#include <algorithm>
 #include <ndn-ind/security/security-exception.hpp>
 #include <ndn-ind/security/v2/certificate-v2.hpp>
 #include <ndn-ind/lite/util/crypto-lite.hpp>
@@ -102,22 +103,8 @@ VerificationHelpers::verifyDataSignature
 {
   SignedBlob signedEncoding;
   Blob signatureValue;
-  const CertificateV2* certificate = dynamic_cast<const CertificateV2*>(&data);
-  if (certificate) {
-    // Special case: Use the CertificateV2 methods which may have special processing.
-    signedEncoding = certificate->getSignedEncoding(wireFormat);
-    if (signedEncoding.isNull())
-      return false;
-    signatureValue = certificate->getSignatureValue();
-  }
-  else {
-    try {
-      signedEncoding = data.wireEncode(wireFormat);
-      signatureValue = data.getSignature()->getSignature();
-    } catch (const std::exception&) {
-      return false;
-    }
-  }
+  if (!getDataSignedEncoding(data, wireFormat, signedEncoding, signatureValue))
+    return false;
 
   return verifySignature
     (signedEncoding.signedBuf(), signedEncoding.signedSize(),
@@ -137,27 +124,84 @@ VerificationHelpers::verifyDataSignature
   }
 }
 
+vector<bool>
+VerificationHelpers::verifyDataSignatures
+  (const vector<const Data*>& dataList, const PublicKey& publicKey,
+   DigestAlgorithm digestAlgorithm, WireFormat& wireFormat)
+{
+  if (digestAlgorithm != DIGEST_ALGORITHM_SHA256)
+    throw invalid_argument("verifyDataSignatures: Invalid digest algorithm");
+
+  vector<bool> results(dataList.size(), false);
+#if NDN_IND_HAVE_LIBCRYPTO
+  // Decode the public key once instead of for each Data packet.
+  ptr_lib::shared_ptr<RsaPublicKeyLite> rsaPublicKey;
+  ptr_lib::shared_ptr<EcPublicKeyLite> ecPublicKey;
+  if (publicKey.getKeyType() == KEY_TYPE_RSA) {
+    rsaPublicKey.reset(new RsaPublicKeyLite());
+    if (rsaPublicKey->decode
+        (publicKey.getKeyDer().buf(), publicKey.getKeyDer().size()) != 0)
+      return results;
+  }
+  else if (publicKey.getKeyType() == KEY_TYPE_EC) {
+    ecPublicKey.reset(new EcPublicKeyLite());
+    if (ecPublicKey->decode
+        (publicKey.getKeyDer().buf(), publicKey.getKeyDer().size()) != 0)
+      return results;
+  }
+  else
+#endif
+    throw invalid_argument("verifyDataSignatures: Invalid key type");
+
+#if NDN_IND_HAVE_LIBCRYPTO
+  SignedBlob signedEncoding;
+  Blob signatureValue;
+  for (size_t i = 0; i < dataList.size(); ++i) {
+    if (!dataList[i] ||
+        !getDataSignedEncoding
+          (*dataList[i], wireFormat, signedEncoding, signatureValue))
+      continue;
+
+    if (rsaPublicKey)
+      results[i] = rsaPublicKey->verifyWithSha256
+        (signatureValue.buf(), signatureValue.size(), signedEncoding.signedBuf(),
+         signedEncoding.signedSize());
+    else
+      results[i] = ecPublicKey->verifyWithSha256
+        (signatureValue.buf(), signatureValue.size(), signedEncoding.signedBuf(),
+         signedEncoding.signedSize());
+  }
+
+  return results;
+#endif
+}
+
+vector<bool>
+VerificationHelpers::verifyDataSignatures
+  (const vector<const Data*>& dataList, const Blob& publicKeyDer,
+   DigestAlgorithm digestAlgorithm, WireFormat& wireFormat)
+{
+  try {
+    return verifyDataSignatures
+      (dataList, PublicKey(publicKeyDer), digestAlgorithm, wireFormat);
+  } catch (const UnrecognizedKeyFormatException&) {
+    return vector<bool>(dataList.size(), false);
+  }
+}
+
 bool
 VerificationHelpers::verifyInterestSignature
   (const Interest& interest, const PublicKey& publicKey,
    DigestAlgorithm digestAlgorithm, WireFormat& wireFormat)
 {
-  ptr_lib::shared_ptr<Signature> signature = extractSignature
-    (interest, wireFormat);
-  if (!signature)
-    return false;
-
   SignedBlob encoding;
-  try {
-    encoding = interest.wireEncode(wireFormat);
-  } catch (const std::exception&) {
+  Blob signatureValue;
+  if (!getInterestSignedEncoding(interest, wireFormat, encoding, signatureValue))
     return false;
-  }
 
   return verifySignature
-    (encoding.signedBuf(), encoding.signedSize(),
-     signature->getSignature().buf(), signature->getSignature().size(),
-     publicKey, digestAlgorithm);
+    (encoding.signedBuf(), encoding.signedSize(), signatureValue.buf(),
+     signatureValue.size(), publicKey, digestAlgorithm);
 }
 
 bool
@@ -203,6 +247,57 @@ VerificationHelpers::verifyDataDigest
      data.getSignature()->getSignature().size(), digestAlgorithm);
 }
 
+vector<bool>
+VerificationHelpers::verifyDataDigests
+  (const vector<const Data*>& dataList, DigestAlgorithm digestAlgorithm,
+   WireFormat& wireFormat)
+{
+  if (digestAlgorithm != DIGEST_ALGORITHM_SHA256)
+    throw invalid_argument("verifyDataDigests: Invalid digest algorithm");
+
+  vector<bool> results(dataList.size(), false);
+
+  // Get the signed portion of each Data packet which can be encoded.
+  vector<size_t> toDigest;
+  vector<SignedBlob> encodings;
+  vector<const uint8_t*> buffers;
+  vector<size_t> bufferLengths;
+  for (size_t i = 0; i < dataList.size(); ++i) {
+    if (!dataList[i])
+      continue;
+
+    SignedBlob encoding;
+    try {
+      encoding = dataList[i]->wireEncode(wireFormat);
+    } catch (const std::exception&) {
+      continue;
+    }
+
+    if (dataList[i]->getSignature()->getSignature().size() !=
+        ndn_SHA256_DIGEST_SIZE)
+      continue;
+
+    encodings.push_back(encoding);
+    toDigest.push_back(i);
+    buffers.push_back(encoding.signedBuf());
+    bufferLengths.push_back(encoding.signedSize());
+  }
+
+  if (toDigest.size() == 0)
+    return results;
+
+  vector<uint8_t> digests(toDigest.size() * ndn_SHA256_DIGEST_SIZE);
+  CryptoLite::digestSha256Batch
+    (&buffers.front(), &bufferLengths.front(), toDigest.size(), &digests.front());
+  for (size_t j = 0; j < toDigest.size(); ++j)
+    results[toDigest[j]] = equal
+      (digests.begin() + j * ndn_SHA256_DIGEST_SIZE,
+       digests.begin() + (j + 1) * ndn_SHA256_DIGEST_SIZE,
+       dataList[toDigest[j]]->getSignature()->getSignature().buf());
+
+  return results;
+}
+
 bool
 VerificationHelpers::verifyInterestDigest
   (const Interest& interest, DigestAlgorithm digestAlgorithm,
@@ -226,6 +321,51 @@ VerificationHelpers::verifyInterestDigest
      digestAlgorithm);
 }
 
+bool
+VerificationHelpers::getDataSignedEncoding
+  (const Data& data, WireFormat& wireFormat, SignedBlob& signedEncoding,
+   Blob& signatureValue)
+{
+  const CertificateV2* certificate = dynamic_cast<const CertificateV2*>(&data);
+  if (certificate) {
+    // Special case: Use the CertificateV2 methods which may have special processing.
+    signedEncoding = certificate->getSignedEncoding(wireFormat);
+    if (signedEncoding.isNull())
+      return false;
+    signatureValue = certificate->getSignatureValue();
+  }
+  else {
+    try {
+      signedEncoding = data.wireEncode(wireFormat);
+      signatureValue = data.getSignature()->getSignature();
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool
+VerificationHelpers::getInterestSignedEncoding
+  (const Interest& interest, WireFormat& wireFormat, SignedBlob& signedEncoding,
+   Blob& signatureValue)
+{
+  ptr_lib::shared_ptr<Signature> signature = extractSignature
+    (interest, wireFormat);
+  if (!signature)
+    return false;
+
+  try {
+    signedEncoding = interest.wireEncode(wireFormat);
+  } catch (const std::exception&) {
+    return false;
+  }
+  signatureValue = signature->getSignature();
+
+  return true;
+}
+
 ptr_lib::shared_ptr<Signature>
 VerificationHelpers::extractSignature
   (const Interest& interest, WireFormat& wireFormat)
@@ -41,6 +41,7 @@
 #include "sync-state.pb.h"
 #include "../c/util/time.h"
 #include "digest-tree.hpp"
+#include <ndn-ind/sync/sync-state-storage.hpp>
 #include <ndn-ind/sync/chrono-sync2013.hpp>
 
 INIT_LOGGER("ndn.ChronoSync2013");
@@ -56,14 +57,17 @@ ChronoSync2013::Impl::Impl
    const OnInitialized& onInitialized, const Name& applicationDataPrefix,
    const Name& applicationBroadcastPrefix, int sessionNo, Face& face,
    KeyChain& keyChain, const Name& certificateName, nanoseconds syncLifetime,
-   int previousSequenceNumber)
+   int previousSequenceNumber, bool useHashTreeRootDigest,
+   const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage)
 : onReceivedSyncState_(onReceivedSyncState), onInitialized_(onInitialized),
   applicationDataPrefixUri_(applicationDataPrefix.toUri()),
   applicationBroadcastPrefix_(applicationBroadcastPrefix), sessionNo_(sessionNo),
   face_(face), keyChain_(keyChain), certificateName_(certificateName),
   syncLifetime_(syncLifetime), initialPreviousSequenceNo_(previousSequenceNumber),
-  sequenceNo_(previousSequenceNumber), digestTree_(new DigestTree()),
-  contentCache_(&face), enabled_(true)
+  sequenceNo_(previousSequenceNumber), digestTree_(new DigestTree(useHashTreeRootDigest)),
+  contentCache_(&face), enabled_(true), nRemovedLogEntries_(0),
+  maxDigestLogSize_(DEFAULT_MAX_DIGEST_LOG_SIZE), stateStorage_(stateStorage),
+  isRestoring_(false)
 {
 }
 
@@ -71,8 +75,7 @@ void
 ChronoSync2013::Impl::initialize(const OnRegisterFailed& onRegisterFailed)
 {
   Sync::SyncStateMsg emptyContent;
-  digestLog_.push_back(ptr_lib::make_shared<DigestLogEntry>
-    ("00", emptyContent.ss()));
+  logAdd("00", emptyContent.ss());
 
   // Register the prefix with the contentCache_ and use our own onInterest
   //   as the onDataNotFound fallback.
@@ -80,6 +83,46 @@ ChronoSync2013::Impl::initialize(const OnRegisterFailed& onRegisterFailed)
     (applicationBroadcastPrefix_, onRegisterFailed,
      (OnInterestCallback)bind(&ChronoSync2013::Impl::onInterest, shared_from_this(), _1, _2, _3, _4, _5));
 
+  vector<SyncState> storedStates;
+  if (stateStorage_)
+    stateStorage_->getChronoSyncSequenceNos
+      (applicationBroadcastPrefix_, storedStates);
+
+  if (storedStates.size() > 0) {
+    // Restore the digest tree from before a restart. Don't use update() since
+    // the sequence numbers are already stored.
+    Sync::SyncStateMsg restoredContent;
+    for (size_t i = 0; i < storedStates.size(); ++i) {
+      const SyncState& state = storedStates[i];
+      digestTree_->update
+        (state.getDataPrefix(), state.getSessionNo(), state.getSequenceNo());
+      if (state.getDataPrefix() == applicationDataPrefixUri_ &&
+          state.getSessionNo() == sessionNo_ &&
+          state.getSequenceNo() > sequenceNo_)
+        sequenceNo_ = state.getSequenceNo();
+
+      Sync::SyncState* content = restoredContent.add_ss();
+      content->set_name(state.getDataPrefix());
+      content->set_type(Sync::SyncState_ActionType_UPDATE);
+      content->mutable_seqno()->set_seq(state.getSequenceNo());
+      content->mutable_seqno()->set_session(state.getSessionNo());
+    }
+    logAdd(digestTree_->getRoot(), restoredContent.ss());
+    isRestoring_ = true;
+
+    // The other participants reply with only the changes since the restored
+    // root digest, if they still have it in their digest log.
+    Interest interest(applicationBroadcastPrefix_);
+    interest.getName().append(digestTree_->getRoot());
+    interest.setInterestLifetime(seconds(1));
+    face_.expressInterest
+      (interest, bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
+       bind(&ChronoSync2013::Impl::restoreTimeOut, shared_from_this(), _1));
+    _LOG_DEBUG("restored " << storedStates.size() << " sync states, sync expressed");
+    _LOG_DEBUG(interest.getName().toUri());
+    return;
+  }
+
   Interest interest(applicationBroadcastPrefix_);
   interest.getName().append("00");
   interest.setInterestLifetime(seconds(1));
@@ -90,21 +133,49 @@ ChronoSync2013::Impl::initialize(const OnRegisterFailed& onRegisterFailed)
   _LOG_DEBUG(interest.getName().toUri());
 }
 
+void
+ChronoSync2013::Impl::setMaxDigestLogSize(size_t maxDigestLogSize)
+{
+  if (maxDigestLogSize < 1)
+    throw runtime_error("ChronoSync: maxDigestLogSize must be at least 1");
+
+  maxDigestLogSize_ = maxDigestLogSize;
+  while (digestLog_.size() > maxDigestLogSize_) {
+    digestLogIndex_.erase(digestLog_.front()->getDigest());
+    digestLog_.pop_front();
+    ++nRemovedLogEntries_;
+  }
+}
+
+void
+ChronoSync2013::Impl::logAdd
+  (const std::string& digest,
+   const google::protobuf::RepeatedPtrField<Sync::SyncState>& data)
+{
+  digestLog_.push_back(ptr_lib::make_shared<DigestLogEntry>(digest, data));
+  digestLogIndex_[digest] = nRemovedLogEntries_ + digestLog_.size() - 1;
+
+  // Use setMaxDigestLogSize to remove the oldest entries.
+  setMaxDigestLogSize(maxDigestLogSize_);
+}
+
 int
 ChronoSync2013::Impl::logFind(const std::string& digest) const
 {
-  for (size_t i = 0; i < digestLog_.size(); ++i) {
-    if (digest == digestLog_[i]->getDigest())
-      return i;
-  }
+  unordered_map<string, uint64_t>::const_iterator entry =
+    digestLogIndex_.find(digest);
+  if (entry == digestLogIndex_.end())
+    return -1;
 
-  return -1;
+  return (int)(entry->second - nRemovedLogEntries_);
 };
 
 bool
 ChronoSync2013::Impl::update
   (const google::protobuf::RepeatedPtrField<Sync::SyncState >& content)
 {
+  // The updated sequence numbers to store in one transaction.
+  vector<SyncState> updatedStates;
   for (size_t i = 0; i < content.size(); ++i) {
     if (content.Get(i).type() == Sync::SyncState_ActionType_UPDATE) {
       if (digestTree_->update
@@ -113,13 +184,19 @@ ChronoSync2013::Impl::update
         // The digest tree was updated.
         if (applicationDataPrefixUri_ == content.Get(i).name())
           sequenceNo_ = content.Get(i).seqno().seq();
+        if (stateStorage_)
+          updatedStates.push_back(SyncState
+            (content.Get(i).name(), content.Get(i).seqno().session(),
+             content.Get(i).seqno().seq(), Blob()));
       }
     }
   }
+  if (stateStorage_)
+    stateStorage_->setChronoSyncSequenceNos
+      (applicationBroadcastPrefix_, updatedStates);
 
   if (logFind(digestTree_->getRoot()) == -1) {
-    digestLog_.push_back(ptr_lib::make_shared<DigestLogEntry>
-      (digestTree_->getRoot(), content));
+    logAdd(digestTree_->getRoot(), content);
     return true;
   }
   else
@@ -248,7 +325,14 @@ ChronoSync2013::Impl::onData
 
   const google::protobuf::RepeatedPtrField<Sync::SyncState >&content = tempContent.ss();
   bool isRecovery;
-  if (digestTree_->getRoot() == "00") {
+  if (isRestoring_) {
+    // This is the reply to the interest for the restored root digest or for
+    // "00". Either way, merge it with the restored digest tree.
+    isRecovery = true;
+    update(content);
+    finishRestore();
+  }
+  else if (digestTree_->getRoot() == "00") {
     isRecovery = true;
     //processing initial sync data
     initialOndata(content);
@@ -303,7 +387,9 @@ ChronoSync2013::Impl::processRecoveryInterest
   (const Interest& interest, const string& syncDigest, Face& face)
 {
   _LOG_DEBUG("processRecoveryInst");
-  if (logFind(syncDigest) != -1) {
+  // The log entry for "00" may have been removed when the log is full, but we
+  // still reply to a newcomer.
+  if (syncDigest == "00" || logFind(syncDigest) != -1) {
     Sync::SyncStateMsg tempContent;
     for (size_t i = 0; i < digestTree_->size(); ++i) {
       Sync::SyncState* content = tempContent.add_ss();
@@ -572,6 +658,72 @@ ChronoSync2013::Impl::initialTimeOut(const ptr_lib::shared_ptr<const Interest>&
   _LOG_DEBUG(name.toUri());
 }
 
+void
+ChronoSync2013::Impl::restoreTimeOut(const ptr_lib::shared_ptr<const Interest>& interest)
+{
+  if (!enabled_ || !isRestoring_)
+    return;
+
+  if (interest->getName().get(applicationBroadcastPrefix_.size()).toEscapedString()
+      != "00") {
+    // The other participants don't have the restored root digest, so get the
+    // full state as a newcomer.
+    _LOG_DEBUG("restored sync timeout");
+    Interest initialInterest(applicationBroadcastPrefix_);
+    initialInterest.getName().append("00");
+    initialInterest.setInterestLifetime(seconds(1));
+    face_.expressInterest
+      (initialInterest,
+       bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
+       bind(&ChronoSync2013::Impl::restoreTimeOut, shared_from_this(), _1));
+    _LOG_DEBUG("initial sync expressed");
+    _LOG_DEBUG(initialInterest.getName().toUri());
+    return;
+  }
+
+  _LOG_DEBUG("initial sync timeout");
+  _LOG_DEBUG("no other people");
+  finishRestore();
+
+  Name name(applicationBroadcastPrefix_);
+  name.append(digestTree_->getRoot());
+  Interest retryInterest(name);
+  retryInterest.setInterestLifetime(syncLifetime_);
+  face_.expressInterest
+    (retryInterest, bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
+     bind(&ChronoSync2013::Impl::syncTimeout, shared_from_this(), _1));
+  _LOG_DEBUG("Syncinterest expressed:");
+  _LOG_DEBUG(name.toUri());
+}
+
+void
+ChronoSync2013::Impl::finishRestore()
+{
+  isRestoring_ = false;
+
+  if (digestTree_->find(applicationDataPrefixUri_, sessionNo_) == -1) {
+    // The stored state didn't have our own session, so add it.
+    string digest = digestTree_->getRoot();
+    ++sequenceNo_;
+    Sync::SyncStateMsg tempContent;
+    Sync::SyncState* content = tempContent.add_ss();
+    content->set_name(applicationDataPrefixUri_);
+    content->set_type(Sync::SyncState_ActionType_UPDATE);
+    content->mutable_seqno()->set_seq(sequenceNo_);
+    content->mutable_seqno()->set_session(sessionNo_);
+    broadcastSyncState(digest, tempContent);
+    update(tempContent.ss());
+  }
+
+  try {
+    onInitialized_();
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("ChronoSync2013::Impl::finishRestore: Error in onInitialized: " << ex.what());
+  } catch (...) {
+    _LOG_ERROR("ChronoSync2013::Impl::finishRestore: Error in onInitialized.");
+  }
+}
+
 void
 ChronoSync2013::Impl::broadcastSyncState
   (const string& digest, const Sync::SyncStateMsg& syncMessage)
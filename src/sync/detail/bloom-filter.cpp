@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+#include <ndn-ind/lite/util/crypto-lite.hpp>
+#include "bloom-filter.hpp"
+
+using namespace std;
+
+namespace ndn {
+
+BloomFilter::BloomFilter
+  (size_t expectedNEntries, double falsePositiveProbability)
+: expectedNEntries_(expectedNEntries),
+  // Clamp before the cast, which is undefined for an out of range double.
+  // computeParameters rejects 0 and 1000. (This also makes NaN 0.)
+  fppMillis_((uint64_t)std::min
+    (1000.0, std::max(0.0, round(falsePositiveProbability * 1000))))
+{
+  computeParameters();
+  table_.assign(tableSize_ / 8, 0);
+}
+
+BloomFilter::BloomFilter
+  (const Name::Component& expectedNEntries,
+   const Name::Component& falsePositiveProbability,
+   const Name::Component& table)
+{
+  // The name is from the network, so check the numbers before using them.
+  uint64_t expectedNEntriesNumber = expectedNEntries.toNumber();
+  if (expectedNEntriesNumber > MAX_EXPECTED_N_ENTRIES)
+    throw runtime_error("BloomFilter: expectedNEntries is too large");
+  expectedNEntries_ = (size_t)expectedNEntriesNumber;
+  fppMillis_ = falsePositiveProbability.toNumber();
+  computeParameters();
+
+  if (table.getValue().size() != tableSize_ / 8)
+    throw runtime_error
+      ("BloomFilter: The bit table size does not match the parameters");
+  table_.assign
+    (table.getValue().buf(), table.getValue().buf() + table.getValue().size());
+}
+
+void
+BloomFilter::computeParameters()
+{
+  if (expectedNEntries_ == 0 || expectedNEntries_ > MAX_EXPECTED_N_ENTRIES)
+    throw runtime_error
+      ("BloomFilter: expectedNEntries must be from 1 to MAX_EXPECTED_N_ENTRIES");
+  if (fppMillis_ == 0 || fppMillis_ >= 1000)
+    throw runtime_error
+      ("BloomFilter: The false positive probability must be from 0.001 to 0.999");
+
+  // The optimal number of bits is -n ln(p) / (ln 2)^2 and the optimal number of
+  // hashes is (bits / n) ln 2. With the limits above, nBits is at most about
+  // 14.4 * MAX_EXPECTED_N_ENTRIES so the cast to size_t is safe.
+  double ln2 = log(2.0);
+  double nBits = -(double)expectedNEntries_ * log(fppMillis_ / 1000.0) /
+    (ln2 * ln2);
+  tableSize_ = (size_t)ceil(nBits);
+  // Round up to a whole number of bytes.
+  tableSize_ = (tableSize_ + 7) / 8 * 8;
+  nHashes_ = (size_t)round((double)tableSize_ / expectedNEntries_ * ln2);
+  if (nHashes_ < 1)
+    nHashes_ = 1;
+}
+
+void
+BloomFilter::computeHashes(const Name& prefix, uint32_t& hash1, uint32_t& hash2)
+{
+  string uri = prefix.toUri();
+  hash1 = CryptoLite::murmurHash3(0, uri.data(), uri.size());
+  hash2 = CryptoLite::murmurHash3(1, uri.data(), uri.size());
+}
+
+void
+BloomFilter::insert(const Name& prefix)
+{
+  uint32_t hash1, hash2;
+  computeHashes(prefix, hash1, hash2);
+
+  for (size_t i = 0; i < nHashes_; ++i) {
+    size_t bit = (uint32_t)(hash1 + i * hash2) % tableSize_;
+    table_[bit / 8] |= (uint8_t)(1 << (bit % 8));
+  }
+}
+
+bool
+BloomFilter::contains(const Name& prefix) const
+{
+  uint32_t hash1, hash2;
+  computeHashes(prefix, hash1, hash2);
+
+  for (size_t i = 0; i < nHashes_; ++i) {
+    size_t bit = (uint32_t)(hash1 + i * hash2) % tableSize_;
+    if ((table_[bit / 8] & (1 << (bit % 8))) == 0)
+      return false;
+  }
+
+  return true;
+}
+
+void
+BloomFilter::clear()
+{
+  std::fill(table_.begin(), table_.end(), 0);
+}
+
+void
+BloomFilter::appendToName(Name& name) const
+{
+  name.appendNumber(expectedNEntries_);
+  name.appendNumber(fppMillis_);
+  name.append(Blob(table_));
+}
+
+}
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_BLOOM_FILTER_HPP
+#define NDN_BLOOM_FILTER_HPP
+
+#include <vector>
+#include <ndn-ind/name.hpp>
+
+namespace ndn {
+
+/**
+ * BloomFilter is a Bloom filter of name prefixes which is used by a
+ * PartialPSync2017Consumer to tell the PartialPSync2017Producer which prefixes
+ * it subscribes to. The filter is carried in the sync Interest name as three
+ * components: the expected number of entries, the false positive probability
+ * times 1000, and the bit table. The number of bits and hash functions is
+ * computed from the first two so that both sides build the same filter. Each
+ * bit index is derived from two murmurHash3 values of the prefix URI by double
+ * hashing.
+ */
+class BloomFilter {
+public:
+  /**
+   * The maximum expected number of entries. This limits the size of the table
+   * computed from the parameters in a received name.
+   */
+  static const size_t MAX_EXPECTED_N_ENTRIES = 100000;
+
+  /**
+   * Create an empty BloomFilter.
+   * @param expectedNEntries The expected number of entries.
+   * @param falsePositiveProbability The false positive probability when the
+   * filter has expectedNEntries entries. This is rounded to a multiple of 0.001
+   * to put it in the name.
+   * @throws runtime_error if expectedNEntries is zero or greater than
+   * MAX_EXPECTED_N_ENTRIES, or the rounded falsePositiveProbability is not
+   * greater than 0 and less than 1.
+   */
+  BloomFilter(size_t expectedNEntries, double falsePositiveProbability);
+
+  /**
+   * Create a BloomFilter from the components of the name which were appended
+   * by appendToName.
+   * @param expectedNEntries The component with the expected number of entries.
+   * @param falsePositiveProbability The component with the false positive
+   * probability times 1000.
+   * @param table The component with the bit table.
+   * @throws runtime_error if a component is not a number, the parameters are
+   * not valid (see the other constructor) or the table size is not compatible
+   * with the parameters. The parameters are checked before allocating the
+   * table.
+   */
+  BloomFilter
+    (const Name::Component& expectedNEntries,
+     const Name::Component& falsePositiveProbability,
+     const Name::Component& table);
+
+  /**
+   * Insert the prefix into the filter.
+   * @param prefix The prefix Name.
+   */
+  void
+  insert(const Name& prefix);
+
+  /**
+   * Check if the prefix is in the filter. This may return a false positive.
+   * @param prefix The prefix Name.
+   * @return True if the prefix is (probably) in the filter, false if it is
+   * definitely not.
+   */
+  bool
+  contains(const Name& prefix) const;
+
+  /**
+   * Remove all entries by clearing the bit table.
+   */
+  void
+  clear();
+
+  /**
+   * Append the expected number of entries, the false positive probability
+   * times 1000 and the bit table to the name.
+   * @param name The Name to append to.
+   */
+  void
+  appendToName(Name& name) const;
+
+  size_t
+  getExpectedNEntries() const { return expectedNEntries_; }
+
+  double
+  getFalsePositiveProbability() const { return fppMillis_ / 1000.0; }
+
+  /**
+   * Get the number of hash functions, which is computed from the parameters.
+   */
+  size_t
+  getNHashes() const { return nHashes_; }
+
+  /**
+   * Get the number of bits in the table, which is computed from the parameters
+   * and is a multiple of 8.
+   */
+  size_t
+  getTableSize() const { return tableSize_; }
+
+private:
+  /**
+   * Compute nHashes_ and tableSize_ from expectedNEntries_ and fppMillis_. This
+   * does not resize table_.
+   * @throws runtime_error if the parameters are not valid.
+   */
+  void
+  computeParameters();
+
+  /**
+   * Compute the two hashes of the prefix URI for double hashing.
+   */
+  static void
+  computeHashes(const Name& prefix, uint32_t& hash1, uint32_t& hash2);
+
+  size_t expectedNEntries_;
+  uint64_t fppMillis_;
+  size_t nHashes_;
+  size_t tableSize_;
+  std::vector<uint8_t> table_;
+};
+
+}
+
+#endif
@@ -61,6 +61,7 @@
 #include <ndn-ind/ndn-ind-config.h>
 #if NDN_IND_HAVE_LIBZ
 
+#include <algorithm>
 #include <stdexcept>
 #include <zlib.h>
 #include <ndn-ind/lite/util/crypto-lite.hpp>
@@ -71,6 +72,7 @@ using namespace std;
 namespace ndn {
 
 InvertibleBloomLookupTable::InvertibleBloomLookupTable(size_t expectedNEntries)
+: compressionLevel_(Z_BEST_COMPRESSION)
 {
   // 1.5 times the expected number of entries gives a very low probability of a
   // decoding failure.
@@ -83,6 +85,18 @@ InvertibleBloomLookupTable::InvertibleBloomLookupTable(size_t expectedNEntries)
   hashTable_.resize(nEntries);
 }
 
+void
+InvertibleBloomLookupTable::setCompressionLevel(int compressionLevel)
+{
+  if (compressionLevel < Z_NO_COMPRESSION || compressionLevel > Z_BEST_COMPRESSION)
+    throw runtime_error("IBLT setCompressionLevel: The level must be from 0 to 9");
+
+  if (compressionLevel != compressionLevel_) {
+    compressionLevel_ = compressionLevel;
+    encoding_ = Blob();
+  }
+}
+
 void
 InvertibleBloomLookupTable::initialize(const Blob& encoding)
 {
@@ -91,6 +105,8 @@ InvertibleBloomLookupTable::initialize(const Blob& encoding)
   if (3 * hashTable_.size() != values.size())
     throw runtime_error("The received Invertible Bloom Filter cannot be decoded");
 
+  encoding_ = Blob();
+
   for (size_t i = 0; i < hashTable_.size(); ++i) {
     HashTableEntry& entry = hashTable_.at(i);
     if (values[i * 3] != 0) {
@@ -105,33 +121,82 @@ bool
 InvertibleBloomLookupTable::listEntries
   (set<uint32_t>& positive, set<uint32_t>& negative) const
 {
+  vector<uint32_t> positiveList;
+  vector<uint32_t> negativeList;
+  bool result = listEntries(positiveList, negativeList);
+
+  // The lists are sorted, so each insert at the end is amortized constant.
   positive.clear();
+  positive.insert(positiveList.begin(), positiveList.end());
   negative.clear();
+  negative.insert(negativeList.begin(), negativeList.end());
 
+  return result;
+}
+
+bool
+InvertibleBloomLookupTable::listEntries
+  (vector<uint32_t>& positive, vector<uint32_t>& negative) const
+{
   // Make a deep copy.
   InvertibleBloomLookupTable peeled(*this);
+  return peeled.peelEntries(positive, negative);
+}
 
-  size_t nErased = 0;
-  do {
-    nErased = 0;
-    for (vector<HashTableEntry>::const_iterator entry = peeled.hashTable_.begin();
-         entry != peeled.hashTable_.end(); ++entry) {
-      if (entry->isPure()) {
-        if (entry->count_ == 1)
-          positive.insert(entry->keySum_);
-        else
-          negative.insert(entry->keySum_);
-
-        peeled.update(-entry->count_, entry->keySum_);
-        ++nErased;
-      }
+bool
+InvertibleBloomLookupTable::peelEntries
+  (vector<uint32_t>& positive, vector<uint32_t>& negative)
+{
+  positive.clear();
+  negative.clear();
+  pureCells_.clear();
+  encoding_ = Blob();
+
+  for (size_t i = 0; i < hashTable_.size(); ++i) {
+    if (hashTable_[i].isPure())
+      pureCells_.push_back(i);
+  }
+
+  size_t bucketsPerHash = hashTable_.size() / N_HASH;
+  while (!pureCells_.empty()) {
+    HashTableEntry& pureEntry = hashTable_[pureCells_.back()];
+    pureCells_.pop_back();
+    // Peeling another cell may have changed this one since it was added.
+    if (!pureEntry.isPure())
+      continue;
+
+    int32_t count = pureEntry.count_;
+    uint32_t key = pureEntry.keySum_;
+    if (count == 1)
+      positive.push_back(key);
+    else
+      negative.push_back(key);
+
+    // This is the same as update(-count, key), but also adds each cell which
+    // becomes pure to the worklist.
+    uint32_t keyCheck = CryptoLite::murmurHash3(N_HASHCHECK, key);
+    for (size_t i = 0; i < N_HASH; ++i) {
+      size_t index = i * bucketsPerHash +
+        (CryptoLite::murmurHash3(i, key) % bucketsPerHash);
+      HashTableEntry& entry = hashTable_[index];
+      entry.count_ -= count;
+      entry.keySum_ ^= key;
+      entry.keyCheck_ ^= keyCheck;
+
+      if (entry.isPure())
+        pureCells_.push_back(index);
     }
-  } while (nErased > 0);
+  }
+
+  sort(positive.begin(), positive.end());
+  positive.erase(unique(positive.begin(), positive.end()), positive.end());
+  sort(negative.begin(), negative.end());
+  negative.erase(unique(negative.begin(), negative.end()), negative.end());
 
   // If any buckets for one of the hash functions is not empty, then we didn't
   // peel them all.
-  for (vector<HashTableEntry>::const_iterator entry = peeled.hashTable_.begin();
-       entry != peeled.hashTable_.end(); ++entry) {
+  for (vector<HashTableEntry>::const_iterator entry = hashTable_.begin();
+       entry != hashTable_.end(); ++entry) {
     if (!entry->isEmpty())
       return false;
   }
@@ -142,26 +207,40 @@ InvertibleBloomLookupTable::listEntries
 ptr_lib::shared_ptr<InvertibleBloomLookupTable>
 InvertibleBloomLookupTable::difference
   (const InvertibleBloomLookupTable& other) const
+{
+  ptr_lib::shared_ptr<InvertibleBloomLookupTable> result =
+    ptr_lib::make_shared<InvertibleBloomLookupTable>(0);
+  difference(other, *result);
+  return result;
+}
+
+void
+InvertibleBloomLookupTable::difference
+  (const InvertibleBloomLookupTable& other,
+   InvertibleBloomLookupTable& result) const
 {
   if (hashTable_.size() != other.hashTable_.size())
     throw runtime_error("IBLT difference: Both tables must be the same size");
 
-  ptr_lib::shared_ptr<InvertibleBloomLookupTable> result =
-    ptr_lib::make_shared<InvertibleBloomLookupTable>(*this);
+  result.encoding_ = Blob();
+  // If the result already has the same size, this copies without allocating.
+  if (&result != this)
+    result.hashTable_.assign(hashTable_.begin(), hashTable_.end());
   for (size_t i = 0; i < hashTable_.size(); ++i) {
-    HashTableEntry& e1 = result->hashTable_.at(i);
-    const HashTableEntry& e2 = other.hashTable_.at(i);
+    HashTableEntry& e1 = result.hashTable_[i];
+    const HashTableEntry& e2 = other.hashTable_[i];
     e1.count_ -= e2.count_;
     e1.keySum_ ^= e2.keySum_;
     e1.keyCheck_ ^= e2.keyCheck_;
   }
-
-  return result;
 }
 
 Blob
 InvertibleBloomLookupTable::encode() const
 {
+  if (!encoding_.isNull())
+    return encoding_;
+
   size_t nEntries = hashTable_.size();
   size_t unitSize = (32 * 3) / 8; // hard coding
   size_t tableSize = unitSize * nEntries;
@@ -193,7 +272,8 @@ InvertibleBloomLookupTable::encode() const
     table[(i * unitSize) + 11] = 0xFF & (entry.keyCheck_ >> 24);
   }
 
-  return zlibCompress(table.data(), table.size());
+  encoding_ = zlibCompress(table.data(), table.size(), compressionLevel_);
+  return encoding_;
 }
 
 bool
@@ -217,6 +297,7 @@ InvertibleBloomLookupTable::equals(const InvertibleBloomLookupTable& other) cons
 void
 InvertibleBloomLookupTable::update(int plusOrMinus, uint32_t key)
 {
+  encoding_ = Blob();
   size_t bucketsPerHash = hashTable_.size() / N_HASH;
 
   for (size_t i = 0; i < N_HASH; ++i) {
@@ -250,7 +331,8 @@ InvertibleBloomLookupTable::decode(const Blob& encoding)
 }
 
 Blob
-InvertibleBloomLookupTable::zlibCompress(const uint8_t* data, size_t dataLength)
+InvertibleBloomLookupTable::zlibCompress
+  (const uint8_t* data, size_t dataLength, int compressionLevel)
 {
   // From https://www.zlib.net/zlib_how.html
 
@@ -262,7 +344,7 @@ InvertibleBloomLookupTable::zlibCompress(const uint8_t* data, size_t dataLength)
   stream.zalloc = Z_NULL;
   stream.zfree = Z_NULL;
   stream.opaque = Z_NULL;
-  deflateInit(&stream, Z_BEST_COMPRESSION);
+  deflateInit(&stream, compressionLevel);
 
   stream.next_in = const_cast<uint8_t*>(data);
   stream.avail_in = dataLength;
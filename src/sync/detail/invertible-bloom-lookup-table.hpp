@@ -65,6 +65,7 @@
 #if NDN_IND_HAVE_LIBZ
 
 #include <set>
+#include <vector>
 #include <ndn-ind/util/blob.hpp>
 
 namespace ndn {
@@ -90,6 +91,24 @@ public:
   void
   initialize(const Blob& encoding);
 
+  /**
+   * Set the zlib compression level used by encode(). A lower level makes
+   * encode() faster at the cost of a larger encoding. The decoder accepts an
+   * encoding made with any level, so this does not need to match other nodes.
+   * @param compressionLevel The zlib compression level from 0 (no compression)
+   * to 9 (best compression). The default is 9.
+   * @throws runtime_error if compressionLevel is not from 0 to 9.
+   */
+  void
+  setCompressionLevel(int compressionLevel);
+
+  /**
+   * Get the zlib compression level used by encode().
+   * @return The compression level from 0 to 9.
+   */
+  int
+  getCompressionLevel() const { return compressionLevel_; }
+
   void
   insert(uint32_t key) { update(INSERT, key); }
 
@@ -108,6 +127,37 @@ public:
   bool
   listEntries(std::set<uint32_t>& positive, std::set<uint32_t>& negative) const;
 
+  /**
+   * List all the entries in the IBLT, the same as listEntries with sets, but
+   * return the entries as sorted vectors. This leaves this IBLT unchanged by
+   * peeling a copy. To avoid the copy, see peelEntries.
+   * @param positive Add positive entries to this vector in ascending order.
+   * This first clears the vector.
+   * @param negative Add negative entries to this vector in ascending order.
+   * This first clears the vector.
+   * @return True if decoding is completed successfully.
+   */
+  bool
+  listEntries
+    (std::vector<uint32_t>& positive, std::vector<uint32_t>& negative) const;
+
+  /**
+   * List all the entries in the IBLT by peeling this IBLT in place. This uses
+   * a worklist of pure cells so that each cell is visited a bounded number of
+   * times, instead of rescanning the whole table until no pure cell remains.
+   * When this returns, this IBLT holds only the cells that could not be peeled,
+   * so it should be used as a scratch table such as the result of difference.
+   * If the positive and negative vectors are reused between calls, this does
+   * not allocate once their capacity is large enough.
+   * @param positive Add positive entries to this vector in ascending order.
+   * This first clears the vector.
+   * @param negative Add negative entries to this vector in ascending order.
+   * This first clears the vector.
+   * @return True if decoding is completed successfully.
+   */
+  bool
+  peelEntries(std::vector<uint32_t>& positive, std::vector<uint32_t>& negative);
+
   /**
    * Get a new IBLT which is the difference of the other IBLT from this IBLT.
    * @param other The other IBLT.
@@ -116,12 +166,27 @@ public:
   ptr_lib::shared_ptr<InvertibleBloomLookupTable>
   difference(const InvertibleBloomLookupTable& other) const;
 
+  /**
+   * Set result to the difference of the other IBLT from this IBLT. This reuses
+   * the hash table of result so that a caller can keep one scratch IBLT for
+   * repeated differences without allocating.
+   * @param other The other IBLT.
+   * @param result The IBLT to set to this - other. This may be this IBLT.
+   * @throws runtime_error if other is not the same size as this IBLT.
+   */
+  void
+  difference
+    (const InvertibleBloomLookupTable& other,
+     InvertibleBloomLookupTable& result) const;
+
   /**
    * Encode this IBLT to a Blob. This encodes this hash table from a uint32_t
    * array to a uint8_t array. We create a uin8_t array 12 times the size of
    * the uint32_t array. We put the first count in the first 4 cells, keySum in
    * the next 4, and keyCheck in the next 4. We repeat for all the other cells
    * of the hash table. Then we append this uint8_t array to the name.
+   * The encoding is cached until the next change to this IBLT, so calling this
+   * again without a change does not compress again.
    * @return The encoded Blob.
    */
   Blob
@@ -181,12 +246,17 @@ private:
   decode(const Blob& encoding);
 
   static Blob
-  zlibCompress(const uint8_t* data, size_t dataLength);
+  zlibCompress(const uint8_t* data, size_t dataLength, int compressionLevel);
 
   static Blob
   zlibDecompress(const uint8_t* data, size_t dataLength);
 
   std::vector<HashTableEntry> hashTable_;
+  // The worklist of pure cell indexes for peelEntries, kept to reuse its capacity.
+  std::vector<size_t> pureCells_;
+  int compressionLevel_;
+  // The cached result of encode(), or isNull() if the hash table has changed.
+  mutable Blob encoding_;
 
   static const int INSERT = 1;
   static const int ERASE = -1;
@@ -36,9 +36,12 @@
 
 using namespace std;
 using namespace std::chrono;
+using namespace ndn::func_lib;
 
 namespace ndn {
 
+static const size_t MAX_SEGMENT_SIZE = MAX_NDN_PACKET_SIZE / 2;
+
 void
 PSyncSegmentPublisher::publish
   (const Name& interestName, const Name& dataName, Blob content,
@@ -48,66 +51,93 @@ PSyncSegmentPublisher::publish
   if (interestName[-1].isSegment())
     interestSegment = interestName[-1].toSegment();
 
-  const uint8_t* rawBuffer = content.buf();
-  const uint8_t* segmentBegin = rawBuffer;
-  const uint8_t* end = rawBuffer + content.size();
-
-  size_t maxPacketSize = MAX_NDN_PACKET_SIZE / 2;
-
-  uint64_t totalSegments = content.size() / maxPacketSize;
-  Name::Component finalBlockId = Name::Component::fromSegment(totalSegments);
+  // Empty content still has one empty segment.
+  size_t nSegments = (content.size() + MAX_SEGMENT_SIZE - 1) / MAX_SEGMENT_SIZE;
+  if (nSegments == 0)
+    nSegments = 1;
 
   Name segmentPrefix(dataName);
   segmentPrefix.appendVersion((uint64_t)ndn_getNowMilliseconds());
 
-  uint64_t segmentNo = 0;
-  do {
-    const uint8_t* segmentEnd = segmentBegin + maxPacketSize;
-    if (segmentEnd > end)
-      segmentEnd = end;
-
-    Name segmentName(segmentPrefix);
-    segmentName.appendSegment(segmentNo);
-
-    ptr_lib::shared_ptr<Data> data = ptr_lib::make_shared<Data>(segmentName);
-    data->setContent(Blob(segmentBegin, segmentEnd - segmentBegin));
-    data->getMetaInfo().setFreshnessPeriod(freshnessPeriod);
-    data->getMetaInfo().setFinalBlockId(finalBlockId);
-
-    segmentBegin = segmentEnd;
-
-    keyChain_.sign(*data, signingInfo);
-
-    // Only send the segment to the Face if it has a pending interest.
-    // Otherwise, the segment is unsolicited.
-    if (interestSegment == segmentNo)
-      face_.putData(*data);
-
-#if 0 // Until InMemoryStorageFifo implements an eviction policy, use InMemoryStorageRetaining.
-    storage_.insert(*data, freshnessPeriod);
-#else
-    storage_.insert(*data);
-#endif
+  ptr_lib::shared_ptr<Publication> publication(new Publication
+    (segmentPrefix, content, freshnessPeriod, signingInfo, nSegments));
+  publications_[segmentPrefix] = publication;
 
-    face_.callLater
-      (freshnessPeriod,
-       bind(&InMemoryStorageRetaining::remove, &storage_, segmentName));
+  // Only send the segment to the Face if it has a pending interest.
+  // Otherwise, the segment is unsolicited.
+  if (interestSegment < nSegments)
+    face_.putData(getSegment(*publication, (size_t)interestSegment));
 
-    ++segmentNo;
-  } while (segmentBegin < end);
+  // Use one timer to remove all the segments.
+  face_.callLater
+    (freshnessPeriod,
+     bind(&PSyncSegmentPublisher::removePublication, this, segmentPrefix,
+          publication));
 }
 
 bool
 PSyncSegmentPublisher::replyFromStore(const Name& interestName)
 {
-  ptr_lib::shared_ptr<Data> data = storage_.find(interestName);
+  if (interestName.size() > 0 && interestName[-1].isSegment()) {
+    // Look for the exact segment.
+    map<Name, ptr_lib::shared_ptr<Publication> >::iterator entry =
+      publications_.find(interestName.getPrefix(-1));
+    if (entry != publications_.end()) {
+      uint64_t segmentNo = interestName[-1].toSegment();
+      if (segmentNo >= entry->second->segments_.size())
+        return false;
+
+      face_.putData(getSegment(*entry->second, (size_t)segmentNo));
+      return true;
+    }
+  }
 
-  if (data) {
-    face_.putData(*data);
+  // Reply with segment 0 of the first publication under the Interest name.
+  // The Name keys are in order, so it is the first entry not less than it.
+  map<Name, ptr_lib::shared_ptr<Publication> >::iterator entry =
+    publications_.lower_bound(interestName);
+  if (entry != publications_.end() && interestName.isPrefixOf(entry->first)) {
+    face_.putData(getSegment(*entry->second, 0));
     return true;
   }
 
   return false;
 }
 
+const Data&
+PSyncSegmentPublisher::getSegment(Publication& publication, size_t segmentNo)
+{
+  if (publication.segments_[segmentNo])
+    return *publication.segments_[segmentNo];
+
+  size_t segmentBegin = segmentNo * MAX_SEGMENT_SIZE;
+  size_t segmentSize = publication.content_.size() - segmentBegin;
+  if (segmentSize > MAX_SEGMENT_SIZE)
+    segmentSize = MAX_SEGMENT_SIZE;
+
+  ptr_lib::shared_ptr<Data> data
+    (new Data(Name(publication.segmentPrefix_).appendSegment(segmentNo)));
+  data->setContent(Blob(publication.content_.buf() + segmentBegin, segmentSize));
+  data->getMetaInfo().setFreshnessPeriod(publication.freshnessPeriod_);
+  data->getMetaInfo().setFinalBlockId
+    (Name::Component::fromSegment(publication.segments_.size() - 1));
+
+  // Only save the segment after signing succeeds, so that an exception
+  // doesn't leave an unsigned segment to be sent later.
+  keyChain_.sign(*data, publication.signingInfo_);
+  publication.segments_[segmentNo] = data;
+  return *data;
+}
+
+void
+PSyncSegmentPublisher::removePublication
+  (const Name& segmentPrefix,
+   const ptr_lib::shared_ptr<Publication>& publication)
+{
+  map<Name, ptr_lib::shared_ptr<Publication> >::iterator entry =
+    publications_.find(segmentPrefix);
+  if (entry != publications_.end() && entry->second == publication)
+    publications_.erase(entry);
+}
+
 }
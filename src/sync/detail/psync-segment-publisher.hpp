@@ -35,15 +35,17 @@
 #ifndef NDN_PSYNC_SEGMENT_PUBLISHER_HPP
 #define NDN_PSYNC_SEGMENT_PUBLISHER_HPP
 
+#include <map>
 #include <ndn-ind/face.hpp>
 #include <ndn-ind/security/key-chain.hpp>
-#include <ndn-ind/in-memory-storage/in-memory-storage-retaining.hpp>
 
 namespace ndn {
 
 /**
  * The PSyncSegmentPublisher class has methods to publish segmented data used by
- * PSync.
+ * PSync. The content of a publication is kept in one Blob. A segment Data
+ * packet is only made and signed when it is first requested, since usually a
+ * consumer only fetches the first segment.
  */
 class PSyncSegmentPublisher {
 public:
@@ -52,22 +54,21 @@ public:
    * @param face The application's Face.
    * @param keyChain The KeyChain for signing Data packets.
    * @param inMemoryStorageLimit (optional) The limit for the in-memory storage.
-   * If omitted, use MAX_SEGMENTS_STORED.
+   * If omitted, use MAX_SEGMENTS_STORED. (This is currently not used, since
+   * publications are removed after the freshness period.)
    */
   PSyncSegmentPublisher
     (Face& face, KeyChain& keyChain, 
      size_t inMemoryStorageLimit = MAX_SEGMENTS_STORED)
   : face_(face), keyChain_(keyChain)
-#if 0 // Until InMemoryStorageFifo implements an eviction policy, use InMemoryStorageRetaining.
-    , storage_(inMemoryStorageLimit)
-#endif
   {
   }
 
   /**
-   * Put all the segments in the memory store.
+   * Save the content to be served as segments until the freshness period
+   * expires.
    * @param interestName If the Interest name ends in a segment, immediately
-   * send the Data packet for the segment to the Face.
+   * send the Data packet for the segment to the Face. Otherwise send segment 0.
    * @param dataName The Data name, which has components after the Interest name.
    * @param content The content of the data to be segmented.
    * @param freshnessPeriod The freshness period of the segments.
@@ -81,8 +82,11 @@ public:
      const SigningInfo& signingInfo = SigningInfo());
 
   /**
-   * Try to reply to the Interest name from the memory store.
-   * @param interestName The Interest name for looking up in the memory store.
+   * Try to reply to the Interest name from the saved publications. If the
+   * Interest name ends in a segment, look for that segment. Otherwise, reply
+   * with segment 0 of the first publication whose name has the Interest name
+   * as a prefix.
+   * @param interestName The Interest name for looking up the segment.
    * @return True if sent the segment Data packet to the Face, or false if we
    * cannot find the segment, in which case the caller is expected to publish
    * the segment.
@@ -93,13 +97,53 @@ public:
   static const size_t MAX_SEGMENTS_STORED = 100;
 
 private:
+  /**
+   * A Publication holds the content of one call to publish and the segment
+   * Data packets which have been made so far.
+   */
+  class Publication {
+  public:
+    Publication
+      (const Name& segmentPrefix, const Blob& content,
+       std::chrono::nanoseconds freshnessPeriod, const SigningInfo& signingInfo,
+       size_t nSegments)
+    : segmentPrefix_(segmentPrefix), content_(content),
+      freshnessPeriod_(freshnessPeriod), signingInfo_(signingInfo),
+      segments_(nSegments)
+    {}
+
+    Name segmentPrefix_;
+    Blob content_;
+    std::chrono::nanoseconds freshnessPeriod_;
+    SigningInfo signingInfo_;
+    // Each entry is null until the segment is made and signed.
+    std::vector<ptr_lib::shared_ptr<Data> > segments_;
+  };
+
+  /**
+   * Get the segment Data packet from the publication, making and signing it if
+   * this is the first request.
+   * @param publication The Publication with the content.
+   * @param segmentNo The segment number, which must be less than the number
+   * of segments.
+   * @return The signed segment Data packet.
+   */
+  const Data&
+  getSegment(Publication& publication, size_t segmentNo);
+
+  /**
+   * Remove the publication from publications_. However, if publications_ now
+   * has a different Publication with the segment prefix, do nothing.
+   */
+  void
+  removePublication
+    (const Name& segmentPrefix,
+     const ptr_lib::shared_ptr<Publication>& publication);
+
   Face& face_;
   KeyChain& keyChain_;
-#if 0 // Until InMemoryStorageFifo implements an eviction policy, use InMemoryStorageRetaining.
-  InMemoryStorageFifo storage_;
-#else
-  InMemoryStorageRetaining storage_;
-#endif
+  // The key is the Data name plus the version, without the segment.
+  std::map<Name, ptr_lib::shared_ptr<Publication> > publications_;
 };
 
 }
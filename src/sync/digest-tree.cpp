@@ -33,6 +33,7 @@
  */
 
 #include <algorithm>
+#include <string.h>
 #include <ndn-ind/util/logging.hpp>
 #if NDN_IND_HAVE_LIBCRYPTO
 #include <openssl/ssl.h>
@@ -47,91 +48,139 @@ using namespace std;
 
 namespace ndn {
 
-/**
- * Convert the hex character to an integer from 0 to 15, or -1 if not a hex character.
- * @param c
- * @return
- */
-static int
-fromHexChar(uint8_t c)
-{
-  if (c >= '0' && c <= '9')
-    return (int)c - (int)'0';
-  else if (c >= 'A' && c <= 'F')
-    return (int)c - (int)'A' + 10;
-  else if (c >= 'a' && c <= 'f')
-    return (int)c - (int)'a' + 10;
-  else
-    return -1;
-}
-
-/**
- * Convert the hex string to bytes and call SHA256_Update.
- * @param context The SHA256_CTX to update.
- * @param hex The hex string.
- * @return The result from SHA256_Update.
- */
-static int
-SHA256_UpdateHex(SHA256_CTX *context, const string& hex)
-{
-  vector<uint8_t> data(hex.size() / 2);
-  for (size_t i = 0; i < data.size(); ++i)
-    data[i] = (uint8_t)(16 * fromHexChar(hex[2 * i]) + fromHexChar(hex[2 * i + 1]));
-
-  return SHA256_Update(context, &data[0], data.size());
-}
-
 bool
 DigestTree::update(const std::string& dataPrefix, int sessionNo, int sequenceNo)
 {
-  int index = find(dataPrefix, sessionNo);
   _LOG_DEBUG(dataPrefix << ", " << sessionNo);
-  _LOG_DEBUG("DigestTree::update session " << sessionNo << ", index " << index);
-  if (index >= 0) {
+  unordered_map<NodeKey, ptr_lib::shared_ptr<Node>, NodeKeyHash>::iterator
+    entry = index_.find(NodeKey(dataPrefix, sessionNo));
+  if (entry != index_.end()) {
+    Node& node = *entry->second;
+    _LOG_DEBUG("DigestTree::update session " << sessionNo << ", index " <<
+               node.index_);
     // only update the newer status
-    if (digestNode_[index]->getSequenceNo() < sequenceNo)
-      digestNode_[index]->setSequenceNo(sequenceNo);
+    if (node.getSequenceNo() < sequenceNo)
+      node.setSequenceNo(sequenceNo);
     else
       return false;
+
+    if (useHashTreeRoot_)
+      updateHashTreePath(node.index_);
   }
   else {
     _LOG_DEBUG("new comer " << dataPrefix << ", session " << sessionNo <<
                ", sequence " << sequenceNo);
     // Insert into digestnode_ sorted.
     ptr_lib::shared_ptr<Node> temp(new Node(dataPrefix, sessionNo, sequenceNo));
-    digestNode_.insert
+    vector<ptr_lib::shared_ptr<Node> >::iterator position = digestNode_.insert
       (std::lower_bound(digestNode_.begin(), digestNode_.end(), temp, nodeCompare_),
        temp);
+    // Update the index of this and the following nodes.
+    for (size_t i = position - digestNode_.begin(); i < digestNode_.size(); ++i)
+      digestNode_[i]->index_ = i;
+    index_[NodeKey(dataPrefix, sessionNo)] = temp;
+
+    if (useHashTreeRoot_)
+      rebuildHashTree();
   }
 
-  recomputeRoot();
+  isRootStale_ = true;
   return true;
 }
 
+const string&
+DigestTree::getRoot() const
+{
+  if (isRootStale_) {
+    recomputeRoot();
+    isRootStale_ = false;
+  }
+
+  return root_;
+}
+
 void
-DigestTree::recomputeRoot()
+DigestTree::recomputeRoot() const
 {
-  SHA256_CTX sha256;
+  if (digestNode_.size() == 0) {
+    root_ = "00";
+    return;
+  }
 
-  SHA256_Init(&sha256);
-  for (size_t i = 0; i < digestNode_.size(); ++i)
-    SHA256_UpdateHex(&sha256, digestNode_[i]->getDigest());
-  uint8_t digestRoot[ndn_SHA256_DIGEST_SIZE];
-  SHA256_Final(&digestRoot[0], &sha256);
-  root_ = toHex(digestRoot, sizeof(digestRoot));
+  if (useHashTreeRoot_) {
+    const Digest& top = hashTree_.back()[0];
+    root_ = toHex(top.value_, sizeof(top.value_));
+  }
+  else {
+    SHA256_CTX sha256;
+
+    SHA256_Init(&sha256);
+    for (size_t i = 0; i < digestNode_.size(); ++i)
+      SHA256_Update(&sha256, digestNode_[i]->getDigest(), ndn_SHA256_DIGEST_SIZE);
+    uint8_t digestRoot[ndn_SHA256_DIGEST_SIZE];
+    SHA256_Final(&digestRoot[0], &sha256);
+    root_ = toHex(digestRoot, sizeof(digestRoot));
+  }
   _LOG_DEBUG("update root to: " + root_);
 }
 
+void
+DigestTree::rebuildHashTree()
+{
+  hashTree_.resize(1);
+  vector<Digest>& leaves = hashTree_[0];
+  leaves.resize(digestNode_.size());
+  for (size_t i = 0; i < digestNode_.size(); ++i)
+    memcpy(leaves[i].value_, digestNode_[i]->getDigest(), ndn_SHA256_DIGEST_SIZE);
+
+  while (hashTree_.back().size() > 1) {
+    hashTree_.push_back(vector<Digest>((hashTree_.back().size() + 1) / 2));
+    const vector<Digest>& children = hashTree_[hashTree_.size() - 2];
+    vector<Digest>& parents = hashTree_.back();
+    for (size_t i = 0; i < parents.size(); ++i)
+      hashChildren(children, i, parents[i]);
+  }
+}
+
+void
+DigestTree::updateHashTreePath(size_t index)
+{
+  memcpy(hashTree_[0][index].value_, digestNode_[index]->getDigest(),
+         ndn_SHA256_DIGEST_SIZE);
+
+  for (size_t level = 1; level < hashTree_.size(); ++level) {
+    index /= 2;
+    hashChildren(hashTree_[level - 1], index, hashTree_[level][index]);
+  }
+}
+
+void
+DigestTree::hashChildren
+  (const vector<Digest>& level, size_t parentIndex, Digest& parent)
+{
+  size_t left = 2 * parentIndex;
+  if (left + 1 >= level.size()) {
+    // There is no right child, so promote the left child.
+    parent = level[left];
+    return;
+  }
+
+  SHA256_CTX sha256;
+  SHA256_Init(&sha256);
+  SHA256_Update(&sha256, level[left].value_, ndn_SHA256_DIGEST_SIZE);
+  SHA256_Update(&sha256, level[left + 1].value_, ndn_SHA256_DIGEST_SIZE);
+  SHA256_Final(parent.value_, &sha256);
+}
+
 int
 DigestTree::find(const string& dataPrefix, int sessionNo) const
 {
-  for (size_t i = 0; i < digestNode_.size(); ++i) {
-    if (digestNode_[i]->getDataPrefix() == dataPrefix &&
-        digestNode_[i]->getSessionNo() == sessionNo)
-      return i;
-  }
+  unordered_map<NodeKey, ptr_lib::shared_ptr<Node>, NodeKeyHash>::const_iterator
+    entry = index_.find(NodeKey(dataPrefix, sessionNo));
+  if (entry == index_.end())
+    return -1;
 
-  return -1;
+  return (int)entry->second->index_;
 }
 
 void
@@ -156,9 +205,7 @@ DigestTree::Node::recomputeDigest()
   SHA256_Init(&sha256);
   SHA256_Update(&sha256, nameDigest, sizeof(nameDigest));
   SHA256_Update(&sha256, sequenceDigest, sizeof(sequenceDigest));
-  uint8_t nodeDigest[ndn_SHA256_DIGEST_SIZE];
-  SHA256_Final(nodeDigest, &sha256);
-  digest_ = toHex(nodeDigest, sizeof(nodeDigest));
+  SHA256_Final(digest_, &sha256);
 }
 
 void
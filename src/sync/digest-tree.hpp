@@ -37,13 +37,34 @@
 
 #include <ndn-ind/common.hpp>
 #include <string>
+#include <unordered_map>
 
 namespace ndn {
 
+/**
+ * DigestTree holds the (data prefix, session number, sequence number) of each
+ * ChronoSync participant and computes the root digest of the sync state. The
+ * nodes are kept sorted by data prefix and session number, with a hash index
+ * to find a node. By default, the root digest is the digest of all the node
+ * digests in sorted order as in the ChronoSync protocol, which is recomputed
+ * only when getRoot() is called after a change. If useHashTreeRoot is true, the
+ * root digest is instead the root of a balanced binary hash tree over the node
+ * digests, so that updating a sequence number only re-hashes the path from the
+ * node to the root.
+ */
 class DigestTree {
 public:
-  DigestTree()
-  : root_("00")
+  /**
+   * Create an empty DigestTree with the root digest "00".
+   * @param useHashTreeRoot (optional) If true, compute the root digest as a
+   * balanced binary hash tree where each parent is the digest of its two
+   * children, or is its only child, and the root is the top of the tree. This
+   * is not compatible with other ChronoSync implementations, so all
+   * participants must use the same setting. If omitted or false, compute the
+   * root digest as in the ChronoSync protocol.
+   */
+  DigestTree(bool useHashTreeRoot = false)
+  : useHashTreeRoot_(useHashTreeRoot), root_("00"), isRootStale_(false)
   {}
 
   class Node {
@@ -57,7 +78,8 @@ public:
     Node(const std::string& dataPrefix, int sessionNo, int sequenceNo)
     : dataPrefix_(dataPrefix),
       sessionNo_(sessionNo),
-      sequenceNo_(sequenceNo)
+      sequenceNo_(sequenceNo),
+      index_(0)
     {
       recomputeDigest();
     }
@@ -73,9 +95,9 @@ public:
 
     /**
      * Get the digest.
-     * @return The digest as a hex string.
+     * @return A pointer to the ndn_SHA256_DIGEST_SIZE bytes of the digest.
      */
-    const std::string&
+    const uint8_t*
     getDigest() const { return digest_; }
 
     /**
@@ -108,8 +130,10 @@ public:
     };
 
   private:
+    friend class DigestTree;
+
     /**
-     * Digest the fields and set digest_ to the hex digest.
+     * Digest the fields and set digest_.
      */
     void
     recomputeDigest();
@@ -120,7 +144,9 @@ public:
     std::string dataPrefix_;
     int sessionNo_;
     int sequenceNo_;
-    std::string digest_;
+    uint8_t digest_[ndn_SHA256_DIGEST_SIZE];
+    // The index of this node in DigestTree::digestNode_.
+    size_t index_;
   };
 
   /**
@@ -136,6 +162,12 @@ public:
   bool
   update(const std::string& dataPrefix, int sessionNo, int sequenceNo);
 
+  /**
+   * Find the node with the dataPrefix and sessionNo.
+   * @param dataPrefix The name prefix.
+   * @param sessionNo The session number.
+   * @return The index of the node for get(i), or -1 if not found.
+   */
   int
   find(const std::string& dataPrefix, int sessionNo) const;
 
@@ -146,26 +178,74 @@ public:
   get(size_t i) const { return *digestNode_[i]; }
 
   /**
-   * Get the root digest.
+   * Get the root digest. If the tree changed since the last call, this first
+   * computes the root digest.
    * @return The root digest as a hex string.
    */
   const std::string&
-  getRoot() const { return root_; }
+  getRoot() const;
 
 private:
   /**
-   * Set root_ to the digest of all digests in digestNode_. This sets root_
-   * to the hex value of the digest.
+   * NodeKey is the (dataPrefix, sessionNo) key for the index.
+   */
+  typedef std::pair<std::string, int> NodeKey;
+
+  class NodeKeyHash {
+  public:
+    size_t
+    operator()(const NodeKey& key) const
+    {
+      return std::hash<std::string>()(key.first) ^
+        ((size_t)key.second * 0x9e3779b9);
+    }
+  };
+
+  struct Digest {
+    uint8_t value_[ndn_SHA256_DIGEST_SIZE];
+  };
+
+  /**
+   * Set root_ to the hex value of the digest of all digests in digestNode_.
+   */
+  void
+  recomputeRoot() const;
+
+  /**
+   * Rebuild all the levels of the hash tree from the node digests. This is
+   * called when a node is inserted.
    */
   void
-  recomputeRoot();
+  rebuildHashTree();
+
+  /**
+   * Copy the digest of the node at the index into the hash tree and re-hash
+   * the path to the top of the tree.
+   * @param index The index of the node in digestNode_.
+   */
+  void
+  updateHashTreePath(size_t index);
+
+  /**
+   * Set parent to the digest of the children of the parent index in the level,
+   * or to the left child if it has no right child.
+   */
+  static void
+  hashChildren
+    (const std::vector<Digest>& level, size_t parentIndex, Digest& parent);
 
   std::vector<ptr_lib::shared_ptr<DigestTree::Node> > digestNode_;
-  std::string root_;
+  std::unordered_map<NodeKey, ptr_lib::shared_ptr<DigestTree::Node>, NodeKeyHash>
+    index_;
+  bool useHashTreeRoot_;
+  // If useHashTreeRoot_, hashTree_[0] has the node digests and each following
+  // level has the digests of the pairs in the previous level, up to one root.
+  std::vector<std::vector<Digest> > hashTree_;
+  mutable std::string root_;
+  mutable bool isRootStale_;
   Node::Compare nodeCompare_;
 };
 
 }
 
 #endif
-
@@ -43,6 +43,7 @@
 #include "./detail/psync-state.hpp"
 #include "./detail/psync-segment-publisher.hpp"
 #include "./detail/psync-user-prefixes.hpp"
+#include <ndn-ind/sync/sync-state-storage.hpp>
 #include <ndn-ind/sync/full-psync2017-with-users.hpp>
 
 using namespace std;
@@ -54,7 +55,8 @@ INIT_LOGGER("ndn.FullPSync2017WithUsers");
 namespace ndn {
 
 FullPSync2017WithUsers::Impl::Impl(const OnUpdate& onUpdate)
-: onUpdate_(onUpdate), prefixes_(new PSyncUserPrefixes())
+: onUpdate_(onUpdate), prefixes_(new PSyncUserPrefixes()),
+  hashNameWireEncoding_(false)
 {
 }
 
@@ -62,14 +64,33 @@ void
 FullPSync2017WithUsers::Impl::initialize
   (size_t expectedNEntries, Face& face, const Name& syncPrefix,
    const Name& userPrefix, KeyChain& keyChain, nanoseconds syncInterestLifetime,
-   nanoseconds syncReplyFreshnessPeriod, const SigningInfo& signingInfo)
+   nanoseconds syncReplyFreshnessPeriod, const SigningInfo& signingInfo,
+   const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage)
 {
+  if (stateStorage) {
+    // Restore the latest sequence number of each user prefix from the stored
+    // names before FullPSync2017 starts syncing.
+    vector<Name> names;
+    stateStorage->getPSyncNames(syncPrefix, names);
+    for (size_t i = 0; i < names.size(); ++i) {
+      Name prefix = names[i].getPrefix(-1);
+      int sequenceNo = names[i].get(-1).toNumber();
+      if (!prefixes_->isUserNode(prefix) ||
+          prefixes_->prefixes_[prefix] < sequenceNo)
+        prefixes_->prefixes_[prefix] = sequenceNo;
+    }
+  }
+
   fullPSync_ = ptr_lib::make_shared<FullPSync2017>
     (expectedNEntries, face, syncPrefix,
      bind(&FullPSync2017WithUsers::Impl::onNamesUpdate, shared_from_this(), _1),
      keyChain, syncInterestLifetime, syncReplyFreshnessPeriod, signingInfo,
      bind(&FullPSync2017WithUsers::Impl::isNotFutureHash, shared_from_this(), _1, _2),
-     bind(&FullPSync2017WithUsers::Impl::canAddReceivedName, shared_from_this(), _1));
+     bind(&FullPSync2017WithUsers::Impl::canAddReceivedName, shared_from_this(), _1),
+     1, stateStorage);
+  for (size_t i = 0; i < constructionRemovedNames_.size(); ++i)
+    fullPSync_->removeName(constructionRemovedNames_[i]);
+  constructionRemovedNames_.clear();
 
   if (userPrefix.size() > 0)
     addUserNode(userPrefix);
@@ -113,6 +134,45 @@ FullPSync2017WithUsers::Impl::publishName(const Name& prefix, int sequenceNo)
     fullPSync_->publishName(Name(prefix).appendNumber(newSequenceNo));
 }
 
+void
+FullPSync2017WithUsers::Impl::publishNames
+  (const vector<pair<Name, int> >& updates)
+{
+  vector<Name> names;
+  names.reserve(updates.size());
+  // The key is the prefix. The value is the index in names. This is used if
+  // the same prefix is updated more than once.
+  map<Name, size_t> nameIndex;
+  for (vector<pair<Name, int> >::const_iterator update = updates.begin();
+       update != updates.end(); ++update) {
+    const Name& prefix = update->first;
+    if (!prefixes_->isUserNode(prefix)) {
+      _LOG_ERROR("Prefix not added: " << prefix);
+      continue;
+    }
+
+    int newSequenceNo = update->second >= 0 ?
+      update->second : prefixes_->prefixes_[prefix] + 1;
+
+    _LOG_INFO("Publish: " << prefix << "/" << newSequenceNo);
+    if (!updateSequenceNo(prefix, newSequenceNo))
+      continue;
+
+    map<Name, size_t>::iterator index = nameIndex.find(prefix);
+    if (index != nameIndex.end())
+      // The earlier sequence number is not in the IBLT yet, so replace it.
+      names[index->second] = Name(prefix).appendNumber(newSequenceNo);
+    else {
+      nameIndex[prefix] = names.size();
+      names.push_back(Name(prefix).appendNumber(newSequenceNo));
+    }
+  }
+
+  // Insert the new sequence numbers and satisfy pending Interests once.
+  if (names.size() > 0)
+    fullPSync_->publishNames(names);
+}
+
 bool
 FullPSync2017WithUsers::Impl::canAddReceivedName(const Name& name)
 {
@@ -126,7 +186,13 @@ FullPSync2017WithUsers::Impl::canAddReceivedName(const Name& name)
       if (oldSequenceNo != 0)
         // Remove the old sequence number from the IBLT before the caller adds
         // the new one.
-        fullPSync_->removeName(Name(prefix).appendNumber(oldSequenceNo));
+        if (fullPSync_)
+          fullPSync_->removeName(Name(prefix).appendNumber(oldSequenceNo));
+        else
+          // An in-process forwarder replied to the first sync Interest while
+          // the restored FullPSync2017 is still being constructed.
+          constructionRemovedNames_.push_back
+            (Name(prefix).appendNumber(oldSequenceNo));
     }
 
     return true;
@@ -170,18 +236,11 @@ FullPSync2017WithUsers::Impl::isNotFutureHash
 {
   Name prefix = name.getPrefix(-1);
 
-  string uri = Name(prefix).appendNumber(prefixes_->prefixes_[prefix] + 1).toUri();
-  uint32_t nextHash = CryptoLite::murmurHash3
-    (InvertibleBloomLookupTable::N_HASHCHECK, uri.data(), uri.size());
-
-  for (set<uint32_t>::iterator negativeHash = negative.begin();
-       negativeHash != negative.end();
-       ++negativeHash) {
-    if (*negativeHash == nextHash)
-      return false;
-  }
+  uint32_t nextHash = PSyncProducerBase::computeNameHash
+    (Name(prefix).appendNumber(prefixes_->prefixes_[prefix] + 1),
+     hashNameWireEncoding_);
 
-  return true;
+  return negative.find(nextHash) == negative.end();
 }
 
 bool
@@ -38,11 +38,13 @@
 
 #include <ndn-ind/util/logging.hpp>
 #include <ndn-ind/lite/util/crypto-lite.hpp>
+#include "../c/util/ndn_memory.h"
 #include "./detail/psync-segment-publisher.hpp"
 #include "./detail/invertible-bloom-lookup-table.hpp"
 #include "./detail/psync-state.hpp"
 #include "./detail/psync-segment-publisher.hpp"
 #include "./detail/invertible-bloom-lookup-table.hpp"
+#include <ndn-ind/sync/sync-state-storage.hpp>
 #include <ndn-ind/sync/full-psync2017.hpp>
 
 using namespace std;
@@ -58,18 +60,34 @@ FullPSync2017::Impl::Impl
    const OnNamesUpdate& onNamesUpdate, KeyChain& keyChain,
    nanoseconds syncInterestLifetime, nanoseconds syncReplyFreshnessPeriod,
    const SigningInfo& signingInfo, const CanAddToSyncData& canAddToSyncData,
-   const CanAddReceivedName& canAddReceivedName)
-: PSyncProducerBase(expectedNEntries, syncPrefix, syncReplyFreshnessPeriod),
+   const CanAddReceivedName& canAddReceivedName, size_t nPartitions,
+   const ptr_lib::shared_ptr<SyncStateStorage>& stateStorage)
+: PSyncProducerBase
+    (expectedNEntries, syncPrefix, syncReplyFreshnessPeriod, nPartitions),
   face_(face), keyChain_(keyChain), syncInterestLifetime_(syncInterestLifetime),
   signingInfo_(signingInfo), onNamesUpdate_(onNamesUpdate),
   canAddToSyncData_(canAddToSyncData), canAddReceivedName_(canAddReceivedName),
-  segmentPublisher_(new PSyncSegmentPublisher(face_, keyChain_))
+  segmentPublisher_(new PSyncSegmentPublisher(face_, keyChain_)),
+  syncInterestGeneration_(0), nPendingPartitionFetches_(0),
+  havePartitionUpdates_(false),
+  differenceIblt_(new InvertibleBloomLookupTable(expectedNEntries)),
+  stateStorage_(stateStorage)
 {
 }
 
 void
 FullPSync2017::Impl::initialize()
 {
+  if (stateStorage_) {
+    // Restore the names from before a restart so that the first sync Interest
+    // only needs to reconcile the names which changed.
+    vector<Name> names;
+    stateStorage_->getPSyncNames(syncPrefix_, names);
+    for (size_t i = 0; i < names.size(); ++i)
+      insertIntoIblt(names[i]);
+    _LOG_DEBUG("Restored " << names.size() << " names from the state storage");
+  }
+
   registeredPrefix_ = face_.registerPrefix
     (syncPrefix_,
      bind(&FullPSync2017::Impl::onSyncInterest,
@@ -91,9 +109,42 @@ FullPSync2017::Impl::publishName(const Name& name)
 
   _LOG_INFO("Publish: " << name);
   insertIntoIblt(name);
+  if (stateStorage_)
+    stateStorage_->addPSyncNames(syncPrefix_, vector<Name>(1, name));
   satisfyPendingInterests();
 }
 
+void
+FullPSync2017::Impl::publishNames(const vector<Name>& names)
+{
+  vector<Name> insertedNames;
+  for (vector<Name>::const_iterator name = names.begin();
+       name != names.end(); ++name) {
+    if (nameToHash_.find(*name) != nameToHash_.end()) {
+      _LOG_DEBUG("Already published, ignoring: " << *name);
+      continue;
+    }
+
+    _LOG_INFO("Publish: " << *name);
+    insertIntoIblt(*name);
+    insertedNames.push_back(*name);
+  }
+
+  if (insertedNames.size() > 0) {
+    if (stateStorage_)
+      stateStorage_->addPSyncNames(syncPrefix_, insertedNames);
+    satisfyPendingInterests();
+  }
+}
+
+void
+FullPSync2017::Impl::removeName(const Name& name)
+{
+  removeFromIblt(name);
+  if (stateStorage_)
+    stateStorage_->removePSyncName(syncPrefix_, name);
+}
+
 void
 FullPSync2017::Impl::sendSyncInterest()
 {
@@ -107,10 +158,14 @@ FullPSync2017::Impl::sendSyncInterest()
 #endif
 
   // Sync Interest format for full sync: /<sync-prefix>/<ourLatestIBF>
+  // or, if partitioned: /<sync-prefix>/<ourLatestPartitionDigests>
   Name syncInterestName(syncPrefix_);
 
-  // Append our latest IBLT.
-  syncInterestName.append(iblt_->encode());
+  // Append our latest IBLT or partition digests.
+  if (nPartitions_ > 1)
+    syncInterestName.append(encodePartitionDigests());
+  else
+    syncInterestName.append(iblt_->encode());
 
   outstandingInterestName_ = syncInterestName;
 
@@ -121,10 +176,55 @@ FullPSync2017::Impl::sendSyncInterest()
   double lifetimeMilliseconds = toMilliseconds(syncInterestLifetime_);
   double jitter = (random1 - 0.5) * (lifetimeMilliseconds * 0.2);
 
+  // Each call to sendSyncInterest starts a new timer, so use the generation
+  // to ignore the timer from an earlier call.
+  ++syncInterestGeneration_;
   face_.callLater
     (fromMilliseconds(lifetimeMilliseconds / 2 + jitter),
-     bind(&FullPSync2017::Impl::sendSyncInterest,
-          static_pointer_cast<FullPSync2017::Impl>(shared_from_this())));
+     bind(&FullPSync2017::Impl::onSyncInterestTimer,
+          static_pointer_cast<FullPSync2017::Impl>(shared_from_this()),
+          syncInterestGeneration_));
+
+  ptr_lib::shared_ptr<Interest> syncInterest
+    (ptr_lib::make_shared<Interest>(syncInterestName));
+  syncInterest->setInterestLifetime(syncInterestLifetime_);
+  syncInterest->setNonce(Blob((const uint8_t*)"0000", 4));
+  syncInterest->refreshNonce();
+
+  if (nPartitions_ > 1)
+    SegmentFetcher::fetch
+      (face_, *syncInterest, SegmentFetcher::DontVerifySegment,
+       bind(&FullPSync2017::Impl::onSyncDigestsData,
+            static_pointer_cast<FullPSync2017::Impl>(shared_from_this()), _1, syncInterest),
+       &FullPSync2017::Impl::onError);
+  else
+    SegmentFetcher::fetch
+      (face_, *syncInterest, SegmentFetcher::DontVerifySegment,
+       bind(&FullPSync2017::Impl::onSyncData,
+            static_pointer_cast<FullPSync2017::Impl>(shared_from_this()), _1, syncInterest),
+       &FullPSync2017::Impl::onError);
+
+  _LOG_DEBUG("sendFullSyncInterest, nonce: " << syncInterest->getNonce().toHex() <<
+             ", hash: " << syncInterestName.hash());
+}
+
+void
+FullPSync2017::Impl::onSyncInterestTimer(uint64_t generation)
+{
+  if (generation != syncInterestGeneration_)
+    // sendSyncInterest was called since this timer was scheduled.
+    return;
+
+  sendSyncInterest();
+}
+
+void
+FullPSync2017::Impl::sendPartitionSyncInterest(size_t partition)
+{
+  // Sync Interest format for a partition: /<sync-prefix>/<partition>/<ourLatestIBF>
+  Name syncInterestName(syncPrefix_);
+  syncInterestName.appendNumber(partition);
+  syncInterestName.append(partitionIblts_[partition]->encode());
 
   ptr_lib::shared_ptr<Interest> syncInterest
     (ptr_lib::make_shared<Interest>(syncInterestName));
@@ -132,14 +232,39 @@ FullPSync2017::Impl::sendSyncInterest()
   syncInterest->setNonce(Blob((const uint8_t*)"0000", 4));
   syncInterest->refreshNonce();
 
+  ++nPendingPartitionFetches_;
   SegmentFetcher::fetch
     (face_, *syncInterest, SegmentFetcher::DontVerifySegment,
-     bind(&FullPSync2017::Impl::onSyncData,
+     bind(&FullPSync2017::Impl::onPartitionSyncData,
           static_pointer_cast<FullPSync2017::Impl>(shared_from_this()), _1, syncInterest),
-     &FullPSync2017::Impl::onError);
+     bind(&FullPSync2017::Impl::onPartitionError,
+          static_pointer_cast<FullPSync2017::Impl>(shared_from_this()), _1, _2));
 
-  _LOG_DEBUG("sendFullSyncInterest, nonce: " << syncInterest->getNonce().toHex() <<
-             ", hash: " << syncInterestName.hash());
+  _LOG_DEBUG("sendPartitionSyncInterest, partition: " << partition <<
+             ", nonce: " << syncInterest->getNonce().toHex());
+}
+
+Blob
+FullPSync2017::Impl::encodePartitionDigests() const
+{
+  ptr_lib::shared_ptr<vector<uint8_t>> digests
+    (new vector<uint8_t>(8 * nPartitions_));
+  uint8_t* digest = digests->data();
+  for (size_t i = 0; i < nPartitions_; ++i) {
+    uint32_t count = partitionCounts_[i];
+    uint32_t checkSum = partitionCheckSums_[i];
+    digest[0] = 0xFF & count;
+    digest[1] = 0xFF & (count >> 8);
+    digest[2] = 0xFF & (count >> 16);
+    digest[3] = 0xFF & (count >> 24);
+    digest[4] = 0xFF & checkSum;
+    digest[5] = 0xFF & (checkSum >> 8);
+    digest[6] = 0xFF & (checkSum >> 16);
+    digest[7] = 0xFF & (checkSum >> 24);
+    digest += 8;
+  }
+
+  return Blob(digests, false);
 }
 
 void
@@ -161,6 +286,36 @@ FullPSync2017::Impl::onSyncInterest
     return;
 
   Name nameWithoutSyncPrefix = interest->getName().getSubName(prefixName->size());
+
+  if (nPartitions_ > 1) {
+    if (nameWithoutSyncPrefix.size() == 1)
+      // /<prefix>/<partition-digests>
+      processSyncDigests(interest, nameWithoutSyncPrefix.get(0).getValue());
+    else if (nameWithoutSyncPrefix.size() == 2) {
+      // /<prefix>/<partition>/<IBLT>
+      if (!nameWithoutSyncPrefix.get(0).isGeneric())
+        return;
+      uint64_t partition = nameWithoutSyncPrefix.get(0).toNumber();
+      if (partition >= nPartitions_) {
+        _LOG_ERROR("The sync Interest partition is out of range: " << partition);
+        return;
+      }
+
+      ptr_lib::shared_ptr<InvertibleBloomLookupTable> iblt
+        (new InvertibleBloomLookupTable(partitionExpectedNEntries_));
+      try {
+        iblt->initialize(nameWithoutSyncPrefix.get(1).getValue());
+      } catch (const std::exception& ex) {
+        _LOG_ERROR(ex.what());
+        return;
+      }
+
+      processSyncIblt(interest, interest->getName(), iblt, (int)partition);
+    }
+
+    return;
+  }
+
   Name interestName;
 
   if (nameWithoutSyncPrefix.size() == 1)
@@ -186,26 +341,39 @@ FullPSync2017::Impl::onSyncInterest
     return;
   }
 
-  ptr_lib::shared_ptr<InvertibleBloomLookupTable> difference =
-   iblt_->difference(*iblt);
+  processSyncIblt(interest, interestName, iblt, -1);
+}
+
+void
+FullPSync2017::Impl::processSyncIblt
+  (const ptr_lib::shared_ptr<const Interest>& interest, const Name& interestName,
+   const ptr_lib::shared_ptr<InvertibleBloomLookupTable>& iblt, int partition)
+{
+  const InvertibleBloomLookupTable& ownIblt =
+    partition < 0 ? *iblt_ : *partitionIblts_[partition];
+  size_t threshold = partition < 0 ? threshold_ : partitionThreshold_;
 
-  set<uint32_t> positive;
-  set<uint32_t> negative;
+  ownIblt.difference(*iblt, *differenceIblt_);
+  vector<uint32_t>& positive = positive_;
+  vector<uint32_t>& negative = negative_;
 
-  if (!difference->listEntries(positive, negative)) {
+  if (!differenceIblt_->peelEntries(positive, negative)) {
     _LOG_TRACE("Cannot decode differences, positive: " << positive.size() <<
             " negative: " << negative.size() << " threshold: " <<
-            threshold_);
+            threshold);
 
-    // Send all data if greater than the threshold, or if there are neither
-    // positive nor negative differences. Otherwise, continue below and send
-    // the positive as usual.
-    if (positive.size() + negative.size() >= threshold_ ||
+    // Send all data (in the partition) if greater than the threshold, or if
+    // there are neither positive nor negative differences. Otherwise, continue
+    // below and send the positive as usual.
+    if (positive.size() + negative.size() >= threshold ||
         (positive.size() == 0 && negative.size() == 0)) {
       PSyncState state1;
-      for (map<Name, uint32_t>::iterator entry = nameToHash_.begin();
-           entry != nameToHash_.end(); ++entry)
-        state1.addContent(entry->first);
+      for (unordered_map<Name, uint32_t, NameHash>::iterator entry =
+             nameToHash_.begin();
+           entry != nameToHash_.end(); ++entry) {
+        if (partition < 0 || getPartition(entry->second) == (size_t)partition)
+          state1.addContent(entry->first);
+      }
 
       if (state1.getContent().size() > 0)
         segmentPublisher_->publish
@@ -216,14 +384,20 @@ FullPSync2017::Impl::onSyncInterest
     }
   }
 
+  // Only make the set for canAddToSyncData_ if needed. Since negative is
+  // sorted, this is linear.
+  set<uint32_t> negativeSet;
+  if (canAddToSyncData_)
+    negativeSet.insert(negative.begin(), negative.end());
+
   PSyncState state;
-  for (set<uint32_t>::iterator hash = positive.begin(); hash != positive.end();
+  for (vector<uint32_t>::iterator hash = positive.begin(); hash != positive.end();
        ++hash) {
-    Name name = hashToName_[*hash];
+    unordered_map<uint32_t, Name>::iterator name = hashToName_.find(*hash);
 
-    if (nameToHash_.find(name) != nameToHash_.end()) {
-      if (!canAddToSyncData_ || canAddToSyncData_(name, negative))
-        state.addContent(name);
+    if (name != hashToName_.end()) {
+      if (!canAddToSyncData_ || canAddToSyncData_(name->second, negativeSet))
+        state.addContent(name->second);
     }
   }
 
@@ -233,7 +407,8 @@ FullPSync2017::Impl::onSyncInterest
     return;
   }
 
-  ptr_lib::shared_ptr<PendingEntryInfoFull> entry(new PendingEntryInfoFull(iblt));
+  ptr_lib::shared_ptr<PendingEntryInfoFull> entry
+    (new PendingEntryInfoFull(iblt, partition));
   pendingEntries_[interestName] = entry;
   face_.callLater
     (interest->getInterestLifetime(),
@@ -242,13 +417,68 @@ FullPSync2017::Impl::onSyncInterest
           interest->getName(), entry, interest->getNonce()));
 }
 
+void
+FullPSync2017::Impl::processSyncDigests
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const Blob& partitionDigests)
+{
+  _LOG_DEBUG("Partition digests sync Interest received, nonce: " <<
+             interest->getNonce().toHex());
+
+  if (partitionDigests.size() != 8 * nPartitions_) {
+    _LOG_ERROR("The sync Interest does not have digests for " << nPartitions_ <<
+               " partitions");
+    return;
+  }
+
+  Blob ownPartitionDigests = encodePartitionDigests();
+  if (!ownPartitionDigests.equals(partitionDigests)) {
+    sendSyncData(interest->getName(), ownPartitionDigests);
+    return;
+  }
+
+  ptr_lib::shared_ptr<PendingEntryInfoFull> entry
+    (new PendingEntryInfoFull(partitionDigests));
+  pendingEntries_[interest->getName()] = entry;
+  face_.callLater
+    (interest->getInterestLifetime(),
+     bind(&FullPSync2017::Impl::delayedRemovePendingEntry,
+          static_pointer_cast<FullPSync2017::Impl>(shared_from_this()),
+          interest->getName(), entry, interest->getNonce()));
+}
+
+void
+FullPSync2017::Impl::onSyncDigestsData
+  (Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest)
+{
+  deletePendingInterests(interest->getName());
+
+  if (encodedContent.size() != 8 * nPartitions_) {
+    _LOG_ERROR("The sync Data does not have digests for " << nPartitions_ <<
+               " partitions");
+    return;
+  }
+
+  // Reconcile each partition with a different digest. finishPartitionFetch
+  // renews the sync Interest once after all of these are fetched.
+  Blob ownPartitionDigests = encodePartitionDigests();
+  for (size_t i = 0; i < nPartitions_; ++i) {
+    if (ndn_memcmp(encodedContent.buf() + 8 * i,
+                   ownPartitionDigests.buf() + 8 * i, 8) != 0)
+      sendPartitionSyncInterest(i);
+  }
+}
+
 void
 FullPSync2017::Impl::sendSyncData(const Name& name, Blob content)
 {
   _LOG_DEBUG("Checking if the Data will satisfy our own pending interest");
 
   Name nameWithIblt;
-  nameWithIblt.append(iblt_->encode());
+  if (nPartitions_ > 1)
+    nameWithIblt.append(encodePartitionDigests());
+  else
+    nameWithIblt.append(iblt_->encode());
 
   // Append the hash of our IBLT so that the Data name should be different for
   // each node.
@@ -289,18 +519,43 @@ FullPSync2017::Impl::satisfyPendingInterests()
 {
   _LOG_DEBUG("Satisfying full sync Interest: " << pendingEntries_.size());
 
+  Blob ownPartitionDigests;
+  if (nPartitions_ > 1)
+    ownPartitionDigests = encodePartitionDigests();
+
+  // Send the replies after the loop, since sending can synchronously deliver
+  // a sync Interest or Data which changes pendingEntries_, for example with an
+  // in-process forwarder.
+  vector<pair<Name, Blob> > replies;
   for (map<Name, ptr_lib::shared_ptr<PendingEntryInfoFull> >::iterator it =
          pendingEntries_.begin();
        it != pendingEntries_.end();) {
-    const InvertibleBloomLookupTable& entryIblt = *it->second->iblt_;
-    ptr_lib::shared_ptr<InvertibleBloomLookupTable> difference =
-            iblt_->difference(entryIblt);
-    set<uint32_t> positive;
-    set<uint32_t> negative;
+    if (!it->second->iblt_) {
+      // A sync Interest with partition digests.
+      if (!ownPartitionDigests.equals(it->second->partitionDigests_)) {
+        _LOG_DEBUG("Satisfying sync Interest with partition digests");
+        replies.push_back(make_pair(it->first, ownPartitionDigests));
+        // Prevent delayedRemovePendingEntry from removing a new entry with the same Name.
+        it->second->isRemoved_ = true;
+        pendingEntries_.erase(it++);
+      }
+      else
+        ++it;
+
+      continue;
+    }
+
+    int partition = it->second->partition_;
+    const InvertibleBloomLookupTable& ownIblt =
+      partition < 0 ? *iblt_ : *partitionIblts_[partition];
+    size_t threshold = partition < 0 ? threshold_ : partitionThreshold_;
+    ownIblt.difference(*it->second->iblt_, *differenceIblt_);
+    vector<uint32_t>& positive = positive_;
+    vector<uint32_t>& negative = negative_;
 
-    if (!difference->listEntries(positive, negative)) {
+    if (!differenceIblt_->peelEntries(positive, negative)) {
       _LOG_TRACE("Decode failed for pending interest");
-      if (positive.size() + negative.size() >= threshold_ ||
+      if (positive.size() + negative.size() >= threshold ||
           (positive.size() == 0 && negative.size() == 0)) {
         _LOG_TRACE
           ("positive + negative > threshold or no difference can be found. Erase pending interest.");
@@ -312,17 +567,17 @@ FullPSync2017::Impl::satisfyPendingInterests()
     }
 
     PSyncState state;
-    for (set<uint32_t>::iterator hash = positive.begin(); hash != positive.end();
+    for (vector<uint32_t>::iterator hash = positive.begin(); hash != positive.end();
          ++hash) {
-      Name name = hashToName_[*hash];
+      unordered_map<uint32_t, Name>::iterator name = hashToName_.find(*hash);
 
-      if (nameToHash_.find(name) != nameToHash_.end())
-        state.addContent(name);
+      if (name != hashToName_.end())
+        state.addContent(name->second);
     }
 
     if (state.getContent().size() > 0) {
       _LOG_DEBUG("Satisfying sync content: " << state.toString());
-      sendSyncData(it->first, state.wireEncode());
+      replies.push_back(make_pair(it->first, state.wireEncode()));
       // Prevent delayedRemovePendingEntry from removing a new entry with the same Name.
       it->second->isRemoved_ = true;
       pendingEntries_.erase(it++);
@@ -330,6 +585,9 @@ FullPSync2017::Impl::satisfyPendingInterests()
     else
       ++it;
   }
+
+  for (size_t i = 0; i < replies.size(); ++i)
+    sendSyncData(replies[i].first, replies[i].second);
 }
 
 void
@@ -349,6 +607,53 @@ FullPSync2017::Impl::deletePendingInterests(const Name& interestName)
 void
 FullPSync2017::Impl::onSyncData
   (Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest)
+{
+  if (processSyncData(encodedContent, interest)) {
+    // We just got the data, so send a new sync Interest.
+    _LOG_TRACE("onSyncData: Renewing sync interest");
+    sendSyncInterest();
+  }
+}
+
+void
+FullPSync2017::Impl::onPartitionSyncData
+  (Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest)
+{
+  try {
+    if (processSyncData(encodedContent, interest))
+      havePartitionUpdates_ = true;
+  } catch (const std::exception& ex) {
+    // Still finish the fetch below so that the round can renew.
+    _LOG_ERROR("Error decoding the partition sync Data: " << ex.what());
+  }
+
+  finishPartitionFetch();
+}
+
+void
+FullPSync2017::Impl::onPartitionError
+  (SegmentFetcher::ErrorCode errorCode, const std::string& message)
+{
+  onError(errorCode, message);
+  finishPartitionFetch();
+}
+
+void
+FullPSync2017::Impl::finishPartitionFetch()
+{
+  if (nPendingPartitionFetches_ > 0)
+    --nPendingPartitionFetches_;
+  if (nPendingPartitionFetches_ > 0 || !havePartitionUpdates_)
+    return;
+
+  havePartitionUpdates_ = false;
+  _LOG_TRACE("finishPartitionFetch: Renewing sync interest");
+  sendSyncInterest();
+}
+
+bool
+FullPSync2017::Impl::processSyncData
+  (Blob encodedContent, ptr_lib::shared_ptr<Interest>& interest)
 {
   deletePendingInterests(interest->getName());
 
@@ -375,8 +680,11 @@ FullPSync2017::Impl::onSyncData
     }
   }
 
-  // We just got the data, so send a new sync Interest.
   if (names->size() > 0) {
+    // Save the names before onNamesUpdate_, which may remove some of them.
+    if (stateStorage_)
+      stateStorage_->addPSyncNames(syncPrefix_, *names);
+
     try {
       onNamesUpdate_(names);
     } catch (const std::exception& ex) {
@@ -385,11 +693,11 @@ FullPSync2017::Impl::onSyncData
       _LOG_ERROR("Error in onUpdate.");
     }
 
-    _LOG_TRACE("onSyncData: Renewing sync interest");
-    sendSyncInterest();
+    return true;
   } else {
     _LOG_TRACE("No new update, interest nonce: " << interest->getNonce().toHex() <<
             " , hash: " << interest->getName().hash());
+    return false;
   }
 }
 
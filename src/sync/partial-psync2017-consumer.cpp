@@ -0,0 +1,295 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+// Only compile if ndn-ind-config.h defines NDN_IND_HAVE_LIBZ 1.
+#include <ndn-ind/ndn-ind-config.h>
+#if NDN_IND_HAVE_LIBZ
+
+#include <ndn-ind/util/logging.hpp>
+#include "./detail/bloom-filter.hpp"
+#include "./detail/psync-state.hpp"
+#include <ndn-ind/sync/partial-psync2017-consumer.hpp>
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn::func_lib;
+
+INIT_LOGGER("ndn.PartialPSync2017Consumer");
+
+namespace ndn {
+
+PartialPSync2017Consumer::Impl::Impl
+  (const Name& syncPrefix, Face& face,
+   const OnReceiveHelloData& onReceiveHelloData, const OnUpdate& onUpdate,
+   size_t expectedNEntries, double falsePositiveProbability,
+   nanoseconds helloInterestLifetime, nanoseconds syncInterestLifetime)
+: syncPrefix_(syncPrefix), face_(face),
+  onReceiveHelloData_(onReceiveHelloData), onUpdate_(onUpdate),
+  bloomFilter_(new BloomFilter(expectedNEntries, falsePositiveProbability)),
+  helloInterestLifetime_(helloInterestLifetime),
+  syncInterestLifetime_(syncInterestLifetime),
+  haveIblt_(false), isRecoveringFromNack_(false), syncGeneration_(0)
+{
+}
+
+void
+PartialPSync2017Consumer::Impl::sendHelloInterest()
+{
+  Name helloInterestName(syncPrefix_);
+  helloInterestName.append("hello");
+
+  Interest helloInterest(helloInterestName);
+  helloInterest.setInterestLifetime(helloInterestLifetime_);
+  helloInterest.setNonce(Blob((const uint8_t*)"0000", 4));
+  helloInterest.refreshNonce();
+
+  _LOG_DEBUG("Send hello Interest " << helloInterestName);
+
+  ptr_lib::shared_ptr<FetchInfo> fetchInfo(new FetchInfo(0));
+  SegmentFetcher::fetch
+    (face_, helloInterest,
+     bind(&PartialPSync2017Consumer::Impl::verifySegment, _1, fetchInfo),
+     bind(&PartialPSync2017Consumer::Impl::onHelloData, shared_from_this(),
+          _1, fetchInfo),
+     bind(&PartialPSync2017Consumer::Impl::onHelloError, shared_from_this(),
+          _1, _2, fetchInfo));
+}
+
+void
+PartialPSync2017Consumer::Impl::sendSyncInterest()
+{
+  if (!haveIblt_) {
+    _LOG_ERROR("Cannot send a sync Interest before receiving the hello Data");
+    return;
+  }
+
+  // Sync Interest name: /<sync-prefix>/sync/<BF>/<IBLT>
+  Name syncInterestName(syncPrefix_);
+  syncInterestName.append("sync");
+  bloomFilter_->appendToName(syncInterestName);
+  syncInterestName.append(iblt_);
+
+  Interest syncInterest(syncInterestName);
+  syncInterest.setInterestLifetime(syncInterestLifetime_);
+  syncInterest.setNonce(Blob((const uint8_t*)"0000", 4));
+  syncInterest.refreshNonce();
+
+  _LOG_DEBUG("sendSyncInterest, nonce: " << syncInterest.getNonce().toHex() <<
+             ", hash: " << syncInterestName.hash());
+
+  ptr_lib::shared_ptr<FetchInfo> fetchInfo(new FetchInfo(++syncGeneration_));
+  SegmentFetcher::fetch
+    (face_, syncInterest,
+     bind(&PartialPSync2017Consumer::Impl::verifySegment, _1, fetchInfo),
+     bind(&PartialPSync2017Consumer::Impl::onSyncData, shared_from_this(),
+          _1, fetchInfo),
+     bind(&PartialPSync2017Consumer::Impl::onSyncError, shared_from_this(),
+          _1, _2, fetchInfo));
+}
+
+bool
+PartialPSync2017Consumer::Impl::addSubscription
+  (const Name& prefix, int sequenceNo)
+{
+  if (isSubscribed(prefix))
+    return false;
+
+  _LOG_DEBUG("Subscribing to: " << prefix);
+  subscriptions_[prefix] = sequenceNo;
+  bloomFilter_->insert(prefix);
+  return true;
+}
+
+bool
+PartialPSync2017Consumer::Impl::removeSubscription(const Name& prefix)
+{
+  map<Name, int>::iterator entry = subscriptions_.find(prefix);
+  if (entry == subscriptions_.end())
+    return false;
+
+  _LOG_DEBUG("Unsubscribing from: " << prefix);
+  subscriptions_.erase(entry);
+
+  // A Bloom filter cannot remove an entry, so rebuild it.
+  bloomFilter_->clear();
+  for (entry = subscriptions_.begin(); entry != subscriptions_.end(); ++entry)
+    bloomFilter_->insert(entry->first);
+  return true;
+}
+
+int
+PartialPSync2017Consumer::Impl::getSequenceNo(const Name& prefix) const
+{
+  map<Name, int>::const_iterator entry = subscriptions_.find(prefix);
+  if (entry == subscriptions_.end())
+    return -1;
+
+  return entry->second;
+}
+
+bool
+PartialPSync2017Consumer::Impl::verifySegment
+  (const ptr_lib::shared_ptr<Data>& data,
+   const ptr_lib::shared_ptr<FetchInfo>& fetchInfo)
+{
+  fetchInfo->dataName_ = data->getName();
+  if (data->getMetaInfo().getType() == ndn_ContentType_NACK) {
+    fetchInfo->isNack_ = true;
+    return false;
+  }
+
+  return true;
+}
+
+void
+PartialPSync2017Consumer::Impl::onHelloData
+  (const Blob& encodedContent, const ptr_lib::shared_ptr<FetchInfo>& fetchInfo)
+{
+  // The Data name is /<sync-prefix>/hello/<IBLT>/<version>/<segment>.
+  if (fetchInfo->dataName_.size() < 3) {
+    _LOG_ERROR("The hello Data name does not have the IBLT");
+    return;
+  }
+  iblt_ = fetchInfo->dataName_.get(-3);
+  haveIblt_ = true;
+
+  if (isRecoveringFromNack_) {
+    // Report any updates which were missed, and resume the sync Interests.
+    isRecoveringFromNack_ = false;
+    processUpdates(encodedContent);
+    sendSyncInterest();
+    return;
+  }
+
+  PSyncState state(encodedContent);
+  ptr_lib::shared_ptr<map<Name, int> > availableSubscriptions
+    (ptr_lib::make_shared<map<Name, int> >());
+
+  _LOG_DEBUG("Hello Data received: " << state.toString());
+
+  const std::vector<Name>& content = state.getContent();
+  for (vector<Name>::const_iterator contentName = content.begin();
+       contentName != content.end(); ++contentName)
+    (*availableSubscriptions)[contentName->getPrefix(-1)] =
+      (int)contentName->get(-1).toNumber();
+
+  try {
+    onReceiveHelloData_(availableSubscriptions);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("Error in onReceiveHelloData: " << ex.what());
+  } catch (...) {
+    _LOG_ERROR("Error in onReceiveHelloData.");
+  }
+}
+
+void
+PartialPSync2017Consumer::Impl::onSyncData
+  (const Blob& encodedContent, const ptr_lib::shared_ptr<FetchInfo>& fetchInfo)
+{
+  // The Data name is /<sync-prefix>/sync/<BF>/<old-IBLT>/<IBLT>/<version>/<segment>.
+  if (fetchInfo->dataName_.size() < 3) {
+    _LOG_ERROR("The sync Data name does not have the IBLT");
+    return;
+  }
+  iblt_ = fetchInfo->dataName_.get(-3);
+
+  processUpdates(encodedContent);
+
+  if (fetchInfo->generation_ == syncGeneration_) {
+    _LOG_TRACE("onSyncData: Renewing sync interest");
+    sendSyncInterest();
+  }
+}
+
+void
+PartialPSync2017Consumer::Impl::onHelloError
+  (SegmentFetcher::ErrorCode errorCode, const std::string& message,
+   const ptr_lib::shared_ptr<FetchInfo>& fetchInfo)
+{
+  _LOG_TRACE("Cannot fetch hello data, error: " << errorCode <<
+             " message: " << message);
+
+  if (isRecoveringFromNack_ && errorCode == SegmentFetcher::INTEREST_TIMEOUT)
+    // Keep trying to resume syncing.
+    sendHelloInterest();
+}
+
+void
+PartialPSync2017Consumer::Impl::onSyncError
+  (SegmentFetcher::ErrorCode errorCode, const std::string& message,
+   const ptr_lib::shared_ptr<FetchInfo>& fetchInfo)
+{
+  if (fetchInfo->generation_ != syncGeneration_)
+    // A later sync Interest replaced this one.
+    return;
+
+  if (fetchInfo->isNack_) {
+    _LOG_TRACE("Received an application Nack from the producer. Sending hello");
+    isRecoveringFromNack_ = true;
+    sendHelloInterest();
+    return;
+  }
+
+  _LOG_TRACE("Cannot fetch sync data, error: " << errorCode <<
+             " message: " << message);
+  if (errorCode == SegmentFetcher::INTEREST_TIMEOUT)
+    // The producer had no new data for the subscriptions.
+    sendSyncInterest();
+}
+
+void
+PartialPSync2017Consumer::Impl::processUpdates(const Blob& encodedContent)
+{
+  PSyncState state(encodedContent);
+  ptr_lib::shared_ptr<vector<ptr_lib::shared_ptr<PSyncMissingDataInfo>>> updates
+    (ptr_lib::make_shared<vector<ptr_lib::shared_ptr<PSyncMissingDataInfo>>>());
+
+  _LOG_DEBUG("Sync Data received: " << state.toString());
+
+  const std::vector<Name>& content = state.getContent();
+  for (vector<Name>::const_iterator contentName = content.begin();
+       contentName != content.end(); ++contentName) {
+    Name prefix = contentName->getPrefix(-1);
+    int sequenceNo = (int)contentName->get(-1).toNumber();
+
+    // A name which is not subscribed is a Bloom filter false positive.
+    map<Name, int>::iterator entry = subscriptions_.find(prefix);
+    if (entry != subscriptions_.end() && entry->second < sequenceNo) {
+      updates->push_back(ptr_lib::make_shared<PSyncMissingDataInfo>
+        (prefix, entry->second + 1, sequenceNo));
+      entry->second = sequenceNo;
+    }
+  }
+
+  if (updates->size() == 0)
+    return;
+
+  try {
+    onUpdate_(updates);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("Error in onUpdate: " << ex.what());
+  } catch (...) {
+    _LOG_ERROR("Error in onUpdate.");
+  }
+}
+
+}
+
+#endif // NDN_IND_HAVE_LIBZ
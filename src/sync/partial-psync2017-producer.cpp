@@ -0,0 +1,293 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+// Only compile if ndn-ind-config.h defines NDN_IND_HAVE_LIBZ 1.
+#include <ndn-ind/ndn-ind-config.h>
+#if NDN_IND_HAVE_LIBZ
+
+#include <ndn-ind/util/logging.hpp>
+#include "./detail/invertible-bloom-lookup-table.hpp"
+#include "./detail/bloom-filter.hpp"
+#include "./detail/psync-state.hpp"
+#include "./detail/psync-segment-publisher.hpp"
+#include "./detail/psync-user-prefixes.hpp"
+#include <ndn-ind/sync/partial-psync2017-producer.hpp>
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn::func_lib;
+
+INIT_LOGGER("ndn.PartialPSync2017Producer");
+
+namespace ndn {
+
+static const Name::Component HELLO_COMPONENT("hello");
+static const Name::Component SYNC_COMPONENT("sync");
+
+PartialPSync2017Producer::Impl::Impl
+  (size_t expectedNEntries, Face& face, const Name& syncPrefix,
+   KeyChain& keyChain, nanoseconds helloReplyFreshnessPeriod,
+   nanoseconds syncReplyFreshnessPeriod, const SigningInfo& signingInfo)
+: PSyncProducerBase(expectedNEntries, syncPrefix, syncReplyFreshnessPeriod),
+  face_(face), keyChain_(keyChain),
+  helloReplyFreshnessPeriod_(helloReplyFreshnessPeriod),
+  signingInfo_(signingInfo),
+  segmentPublisher_(new PSyncSegmentPublisher(face_, keyChain_)),
+  prefixes_(new PSyncUserPrefixes()),
+  differenceIblt_(new InvertibleBloomLookupTable(expectedNEntries))
+{
+}
+
+void
+PartialPSync2017Producer::Impl::initialize(const Name& userPrefix)
+{
+  if (userPrefix.size() > 0)
+    addUserNode(userPrefix);
+
+  registeredPrefix_ = face_.registerPrefix
+    (syncPrefix_,
+     bind(&PartialPSync2017Producer::Impl::onInterest,
+     static_pointer_cast<PartialPSync2017Producer::Impl>(shared_from_this()),
+     _1, _2, _3, _4, _5),
+     &PSyncProducerBase::onRegisterFailed);
+}
+
+int
+PartialPSync2017Producer::Impl::getSequenceNo(const Name& prefix) const
+{
+  return prefixes_->getSequenceNo(prefix);
+}
+
+bool
+PartialPSync2017Producer::Impl::addUserNode(const Name& prefix)
+{
+  return prefixes_->addUserNode(prefix);
+}
+
+void
+PartialPSync2017Producer::Impl::removeUserNode(const Name& prefix)
+{
+  if (prefixes_->isUserNode(prefix)) {
+    int sequenceNo = prefixes_->prefixes_[prefix];
+    prefixes_->removeUserNode(prefix);
+    removeFromIblt(Name(prefix).appendNumber(sequenceNo));
+  }
+}
+
+void
+PartialPSync2017Producer::Impl::publishName(const Name& prefix, int sequenceNo)
+{
+  if (!prefixes_->isUserNode(prefix)) {
+    _LOG_ERROR("Prefix not added: " << prefix);
+    return;
+  }
+
+  int newSequenceNo = sequenceNo >= 0 ? sequenceNo : prefixes_->prefixes_[prefix] + 1;
+
+  _LOG_INFO("Publish: " << prefix << "/" << newSequenceNo);
+  int oldSequenceNo;
+  if (!prefixes_->updateSequenceNo(prefix, newSequenceNo, oldSequenceNo))
+    return;
+
+  // We don't insert a zero sequence number into the IBLT.
+  if (oldSequenceNo != 0)
+    removeFromIblt(Name(prefix).appendNumber(oldSequenceNo));
+  insertIntoIblt(Name(prefix).appendNumber(newSequenceNo));
+
+  satisfyPendingInterests(prefix);
+}
+
+void
+PartialPSync2017Producer::Impl::onInterest
+  (const ptr_lib::shared_ptr<const Name>& prefixName,
+   const ptr_lib::shared_ptr<const Interest>& interest, Face& face,
+   uint64_t interestFilterId,
+   const ptr_lib::shared_ptr<const InterestFilter>& filter)
+{
+  if (segmentPublisher_->replyFromStore(interest->getName()))
+    return;
+
+  Name nameWithoutSyncPrefix = interest->getName().getSubName(prefixName->size());
+  if (nameWithoutSyncPrefix.size() == 0)
+    return;
+
+  if (nameWithoutSyncPrefix.get(0).equals(HELLO_COMPONENT)) {
+    // Hello Interest name: /<sync-prefix>/hello
+    if (nameWithoutSyncPrefix.size() == 1)
+      onHelloInterest(interest, interest->getName());
+    else if (nameWithoutSyncPrefix.size() == 3)
+      // Remove the <version>/<segment-no> .
+      onHelloInterest(interest, interest->getName().getPrefix(-2));
+  }
+  else if (nameWithoutSyncPrefix.get(0).equals(SYNC_COMPONENT)) {
+    // Sync Interest name: /<sync-prefix>/sync/<BF>/<old-IBLT> where the Bloom
+    // filter has three components.
+    if (nameWithoutSyncPrefix.size() == 5)
+      onSyncInterest(interest, interest->getName());
+    else if (nameWithoutSyncPrefix.size() == 7)
+      // Remove the <version>/<segment-no> .
+      onSyncInterest(interest, interest->getName().getPrefix(-2));
+  }
+}
+
+void
+PartialPSync2017Producer::Impl::onHelloInterest
+  (const ptr_lib::shared_ptr<const Interest>& interest, const Name& interestName)
+{
+  _LOG_DEBUG("Hello Interest received, nonce: " << interest->getNonce().toHex());
+
+  PSyncState state;
+  for (map<Name, int>::const_iterator entry = prefixes_->prefixes_.begin();
+       entry != prefixes_->prefixes_.end(); ++entry)
+    state.addContent(Name(entry->first).appendNumber(entry->second));
+
+  _LOG_DEBUG("Sending hello content: " << state.toString());
+  Name helloDataName(interestName);
+  helloDataName.append(iblt_->encode());
+  segmentPublisher_->publish
+    (interest->getName(), helloDataName, state.wireEncode(),
+     helloReplyFreshnessPeriod_, signingInfo_);
+}
+
+void
+PartialPSync2017Producer::Impl::onSyncInterest
+  (const ptr_lib::shared_ptr<const Interest>& interest, const Name& interestName)
+{
+  _LOG_DEBUG("Partial sync Interest received, nonce: " <<
+             interest->getNonce().toHex());
+
+  ptr_lib::shared_ptr<BloomFilter> bloomFilter;
+  ptr_lib::shared_ptr<InvertibleBloomLookupTable> iblt
+    (new InvertibleBloomLookupTable(expectedNEntries_));
+  try {
+    bloomFilter.reset(new BloomFilter
+      (interestName.get(-4), interestName.get(-3), interestName.get(-2)));
+    iblt->initialize(interestName.get(-1).getValue());
+  } catch (const std::exception& ex) {
+    _LOG_ERROR(ex.what());
+    return;
+  }
+
+  iblt_->difference(*iblt, *differenceIblt_);
+  if (!differenceIblt_->peelEntries(positive_, negative_)) {
+    _LOG_TRACE("Cannot decode differences, positive: " << positive_.size() <<
+               " negative: " << negative_.size());
+    sendApplicationNack(interest);
+    return;
+  }
+
+  PSyncState state;
+  for (vector<uint32_t>::iterator hash = positive_.begin();
+       hash != positive_.end(); ++hash) {
+    unordered_map<uint32_t, Name>::iterator name = hashToName_.find(*hash);
+
+    if (name != hashToName_.end() &&
+        bloomFilter->contains(name->second.getPrefix(-1)))
+      state.addContent(name->second);
+  }
+
+  if (state.getContent().size() > 0) {
+    _LOG_DEBUG("Sending sync content: " << state.toString());
+    Name syncDataName(interestName);
+    syncDataName.append(iblt_->encode());
+    segmentPublisher_->publish
+      (interest->getName(), syncDataName, state.wireEncode(),
+       syncReplyFreshnessPeriod_, signingInfo_);
+    return;
+  }
+
+  ptr_lib::shared_ptr<PendingEntryInfo> entry(new PendingEntryInfo(bloomFilter));
+  pendingEntries_[interestName] = entry;
+  face_.callLater
+    (interest->getInterestLifetime(),
+     bind(&PartialPSync2017Producer::Impl::delayedRemovePendingEntry,
+          static_pointer_cast<PartialPSync2017Producer::Impl>(shared_from_this()),
+          interestName, entry));
+}
+
+void
+PartialPSync2017Producer::Impl::satisfyPendingInterests(const Name& prefix)
+{
+  _LOG_DEBUG("Satisfying partial sync Interest: " << pendingEntries_.size());
+
+  Name name(prefix);
+  name.appendNumber(prefixes_->prefixes_[prefix]);
+
+  // Collect the replies and send them after the loop, since sending can
+  // synchronously deliver an Interest which changes pendingEntries_, for
+  // example with an in-process forwarder.
+  vector<Name> interestNames;
+  for (map<Name, ptr_lib::shared_ptr<PendingEntryInfo> >::iterator it =
+         pendingEntries_.begin();
+       it != pendingEntries_.end();) {
+    if (it->second->bloomFilter_->contains(prefix)) {
+      interestNames.push_back(it->first);
+      // Prevent delayedRemovePendingEntry from removing a new entry with the same Name.
+      it->second->isRemoved_ = true;
+      pendingEntries_.erase(it++);
+    }
+    else
+      ++it;
+  }
+
+  if (interestNames.size() == 0)
+    return;
+
+  PSyncState state;
+  state.addContent(name);
+  Blob content = state.wireEncode();
+  Name::Component ibltComponent(iblt_->encode());
+  for (size_t i = 0; i < interestNames.size(); ++i) {
+    _LOG_DEBUG("Satisfying sync content: " << state.toString());
+    segmentPublisher_->publish
+      (interestNames[i], Name(interestNames[i]).append(ibltComponent), content,
+       syncReplyFreshnessPeriod_, signingInfo_);
+  }
+}
+
+void
+PartialPSync2017Producer::Impl::sendApplicationNack
+  (const ptr_lib::shared_ptr<const Interest>& interest)
+{
+  _LOG_DEBUG("Sending application Nack");
+  Data nack(interest->getName());
+  nack.getMetaInfo().setType(ndn_ContentType_NACK);
+  nack.getMetaInfo().setFreshnessPeriod(syncReplyFreshnessPeriod_);
+  keyChain_.sign(nack, signingInfo_);
+  face_.putData(nack);
+}
+
+void
+PartialPSync2017Producer::Impl::delayedRemovePendingEntry
+  (const Name& name, const ptr_lib::shared_ptr<PendingEntryInfo>& entry)
+{
+  if (entry->isRemoved_)
+    // A previous operation already removed this entry, so don't try again to
+    // remove the entry with the Name in case it is a new entry.
+    return;
+
+  _LOG_TRACE("Remove Pending Interest " << name);
+  entry->isRemoved_ = true;
+  pendingEntries_.erase(name);
+}
+
+}
+
+#endif // NDN_IND_HAVE_LIBZ
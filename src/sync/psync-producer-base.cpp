@@ -36,8 +36,10 @@
 #include <ndn-ind/ndn-ind-config.h>
 #if NDN_IND_HAVE_LIBZ
 
+#include <stdexcept>
 #include <ndn-ind/util/logging.hpp>
 #include <ndn-ind/lite/util/crypto-lite.hpp>
+#include <ndn-ind/encoding/tlv-wire-format.hpp>
 #include "./detail/invertible-bloom-lookup-table.hpp"
 #include <ndn-ind/sync/psync-producer-base.hpp>
 
@@ -50,36 +52,123 @@ namespace ndn {
 
 PSyncProducerBase::PSyncProducerBase
   (size_t expectedNEntries, const Name& syncPrefix,
-   nanoseconds syncReplyFreshnessPeriod)
+   nanoseconds syncReplyFreshnessPeriod, size_t nPartitions)
 : iblt_(new InvertibleBloomLookupTable(expectedNEntries)),
   expectedNEntries_(expectedNEntries),
   threshold_(expectedNEntries / 2),
   syncPrefix_(syncPrefix),
-  syncReplyFreshnessPeriod_(syncReplyFreshnessPeriod)
+  syncReplyFreshnessPeriod_(syncReplyFreshnessPeriod),
+  hashNameWireEncoding_(false),
+  nPartitions_(nPartitions)
 {
+  if (nPartitions_ == 0)
+    throw runtime_error("PSyncProducerBase: nPartitions must be at least 1");
+
+  // Round up so that each partition has at least one expected entry.
+  partitionExpectedNEntries_ =
+    (expectedNEntries + nPartitions_ - 1) / nPartitions_;
+  partitionThreshold_ = partitionExpectedNEntries_ / 2;
+  if (nPartitions_ > 1) {
+    for (size_t i = 0; i < nPartitions_; ++i)
+      partitionIblts_.push_back(ptr_lib::make_shared<InvertibleBloomLookupTable>
+        (partitionExpectedNEntries_));
+    partitionCounts_.resize(nPartitions_, 0);
+    partitionCheckSums_.resize(nPartitions_, 0);
+  }
+}
+
+uint32_t
+PSyncProducerBase::computeNameHash(const Name& name, bool hashNameWireEncoding)
+{
+  if (hashNameWireEncoding) {
+    Blob encoding = name.wireEncode(*TlvWireFormat::get());
+    return CryptoLite::murmurHash3
+      (InvertibleBloomLookupTable::N_HASHCHECK, encoding.buf(), encoding.size());
+  }
+  else {
+    string uri = name.toUri();
+    return CryptoLite::murmurHash3
+      (InvertibleBloomLookupTable::N_HASHCHECK, uri.data(), uri.size());
+  }
 }
 
 void
 PSyncProducerBase::insertIntoIblt(const Name& name)
 {
-  string uri = name.toUri();
-  uint32_t newHash = CryptoLite::murmurHash3
-    (InvertibleBloomLookupTable::N_HASHCHECK, uri.data(), uri.size());
+  uint32_t newHash = computeNameHash(name, hashNameWireEncoding_);
   nameToHash_[name] = newHash;
   hashToName_[newHash] = name;
-  iblt_->insert(newHash);
+  insertHash(newHash);
 }
 
 void
 PSyncProducerBase::removeFromIblt(const Name& name)
 {
-  map<Name, uint32_t>::iterator hashEntry = nameToHash_.find(name);
+  unordered_map<Name, uint32_t, NameHash>::iterator hashEntry =
+    nameToHash_.find(name);
   if (hashEntry != nameToHash_.end()) {
     uint32_t hash = hashEntry->second;
     nameToHash_.erase(hashEntry);
     hashToName_.erase(hash);
+    eraseHash(hash);
+  }
+}
+
+void
+PSyncProducerBase::setIbltCompressionLevel(int compressionLevel)
+{
+  iblt_->setCompressionLevel(compressionLevel);
+  for (size_t i = 0; i < partitionIblts_.size(); ++i)
+    partitionIblts_[i]->setCompressionLevel(compressionLevel);
+}
+
+void
+PSyncProducerBase::setHashNameWireEncoding(bool hashNameWireEncoding)
+{
+  if (hashNameWireEncoding == hashNameWireEncoding_)
+    return;
+
+  hashNameWireEncoding_ = hashNameWireEncoding;
+  // Replace the hash of each existing name.
+  hashToName_.clear();
+  for (unordered_map<Name, uint32_t, NameHash>::iterator entry =
+         nameToHash_.begin();
+       entry != nameToHash_.end(); ++entry) {
+    eraseHash(entry->second);
+    entry->second = computeNameHash(entry->first, hashNameWireEncoding_);
+    hashToName_[entry->second] = entry->first;
+    insertHash(entry->second);
+  }
+}
+
+void
+PSyncProducerBase::insertHash(uint32_t hash)
+{
+  if (nPartitions_ <= 1) {
+    iblt_->insert(hash);
+    return;
+  }
+
+  size_t partition = getPartition(hash);
+  partitionIblts_[partition]->insert(hash);
+  ++partitionCounts_[partition];
+  partitionCheckSums_[partition] ^= CryptoLite::murmurHash3
+    (InvertibleBloomLookupTable::N_HASHCHECK, hash);
+}
+
+void
+PSyncProducerBase::eraseHash(uint32_t hash)
+{
+  if (nPartitions_ <= 1) {
     iblt_->erase(hash);
+    return;
   }
+
+  size_t partition = getPartition(hash);
+  partitionIblts_[partition]->erase(hash);
+  --partitionCounts_[partition];
+  partitionCheckSums_[partition] ^= CryptoLite::murmurHash3
+    (InvertibleBloomLookupTable::N_HASHCHECK, hash);
 }
 
 void
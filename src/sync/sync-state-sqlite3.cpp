@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+// Only compile if ndn-ind-config.h defines NDN_IND_HAVE_SQLITE3.
+#include <ndn-ind/ndn-ind-config.h>
+#ifdef NDN_IND_HAVE_SQLITE3
+
+#include <sqlite3.h>
+#include <errno.h>
+#include <string.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#ifdef NDN_IND_HAVE_BOOST_FILESYSTEM
+#include <boost/filesystem.hpp>
+#elif NDN_IND_HAVE_STD_FILESYSTEM
+#include <filesystem>
+#endif
+#include <ndn-ind/security/pib/pib-sqlite3.hpp>
+#include "../util/sqlite3-statement.hpp"
+#include <ndn-ind/sync/sync-state-sqlite3.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+static const string INITIALIZATION = "\
+CREATE TABLE IF NOT EXISTS                         \n\
+  psync_names(                                     \n\
+    sync_prefix           BLOB NOT NULL,           \n\
+    name                  BLOB NOT NULL,           \n\
+    PRIMARY KEY(sync_prefix, name)                 \n\
+  );                                               \n\
+                                                   \n\
+CREATE TABLE IF NOT EXISTS                         \n\
+  chrono_sync_sequence_nos(                        \n\
+    broadcast_prefix      BLOB NOT NULL,           \n\
+    data_prefix           TEXT NOT NULL,           \n\
+    session_no            INTEGER NOT NULL,        \n\
+    sequence_no           INTEGER NOT NULL,        \n\
+    PRIMARY KEY(broadcast_prefix, data_prefix, session_no) \n\
+  );                                               \n\
+";
+
+SyncStateSqlite3::SyncStateSqlite3
+  (const string& databaseDirectoryPathIn, const string& databaseFilename)
+{
+  string databaseDirectoryPath;
+  if (databaseDirectoryPathIn != "") {
+    databaseDirectoryPath = databaseDirectoryPathIn;
+    if (databaseDirectoryPath[databaseDirectoryPath.size() - 1] == '/' ||
+        databaseDirectoryPath[databaseDirectoryPath.size() - 1] == '\\')
+      // Strip the ending path separator.
+      databaseDirectoryPath.erase(databaseDirectoryPath.size() - 1);
+  }
+  else
+    databaseDirectoryPath = PibSqlite3::getDefaultDatabaseDirectoryPath();
+
+#if defined(_WIN32)
+  int status = -1;
+#else
+  // ::mkdir will work if the parent directory already exists, which is most cases.
+  int status = ::mkdir(databaseDirectoryPath.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+#endif
+  if (status != 0 && errno != EEXIST) {
+    // Can't create the directory with ::mkdir.
+    // Try with create_directories.
+#ifdef NDN_IND_HAVE_BOOST_FILESYSTEM
+    boost::filesystem::create_directories(databaseDirectoryPath);
+#elif NDN_IND_HAVE_STD_FILESYSTEM
+    filesystem::create_directories(databaseDirectoryPath);
+#else
+    throw runtime_error
+      (string("SyncStateSqlite3: Error '") + strerror(errno) + "' in 'mkdir " +
+       databaseDirectoryPath + "' . Create the parent directory and try again.");
+#endif
+  }
+
+  string databaseFilePath = databaseDirectoryPath + '/' + databaseFilename;
+  int result = sqlite3_open(databaseFilePath.c_str(), &database_);
+  if (result != SQLITE_OK) {
+    sqlite3_close(database_);
+    throw runtime_error
+      ("SyncStateSqlite3: The database cannot be opened/created: " +
+       databaseFilePath);
+  }
+
+  // A commit which is lost in a power failure is recovered from the other nodes.
+  Sqlite3Statement::setWriteAheadLogging(database_);
+
+  char* errorMessage = 0;
+  result = sqlite3_exec
+    (database_, INITIALIZATION.c_str(), NULL, NULL, &errorMessage);
+  if (result != SQLITE_OK && errorMessage != 0) {
+    sqlite3_free(errorMessage);
+    sqlite3_close(database_);
+    throw runtime_error("SyncStateSqlite3: The database cannot be initialized");
+  }
+}
+
+SyncStateSqlite3::~SyncStateSqlite3()
+{
+  sqlite3_close(database_);
+}
+
+void
+SyncStateSqlite3::addPSyncNames
+  (const Name& syncPrefix, const vector<Name>& names)
+{
+  if (names.size() == 0)
+    return;
+
+  Blob syncPrefixEncoding = syncPrefix.wireEncode();
+  // Use one transaction so that the names are written together.
+  sqlite3_exec(database_, "BEGIN", NULL, NULL, NULL);
+  {
+    Sqlite3Statement statement
+      (database_,
+       "INSERT OR IGNORE INTO psync_names (sync_prefix, name) values (?, ?)");
+    for (size_t i = 0; i < names.size(); ++i) {
+      statement.bind(1, syncPrefixEncoding, true);
+      statement.bind(2, names[i].wireEncode());
+      statement.step();
+      statement.reset();
+    }
+  }
+  sqlite3_exec(database_, "COMMIT", NULL, NULL, NULL);
+}
+
+void
+SyncStateSqlite3::removePSyncName(const Name& syncPrefix, const Name& name)
+{
+  Sqlite3Statement statement
+    (database_, "DELETE FROM psync_names WHERE sync_prefix=? AND name=?");
+  statement.bind(1, syncPrefix.wireEncode());
+  statement.bind(2, name.wireEncode());
+  statement.step();
+}
+
+void
+SyncStateSqlite3::getPSyncNames(const Name& syncPrefix, vector<Name>& names)
+{
+  names.clear();
+
+  Sqlite3Statement statement
+    (database_, "SELECT name FROM psync_names WHERE sync_prefix=?");
+  statement.bind(1, syncPrefix.wireEncode());
+  while (statement.step() == SQLITE_ROW) {
+    Name name;
+    name.wireDecode(statement.getBuf(0), statement.getSize(0));
+    names.push_back(name);
+  }
+}
+
+void
+SyncStateSqlite3::setChronoSyncSequenceNos
+  (const Name& broadcastPrefix,
+   const vector<ChronoSync2013::SyncState>& syncStates)
+{
+  if (syncStates.size() == 0)
+    return;
+
+  Blob broadcastPrefixEncoding = broadcastPrefix.wireEncode();
+  // Use one transaction so that the sequence numbers are written together.
+  sqlite3_exec(database_, "BEGIN", NULL, NULL, NULL);
+  {
+    Sqlite3Statement statement
+      (database_,
+       "INSERT OR REPLACE INTO chrono_sync_sequence_nos \
+(broadcast_prefix, data_prefix, session_no, sequence_no) values (?, ?, ?, ?)");
+    for (size_t i = 0; i < syncStates.size(); ++i) {
+      statement.bind(1, broadcastPrefixEncoding, true);
+      statement.bind(2, syncStates[i].getDataPrefix());
+      statement.bind(3, syncStates[i].getSessionNo());
+      statement.bind(4, syncStates[i].getSequenceNo());
+      statement.step();
+      statement.reset();
+    }
+  }
+  sqlite3_exec(database_, "COMMIT", NULL, NULL, NULL);
+}
+
+void
+SyncStateSqlite3::getChronoSyncSequenceNos
+  (const Name& broadcastPrefix, vector<ChronoSync2013::SyncState>& syncStates)
+{
+  syncStates.clear();
+
+  Sqlite3Statement statement
+    (database_,
+     "SELECT data_prefix, session_no, sequence_no \
+FROM chrono_sync_sequence_nos WHERE broadcast_prefix=?");
+  statement.bind(1, broadcastPrefix.wireEncode());
+  while (statement.step() == SQLITE_ROW)
+    syncStates.push_back(ChronoSync2013::SyncState
+      (statement.getString(0), statement.getInt(1), statement.getInt(2), Blob()));
+}
+
+}
+
+#endif // NDN_IND_HAVE_SQLITE3
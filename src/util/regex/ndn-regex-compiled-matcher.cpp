@@ -0,0 +1,502 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "ndn-regex-matcher-base.hpp"
+// Only compile if we set NDN_IND_HAVE_REGEX_LIB in ndn-regex-matcher-base.hpp.
+#if NDN_IND_HAVE_REGEX_LIB
+
+#include <stdlib.h>
+#include <ctype.h>
+#include <string.h>
+#include <algorithm>
+#include "ndn-regex-compiled-matcher.hpp"
+
+using namespace std;
+
+namespace ndn {
+
+// The same as NdnRegexRepeatMatcher, where this is the maximum for "*" and "+".
+static const size_t MAX_REPETITIONS = 32767;
+
+NdnRegexCompiledMatcher::NdnRegexCompiledMatcher(const string& expr)
+{
+  Node sequence(Node::SEQUENCE);
+  parseSequence(expr, sequence);
+
+  emit(sequence);
+  append(Instruction(OP_MATCH));
+}
+
+bool
+NdnRegexCompiledMatcher::match
+  (const Name& name, vector<vector<Name::Component> >* backrefs) const
+{
+  MatchState state(name, predicates_.size(), program_.size());
+  int nComponents = (int)name.size();
+
+  vector<Thread> currentThreads;
+  vector<Thread> nextThreads;
+  vector<int> captures(backrefs_.size() * 2, -1);
+  addThread(currentThreads, state, 0, captures, 0);
+
+  for (int position = 0; !currentThreads.empty(); ++position) {
+    if (position == nComponents) {
+      // The threads are in priority order, so the first MATCH is the result.
+      for (size_t i = 0; i < currentThreads.size(); ++i) {
+        const Thread& thread = currentThreads[i];
+        if (program_[thread.pc_].opcode_ != OP_MATCH)
+          continue;
+
+        if (backrefs) {
+          backrefs->clear();
+          backrefs->resize(backrefs_.size());
+          for (size_t j = 0; j < backrefs_.size(); ++j) {
+            const Backref& backref = backrefs_[j];
+            int start = thread.captures_[j * 2];
+            if (start < 0)
+              continue;
+
+            if (backref.isGroup_) {
+              int end = thread.captures_[j * 2 + 1];
+              for (int k = start; k < end; ++k)
+                (*backrefs)[j].push_back(name.get(k));
+            }
+            else {
+              // Run the component regex again to get the capture group.
+              regex_lib::smatch subResult;
+              const string& escaped = state.getEscaped(start);
+              regex_lib::regex_match
+                (escaped, subResult, predicates_[backref.predicate_].regex_);
+              string value = subResult[backref.markNo_];
+              (*backrefs)[j].push_back(Name::Component
+                ((const uint8_t*)value.c_str(), value.size()));
+            }
+          }
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+    fill(state.predicateResults_.begin(), state.predicateResults_.end(), -1);
+    nextThreads.clear();
+    for (size_t i = 0; i < currentThreads.size(); ++i) {
+      Thread& thread = currentThreads[i];
+      const Instruction& instruction = program_[thread.pc_];
+      // A MATCH before the end of the name fails.
+      if (instruction.opcode_ == OP_CONSUME &&
+          matchComponentSet
+            (instruction.x_, state, position, thread.captures_))
+        addThread
+          (nextThreads, state, thread.pc_ + 1, thread.captures_, position + 1);
+    }
+
+    currentThreads.swap(nextThreads);
+  }
+
+  return false;
+}
+
+const string&
+NdnRegexCompiledMatcher::MatchState::getEscaped(size_t position)
+{
+  if (!haveEscaped_[position]) {
+    escaped_[position] = name_.get(position).toEscapedString();
+    haveEscaped_[position] = true;
+  }
+
+  return escaped_[position];
+}
+
+void
+NdnRegexCompiledMatcher::parseSequence(const string& expr, Node& sequence)
+{
+  size_t index = 0;
+  while (index < expr.size()) {
+    size_t start = index;
+    char left = expr[index];
+    char right;
+    if (left == '(')
+      right = ')';
+    else if (left == '<')
+      right = '>';
+    else if (left == '[')
+      right = ']';
+    else
+      throw NdnRegexMatcherBase::Error("Unexpected syntax");
+
+    size_t indicator = findClosing(expr, left, right, index + 1);
+
+    // Extract the repetition the same as NdnRegexPatternListMatcher.
+    size_t end = indicator;
+    if (end < expr.size()) {
+      if (expr[end] == '+' || expr[end] == '?' || expr[end] == '*')
+        ++end;
+      else if (expr[end] == '{') {
+        end = expr.find('}', end);
+        if (end == string::npos)
+          throw NdnRegexMatcherBase::Error("Missing right brace bracket");
+        ++end;
+      }
+    }
+
+    if (left == '(') {
+      Node node(Node::GROUP);
+      // Number the back reference before the inner groups, the same as
+      // NdnRegexBackrefManager.
+      node.index_ = backrefs_.size();
+      backrefs_.push_back(Backref(true));
+      node.children_.push_back(Node(Node::SEQUENCE));
+      parseSequence
+        (expr.substr(start + 1, indicator - start - 2), node.children_[0]);
+      parseRepetition(expr.substr(indicator, end - indicator), node);
+      sequence.children_.push_back(node);
+    }
+    else {
+      Node node(Node::SET);
+      parseComponentSet(expr.substr(start, indicator - start), node);
+      parseRepetition(expr.substr(indicator, end - indicator), node);
+      sequence.children_.push_back(node);
+    }
+
+    index = end;
+  }
+}
+
+void
+NdnRegexCompiledMatcher::parseRepetition
+  (const string& repeatStruct, Node& node)
+{
+  size_t min = 1;
+  size_t max = 1;
+
+  if (repeatStruct.size() == 0) {
+  }
+  else if (repeatStruct == "?") {
+    min = 0;
+    max = 1;
+  }
+  else if (repeatStruct == "+") {
+    min = 1;
+    max = MAX_REPETITIONS;
+  }
+  else if (repeatStruct == "*") {
+    min = 0;
+    max = MAX_REPETITIONS;
+  }
+  else {
+    size_t rsSize = repeatStruct.size();
+    if (regex_lib::regex_match
+        (repeatStruct, regex_lib::regex("\\{[0-9]+,[0-9]+\\}"))) {
+      size_t separator = repeatStruct.find_first_of(',', 0);
+      min = ::atoi(repeatStruct.substr(1, separator - 1).c_str());
+      max = ::atoi
+        (repeatStruct.substr(separator + 1, rsSize - separator - 2).c_str());
+    }
+    else if (regex_lib::regex_match
+             (repeatStruct, regex_lib::regex("\\{,[0-9]+\\}"))) {
+      min = 0;
+      max = ::atoi(repeatStruct.substr(2, rsSize - 3).c_str());
+    }
+    else if (regex_lib::regex_match
+             (repeatStruct, regex_lib::regex("\\{[0-9]+,\\}"))) {
+      min = ::atoi(repeatStruct.substr(1, rsSize - 3).c_str());
+      max = MAX_REPETITIONS;
+    }
+    else if (regex_lib::regex_match
+             (repeatStruct, regex_lib::regex("\\{[0-9]+\\}"))) {
+      min = ::atoi(repeatStruct.substr(1, rsSize - 2).c_str());
+      max = min;
+    }
+    else
+      throw NdnRegexMatcherBase::Error
+        ("Error: RegexRepeatMatcher.ParseRepetition(): Unrecognized format " +
+         repeatStruct);
+
+    if (min > MAX_REPETITIONS || max > MAX_REPETITIONS || min > max)
+      throw NdnRegexMatcherBase::Error
+        ("Error: RegexRepeatMatcher.ParseRepetition(): Wrong number " +
+         repeatStruct);
+  }
+
+  node.repeatMin_ = min;
+  node.repeatMax_ = max;
+  // A name cannot have MAX_REPETITIONS components in practice, so treat it as
+  // unbounded.
+  node.isInfinite_ = (max == MAX_REPETITIONS);
+}
+
+void
+NdnRegexCompiledMatcher::parseComponentSet(const string& expr, Node& node)
+{
+  if (expr.size() < 2)
+    throw NdnRegexMatcherBase::Error
+      ("Regexp compile error (cannot parse " + expr + ")");
+
+  ComponentSet componentSet;
+  size_t index;
+  size_t lastIndex;
+  if (expr[0] == '<') {
+    index = 0;
+    lastIndex = expr.size();
+  }
+  else {
+    if (expr[expr.size() - 1] != ']')
+      throw NdnRegexMatcherBase::Error
+        ("Regexp compile error (no matching ']' in " + expr + ")");
+
+    index = 1;
+    lastIndex = expr.size() - 1;
+    if (expr[1] == '^') {
+      componentSet.isInclusion_ = false;
+      index = 2;
+    }
+  }
+
+  while (index < lastIndex) {
+    if (expr[index] != '<')
+      throw NdnRegexMatcherBase::Error("Component expr error " + expr);
+
+    size_t start = index + 1;
+    index = findClosing(expr, '<', '>', start);
+    componentSet.predicates_.push_back
+      (addPredicate(expr.substr(start, index - start - 1)));
+  }
+
+  if (index != lastIndex)
+    throw NdnRegexMatcherBase::Error("Not sufficient expr to parse " + expr);
+
+  node.index_ = componentSets_.size();
+  componentSets_.push_back(componentSet);
+}
+
+size_t
+NdnRegexCompiledMatcher::addPredicate(const string& expr)
+{
+  Predicate predicate;
+  predicate.nMarks_ = 0;
+  predicate.firstBackref_ = backrefs_.size();
+
+  if (expr.size() == 0 || expr == ".*")
+    predicate.type_ = PREDICATE_ANY;
+  else if (getLiteral(expr, predicate.literal_))
+    predicate.type_ = PREDICATE_LITERAL;
+  else {
+    predicate.type_ = PREDICATE_REGEX;
+    predicate.regex_ = regex_lib::regex(expr);
+    predicate.nMarks_ =
+      predicate.regex_.mark_count() - NDN_REGEXP_MARK_COUNT_CORRECTION;
+    for (size_t i = 1; i <= predicate.nMarks_; ++i)
+      backrefs_.push_back(Backref(false, predicates_.size(), i));
+  }
+
+  predicates_.push_back(predicate);
+  return predicates_.size() - 1;
+}
+
+bool
+NdnRegexCompiledMatcher::getLiteral(const string& expr, string& literal)
+{
+  // Allow a special character escaped by a backslash as in
+  // NdnRegexTopMatcher::fromName.
+  literal.clear();
+  for (size_t i = 0; i < expr.size(); ++i) {
+    char c = expr[i];
+    if (c == '\\') {
+      if (i + 1 < expr.size() && ::ispunct((unsigned char)expr[i + 1])) {
+        ++i;
+        literal.push_back(expr[i]);
+        continue;
+      }
+    }
+    else if (::isalnum((unsigned char)c) || ::strchr("-_~%=,:@", c)) {
+      literal.push_back(c);
+      continue;
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
+void
+NdnRegexCompiledMatcher::emit(const Node& node)
+{
+  if (node.type_ == Node::SEQUENCE) {
+    for (size_t i = 0; i < node.children_.size(); ++i) {
+      const Node& child = node.children_[i];
+
+      for (size_t j = 0; j < child.repeatMin_; ++j)
+        emitAtom(child);
+
+      if (child.isInfinite_) {
+        // loop: SPLIT body, exit; body: atom; JUMP loop; exit:
+        int loop = program_.size();
+        append(Instruction(OP_SPLIT, loop + 1, 0));
+        emitAtom(child);
+        append(Instruction(OP_JUMP, loop));
+        program_[loop].y_ = program_.size();
+      }
+      else {
+        // Each optional repetition is only tried if the previous one matched.
+        vector<int> splits;
+        for (size_t j = child.repeatMin_; j < child.repeatMax_; ++j) {
+          splits.push_back(program_.size());
+          append(Instruction(OP_SPLIT, program_.size() + 1, 0));
+          emitAtom(child);
+        }
+        for (size_t j = 0; j < splits.size(); ++j)
+          program_[splits[j]].y_ = program_.size();
+      }
+    }
+  }
+  else
+    emitAtom(node);
+}
+
+void
+NdnRegexCompiledMatcher::emitAtom(const Node& node)
+{
+  if (node.type_ == Node::GROUP) {
+    append(Instruction(OP_SAVE, node.index_ * 2));
+    emit(node.children_[0]);
+    append(Instruction(OP_SAVE, node.index_ * 2 + 1));
+  }
+  else
+    append(Instruction(OP_CONSUME, node.index_));
+}
+
+void
+NdnRegexCompiledMatcher::append(const Instruction& instruction)
+{
+  if (program_.size() >= MAX_PROGRAM_SIZE)
+    throw NdnRegexMatcherBase::Error
+      ("NdnRegexCompiledMatcher: The compiled expression is too large");
+
+  program_.push_back(instruction);
+}
+
+void
+NdnRegexCompiledMatcher::addThread
+  (vector<Thread>& threads, MatchState& state, int pc, vector<int>& captures,
+   int position) const
+{
+  if (state.visited_[pc] == position)
+    // A higher priority thread already reached this instruction.
+    return;
+  state.visited_[pc] = position;
+
+  const Instruction& instruction = program_[pc];
+  switch (instruction.opcode_) {
+  case OP_JUMP:
+    addThread(threads, state, instruction.x_, captures, position);
+    break;
+
+  case OP_SPLIT:
+    addThread(threads, state, instruction.x_, captures, position);
+    addThread(threads, state, instruction.y_, captures, position);
+    break;
+
+  case OP_SAVE:
+    {
+      int saved = captures[instruction.x_];
+      captures[instruction.x_] = position;
+      addThread(threads, state, pc + 1, captures, position);
+      captures[instruction.x_] = saved;
+      break;
+    }
+
+  default:
+    threads.push_back(Thread(pc, captures));
+    break;
+  }
+}
+
+bool
+NdnRegexCompiledMatcher::matchComponentSet
+  (size_t setIndex, MatchState& state, int position,
+   vector<int>& captures) const
+{
+  const ComponentSet& componentSet = componentSets_[setIndex];
+
+  for (size_t i = 0; i < componentSet.predicates_.size(); ++i) {
+    size_t predicateIndex = componentSet.predicates_[i];
+    if (matchPredicate(predicateIndex, state, position)) {
+      if (!componentSet.isInclusion_)
+        return false;
+
+      // Save the position for the capture groups of the component regex.
+      const Predicate& predicate = predicates_[predicateIndex];
+      for (size_t j = 0; j < predicate.nMarks_; ++j)
+        captures[(predicate.firstBackref_ + j) * 2] = position;
+      return true;
+    }
+  }
+
+  return !componentSet.isInclusion_;
+}
+
+bool
+NdnRegexCompiledMatcher::matchPredicate
+  (size_t predicateIndex, MatchState& state, int position) const
+{
+  signed char& result = state.predicateResults_[predicateIndex];
+  if (result < 0) {
+    const Predicate& predicate = predicates_[predicateIndex];
+    if (predicate.type_ == PREDICATE_ANY)
+      result = 1;
+    else if (predicate.type_ == PREDICATE_LITERAL)
+      result = (state.getEscaped(position) == predicate.literal_) ? 1 : 0;
+    else
+      result = regex_lib::regex_match
+        (state.getEscaped(position), predicate.regex_) ? 1 : 0;
+  }
+
+  return result != 0;
+}
+
+size_t
+NdnRegexCompiledMatcher::findClosing
+  (const string& expr, char left, char right, size_t index)
+{
+  size_t lcount = 1;
+  size_t rcount = 0;
+
+  while (lcount > rcount) {
+    if (index >= expr.size())
+      throw NdnRegexMatcherBase::Error("Parenthesis mismatch");
+
+    if (left == expr[index])
+      ++lcount;
+    if (right == expr[index])
+      ++rcount;
+
+    ++index;
+  }
+
+  return index;
+}
+
+}
+
+#endif // NDN_IND_HAVE_REGEX_LIB
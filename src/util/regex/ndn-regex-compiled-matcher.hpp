@@ -0,0 +1,272 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_NDN_REGEX_COMPILED_MATCHER_HPP
+#define NDN_NDN_REGEX_COMPILED_MATCHER_HPP
+
+#include "ndn-regex-matcher-base.hpp"
+
+// Only compile if we set NDN_IND_HAVE_REGEX_LIB in ndn-regex-matcher-base.hpp.
+#if NDN_IND_HAVE_REGEX_LIB
+
+namespace ndn {
+
+/**
+ * NdnRegexCompiledMatcher compiles an NDN regex pattern list into a program of
+ * an automaton over name components, and matches a name by simulating all
+ * states of the automaton in one pass over the components. The component
+ * expressions are compiled once into predicates where an empty expression and
+ * ".*" match any component and an expression without special characters is
+ * compared as a string, so that std::regex is only used for the other
+ * expressions. Each predicate is evaluated at most once per name component.
+ * The back references are numbered in the same order as NdnRegexBackrefManager
+ * and, for alternative paths, are taken from the path with the same priority as
+ * the backtracking matchers.
+ */
+class NdnRegexCompiledMatcher {
+public:
+  /**
+   * Compile the pattern list expression, which should not have the ^ and $
+   * anchors. See NdnRegexTopMatcher.
+   * @param expr The pattern list expression.
+   * @throws NdnRegexMatcherBase::Error for a syntax error or if the compiled
+   * program would be larger than MAX_PROGRAM_SIZE, for example for a large
+   * repetition count. (The caller can use the backtracking matchers instead.)
+   * @throws regex_error if a component expression is not a valid regex.
+   */
+  NdnRegexCompiledMatcher(const std::string& expr);
+
+  /**
+   * Check if the expression matches all the components of the name. This does
+   * not change this object, so it can be called from multiple threads.
+   * @param name The name to match.
+   * @param backrefs (optional) If not null and the name matches, set this to
+   * the matched components of each back reference, where a back reference
+   * which was not in the matched path is empty. If omitted or null, don't get
+   * the back references.
+   * @return True if the expression matches the name.
+   */
+  bool
+  match
+    (const Name& name,
+     std::vector<std::vector<Name::Component> >* backrefs = 0) const;
+
+  /**
+   * Get the number of back references, including the capture groups of the
+   * component expressions.
+   * @return The number of back references.
+   */
+  size_t
+  getBackrefCount() const { return backrefs_.size(); }
+
+  /**
+   * Check if the component expression has no special characters, so that it
+   * only matches a component whose escaped string is the same as the
+   * expression without the backslash escapes.
+   * @param expr The component expression, for example the "a" in "<a>".
+   * @param literal Set this to the expression without the backslash escapes.
+   * @return True if the expression has no special characters.
+   */
+  static bool
+  getLiteral(const std::string& expr, std::string& literal);
+
+  static const size_t MAX_PROGRAM_SIZE = 4096;
+
+private:
+  enum PredicateType {
+    PREDICATE_ANY,
+    PREDICATE_LITERAL,
+    PREDICATE_REGEX
+  };
+
+  /**
+   * A Predicate is a compiled component expression.
+   */
+  class Predicate {
+  public:
+    PredicateType type_;
+    std::string literal_;
+    regex_lib::regex regex_;
+    size_t nMarks_;
+    // The index in backrefs_ of the first capture group of regex_.
+    size_t firstBackref_;
+  };
+
+  /**
+   * A ComponentSet is the list of predicates of one <...> or [...] item.
+   */
+  class ComponentSet {
+  public:
+    ComponentSet() : isInclusion_(true) {}
+
+    std::vector<size_t> predicates_;
+    bool isInclusion_;
+  };
+
+  /**
+   * A Node is a parsed pattern list, a group with a back reference or a
+   * component set, with its repetition.
+   */
+  class Node {
+  public:
+    enum NodeType { SEQUENCE, GROUP, SET };
+
+    Node(NodeType type)
+    : type_(type), index_(0), repeatMin_(1), repeatMax_(1), isInfinite_(false)
+    {}
+
+    NodeType type_;
+    // The children of a SEQUENCE, or the one SEQUENCE child of a GROUP.
+    std::vector<Node> children_;
+    // The back reference of a GROUP, or the component set of a SET.
+    size_t index_;
+    size_t repeatMin_;
+    size_t repeatMax_;
+    bool isInfinite_;
+  };
+
+  enum Opcode {
+    // Consume the component if it matches componentSets_[x_].
+    OP_CONSUME,
+    // Continue at x_ and, with a lower priority, at y_.
+    OP_SPLIT,
+    OP_JUMP,
+    // Save the component position in capture slot x_.
+    OP_SAVE,
+    OP_MATCH
+  };
+
+  class Instruction {
+  public:
+    Instruction(Opcode opcode, int x = 0, int y = 0)
+    : opcode_(opcode), x_(x), y_(y)
+    {}
+
+    Opcode opcode_;
+    int x_;
+    int y_;
+  };
+
+  /**
+   * A Backref describes where a back reference comes from. If isGroup_, its
+   * capture slots have the start and end positions. Otherwise it is capture
+   * group markNo_ of predicates_[predicate_] and its first capture slot has the
+   * position of the component.
+   */
+  class Backref {
+  public:
+    Backref(bool isGroup, size_t predicate = 0, size_t markNo = 0)
+    : isGroup_(isGroup), predicate_(predicate), markNo_(markNo)
+    {}
+
+    bool isGroup_;
+    size_t predicate_;
+    size_t markNo_;
+  };
+
+  class Thread {
+  public:
+    Thread(int pc, const std::vector<int>& captures)
+    : pc_(pc), captures_(captures)
+    {}
+
+    int pc_;
+    std::vector<int> captures_;
+  };
+
+  /**
+   * MatchState holds the working state of one call to match().
+   */
+  class MatchState {
+  public:
+    MatchState(const Name& name, size_t nPredicates, size_t programSize)
+    : name_(name), escaped_(name.size()), haveEscaped_(name.size(), false),
+      predicateResults_(nPredicates, -1), visited_(programSize, -1)
+    {}
+
+    const std::string&
+    getEscaped(size_t position);
+
+    const Name& name_;
+    std::vector<std::string> escaped_;
+    std::vector<bool> haveEscaped_;
+    // The result of each predicate for the current position: -1 if not
+    // evaluated, otherwise 0 or 1.
+    std::vector<signed char> predicateResults_;
+    // The position where each instruction was last added to a thread list.
+    std::vector<int> visited_;
+  };
+
+  void
+  parseSequence(const std::string& expr, Node& sequence);
+
+  void
+  parseRepetition(const std::string& repeatStruct, Node& node);
+
+  void
+  parseComponentSet(const std::string& expr, Node& node);
+
+  size_t
+  addPredicate(const std::string& expr);
+
+  void
+  emit(const Node& node);
+
+  void
+  emitAtom(const Node& node);
+
+  void
+  append(const Instruction& instruction);
+
+  /**
+   * Follow the SPLIT, JUMP and SAVE instructions from pc and add a Thread to
+   * threads for each reached CONSUME or MATCH instruction, in priority order.
+   */
+  void
+  addThread
+    (std::vector<Thread>& threads, MatchState& state, int pc,
+     std::vector<int>& captures, int position) const;
+
+  /**
+   * Check if componentSets_[setIndex] matches the component at position. If it
+   * matches a predicate with capture groups, save the position in captures.
+   */
+  bool
+  matchComponentSet
+    (size_t setIndex, MatchState& state, int position,
+     std::vector<int>& captures) const;
+
+  bool
+  matchPredicate(size_t predicateIndex, MatchState& state, int position) const;
+
+  static size_t
+  findClosing(const std::string& expr, char left, char right, size_t index);
+
+  std::vector<Predicate> predicates_;
+  std::vector<ComponentSet> componentSets_;
+  std::vector<Backref> backrefs_;
+  std::vector<Instruction> program_;
+};
+
+}
+
+#endif // NDN_IND_HAVE_REGEX_LIB
+
+#endif
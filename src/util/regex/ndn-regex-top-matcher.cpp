@@ -39,6 +39,7 @@
 #include <stdlib.h>
 #include "ndn-regex-backref-manager.hpp"
 #include "ndn-regex-pattern-list-matcher.hpp"
+#include "ndn-regex-compiled-matcher.hpp"
 #include "ndn-regex-top-matcher.hpp"
 
 using namespace std;
@@ -70,11 +71,27 @@ NdnRegexTopMatcher::compile()
   else
     expr = expr.substr(0, expr.size() - 1);
 
-  if ('^' != expr[0])
+  bool hasSecondary = ('^' != expr[0]);
+  if (!hasSecondary)
+    expr = expr.substr(1, expr.size() - 1);
+
+  try {
+    // Match in linear time with the compiled automaton if possible.
+    compiledPrimaryMatcher_ = ptr_lib::make_shared<NdnRegexCompiledMatcher>
+      (expr);
+    if (hasSecondary)
+      compiledSecondaryMatcher_ = ptr_lib::make_shared<NdnRegexCompiledMatcher>
+        ("<.*>*" + expr);
+    return;
+  } catch (const std::exception&) {
+    // Use the backtracking matchers, which also report a syntax error.
+    compiledPrimaryMatcher_.reset();
+    compiledSecondaryMatcher_.reset();
+  }
+
+  if (hasSecondary)
     secondaryMatcher_ = ptr_lib::make_shared<NdnRegexPatternListMatcher>
       ("<.*>*" + expr, secondaryBackrefManager_);
-  else
-    expr = expr.substr(1, expr.size() - 1);
 
   primaryMatcher_ = ptr_lib::make_shared<NdnRegexPatternListMatcher>
     (expr, primaryBackrefManager_);
@@ -87,6 +104,20 @@ NdnRegexTopMatcher::match(const Name& name)
 
   matchResult_.clear();
 
+  if (compiledPrimaryMatcher_) {
+    if (compiledPrimaryMatcher_->match(name, &compiledBackrefs_))
+      isSecondaryUsed_ = false;
+    else if (compiledSecondaryMatcher_ &&
+             compiledSecondaryMatcher_->match(name, &compiledBackrefs_))
+      isSecondaryUsed_ = true;
+    else
+      return false;
+
+    for (size_t i = 0; i < name.size(); ++i)
+      matchResult_.push_back(name.get(i));
+    return true;
+  }
+
   if (primaryMatcher_->match(name, 0, name.size())) {
     matchResult_ = primaryMatcher_->getMatchResult();
     return true;
@@ -116,7 +147,8 @@ NdnRegexTopMatcher::expand(const string& expandStr)
   ptr_lib::shared_ptr<NdnRegexBackrefManager> backrefManager =
     (isSecondaryUsed_ ? secondaryBackrefManager_ : primaryBackrefManager_);
 
-  size_t backrefNo = backrefManager->size();
+  size_t backrefNo = (compiledPrimaryMatcher_ ?
+    compiledPrimaryMatcher_->getBackrefCount() : backrefManager->size());
 
   string expand;
 
@@ -140,6 +172,14 @@ NdnRegexTopMatcher::expand(const string& expandStr)
         for (; it != end; ++it)
           result.append(*it);
       }
+      else if (index <= backrefNo && compiledPrimaryMatcher_) {
+        // Before the first match, there are no back references.
+        if (index <= compiledBackrefs_.size()) {
+          const vector<Name::Component>& backref = compiledBackrefs_[index - 1];
+          for (size_t i = 0; i < backref.size(); ++i)
+            result.append(backref[i]);
+        }
+      }
       else if (index <= backrefNo) {
         vector<Name::Component>::const_iterator it =
           backrefManager->getBackref(index - 1)->getMatchResult().begin();
@@ -32,6 +32,7 @@ namespace ndn {
 
 class NdnRegexPatternListMatcher;
 class NdnRegexBackrefManager;
+class NdnRegexCompiledMatcher;
 
 class NdnRegexTopMatcher: public NdnRegexMatcherBase {
 public:
@@ -65,6 +66,12 @@ private:
 
 private:
   const std::string expand_;
+  // If the expression could be compiled by NdnRegexCompiledMatcher, these are
+  // used instead of the backtracking primaryMatcher_ and secondaryMatcher_.
+  ptr_lib::shared_ptr<NdnRegexCompiledMatcher> compiledPrimaryMatcher_;
+  ptr_lib::shared_ptr<NdnRegexCompiledMatcher> compiledSecondaryMatcher_;
+  // The back references from the last match with a compiled matcher.
+  std::vector<std::vector<Name::Component> > compiledBackrefs_;
   ptr_lib::shared_ptr<NdnRegexPatternListMatcher> primaryMatcher_;
   ptr_lib::shared_ptr<NdnRegexPatternListMatcher> secondaryMatcher_;
   ptr_lib::shared_ptr<NdnRegexBackrefManager> primaryBackrefManager_;
@@ -55,6 +55,13 @@ Sqlite3Statement::~Sqlite3Statement()
   sqlite3_finalize(statement_);
 }
 
+void
+Sqlite3Statement::setWriteAheadLogging(sqlite3* database)
+{
+  sqlite3_exec(database, "PRAGMA journal_mode=WAL", NULL, NULL, NULL);
+  sqlite3_exec(database, "PRAGMA synchronous=NORMAL", NULL, NULL, NULL);
+}
+
 }
 
 #endif // NDN_IND_HAVE_SQLITE3
@@ -192,6 +192,33 @@ public:
   int
   step() { return sqlite3_step(statement_); }
 
+  /**
+   * Wrap sqlite3_reset so that the statement can be stepped again with new
+   * bindings.
+   * @return SQLite result value.
+   */
+  int
+  reset() { return sqlite3_reset(statement_); }
+
+  /**
+   * Wrap sqlite3_clear_bindings to set all the bindings to NULL, so that the
+   * statement doesn't refer to a buffer bound with SQLITE_STATIC.
+   * @return SQLite result value.
+   */
+  int
+  clearBindings() { return sqlite3_clear_bindings(statement_); }
+
+  /**
+   * Set the database to use write-ahead logging so that a write appends to the
+   * log instead of rewriting a rollback journal, and readers don't block the
+   * writer. Also set synchronous=NORMAL which, with write-ahead logging, is
+   * still safe from corruption and only syncs to disk at a checkpoint. (A
+   * commit just before a power loss may be rolled back.)
+   * @param database The handle to the open SQLite3 database.
+   */
+  static void
+  setWriteAheadLogging(sqlite3* database);
+
 private:
   // Disable the copy constructor and assignment operator.
   Sqlite3Statement(const Sqlite3Statement& other);
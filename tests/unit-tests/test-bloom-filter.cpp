@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include <ndn-ind/name.hpp>
+#include "../../src/sync/detail/bloom-filter.hpp"
+
+using namespace std;
+using namespace ndn;
+
+class TestBloomFilter : public ::testing::Test {
+};
+
+TEST_F(TestBloomFilter, Basic)
+{
+  BloomFilter bloomFilter(100, 0.001);
+
+  Name prefix("/test/memphis");
+  bloomFilter.insert(prefix);
+  ASSERT_TRUE(bloomFilter.contains(prefix));
+  ASSERT_FALSE(bloomFilter.contains(Name("/test/nashville")));
+
+  bloomFilter.clear();
+  ASSERT_FALSE(bloomFilter.contains(prefix));
+}
+
+TEST_F(TestBloomFilter, NameAppendAndExtract)
+{
+  BloomFilter bloomFilter(100, 0.001);
+  ASSERT_EQ(0, bloomFilter.getTableSize() % 8);
+  ASSERT_TRUE(bloomFilter.getNHashes() >= 1);
+
+  for (int i = 0; i < 50; ++i)
+    bloomFilter.insert(Name("/test/user").appendNumber(i));
+
+  Name name("/sync");
+  bloomFilter.appendToName(name);
+  ASSERT_EQ(4, name.size());
+
+  BloomFilter decoded(name.get(1), name.get(2), name.get(3));
+  ASSERT_EQ(bloomFilter.getExpectedNEntries(), decoded.getExpectedNEntries());
+  ASSERT_EQ(bloomFilter.getTableSize(), decoded.getTableSize());
+  ASSERT_EQ(bloomFilter.getNHashes(), decoded.getNHashes());
+  for (int i = 0; i < 50; ++i)
+    ASSERT_TRUE(decoded.contains(Name("/test/user").appendNumber(i)));
+
+  Name decodedName("/sync");
+  decoded.appendToName(decodedName);
+  ASSERT_TRUE(name.equals(decodedName));
+
+  // A table which doesn't match the parameters.
+  ASSERT_THROW(BloomFilter
+    (Name::Component::fromNumber(101), name.get(2), name.get(3)), runtime_error);
+}
+
+TEST_F(TestBloomFilter, FalsePositiveRate)
+{
+  size_t nEntries = 1000;
+  BloomFilter bloomFilter(nEntries, 0.01);
+  for (size_t i = 0; i < nEntries; ++i)
+    bloomFilter.insert(Name("/in").appendNumber(i));
+
+  size_t nFalsePositives = 0;
+  size_t nTests = 10000;
+  for (size_t i = 0; i < nTests; ++i) {
+    if (bloomFilter.contains(Name("/out").appendNumber(i)))
+      ++nFalsePositives;
+  }
+
+  // Allow a generous margin over the expected 1%.
+  ASSERT_TRUE(nFalsePositives < nTests * 3 / 100);
+}
+
+TEST_F(TestBloomFilter, InvalidParameters)
+{
+  ASSERT_THROW(BloomFilter(0, 0.01), runtime_error);
+  ASSERT_THROW(BloomFilter(10, 0.0), runtime_error);
+  ASSERT_THROW(BloomFilter(10, 1.0), runtime_error);
+  ASSERT_THROW(BloomFilter(10, -1e300), runtime_error);
+  ASSERT_THROW(BloomFilter(10, 1e300), runtime_error);
+  ASSERT_THROW
+    (BloomFilter(BloomFilter::MAX_EXPECTED_N_ENTRIES + 1, 0.01), runtime_error);
+
+  // Hostile parameters in a name.
+  Name::Component table(Blob(vector<uint8_t>(8, 0)));
+  ASSERT_THROW(BloomFilter
+    (Name::Component::fromNumber(0xffffffffffffffffULL),
+     Name::Component::fromNumber(1), table), runtime_error);
+  ASSERT_THROW(BloomFilter
+    (Name::Component::fromNumber(10), Name::Component::fromNumber(0), table),
+    runtime_error);
+  ASSERT_THROW(BloomFilter
+    (Name::Component::fromNumber(10), Name::Component::fromNumber(1000000),
+     table), runtime_error);
+  // Large valid parameters with a small table are rejected before allocating.
+  ASSERT_THROW(BloomFilter
+    (Name::Component::fromNumber(BloomFilter::MAX_EXPECTED_N_ENTRIES),
+     Name::Component::fromNumber(1), table), runtime_error);
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include "identity-management-fixture.hpp"
+#include <ndn-ind/security/v2/certificate-cache-v2.hpp>
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn;
+
+class TestCertificateCacheV2 : public ::testing::Test {
+public:
+  TestCertificateCacheV2()
+  : certificate_(*fixture_.addIdentity("/TestCertificateCacheV2")
+                 ->getDefaultKey()->getDefaultCertificate())
+  {
+  }
+
+  /**
+   * Make a copy of certificate_ with the name changed to end with the version.
+   * @param version The version component of the certificate name.
+   * @param notAfter The NotAfter time of the validity period.
+   * @return The new certificate.
+   */
+  CertificateV2
+  makeCertificate(uint64_t version, system_clock::time_point notAfter)
+  {
+    CertificateV2 certificate(certificate_);
+    certificate.setName(certificate_.getName().getPrefix(-1).appendVersion(version));
+    certificate.getValidityPeriod().setPeriod(system_clock::now(), notAfter);
+    return certificate;
+  }
+
+  IdentityManagementFixture fixture_;
+  CertificateV2 certificate_;
+};
+
+TEST_F(TestCertificateCacheV2, FindExact)
+{
+  CertificateCacheV2 cache;
+  cache.insert(makeCertificate(1, system_clock::now() + hours(1)));
+  cache.insert(makeCertificate(2, system_clock::now() + hours(1)));
+
+  Name name1 = certificate_.getName().getPrefix(-1).appendVersion(1);
+  ASSERT_TRUE(!!cache.findExact(name1));
+  ASSERT_EQ(name1, cache.findExact(name1)->getName());
+  // A prefix is found by find but not by findExact.
+  ASSERT_TRUE(!!cache.find(name1.getPrefix(-1)));
+  ASSERT_FALSE(cache.findExact(name1.getPrefix(-1)));
+
+  cache.deleteCertificate(name1);
+  ASSERT_FALSE(cache.findExact(name1));
+  ASSERT_EQ(1, cache.getCertificatesByName().size());
+
+  cache.clear();
+  ASSERT_EQ(0, cache.getCertificatesByName().size());
+  ASSERT_FALSE(cache.findExact
+    (certificate_.getName().getPrefix(-1).appendVersion(2)));
+}
+
+TEST_F(TestCertificateCacheV2, Expiration)
+{
+  CertificateCacheV2 cache(seconds(10));
+  Name prefix = certificate_.getName().getPrefix(-1);
+  // Removed at its NotAfter time.
+  cache.insert(makeCertificate(1, system_clock::now() + seconds(3)));
+  // Removed after the maximum lifetime.
+  cache.insert(makeCertificate(2, system_clock::now() + hours(1)));
+  // Inserted again with a later removal time, so its first removal time is
+  // skipped.
+  cache.insert(makeCertificate(3, system_clock::now() + seconds(3)));
+  cache.insert(makeCertificate(3, system_clock::now() + seconds(6)));
+
+  cache.setNowOffset_(seconds(4));
+  ASSERT_FALSE(cache.findExact(Name(prefix).appendVersion(1)));
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(2)));
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(3)));
+
+  cache.setNowOffset_(seconds(7));
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(2)));
+  ASSERT_FALSE(cache.findExact(Name(prefix).appendVersion(3)));
+
+  cache.setNowOffset_(seconds(11));
+  ASSERT_FALSE(cache.find(prefix));
+  ASSERT_EQ(0, cache.getCertificatesByName().size());
+}
+
+TEST_F(TestCertificateCacheV2, Capacity)
+{
+  CertificateCacheV2 cache;
+  ASSERT_EQ(0, cache.getCapacity());
+  cache.setCapacity(2);
+  Name prefix = certificate_.getName().getPrefix(-1);
+
+  cache.insert(makeCertificate(1, system_clock::now() + hours(1)));
+  cache.insert(makeCertificate(2, system_clock::now() + hours(1)));
+  // Use certificate 1 so that certificate 2 is the least recently used.
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(1)));
+  cache.insert(makeCertificate(3, system_clock::now() + hours(1)));
+
+  ASSERT_EQ(2, cache.getCertificatesByName().size());
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(1)));
+  ASSERT_FALSE(cache.findExact(Name(prefix).appendVersion(2)));
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(3)));
+
+  // Replacing a certificate doesn't remove another one.
+  cache.insert(makeCertificate(3, system_clock::now() + hours(2)));
+  ASSERT_EQ(2, cache.getCertificatesByName().size());
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(1)));
+
+  // Reducing the capacity removes the least recently used certificate.
+  cache.setCapacity(1);
+  ASSERT_EQ(1, cache.getCertificatesByName().size());
+  ASSERT_TRUE(!!cache.findExact(Name(prefix).appendVersion(1)));
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,289 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <ndn-ind/sync/chrono-sync2013.hpp>
+
+// Only test if ndn-ind-config.h defines NDN_IND_HAVE_PROTOBUF = 1.
+#if NDN_IND_HAVE_PROTOBUF
+
+#include "../../src/sync/sync-state.pb.h"
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+/**
+ * ChronoSyncTestFace extends Face to remember the calls to expressInterest
+ * without replying, so that the test can call onData or onTimeout. It also
+ * remembers the OnInterestCallback from registerPrefix and the Data from
+ * putData.
+ */
+class ChronoSyncTestFace : public Face {
+public:
+  class SentInterest {
+  public:
+    SentInterest
+      (const Interest& interest, const OnData& onData,
+       const OnTimeout& onTimeout)
+    : interest_(new Interest(interest)), onData_(onData),
+      onTimeout_(onTimeout)
+    {
+    }
+
+    ptr_lib::shared_ptr<Interest> interest_;
+    OnData onData_;
+    OnTimeout onTimeout_;
+  };
+
+  ChronoSyncTestFace()
+  : Face("localhost")
+  {
+  }
+
+  virtual uint64_t
+  expressInterest
+    (const Interest& interest, const OnData& onData,
+     const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
+  {
+    sentInterests_.push_back(SentInterest(interest, onData, onTimeout));
+    return sentInterests_.size();
+  }
+
+  virtual uint64_t
+  registerPrefix
+    (const Name& prefix, const OnInterestCallback& onInterest,
+     const OnRegisterFailed& onRegisterFailed,
+     const OnRegisterSuccess& onRegisterSuccess,
+     const RegistrationOptions& registrationOptions = RegistrationOptions(),
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
+  {
+    prefix_ = prefix;
+    onInterest_ = onInterest;
+    return 1;
+  }
+
+  virtual void
+  putData
+    (const Data& data,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
+  {
+    sentData_.push_back(ptr_lib::make_shared<Data>(data));
+  }
+
+  /**
+   * Call the OnInterestCallback from registerPrefix with an Interest for name.
+   */
+  void
+  receive(const Name& name)
+  {
+    onInterest_
+      (ptr_lib::make_shared<Name>(prefix_), ptr_lib::make_shared<Interest>(name),
+       *this, 1, ptr_lib::make_shared<InterestFilter>(prefix_));
+  }
+
+  vector<SentInterest> sentInterests_;
+  vector<ptr_lib::shared_ptr<Data> > sentData_;
+
+private:
+  Name prefix_;
+  OnInterestCallback onInterest_;
+};
+
+static void
+onReceivedSyncState
+  (const vector<ChronoSync2013::SyncState>& syncStates, bool isRecovery)
+{
+}
+
+static void
+onInitialized()
+{
+}
+
+static void
+onRegisterFailed(const ptr_lib::shared_ptr<const Name>& prefix)
+{
+}
+
+class TestChronoSync2013 : public ::testing::Test {
+public:
+  TestChronoSync2013()
+  : keyChain_("pib-memory:", "tpm-memory:"),
+    broadcastPrefix_("/ndn/broadcast/chrono")
+  {
+    Name certificateName = keyChain_.createIdentityV2(Name("/alice"))
+      ->getDefaultKey()->getDefaultCertificate()->getName();
+    sync_.reset(new ChronoSync2013
+      (&onReceivedSyncState, &onInitialized, Name("/alice"), broadcastPrefix_,
+       1, face_, keyChain_, certificateName, seconds(5), &onRegisterFailed));
+  }
+
+  /**
+   * Get the digest in the name of the last expressed Interest, which is the
+   * sync Interest for the current root digest.
+   */
+  string
+  getRootDigest()
+  {
+    return face_.sentInterests_.back().interest_->getName().get
+      (broadcastPrefix_.size()).toEscapedString();
+  }
+
+  /**
+   * Reply to the last expressed Interest with a sync state message with one
+   * update.
+   */
+  void
+  receiveSyncState(const string& dataPrefix, int sessionNo, int sequenceNo)
+  {
+    Sync::SyncStateMsg message;
+    Sync::SyncState* content = message.add_ss();
+    content->set_name(dataPrefix);
+    content->set_type(Sync::SyncState_ActionType_UPDATE);
+    content->mutable_seqno()->set_seq(sequenceNo);
+    content->mutable_seqno()->set_session(sessionNo);
+    ptr_lib::shared_ptr<vector<uint8_t> > array
+      (new vector<uint8_t>(message.ByteSize()));
+    message.SerializeToArray(&array->front(), array->size());
+
+    ChronoSyncTestFace::SentInterest sentInterest = face_.sentInterests_.back();
+    ptr_lib::shared_ptr<Data> data(new Data(sentInterest.interest_->getName()));
+    data->setContent(Blob(array, false));
+    sentInterest.onData_(sentInterest.interest_, data);
+  }
+
+  /**
+   * Receive a sync Interest for the digest.
+   */
+  void
+  receiveSyncInterest(const string& digest)
+  {
+    face_.receive(Name(broadcastPrefix_).append(digest));
+  }
+
+  /**
+   * Decode the sync state message in the content of the last sent Data and
+   * return the data prefix of each update.
+   */
+  vector<string>
+  getSentDataPrefixes()
+  {
+    Sync::SyncStateMsg message;
+    const Blob& content = face_.sentData_.back()->getContent();
+    message.ParseFromArray(content.buf(), content.size());
+
+    vector<string> dataPrefixes;
+    for (int i = 0; i < message.ss_size(); ++i)
+      dataPrefixes.push_back(message.ss(i).name());
+    return dataPrefixes;
+  }
+
+  KeyChain keyChain_;
+  ChronoSyncTestFace face_;
+  Name broadcastPrefix_;
+  ptr_lib::shared_ptr<ChronoSync2013> sync_;
+};
+
+TEST_F(TestChronoSync2013, DigestLog)
+{
+  ASSERT_EQ(DEFAULT_MAX_DIGEST_LOG_SIZE, sync_->getMaxDigestLogSize());
+
+  // There are no other participants.
+  ASSERT_EQ(1, face_.sentInterests_.size());
+  ChronoSyncTestFace::SentInterest initialInterest = face_.sentInterests_[0];
+  initialInterest.onTimeout_(initialInterest.interest_);
+  string digest1 = getRootDigest();
+
+  receiveSyncState("/bob", 1, 0);
+  string digest2 = getRootDigest();
+  receiveSyncState("/carol", 1, 0);
+  receiveSyncState("/bob", 1, 1);
+  // The digest log has "00" and 4 more entries.
+
+  // Reply to a sync Interest for an older digest with the later updates.
+  receiveSyncInterest(digest2);
+  ASSERT_EQ(1, face_.sentData_.size());
+  vector<string> dataPrefixes = getSentDataPrefixes();
+  ASSERT_EQ(2, dataPrefixes.size());
+  ASSERT_EQ("/carol", dataPrefixes[0]);
+  ASSERT_EQ("/bob", dataPrefixes[1]);
+
+  // Remove "00" and digest1. The index of digest2 is still correct.
+  sync_->setMaxDigestLogSize(3);
+  ASSERT_EQ(3, sync_->getMaxDigestLogSize());
+  receiveSyncInterest(digest2);
+  ASSERT_EQ(2, face_.sentData_.size());
+  dataPrefixes = getSentDataPrefixes();
+  ASSERT_EQ(2, dataPrefixes.size());
+  ASSERT_EQ("/carol", dataPrefixes[0]);
+  ASSERT_EQ("/bob", dataPrefixes[1]);
+
+  // Adding an entry to the full log removes digest2.
+  receiveSyncState("/dave", 1, 0);
+  size_t nSentInterests = face_.sentInterests_.size();
+  receiveSyncInterest(digest2);
+  // A removed digest is unknown, so wait to send a recovery Interest.
+  ASSERT_EQ(2, face_.sentData_.size());
+  ASSERT_EQ(nSentInterests + 1, face_.sentInterests_.size());
+  ChronoSyncTestFace::SentInterest timeout = face_.sentInterests_.back();
+  ASSERT_EQ(Name("/local/timeout"), timeout.interest_->getName());
+  timeout.onTimeout_(timeout.interest_);
+  ASSERT_EQ(nSentInterests + 2, face_.sentInterests_.size());
+  ASSERT_EQ
+    (Name(broadcastPrefix_).append("recovery").append(digest2),
+     face_.sentInterests_.back().interest_->getName());
+
+  ASSERT_THROW(sync_->setMaxDigestLogSize(0), runtime_error);
+}
+
+TEST_F(TestChronoSync2013, NewcomerRecovery)
+{
+  ChronoSyncTestFace::SentInterest initialInterest = face_.sentInterests_[0];
+  initialInterest.onTimeout_(initialInterest.interest_);
+  receiveSyncState("/bob", 1, 0);
+
+  // Remove the log entry for "00".
+  sync_->setMaxDigestLogSize(1);
+
+  // Still reply to a recovery Interest from a newcomer with the full state.
+  face_.receive(Name(broadcastPrefix_).append("recovery").append("00"));
+  ASSERT_EQ(1, face_.sentData_.size());
+  vector<string> dataPrefixes = getSentDataPrefixes();
+  ASSERT_EQ(2, dataPrefixes.size());
+  ASSERT_EQ("/alice", dataPrefixes[0]);
+  ASSERT_EQ("/bob", dataPrefixes[1]);
+
+  // Don't reply to a recovery Interest for an unknown digest.
+  face_.receive(Name(broadcastPrefix_).append("recovery").append("1234"));
+  ASSERT_EQ(1, face_.sentData_.size());
+}
+
+#endif // NDN_IND_HAVE_PROTOBUF
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -37,6 +37,7 @@
 #include <sstream>
 #include <ndn-ind/data.hpp>
 #include <ndn-ind/security/key-chain.hpp>
+#include <ndn-ind/security/verification-helpers.hpp>
 #include <ndn-ind/sha256-with-rsa-signature.hpp>
 #include <ndn-ind/generic-signature.hpp>
 #include <ndn-ind/lite/util/crypto-lite.hpp>
@@ -376,6 +377,83 @@ TEST_F(TestDataMethods, FullName)
   Name saveFullName(*data.getFullName());
   data.setContent(Blob());
   ASSERT_FALSE(data.getFullName()->get(-1).equals(saveFullName.get(-1)));
+
+  // Changing and encoding a copy should also change its full name.
+  data.wireDecode(codedData, sizeof(codedData));
+  data.getFullName();
+  Data data2(data);
+  ASSERT_TRUE(data2.getFullName()->equals(saveFullName));
+  data2.setContent(Blob());
+  data2.wireEncode();
+  ASSERT_FALSE(data2.getFullName()->get(-1).equals(saveFullName.get(-1)));
+
+  // Decoding or assigning a different Data packet should change the full name.
+  data.wireDecode(data2.wireEncode());
+  ASSERT_TRUE(data.getFullName()->equals(*data2.getFullName()));
+  Data data3;
+  data3.wireDecode(codedData, sizeof(codedData));
+  data3.getFullName();
+  data3 = data2;
+  ASSERT_TRUE(data3.getFullName()->equals(*data2.getFullName()));
+}
+
+TEST_F(TestDataMethods, FullNames)
+{
+  vector<ptr_lib::shared_ptr<Data> > dataObjects;
+  vector<const Data*> dataList;
+  for (int i = 0; i < 5; ++i) {
+    ptr_lib::shared_ptr<Data> data(new Data());
+    data->wireDecode(codedData, sizeof(codedData));
+    if (i > 0)
+      data->setContent(Blob::fromRawStr("content" + to_string(i)));
+    dataObjects.push_back(data);
+    dataList.push_back(data.get());
+  }
+  // The first Data packet already has a cached full name.
+  ptr_lib::shared_ptr<Name> cachedFullName = dataObjects[0]->getFullName();
+
+  vector<ptr_lib::shared_ptr<Name> > fullNames = Data::getFullNames(dataList);
+  ASSERT_EQ(dataList.size(), fullNames.size());
+  ASSERT_EQ(cachedFullName.get(), fullNames[0].get());
+  for (size_t i = 0; i < dataObjects.size(); ++i) {
+    uint8_t digest[ndn_SHA256_DIGEST_SIZE];
+    Blob encoding = dataObjects[i]->wireEncode();
+    CryptoLite::digestSha256(encoding.buf(), encoding.size(), digest);
+    ASSERT_EQ(Name(dataObjects[i]->getName()).appendImplicitSha256Digest
+                (Blob(digest, sizeof(digest))),
+              *fullNames[i]);
+    // getFullNames caches the full name.
+    ASSERT_EQ(fullNames[i].get(), dataObjects[i]->getFullName().get());
+  }
+
+  ASSERT_EQ(0, Data::getFullNames(vector<const Data*>()).size());
+}
+
+TEST_F(TestDataMethods, VerifyDataDigests)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  vector<ptr_lib::shared_ptr<Data> > dataObjects;
+  vector<const Data*> dataList;
+  for (int i = 0; i < 5; ++i) {
+    ptr_lib::shared_ptr<Data> data(new Data(Name("/test/data").appendSegment(i)));
+    data->setContent(Blob::fromRawStr("content" + to_string(i)));
+    keyChain.signWithSha256(*data);
+    dataObjects.push_back(data);
+    dataList.push_back(data.get());
+  }
+  // Change the content of one Data packet after signing.
+  dataObjects[2]->setContent(Blob::fromRawStr("changed"));
+  dataList.push_back(0);
+
+  vector<bool> results = VerificationHelpers::verifyDataDigests
+    (dataList, DIGEST_ALGORITHM_SHA256);
+  ASSERT_EQ(dataList.size(), results.size());
+  for (size_t i = 0; i < dataObjects.size(); ++i) {
+    ASSERT_EQ(i != 2, results[i]);
+    ASSERT_EQ(VerificationHelpers::verifyDataDigest
+              (*dataObjects[i], DIGEST_ALGORITHM_SHA256), results[i]);
+  }
+  ASSERT_FALSE(results[dataObjects.size()]);
 }
 
 
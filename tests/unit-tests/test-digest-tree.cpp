@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <sstream>
+#include "gtest/gtest.h"
+#include "../../src/sync/digest-tree.hpp"
+
+using namespace std;
+using namespace ndn;
+
+static string
+makePrefix(int i)
+{
+  ostringstream prefix;
+  prefix << "/ndn/user" << i;
+  return prefix.str();
+}
+
+class TestDigestTree : public ::testing::Test {
+};
+
+TEST_F(TestDigestTree, Root)
+{
+  DigestTree digestTree;
+  ASSERT_EQ("00", digestTree.getRoot());
+
+  ASSERT_TRUE(digestTree.update("/ndn/user1", 1, 0));
+  // The root digest of the ChronoSync protocol for this node.
+  ASSERT_EQ
+    ("fb252a6b7fcfc3dd306593f7710a57917fcc1c254b60f1f632572dbccbd8fd32",
+     digestTree.getRoot());
+}
+
+TEST_F(TestDigestTree, UpdateAndFind)
+{
+  DigestTree digestTree;
+  for (int i = 9; i >= 0; --i)
+    ASSERT_TRUE(digestTree.update(makePrefix(i), 1, 0));
+  ASSERT_EQ(10, digestTree.size());
+
+  // The nodes are sorted.
+  for (size_t i = 0; i < digestTree.size(); ++i) {
+    ASSERT_EQ(makePrefix(i), digestTree.get(i).getDataPrefix());
+    ASSERT_EQ(i, digestTree.find(makePrefix(i), 1));
+  }
+  ASSERT_EQ(-1, digestTree.find(makePrefix(1), 2));
+
+  string root = digestTree.getRoot();
+  // An old sequence number doesn't change the tree.
+  ASSERT_FALSE(digestTree.update(makePrefix(3), 1, 0));
+  ASSERT_EQ(root, digestTree.getRoot());
+
+  ASSERT_TRUE(digestTree.update(makePrefix(3), 1, 5));
+  ASSERT_EQ(5, digestTree.get(digestTree.find(makePrefix(3), 1)).getSequenceNo());
+  ASSERT_NE(root, digestTree.getRoot());
+}
+
+TEST_F(TestDigestTree, HashTreeRoot)
+{
+  // Update a tree incrementally.
+  DigestTree digestTree(true);
+  ASSERT_EQ("00", digestTree.getRoot());
+  for (int i = 0; i < 13; ++i)
+    digestTree.update(makePrefix((i * 7) % 13), 1, 0);
+  for (int i = 0; i < 13; i += 2)
+    digestTree.update(makePrefix(i), 1, i + 1);
+
+  // Create a tree with the final state. The root should be the same.
+  DigestTree expected(true);
+  for (int i = 0; i < 13; ++i)
+    expected.update(makePrefix(i), 1, i % 2 == 0 ? i + 1 : 0);
+  ASSERT_EQ(expected.getRoot(), digestTree.getRoot());
+
+  // The root of the hash tree differs from the ChronoSync root digest.
+  DigestTree flat;
+  for (int i = 0; i < 13; ++i)
+    flat.update(makePrefix(i), 1, i % 2 == 0 ? i + 1 : 0);
+  ASSERT_NE(flat.getRoot(), digestTree.getRoot());
+
+  // A change in any node changes the root.
+  string root = digestTree.getRoot();
+  digestTree.update(makePrefix(12), 1, 100);
+  ASSERT_NE(root, digestTree.getRoot());
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
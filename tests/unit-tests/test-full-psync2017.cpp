@@ -0,0 +1,743 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <set>
+#include <ndn-ind/sync/full-psync2017.hpp>
+#include <ndn-ind/sync/full-psync2017-with-users.hpp>
+#include "../../src/sync/detail/invertible-bloom-lookup-table.hpp"
+#include "../../src/sync/detail/psync-state.hpp"
+#include "in-memory-storage-face.hpp"
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+/**
+ * PSyncTestFace extends Face to connect the sync producers on two faces
+ * without a forwarder. expressInterest and putData only remember the Interest
+ * and Data so that exchange can pass them between the faces. callLater only
+ * remembers the callback so that the test can call callLaterCallbacks.
+ */
+class PSyncTestFace : public Face {
+public:
+  class PendingInterest {
+  public:
+    PendingInterest
+      (const ptr_lib::shared_ptr<Interest>& interest, const OnData& onData)
+    : interest_(interest), onData_(onData)
+    {
+    }
+
+    ptr_lib::shared_ptr<Interest> interest_;
+    OnData onData_;
+  };
+
+  PSyncTestFace()
+  : Face("localhost"), nForwardedInterests_(0), nForwardedData_(0)
+  {
+  }
+
+  virtual uint64_t
+  expressInterest
+    (const Interest& interest, const OnData& onData,
+     const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
+  {
+    ptr_lib::shared_ptr<Interest> interestCopy(new Interest(interest));
+    sentInterests_.push_back(interestCopy);
+    pendingInterests_.push_back(PendingInterest(interestCopy, onData));
+    return sentInterests_.size();
+  }
+
+  virtual uint64_t
+  registerPrefix
+    (const Name& prefix, const OnInterestCallback& onInterest,
+     const OnRegisterFailed& onRegisterFailed,
+     const OnRegisterSuccess& onRegisterSuccess,
+     const RegistrationOptions& registrationOptions = RegistrationOptions(),
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
+  {
+    interestFilterTable_.setInterestFilter
+      (0, ptr_lib::make_shared<InterestFilter>(prefix), onInterest, this);
+    return 0;
+  }
+
+  virtual void
+  putData
+    (const Data& data,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
+  {
+    sentData_.push_back(ptr_lib::make_shared<Data>(data));
+  }
+
+  virtual void
+  callLater(nanoseconds delay, const Face::Callback& callback)
+  {
+    callLaterCallbacks_.push_back(callback);
+  }
+
+  /**
+   * Call each callback from callLater once, as if its delay expired. This
+   * does not call the callbacks which are added by these calls.
+   */
+  void
+  callLaterCallbacks()
+  {
+    vector<Face::Callback> callbacks;
+    callbacks.swap(callLaterCallbacks_);
+    for (size_t i = 0; i < callbacks.size(); ++i)
+      callbacks[i]();
+  }
+
+  /**
+   * Call the OnInterestCallback from registerPrefix if the Interest matches.
+   */
+  void
+  receive(const ptr_lib::shared_ptr<Interest>& interest)
+  {
+    vector<ptr_lib::shared_ptr<InterestFilterTable::Entry> > matchedFilters;
+    interestFilterTable_.getMatchedFilters(*interest, matchedFilters);
+    for (size_t i = 0; i < matchedFilters.size(); ++i) {
+      InterestFilterTable::Entry &entry = *matchedFilters[i];
+      entry.getOnInterest()
+        (entry.getPrefix(), interest, entry.getFace(),
+         entry.getInterestFilterId(), entry.getFilter());
+    }
+  }
+
+  /**
+   * Remove each pending Interest whose name is a prefix of the Data name and
+   * call its OnData callback.
+   */
+  void
+  deliver(const ptr_lib::shared_ptr<Data>& data)
+  {
+    // Remove the matching Interests first since OnData can express more.
+    vector<PendingInterest> matched;
+    for (size_t i = 0; i < pendingInterests_.size();) {
+      if (pendingInterests_[i].interest_->getName().isPrefixOf(data->getName())) {
+        matched.push_back(pendingInterests_[i]);
+        pendingInterests_.erase(pendingInterests_.begin() + i);
+      }
+      else
+        ++i;
+    }
+
+    for (size_t i = 0; i < matched.size(); ++i)
+      matched[i].onData_(matched[i].interest_, data);
+  }
+
+  /**
+   * Pass the new Interests from each face to the other and pass back the Data
+   * which replies to them, until there are no more.
+   */
+  static void
+  exchange(PSyncTestFace& face1, PSyncTestFace& face2)
+  {
+    while (true) {
+      bool forwarded1 = face1.forward(face2);
+      bool forwarded2 = face2.forward(face1);
+      if (!forwarded1 && !forwarded2)
+        break;
+    }
+  }
+
+  /**
+   * Get the partition of each partition sync Interest sent by this face. A
+   * partition sync Interest name is /<sync-prefix>/<partition>/<IBLT>.
+   */
+  set<uint64_t>
+  getFetchedPartitions(const Name& syncPrefix)
+  {
+    set<uint64_t> partitions;
+    for (size_t i = 0; i < sentInterests_.size(); ++i) {
+      if (sentInterests_[i]->getName().size() == syncPrefix.size() + 2)
+        partitions.insert
+          (sentInterests_[i]->getName().get(syncPrefix.size()).toNumber());
+    }
+    return partitions;
+  }
+
+  /**
+   * Get the number of sync Interests with partition digests sent by this face,
+   * which have the name /<sync-prefix>/<partition-digests>.
+   */
+  size_t
+  getNDigestInterests(const Name& syncPrefix)
+  {
+    size_t count = 0;
+    for (size_t i = 0; i < sentInterests_.size(); ++i) {
+      if (sentInterests_[i]->getName().size() == syncPrefix.size() + 1)
+        ++count;
+    }
+    return count;
+  }
+
+  vector<ptr_lib::shared_ptr<Interest> > sentInterests_;
+  vector<ptr_lib::shared_ptr<Data> > sentData_;
+
+private:
+  /**
+   * Pass each new Interest from this face to the other face, and deliver each
+   * new Data from the other face to this face.
+   * @return True if anything was passed.
+   */
+  bool
+  forward(PSyncTestFace& other)
+  {
+    bool forwarded = false;
+    while (nForwardedInterests_ < sentInterests_.size()) {
+      other.receive(sentInterests_[nForwardedInterests_++]);
+      forwarded = true;
+    }
+    while (other.nForwardedData_ < other.sentData_.size()) {
+      deliver(other.sentData_[other.nForwardedData_++]);
+      forwarded = true;
+    }
+
+    return forwarded;
+  }
+
+  vector<PendingInterest> pendingInterests_;
+  vector<Face::Callback> callLaterCallbacks_;
+  size_t nForwardedInterests_;
+  size_t nForwardedData_;
+  InterestFilterTable interestFilterTable_;
+};
+
+static void
+onNamesUpdate(const ptr_lib::shared_ptr<vector<Name> >& updates)
+{
+}
+
+static void
+appendNames
+  (const ptr_lib::shared_ptr<vector<Name> >& updates, vector<Name>* names)
+{
+  names->insert(names->end(), updates->begin(), updates->end());
+  sort(names->begin(), names->end());
+}
+
+static void
+onUpdate
+  (const ptr_lib::shared_ptr<vector<ptr_lib::shared_ptr<PSyncMissingDataInfo> > >&
+     updates)
+{
+}
+
+class TestFullPSync2017 : public ::testing::Test {
+public:
+  TestFullPSync2017()
+  : keyChain_("pib-memory:", "tpm-memory:"),
+    face_(&storage_),
+    syncPrefix_("/psync")
+  {
+    keyChain_.createIdentityV2(Name("/producer"));
+  }
+
+  /**
+   * Make the name of a sync Interest with an IBLT which has the names.
+   * @param names The names to insert in the IBLT.
+   * @param hashNameWireEncoding (optional) True to hash the wire encoding of
+   * the names. If omitted, hash the URI.
+   */
+  Name
+  makeSyncInterestName
+    (const vector<Name>& names, bool hashNameWireEncoding = false)
+  {
+    InvertibleBloomLookupTable iblt(40);
+    for (size_t i = 0; i < names.size(); ++i)
+      iblt.insert(PSyncProducerBase::computeNameHash
+        (names[i], hashNameWireEncoding));
+
+    return Name(syncPrefix_).append(iblt.encode());
+  }
+
+  /**
+   * Make a sync Interest with an IBLT which has the names.
+   */
+  ptr_lib::shared_ptr<Interest>
+  makeSyncInterest
+    (const vector<Name>& names, bool hashNameWireEncoding = false)
+  {
+    return ptr_lib::make_shared<Interest>
+      (makeSyncInterestName(names, hashNameWireEncoding));
+  }
+
+  /**
+   * Make a sync Interest for the partition with an empty IBLT.
+   */
+  ptr_lib::shared_ptr<Interest>
+  makePartitionSyncInterest(const Name::Component& partition)
+  {
+    return ptr_lib::make_shared<Interest>(Name(syncPrefix_).append(partition)
+      .append(InvertibleBloomLookupTable(PARTITION_N_ENTRIES).encode()));
+  }
+
+  /**
+   * Make a sync Interest with all-zero partition digests, which match a
+   * producer with no names.
+   * @param nBytes The number of bytes of digests.
+   */
+  ptr_lib::shared_ptr<Interest>
+  makeDigestsInterest(size_t nBytes)
+  {
+    ptr_lib::shared_ptr<vector<uint8_t> > digests
+      (new vector<uint8_t>(nBytes, 0));
+    return ptr_lib::make_shared<Interest>
+      (Name(syncPrefix_).append(Blob(digests, false)));
+  }
+
+  /**
+   * Get the partition of the name from its URI hash.
+   */
+  static uint64_t
+  getPartition(const Name& name)
+  {
+    return PSyncProducerBase::computeNameHash(name, false) % N_PARTITIONS;
+  }
+
+  /**
+   * Make a FullPSync2017 with N_PARTITIONS, which appends its received names
+   * to receivedNames.
+   */
+  ptr_lib::shared_ptr<FullPSync2017>
+  makePartitionedSync(Face& face, vector<Name>& receivedNames)
+  {
+    return ptr_lib::make_shared<FullPSync2017>
+      (40, face, syncPrefix_, bind(&appendNames, _1, &receivedNames),
+       keyChain_, DEFAULT_SYNC_INTEREST_LIFETIME,
+       DEFAULT_SYNC_REPLY_FRESHNESS_PERIOD, SigningInfo(),
+       FullPSync2017::CanAddToSyncData(), FullPSync2017::CanAddReceivedName(),
+       N_PARTITIONS);
+  }
+
+  /**
+   * Make the Data with one segment which replies to the sync Interest with
+   * partition digests.
+   */
+  static ptr_lib::shared_ptr<Data>
+  makeDigestsData(const Name& interestName, const vector<uint8_t>& digests)
+  {
+    ptr_lib::shared_ptr<Data> data(new Data
+      (Name(interestName).appendVersion(1).appendSegment(0)));
+    data->getMetaInfo().setFinalBlockId(Name::Component::fromSegment(0));
+    data->setContent(Blob(digests));
+    return data;
+  }
+
+  // The expected number of entries of 40 for each partition IBLT.
+  static const size_t N_PARTITIONS = 4;
+  static const size_t PARTITION_N_ENTRIES = 10;
+
+  /**
+   * Decode the PSyncState in the last sent Data and return its names, sorted.
+   */
+  vector<Name>
+  getSentNames()
+  {
+    return getSentNames(face_.sentData_);
+  }
+
+  /**
+   * Decode the PSyncState in the last Data in sentData and return its names,
+   * sorted.
+   */
+  static vector<Name>
+  getSentNames(const vector<ptr_lib::shared_ptr<Data> >& sentData)
+  {
+    vector<Name> names
+      (PSyncState(sentData.back()->getContent()).getContent());
+    sort(names.begin(), names.end());
+    return names;
+  }
+
+  KeyChain keyChain_;
+  InMemoryStorageRetaining storage_;
+  InMemoryStorageFace face_;
+  Name syncPrefix_;
+};
+
+TEST_F(TestFullPSync2017, PublishNames)
+{
+  FullPSync2017 fullPSync(40, face_, syncPrefix_, &onNamesUpdate, keyChain_);
+  fullPSync.publishName(Name("/a/1"));
+
+  // The sync Interest has the same IBLT, so it is pending.
+  face_.receive(makeSyncInterest(vector<Name>(1, Name("/a/1"))));
+  ASSERT_EQ(0, face_.sentData_.size());
+
+  vector<Name> names;
+  names.push_back(Name("/b/1"));
+  // A name which is already published is skipped.
+  names.push_back(Name("/a/1"));
+  names.push_back(Name("/c/1"));
+  fullPSync.publishNames(names);
+
+  // The pending Interest gets one reply with all the new names.
+  ASSERT_EQ(1, face_.sentData_.size());
+  vector<Name> sentNames = getSentNames();
+  ASSERT_EQ(2, sentNames.size());
+  ASSERT_EQ(Name("/b/1"), sentNames[0]);
+  ASSERT_EQ(Name("/c/1"), sentNames[1]);
+
+  // Publishing only names which are already published doesn't reply.
+  face_.receive(makeSyncInterest(names));
+  fullPSync.publishNames(names);
+  ASSERT_EQ(1, face_.sentData_.size());
+}
+
+TEST_F(TestFullPSync2017, RemoveName)
+{
+  FullPSync2017 fullPSync(40, face_, syncPrefix_, &onNamesUpdate, keyChain_);
+  fullPSync.publishName(Name("/a/1"));
+  fullPSync.publishName(Name("/b/1"));
+  fullPSync.removeName(Name("/a/1"));
+  // Removing a name which is not published does nothing.
+  fullPSync.removeName(Name("/c/1"));
+
+  // The IBLT only has /b/1, so there is no difference and no reply.
+  face_.receive(makeSyncInterest(vector<Name>(1, Name("/b/1"))));
+  ASSERT_EQ(0, face_.sentData_.size());
+
+  // A sync Interest with an empty IBLT only gets /b/1.
+  face_.receive(makeSyncInterest(vector<Name>()));
+  ASSERT_EQ(1, face_.sentData_.size());
+  vector<Name> sentNames = getSentNames();
+  ASSERT_EQ(1, sentNames.size());
+  ASSERT_EQ(Name("/b/1"), sentNames[0]);
+
+  // The removed name can be published again.
+  fullPSync.publishName(Name("/a/1"));
+  ASSERT_EQ(2, face_.sentData_.size());
+  sentNames = getSentNames();
+  ASSERT_EQ(1, sentNames.size());
+  ASSERT_EQ(Name("/a/1"), sentNames[0]);
+}
+
+TEST_F(TestFullPSync2017, PublishNamesWithUsers)
+{
+  FullPSync2017WithUsers fullPSync
+    (40, face_, syncPrefix_, Name("/a"), &onUpdate, keyChain_);
+  fullPSync.addUserNode(Name("/b"));
+  fullPSync.publishName(Name("/a"), 1);
+
+  face_.receive(makeSyncInterest
+    (vector<Name>(1, Name("/a").appendNumber(1))));
+  ASSERT_EQ(0, face_.sentData_.size());
+
+  vector<pair<Name, int> > updates;
+  updates.push_back(make_pair(Name("/a"), -1));
+  updates.push_back(make_pair(Name("/b"), 1));
+  // A prefix which was not added is skipped.
+  updates.push_back(make_pair(Name("/c"), 1));
+  // Only the last sequence number of the same prefix is inserted.
+  updates.push_back(make_pair(Name("/a"), 3));
+  fullPSync.publishNames(updates);
+
+  ASSERT_EQ(3, fullPSync.getSequenceNo(Name("/a")));
+  ASSERT_EQ(1, fullPSync.getSequenceNo(Name("/b")));
+  ASSERT_EQ(-1, fullPSync.getSequenceNo(Name("/c")));
+
+  // The pending Interest gets one reply with the new sequence numbers.
+  ASSERT_EQ(1, face_.sentData_.size());
+  vector<Name> sentNames = getSentNames();
+  ASSERT_EQ(2, sentNames.size());
+  ASSERT_EQ(Name("/a").appendNumber(3), sentNames[0]);
+  ASSERT_EQ(Name("/b").appendNumber(1), sentNames[1]);
+
+  // The old sequence number /a/1 was removed from the IBLT, so a sync Interest
+  // with the new names has no difference and gets no reply.
+  vector<Name> names;
+  names.push_back(Name("/a").appendNumber(3));
+  names.push_back(Name("/b").appendNumber(1));
+  face_.receive(makeSyncInterest(names));
+  ASSERT_EQ(1, face_.sentData_.size());
+}
+
+TEST_F(TestFullPSync2017, PartitionsReconcile)
+{
+  PSyncTestFace face1;
+  PSyncTestFace face2;
+  vector<Name> receivedNames1;
+  vector<Name> receivedNames2;
+  ptr_lib::shared_ptr<FullPSync2017> sync1 =
+    makePartitionedSync(face1, receivedNames1);
+  ptr_lib::shared_ptr<FullPSync2017> sync2 =
+    makePartitionedSync(face2, receivedNames2);
+  // The digests are the same, so each sync Interest is pending.
+  PSyncTestFace::exchange(face1, face2);
+  ASSERT_EQ(0, face1.sentData_.size());
+  ASSERT_EQ(0, face2.sentData_.size());
+
+  // Get two names in different partitions.
+  vector<Name> names;
+  names.push_back(Name("/a/1"));
+  for (int i = 2; names.size() < 2; ++i) {
+    Name name = Name("/a").append(to_string(i));
+    if (getPartition(name) != getPartition(names[0]))
+      names.push_back(name);
+  }
+  sort(names.begin(), names.end());
+  set<uint64_t> differentPartitions;
+  differentPartitions.insert(getPartition(names[0]));
+  differentPartitions.insert(getPartition(names[1]));
+
+  sync1->publishNames(names);
+  PSyncTestFace::exchange(face1, face2);
+
+  ASSERT_EQ(names, receivedNames2);
+  ASSERT_EQ(0, receivedNames1.size());
+  // Only the partitions with a different digest are fetched.
+  ASSERT_EQ(differentPartitions, face2.getFetchedPartitions(syncPrefix_));
+  // The sync Interest with partition digests is renewed once for the round,
+  // not once for each partition.
+  ASSERT_EQ(2, face2.getNDigestInterests(syncPrefix_));
+
+  // When the timers expire, only one chain of periodic sync Interests sends.
+  face2.callLaterCallbacks();
+  ASSERT_EQ(3, face2.getNDigestInterests(syncPrefix_));
+
+  // Now the digests are the same, so there is nothing more to fetch.
+  PSyncTestFace::exchange(face1, face2);
+  ASSERT_EQ(differentPartitions, face2.getFetchedPartitions(syncPrefix_));
+  ASSERT_EQ(3, face2.getNDigestInterests(syncPrefix_));
+  ASSERT_EQ(names, receivedNames2);
+}
+
+TEST_F(TestFullPSync2017, PartitionDigestsLength)
+{
+  PSyncTestFace face;
+  vector<Name> receivedNames;
+  ptr_lib::shared_ptr<FullPSync2017> sync =
+    makePartitionedSync(face, receivedNames);
+
+  // A sync Interest without 8 bytes for each partition is not pending, so it
+  // doesn't get a reply after a publish.
+  face.receive(makeDigestsInterest(8 * N_PARTITIONS - 1));
+  face.receive(makeDigestsInterest(8 * N_PARTITIONS + 8));
+  sync->publishName(Name("/a/1"));
+  ASSERT_EQ(0, face.sentData_.size());
+
+  // Reply to our own sync Interest with digests of the wrong length.
+  Name digestsInterestName = face.sentInterests_.back()->getName();
+  ASSERT_EQ(syncPrefix_.size() + 1, digestsInterestName.size());
+  face.deliver(makeDigestsData
+    (digestsInterestName, vector<uint8_t>(8 * N_PARTITIONS - 1, 1)));
+  ASSERT_EQ(0, face.getFetchedPartitions(syncPrefix_).size());
+
+  // Send the next sync Interest, which has the digests with /a/1.
+  face.callLaterCallbacks();
+  digestsInterestName = face.sentInterests_.back()->getName();
+  ASSERT_EQ(syncPrefix_.size() + 1, digestsInterestName.size());
+
+  // Reply with digests of the correct length where only partition 1 differs.
+  Blob ownDigests = digestsInterestName.get(-1).getValue();
+  vector<uint8_t> digests(ownDigests.buf(), ownDigests.buf() + ownDigests.size());
+  ++digests[8 * 1];
+  face.deliver(makeDigestsData(digestsInterestName, digests));
+  ASSERT_EQ(set<uint64_t>({ 1 }), face.getFetchedPartitions(syncPrefix_));
+}
+
+TEST_F(TestFullPSync2017, PartitionComponent)
+{
+  PSyncTestFace face;
+  vector<Name> receivedNames;
+  ptr_lib::shared_ptr<FullPSync2017> sync =
+    makePartitionedSync(face, receivedNames);
+  Name name("/a/1");
+  sync->publishName(name);
+
+  // The partition is out of range.
+  face.receive(makePartitionSyncInterest
+    (Name::Component::fromNumber(N_PARTITIONS)));
+  // The partition is not a generic component.
+  face.receive(makePartitionSyncInterest(Name::Component::fromNumber
+    (getPartition(name), ndn_NameComponentType_OTHER_CODE, 0x21)));
+  ASSERT_EQ(0, face.sentData_.size());
+
+  // A sync Interest for the partition of the name with an empty IBLT gets it.
+  face.receive(makePartitionSyncInterest
+    (Name::Component::fromNumber(getPartition(name))));
+  ASSERT_EQ(1, face.sentData_.size());
+  ASSERT_EQ(vector<Name>(1, name), getSentNames(face.sentData_));
+
+  // Another partition has no names, so the sync Interest is pending.
+  face.receive(makePartitionSyncInterest
+    (Name::Component::fromNumber((getPartition(name) + 1) % N_PARTITIONS)));
+  ASSERT_EQ(1, face.sentData_.size());
+}
+
+TEST_F(TestFullPSync2017, PendingPartitionDigests)
+{
+  PSyncTestFace face;
+  vector<Name> receivedNames;
+  ptr_lib::shared_ptr<FullPSync2017> sync =
+    makePartitionedSync(face, receivedNames);
+
+  // The digests of an empty producer are all zero, so the Interest is pending.
+  ptr_lib::shared_ptr<Interest> digestsInterest =
+    makeDigestsInterest(8 * N_PARTITIONS);
+  face.receive(digestsInterest);
+  ASSERT_EQ(0, face.sentData_.size());
+
+  // satisfyPendingInterests replies with the new digests.
+  Name name("/a/1");
+  sync->publishName(name);
+  ASSERT_EQ(1, face.sentData_.size());
+  ASSERT_TRUE(digestsInterest->getName().isPrefixOf
+    (face.sentData_[0]->getName()));
+  const Blob& digests = face.sentData_[0]->getContent();
+  ASSERT_EQ(8 * N_PARTITIONS, digests.size());
+  // Only the digest of the partition of the name is not zero. The count is 1.
+  for (size_t i = 0; i < N_PARTITIONS; ++i) {
+    if (i == getPartition(name))
+      ASSERT_EQ(1, digests.buf()[8 * i]);
+    else
+      ASSERT_EQ(vector<uint8_t>(8, 0), vector<uint8_t>
+        (digests.buf() + 8 * i, digests.buf() + 8 * (i + 1)));
+  }
+
+  // The pending Interest was removed, so it doesn't get another reply.
+  sync->publishName(Name("/b/1"));
+  ASSERT_EQ(1, face.sentData_.size());
+}
+
+TEST_F(TestFullPSync2017, HashNameWireEncoding)
+{
+  PSyncTestFace face1;
+  PSyncTestFace face2;
+  vector<Name> receivedNames1;
+  vector<Name> receivedNames2;
+  FullPSync2017 sync1
+    (40, face1, syncPrefix_, bind(&appendNames, _1, &receivedNames1),
+     keyChain_);
+  FullPSync2017 sync2
+    (40, face2, syncPrefix_, bind(&appendNames, _1, &receivedNames2),
+     keyChain_);
+  sync1.setHashNameWireEncoding(true);
+  sync2.setHashNameWireEncoding(true);
+  PSyncTestFace::exchange(face1, face2);
+
+  vector<Name> names;
+  names.push_back(Name("/a/1"));
+  names.push_back(Name("/b/1"));
+  sync1.publishNames(names);
+  PSyncTestFace::exchange(face1, face2);
+
+  ASSERT_EQ(names, receivedNames2);
+  ASSERT_EQ(0, receivedNames1.size());
+  // The renewed sync Interest has the IBLT of the wire encoding hashes.
+  ASSERT_EQ(makeSyncInterestName(names, true),
+            face2.sentInterests_.back()->getName());
+}
+
+TEST_F(TestFullPSync2017, RehashNames)
+{
+  PSyncTestFace face;
+  FullPSync2017 fullPSync(40, face, syncPrefix_, &onNamesUpdate, keyChain_);
+  vector<Name> names;
+  names.push_back(Name("/a/1"));
+  names.push_back(Name("/b/1"));
+  fullPSync.publishNames(names);
+
+  fullPSync.setHashNameWireEncoding(true);
+  // The next sync Interest has the IBLT of the new hashes.
+  face.callLaterCallbacks();
+  ASSERT_EQ(makeSyncInterestName(names, true),
+            face.sentInterests_.back()->getName());
+
+  // hashToName_ has the new hashes, so an empty IBLT gets both names.
+  face.receive(makeSyncInterest(vector<Name>(), true));
+  ASSERT_EQ(1, face.sentData_.size());
+  ASSERT_EQ(names, getSentNames(face.sentData_));
+
+  // nameToHash_ has the new hashes, so removing a name removes its new hash.
+  fullPSync.publishName(Name("/a/1"));
+  ASSERT_EQ(1, face.sentData_.size());
+  fullPSync.removeName(Name("/a/1"));
+  face.callLaterCallbacks();
+  ASSERT_EQ(makeSyncInterestName(vector<Name>(1, Name("/b/1")), true),
+            face.sentInterests_.back()->getName());
+
+  // Switching back rehashes with the URI.
+  fullPSync.setHashNameWireEncoding(false);
+  face.callLaterCallbacks();
+  ASSERT_EQ(makeSyncInterestName(vector<Name>(1, Name("/b/1")), false),
+            face.sentInterests_.back()->getName());
+}
+
+TEST_F(TestFullPSync2017, HashNameWireEncodingWithUsers)
+{
+  PSyncTestFace face1;
+  PSyncTestFace face2;
+  FullPSync2017WithUsers sync1
+    (40, face1, syncPrefix_, Name("/a"), &onUpdate, keyChain_);
+  FullPSync2017WithUsers sync2
+    (40, face2, syncPrefix_, Name("/b"), &onUpdate, keyChain_);
+  sync1.setHashNameWireEncoding(true);
+  sync2.setHashNameWireEncoding(true);
+  PSyncTestFace::exchange(face1, face2);
+
+  sync1.publishName(Name("/a"));
+  PSyncTestFace::exchange(face1, face2);
+  ASSERT_EQ(1, sync2.getSequenceNo(Name("/a")));
+  sync1.publishName(Name("/a"));
+  PSyncTestFace::exchange(face1, face2);
+  ASSERT_EQ(2, sync2.getSequenceNo(Name("/a")));
+  // The old sequence number was removed with its wire encoding hash.
+  ASSERT_EQ
+    (makeSyncInterestName(vector<Name>(1, Name("/a").appendNumber(2)), true),
+     face2.sentInterests_.back()->getName());
+}
+
+TEST_F(TestFullPSync2017, RehashNamesWithUsers)
+{
+  PSyncTestFace face;
+  FullPSync2017WithUsers fullPSync
+    (40, face, syncPrefix_, Name("/a"), &onUpdate, keyChain_);
+  fullPSync.publishName(Name("/a"), 1);
+  Name name1 = Name("/a").appendNumber(1);
+
+  fullPSync.setHashNameWireEncoding(true);
+  face.callLaterCallbacks();
+  ASSERT_EQ(makeSyncInterestName(vector<Name>(1, name1), true),
+            face.sentInterests_.back()->getName());
+
+  // The other IBLT has the next sequence number /a/2, so /a/1 is not sent.
+  // This needs the next hash to use the wire encoding.
+  face.receive(makeSyncInterest
+    (vector<Name>(1, Name("/a").appendNumber(2)), true));
+  ASSERT_EQ(0, face.sentData_.size());
+
+  face.receive(makeSyncInterest(vector<Name>(), true));
+  ASSERT_EQ(1, face.sentData_.size());
+  ASSERT_EQ(vector<Name>(1, name1), getSentNames(face.sentData_));
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -33,6 +33,7 @@
  * A copy of the GNU Lesser General Public License is in the file COPYING.
  */
 
+#include <algorithm>
 #include "gtest/gtest.h"
 #include <ndn-ind/name.hpp>
 #include <ndn-ind/lite/util/crypto-lite.hpp>
@@ -225,6 +226,90 @@ TEST_F(TestInvertibleBloomLookupTable, DifferenceBwOversizedIblts)
   ASSERT_TRUE(!receivedIblt.listEntries(positive, negative));
 }
 
+TEST_F(TestInvertibleBloomLookupTable, PeelIntoReusedDifference)
+{
+  size_t size = 40;
+
+  InvertibleBloomLookupTable ownIblt(size);
+  InvertibleBloomLookupTable receivedIblt(size);
+  vector<uint32_t> expectedPositive;
+  vector<uint32_t> expectedNegative;
+
+  for (int i = 0; i < 30; ++i) {
+    string prefix = Name("/test/memphis").appendNumber(i).toUri();
+    uint32_t newHash = CryptoLite::murmurHash3(11, prefix.data(), prefix.size());
+    if (i % 3 == 0) {
+      ownIblt.insert(newHash);
+      expectedPositive.push_back(newHash);
+    }
+    else if (i % 3 == 1) {
+      receivedIblt.insert(newHash);
+      expectedNegative.push_back(newHash);
+    }
+    else {
+      ownIblt.insert(newHash);
+      receivedIblt.insert(newHash);
+    }
+  }
+  sort(expectedPositive.begin(), expectedPositive.end());
+  sort(expectedNegative.begin(), expectedNegative.end());
+
+  InvertibleBloomLookupTable diff(size);
+  vector<uint32_t> positive;
+  vector<uint32_t> negative;
+  // Repeat with the same scratch IBLT and vectors.
+  for (int i = 0; i < 2; ++i) {
+    ownIblt.difference(receivedIblt, diff);
+    ASSERT_TRUE(diff.peelEntries(positive, negative));
+    ASSERT_EQ(expectedPositive, positive);
+    ASSERT_EQ(expectedNegative, negative);
+  }
+
+  // The const listEntries should give the same result without changing the IBLT.
+  ptr_lib::shared_ptr<InvertibleBloomLookupTable> diff2 =
+    ownIblt.difference(receivedIblt);
+  InvertibleBloomLookupTable diff2Copy(*diff2);
+  ASSERT_TRUE(diff2->listEntries(positive, negative));
+  ASSERT_EQ(expectedPositive, positive);
+  ASSERT_EQ(expectedNegative, negative);
+  ASSERT_TRUE(*diff2 == diff2Copy);
+}
+
+TEST_F(TestInvertibleBloomLookupTable, CachedEncodingAndCompressionLevel)
+{
+  size_t size = 10;
+
+  InvertibleBloomLookupTable iblt(size);
+  string prefix = Name("/test/memphis").appendNumber(1).toUri();
+  uint32_t hash1 = CryptoLite::murmurHash3(11, prefix.data(), prefix.size());
+  iblt.insert(hash1);
+
+  // Encoding again without a change should return the cached encoding.
+  Blob encoding = iblt.encode();
+  ASSERT_EQ(encoding.buf(), iblt.encode().buf());
+
+  prefix = Name("/test/memphis").appendNumber(2).toUri();
+  uint32_t hash2 = CryptoLite::murmurHash3(11, prefix.data(), prefix.size());
+  iblt.insert(hash2);
+  Blob encoding2 = iblt.encode();
+  ASSERT_FALSE(encoding.equals(encoding2));
+
+  // An encoding with no compression should decode to the same IBLT.
+  iblt.setCompressionLevel(0);
+  Blob uncompressedEncoding = iblt.encode();
+  ASSERT_TRUE(uncompressedEncoding.size() > encoding2.size());
+  InvertibleBloomLookupTable decoded(size);
+  decoded.initialize(uncompressedEncoding);
+  ASSERT_TRUE(iblt == decoded);
+
+  // After removing the change and restoring the level, the encoding should match.
+  iblt.erase(hash2);
+  iblt.setCompressionLevel(9);
+  ASSERT_TRUE(encoding.equals(iblt.encode()));
+
+  ASSERT_THROW(iblt.setCompressionLevel(10), runtime_error);
+}
+
 int
 main(int argc, char **argv)
 {
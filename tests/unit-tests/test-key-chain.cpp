@@ -40,6 +40,7 @@
 #include <cstdio>
 #include "identity-management-fixture.hpp"
 #include <ndn-ind/security/key-chain.hpp>
+#include <ndn-ind/security/verification-helpers.hpp>
 
 using namespace std;
 using namespace std::chrono;
@@ -170,6 +171,58 @@ TEST_F(TestKeyChain, SelfSignedCertValidity)
     system_clock::now() + hours(10 * 365 * 24));
 }
 
+TEST_F(TestKeyChain, VerifyDataSignatures)
+{
+  ptr_lib::shared_ptr<PibIdentity> ecIdentity = fixture_.addIdentity
+    ("/Security/V2/TestKeyChain/VerifyDataSignatures/EC", EcKeyParams());
+  ptr_lib::shared_ptr<PibIdentity> rsaIdentity = fixture_.addIdentity
+    ("/Security/V2/TestKeyChain/VerifyDataSignatures/RSA", RsaKeyParams());
+  ptr_lib::shared_ptr<PibIdentity> identities[] = { ecIdentity, rsaIdentity };
+
+  for (size_t iIdentity = 0; iIdentity < 2; ++iIdentity) {
+    ptr_lib::shared_ptr<PibIdentity> identity = identities[iIdentity];
+    ptr_lib::shared_ptr<CertificateV2> certificate =
+      identity->getDefaultKey()->getDefaultCertificate();
+
+    vector<ptr_lib::shared_ptr<Data> > segments;
+    vector<const Data*> dataList;
+    for (int i = 0; i < 6; ++i) {
+      ptr_lib::shared_ptr<Data> data(new Data
+        (Name("/test/object").appendSegment(i)));
+      data->setContent(Blob::fromRawStr("segment"));
+      fixture_.keyChain_.sign(*data, SigningInfo(identity));
+      segments.push_back(data);
+      dataList.push_back(data.get());
+    }
+    // Change the content of one segment after signing.
+    segments[3]->setContent(Blob::fromRawStr("changed"));
+    dataList.push_back(0);
+
+    vector<bool> results = VerificationHelpers::verifyDataSignatures
+      (dataList, *certificate);
+    ASSERT_EQ(dataList.size(), results.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+      ASSERT_EQ(i != 3, results[i]);
+      ASSERT_EQ(VerificationHelpers::verifyDataSignature
+                (*segments[i], *certificate), results[i]);
+    }
+    ASSERT_FALSE(results[segments.size()]);
+
+    // The key of the other identity doesn't verify any segment.
+    results = VerificationHelpers::verifyDataSignatures
+      (dataList, *identities[1 - iIdentity]->getDefaultKey()->getDefaultCertificate());
+    ASSERT_TRUE(find(results.begin(), results.end(), true) == results.end());
+  }
+
+  // A public key which can't be decoded fails every packet.
+  vector<const Data*> dataList(2, (const Data*)0);
+  vector<bool> results = VerificationHelpers::verifyDataSignatures
+    (dataList, Blob::fromRawStr("bad key"));
+  ASSERT_EQ(2, results.size());
+  ASSERT_FALSE(results[0]);
+  ASSERT_FALSE(results[1]);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -0,0 +1,768 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <thread>
+#include "gtest/gtest.h"
+#include <ndn-ind/digest-sha256-signature.hpp>
+#include <ndn-ind/face.hpp>
+#include <ndn-ind-tools/micro-forwarder/micro-forwarder-transport.hpp>
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn;
+using namespace ndntools;
+
+/**
+ * An InMemoryTransport is connected to a MicroForwarder face. The test calls
+ * receive() to simulate a packet from the remote side, and the packets sent by
+ * the forwarder are kept in a list.
+ */
+class InMemoryTransport : public Transport {
+public:
+  InMemoryTransport()
+  : elementListener_(0)
+  {
+  }
+
+  virtual bool
+  isLocal(const Transport::ConnectionInfo& connectionInfo) { return false; }
+
+  virtual bool
+  isAsync() { return false; }
+
+  virtual void
+  connect
+    (const Transport::ConnectionInfo& connectionInfo,
+     ElementListener& elementListener, const OnConnected& onConnected)
+  {
+    elementListener_ = &elementListener;
+    if (onConnected)
+      onConnected();
+  }
+
+  virtual void
+  send(const uint8_t *data, size_t dataLength)
+  {
+    Blob packet(data, dataLength);
+    {
+      lock_guard<mutex> lock(mutex_);
+      sentPackets_.push_back(packet);
+    }
+
+    if (onSend_)
+      onSend_(packet);
+  }
+
+  virtual void
+  processEvents() {}
+
+  virtual bool
+  getIsConnected() { return true; }
+
+  /**
+   * Give the element to the forwarder as if it was received on this face.
+   */
+  void
+  receive(const Blob& element)
+  {
+    elementListener_->onReceivedElement(element.buf(), element.size());
+  }
+
+  /**
+   * Get a copy of the packets sent by the forwarder on this face and clear
+   * the list.
+   */
+  vector<Blob>
+  takeSentPackets()
+  {
+    lock_guard<mutex> lock(mutex_);
+    vector<Blob> result;
+    result.swap(sentPackets_);
+    return result;
+  }
+
+  // If set, this is called after a packet is sent, for example to simulate an
+  // application which replies during the call.
+  func_lib::function<void(const Blob& packet)> onSend_;
+
+private:
+  ElementListener* elementListener_;
+  mutex mutex_;
+  vector<Blob> sentPackets_;
+};
+
+static Blob
+makeInterest
+  (const Name& name, uint32_t nonce, bool canBePrefix = false,
+   bool mustBeFresh = false)
+{
+  Interest interest(name);
+  interest.setCanBePrefix(canBePrefix);
+  interest.setMustBeFresh(mustBeFresh);
+  interest.setInterestLifetime(seconds(4));
+  uint8_t nonceBytes[] = {
+    (uint8_t)(nonce >> 24), (uint8_t)(nonce >> 16), (uint8_t)(nonce >> 8),
+    (uint8_t)nonce };
+  interest.setNonce(Blob(nonceBytes, sizeof(nonceBytes)));
+  return interest.wireEncode();
+}
+
+static Blob
+makeData(const Name& name, milliseconds freshnessPeriod = milliseconds(-1))
+{
+  Data data(name);
+  data.setContent(Blob((const uint8_t*)"content", 7));
+  if (freshnessPeriod.count() >= 0)
+    data.getMetaInfo().setFreshnessPeriod(freshnessPeriod);
+  data.setSignature(DigestSha256Signature());
+  data.getSignature()->setSignature(Blob(vector<uint8_t>(32, 0)));
+  return data.wireEncode();
+}
+
+/**
+ * Append the TLV type or length as a VAR-NUMBER.
+ */
+static void
+appendVarNumber(vector<uint8_t>& output, uint64_t value)
+{
+  if (value < 253)
+    output.push_back((uint8_t)value);
+  else {
+    output.push_back(253);
+    output.push_back((uint8_t)(value >> 8));
+    output.push_back((uint8_t)value);
+  }
+}
+
+static void
+appendTlv(vector<uint8_t>& output, uint64_t type, const vector<uint8_t>& value)
+{
+  appendVarNumber(output, type);
+  appendVarNumber(output, value.size());
+  output.insert(output.end(), value.begin(), value.end());
+}
+
+/**
+ * Make an LpPacket with a Nack header for the Interest encoding.
+ */
+static Blob
+makeNack(const Blob& interestEncoding)
+{
+  vector<uint8_t> nackReason;
+  // NoRoute.
+  appendTlv(nackReason, 801, vector<uint8_t>(1, 150));
+  vector<uint8_t> lpValue;
+  appendTlv(lpValue, 800, nackReason);
+  appendTlv
+    (lpValue, 80, vector<uint8_t>(interestEncoding.buf(),
+                                  interestEncoding.buf() + interestEncoding.size()));
+  vector<uint8_t> lpPacket;
+  appendTlv(lpPacket, 100, lpValue);
+  return Blob(lpPacket);
+}
+
+/**
+ * Get the name of the Interest or Data packet in the sent element, which can
+ * also be an LpPacket.
+ */
+static Name
+getPacketName(const Blob& element)
+{
+  const uint8_t Tlv_Interest = 5;
+  const uint8_t Tlv_Data = 6;
+  if (element.buf()[0] == Tlv_Interest) {
+    Interest interest;
+    interest.wireDecode(element);
+    return interest.getName();
+  }
+  else if (element.buf()[0] == Tlv_Data) {
+    Data data;
+    data.wireDecode(element);
+    return data.getName();
+  }
+  else
+    return Name("/LpPacket");
+}
+
+class TestMicroForwarder : public ::testing::Test {
+public:
+  /**
+   * Add a face to the forwarder with a new InMemoryTransport.
+   * @param forwarder The MicroForwarder.
+   * @param transport Set this to the new InMemoryTransport.
+   * @return The face ID.
+   */
+  static int
+  addFace
+    (MicroForwarder& forwarder, ptr_lib::shared_ptr<InMemoryTransport>& transport)
+  {
+    transport = ptr_lib::make_shared<InMemoryTransport>();
+    return forwarder.addFace
+      ("test://", transport, ptr_lib::make_shared<Transport::ConnectionInfo>());
+  }
+};
+
+TEST_F(TestMicroForwarder, Multicast)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer1, producer2;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/a", addFace(forwarder, producer1));
+  forwarder.addRoute("/a", addFace(forwarder, producer2));
+
+  consumer->receive(makeInterest("/a/1", 1));
+  ASSERT_EQ(1, producer1->takeSentPackets().size());
+  ASSERT_EQ(1, producer2->takeSentPackets().size());
+
+  // A Nack from one upstream waits for the other.
+  consumer->receive(makeInterest("/a/2", 2));
+  producer1->takeSentPackets();
+  producer2->takeSentPackets();
+  producer1->receive(makeNack(makeInterest("/a/2", 2)));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+  producer2->receive(makeNack(makeInterest("/a/2", 2)));
+  vector<Blob> sent = consumer->takeSentPackets();
+  ASSERT_EQ(1, sent.size());
+  ASSERT_EQ(Name("/LpPacket"), getPacketName(sent[0]))
+    << "The consumer should get the Nack";
+
+  // The Data is returned to the consumer.
+  consumer->receive(makeInterest("/a/3", 3));
+  producer1->receive(makeData("/a/3"));
+  sent = consumer->takeSentPackets();
+  ASSERT_EQ(1, sent.size());
+  ASSERT_EQ(Name("/a/3"), getPacketName(sent[0]));
+}
+
+TEST_F(TestMicroForwarder, BestRouteNackRetry)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, expensive, cheap;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/a", addFace(forwarder, expensive), 10);
+  forwarder.addRoute("/a", addFace(forwarder, cheap), 5);
+  ASSERT_TRUE(forwarder.setStrategy
+    ("/a", "/localhost/nfd/strategy/best-route/%FD%05"));
+
+  Blob interest = makeInterest("/a/1", 1);
+  consumer->receive(interest);
+  ASSERT_EQ(0, expensive->takeSentPackets().size());
+  ASSERT_EQ(1, cheap->takeSentPackets().size());
+
+  // After a Nack, the Interest is retried on the untried next hop.
+  cheap->receive(makeNack(interest));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+  vector<Blob> sent = expensive->takeSentPackets();
+  ASSERT_EQ(1, sent.size());
+  ASSERT_EQ(Name("/a/1"), getPacketName(sent[0]))
+    << "The retry should be the Interest without the Nack header";
+
+  // When all next hops were tried, the Nack goes to the consumer.
+  expensive->receive(makeNack(interest));
+  ASSERT_EQ(0, cheap->takeSentPackets().size());
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+
+  // A Nack for an unknown Interest is dropped.
+  cheap->receive(makeNack(makeInterest("/a/2", 2)));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, StrategyChoice)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer1, producer2;
+  addFace(forwarder, consumer);
+  int faceId1 = addFace(forwarder, producer1);
+  int faceId2 = addFace(forwarder, producer2);
+  forwarder.addRoute("/a", faceId1);
+  forwarder.addRoute("/a", faceId2);
+
+  ASSERT_FALSE(forwarder.setStrategy("/a/b", "/localhost/nfd/strategy/unknown"));
+  ASSERT_FALSE(forwarder.setStrategy("/a/b", "/other/best-route"));
+  ASSERT_TRUE(forwarder.setStrategy("/a/b", "/localhost/nfd/strategy/round-robin"));
+
+  // The longest matching prefix selects the strategy.
+  consumer->receive(makeInterest("/a/c", 1));
+  ASSERT_EQ(1, producer1->takeSentPackets().size());
+  ASSERT_EQ(1, producer2->takeSentPackets().size());
+
+  // Round robin alternates between the next hops.
+  consumer->receive(makeInterest("/a/b/1", 2));
+  consumer->receive(makeInterest("/a/b/2", 3));
+  ASSERT_EQ(1, producer1->takeSentPackets().size());
+  ASSERT_EQ(1, producer2->takeSentPackets().size());
+
+  // Replace the strategy for the same prefix.
+  ASSERT_TRUE(forwarder.setStrategy("/a/b", "/localhost/nfd/strategy/multicast"));
+  consumer->receive(makeInterest("/a/b/3", 4));
+  ASSERT_EQ(1, producer1->takeSentPackets().size());
+  ASSERT_EQ(1, producer2->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, Asf)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer1, producer2;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/a", addFace(forwarder, producer1), 1);
+  forwarder.addRoute("/a", addFace(forwarder, producer2), 2);
+  ASSERT_TRUE(forwarder.setStrategy("/a", "/localhost/nfd/strategy/asf"));
+
+  // Neither face is measured, so use the lowest cost and also probe the other.
+  consumer->receive(makeInterest("/a/1", 1));
+  ASSERT_EQ(1, producer1->takeSentPackets().size());
+  ASSERT_EQ(1, producer2->takeSentPackets().size());
+
+  // Only producer2 answers, so it is the only measured face.
+  producer2->receive(makeData("/a/1"));
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+
+  // The measured face is preferred, and there is no probe until the interval.
+  consumer->receive(makeInterest("/a/2", 2));
+  ASSERT_EQ(0, producer1->takeSentPackets().size());
+  ASSERT_EQ(1, producer2->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, DuplicateNonce)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer1, consumer2, producer;
+  addFace(forwarder, consumer1);
+  addFace(forwarder, consumer2);
+  forwarder.addRoute("/a", addFace(forwarder, producer));
+
+  consumer1->receive(makeInterest("/a/1", 1));
+  // A looping Interest with the same nonce is dropped.
+  consumer2->receive(makeInterest("/a/1", 1));
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+
+  // The Data only goes to the downstream with a PIT entry.
+  producer->receive(makeData("/a/1"));
+  ASSERT_EQ(1, consumer1->takeSentPackets().size());
+  ASSERT_EQ(0, consumer2->takeSentPackets().size());
+
+  // The PIT entry is consumed.
+  producer->receive(makeData("/a/1"));
+  ASSERT_EQ(0, consumer1->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, MalformedPackets)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/", addFace(forwarder, producer));
+
+  // A truncated Interest where the outer length exceeds the element.
+  Blob interest = makeInterest("/a/b", 1);
+  Blob truncated(interest.buf(), interest.size() - 3);
+  ASSERT_THROW(consumer->receive(truncated), runtime_error);
+
+  // The Interest length is 1, but the Name TLV type and length are past it and
+  // the Name length is within the element but past the Interest.
+  const uint8_t nestedOverflow[] = { 5, 1, 7, 5, 8, 3, 'a', 'b', 'c' };
+  ASSERT_THROW
+    (consumer->receive(Blob(nestedOverflow, sizeof(nestedOverflow))),
+     runtime_error);
+
+  // A Name component whose length goes past the end of the Name.
+  vector<uint8_t> component;
+  appendTlv(component, 8, vector<uint8_t>(3, 'a'));
+  // Claim 10 bytes for the component value.
+  component[1] = 10;
+  vector<uint8_t> name;
+  appendTlv(name, 7, component);
+  vector<uint8_t> nonce;
+  appendTlv(nonce, 10, vector<uint8_t>(4, 1));
+  name.insert(name.end(), nonce.begin(), nonce.end());
+  vector<uint8_t> badComponent;
+  appendTlv(badComponent, 5, name);
+  ASSERT_THROW(consumer->receive(Blob(badComponent)), runtime_error);
+
+  // A Data packet with a huge length.
+  const uint8_t hugeData[] = { 6, 254, 0xff, 0xff, 0xff, 0xff, 7, 0 };
+  ASSERT_THROW
+    (consumer->receive(Blob(hugeData, sizeof(hugeData))), runtime_error);
+
+  ASSERT_EQ(0, producer->takeSentPackets().size());
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+
+  // The forwarder still works.
+  consumer->receive(interest);
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+  producer->receive(makeData("/a/b"));
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, ContentStore)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/a", addFace(forwarder, producer));
+  forwarder.setContentStoreCapacity(10000);
+
+  // Unsolicited Data is not cached.
+  producer->receive(makeData("/a/0", hours(1)));
+  ASSERT_EQ(0, forwarder.getContentStoreSize());
+
+  Blob fresh = makeData("/a/1", hours(1));
+  consumer->receive(makeInterest("/a/1", 1));
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+  producer->receive(fresh);
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+  ASSERT_EQ(fresh.size(), forwarder.getContentStoreSize());
+
+  // A new Interest for the name is answered from the Content Store.
+  consumer->receive(makeInterest("/a/1", 2, false, true));
+  vector<Blob> sent = consumer->takeSentPackets();
+  ASSERT_EQ(1, sent.size());
+  ASSERT_TRUE(sent[0].equals(fresh));
+  ASSERT_EQ(0, producer->takeSentPackets().size());
+
+  // A prefix matches with CanBePrefix, but not without it.
+  consumer->receive(makeInterest("/a", 3, true));
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+  consumer->receive(makeInterest("/a", 4, false));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+
+  // An Interest for the full name with the implicit digest matches.
+  Data freshData;
+  freshData.wireDecode(fresh);
+  consumer->receive(makeInterest(*freshData.getFullName(), 5));
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+  Name wrongDigest("/a/1");
+  wrongDigest.appendImplicitSha256Digest(Blob(vector<uint8_t>(32, 1)));
+  consumer->receive(makeInterest(wrongDigest, 6));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+  producer->takeSentPackets();
+
+  // Capacity 0 disables the Content Store and removes the cached Data.
+  forwarder.setContentStoreCapacity(0);
+  ASSERT_EQ(0, forwarder.getContentStoreSize());
+  consumer->receive(makeInterest("/a/1", 7));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, ContentStoreFreshness)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/a", addFace(forwarder, producer));
+  forwarder.setContentStoreCapacity(10000);
+
+  // Data without a FreshnessPeriod is immediately stale.
+  consumer->receive(makeInterest("/a/stale", 1));
+  producer->receive(makeData("/a/stale"));
+  consumer->receive(makeInterest("/a/short", 2));
+  producer->receive(makeData("/a/short", milliseconds(50)));
+  ASSERT_EQ(2, consumer->takeSentPackets().size());
+  producer->takeSentPackets();
+
+  // Without MustBeFresh, stale Data is used.
+  consumer->receive(makeInterest("/a/stale", 3));
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+  ASSERT_EQ(0, producer->takeSentPackets().size());
+
+  // With MustBeFresh, stale Data is not used and the Interest is forwarded.
+  consumer->receive(makeInterest("/a/stale", 4, false, true));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+
+  // Data is fresh until its FreshnessPeriod elapses.
+  consumer->receive(makeInterest("/a/short", 5, false, true));
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+  this_thread::sleep_for(milliseconds(100));
+  consumer->receive(makeInterest("/a/short", 6, false, true));
+  ASSERT_EQ(0, consumer->takeSentPackets().size());
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, ContentStoreEviction)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/a", addFace(forwarder, producer));
+
+  Blob data1 = makeData("/a/1", hours(1));
+  // Leave room for two Data packets.
+  forwarder.setContentStoreCapacity(data1.size() * 2 + data1.size() / 2);
+  for (int i = 1; i <= 2; ++i) {
+    Name name = Name("/a").append(to_string(i));
+    consumer->receive(makeInterest(name, i));
+    producer->receive(makeData(name, hours(1)));
+  }
+  // Use /a/1 so that /a/2 is the least recently used.
+  consumer->receive(makeInterest("/a/1", 10));
+  consumer->takeSentPackets();
+  producer->takeSentPackets();
+
+  consumer->receive(makeInterest("/a/3", 3));
+  producer->receive(makeData("/a/3", hours(1)));
+  consumer->takeSentPackets();
+  producer->takeSentPackets();
+  ASSERT_EQ(data1.size() * 2, forwarder.getContentStoreSize());
+
+  consumer->receive(makeInterest("/a/1", 11));
+  ASSERT_EQ(1, consumer->takeSentPackets().size());
+  consumer->receive(makeInterest("/a/2", 12));
+  ASSERT_EQ(0, consumer->takeSentPackets().size())
+    << "The least recently used Data should be evicted";
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, Shards)
+{
+  MicroForwarder forwarder(8, 2);
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer;
+  addFace(forwarder, consumer);
+  forwarder.addRoute(Name(), addFace(forwarder, producer));
+
+  // The names under /ndn are spread over the shards.
+  for (int i = 0; i < 20; ++i) {
+    Name name = Name("/ndn").append("app" + to_string(i)).append("data");
+    consumer->receive(makeInterest(name, i + 1));
+    ASSERT_EQ(1, producer->takeSentPackets().size());
+    producer->receive(makeData(name, hours(1)));
+    vector<Blob> sent = consumer->takeSentPackets();
+    ASSERT_EQ(1, sent.size());
+    ASSERT_EQ(name, getPacketName(sent[0]));
+  }
+
+  forwarder.setContentStoreCapacity(100000);
+  // An Interest with CanBePrefix and fewer components than are hashed for the
+  // shard is satisfied by Data which is processed in another shard.
+  consumer->receive(makeInterest(Name(), 100, true));
+  consumer->receive(makeInterest("/ndn", 101, true));
+  consumer->receive(makeInterest("/ndn/app1/x", 102));
+  ASSERT_EQ(3, producer->takeSentPackets().size());
+  Blob data = makeData("/ndn/app1/x", hours(1));
+  producer->receive(data);
+  ASSERT_EQ(3, consumer->takeSentPackets().size());
+
+  // The Data is cached in the shard of its first components, which is also
+  // the shard of an Interest with the implicit digest.
+  Data decodedData;
+  decodedData.wireDecode(data);
+  consumer->receive(makeInterest(*decodedData.getFullName(), 103));
+  vector<Blob> sent = consumer->takeSentPackets();
+  ASSERT_EQ(1, sent.size());
+  ASSERT_TRUE(sent[0].equals(data));
+  ASSERT_EQ(0, producer->takeSentPackets().size());
+
+  // The Nack is processed in the shard of the Interest.
+  Blob interest = makeInterest("/ndn/app2/y", 104);
+  consumer->receive(interest);
+  producer->receive(makeNack(interest));
+  sent = consumer->takeSentPackets();
+  ASSERT_EQ(1, sent.size());
+  ASSERT_EQ(Name("/LpPacket"), getPacketName(sent[0]));
+}
+
+TEST_F(TestMicroForwarder, TokenBucket)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer;
+  addFace(forwarder, consumer);
+  int producerFaceId = addFace(forwarder, producer);
+  forwarder.addRoute("/a", producerFaceId);
+
+  // The bucket has tokens for one Interest and refills very slowly.
+  size_t interestSize = makeInterest("/a/0", 0).size();
+  forwarder.setFaceRateLimit(producerFaceId, 1.0, interestSize - 1);
+  forwarder.setFaceQueueLimits(producerFaceId, 2 * interestSize, interestSize);
+
+  for (int i = 0; i < 4; ++i)
+    consumer->receive(makeInterest(Name("/a").append(to_string(i)), i));
+
+  // The first Interest uses the burst. The second is queued. The third is
+  // queued with a CongestionMark because the queue is at the threshold. The
+  // fourth is dropped because the queue is full.
+  vector<Blob> sent = producer->takeSentPackets();
+  ASSERT_EQ(1, sent.size());
+  ASSERT_EQ(Name("/a/0"), getPacketName(sent[0]));
+  MicroForwarder::QueueCounters counters;
+  ASSERT_TRUE(forwarder.getFaceQueueCounters(producerFaceId, counters));
+  ASSERT_EQ(2, counters.getNQueuedPackets());
+  ASSERT_EQ(1, counters.getNSentPackets());
+  ASSERT_EQ(1, counters.getNDroppedPackets());
+  ASSERT_EQ(1, counters.getNCongestionMarkedPackets());
+
+  // processEvents doesn't send before the bucket has tokens.
+  forwarder.processEvents();
+  ASSERT_EQ(0, producer->takeSentPackets().size());
+
+  // Removing the rate limit sends the queued packets in order.
+  forwarder.setFaceRateLimit(producerFaceId, 0);
+  forwarder.processEvents();
+  sent = producer->takeSentPackets();
+  ASSERT_EQ(2, sent.size());
+  ASSERT_EQ(Name("/a/1"), getPacketName(sent[0]));
+  // The marked Interest is in an LpPacket.
+  ASSERT_EQ(Name("/LpPacket"), getPacketName(sent[1]));
+  ASSERT_TRUE(forwarder.getFaceQueueCounters(producerFaceId, counters));
+  ASSERT_EQ(0, counters.getNQueuedPackets());
+  ASSERT_EQ(0, counters.getNQueuedBytes());
+  ASSERT_EQ(3, counters.getNSentPackets());
+}
+
+TEST_F(TestMicroForwarder, DeficitRoundRobin)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumerA, consumerB, producer;
+  addFace(forwarder, consumerA);
+  addFace(forwarder, consumerB);
+  int producerFaceId = addFace(forwarder, producer);
+  forwarder.addRoute("/a", producerFaceId);
+  // After the first Interest, queue everything.
+  forwarder.setFaceRateLimit(producerFaceId, 1.0, 1);
+  consumerA->receive(makeInterest("/a/first", 100));
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+
+  // Use Interests larger than half the DRR quantum so that each consumer
+  // sends one per round.
+  string padding(300, 'x');
+  for (int i = 0; i < 6; ++i)
+    consumerA->receive(makeInterest
+      (Name("/a/A").append(padding).append(to_string(i)), i));
+  for (int i = 0; i < 2; ++i)
+    consumerB->receive(makeInterest
+      (Name("/a/B").append(padding).append(to_string(i)), 10 + i));
+  ASSERT_EQ(0, producer->takeSentPackets().size());
+
+  forwarder.setFaceRateLimit(producerFaceId, 0);
+  forwarder.processEvents();
+  vector<Blob> sent = producer->takeSentPackets();
+  ASSERT_EQ(8, sent.size());
+
+  // Consumer B, which sent later, doesn't wait for all of consumer A's
+  // Interests. Each consumer's Interests stay in order.
+  string order;
+  for (size_t i = 0; i < sent.size(); ++i)
+    order += getPacketName(sent[i]).get(1).toEscapedString();
+  ASSERT_EQ("ABAABAAA", order);
+}
+
+TEST_F(TestMicroForwarder, SendWithoutDeadlock)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, appA, appB;
+  addFace(forwarder, consumer);
+  forwarder.addRoute("/toA", addFace(forwarder, appA));
+  forwarder.addRoute("/toB", addFace(forwarder, appB));
+
+  // Each application takes a while to process a request, then sends a
+  // request to the other application while the forwarder is sending to it.
+  appA->onSend_ = [&](const Blob& packet) {
+    if (getPacketName(packet).get(1).toEscapedString() == "request") {
+      this_thread::sleep_for(milliseconds(50));
+      appA->receive(makeInterest("/toB/fromA", 10));
+    }
+  };
+  appB->onSend_ = [&](const Blob& packet) {
+    if (getPacketName(packet).get(1).toEscapedString() == "request") {
+      this_thread::sleep_for(milliseconds(50));
+      appB->receive(makeInterest("/toA/fromB", 11));
+    }
+  };
+
+  thread thread1([&]() { consumer->receive(makeInterest("/toA/request", 1)); });
+  thread thread2([&]() { consumer->receive(makeInterest("/toB/request", 2)); });
+  thread1.join();
+  thread2.join();
+
+  ASSERT_EQ(2, appA->takeSentPackets().size());
+  ASSERT_EQ(2, appB->takeSentPackets().size());
+}
+
+TEST_F(TestMicroForwarder, AppFaceCallbackInProcessEvents)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> producer;
+  forwarder.addRoute("/a", addFace(forwarder, producer));
+  forwarder.startFaceThreads();
+
+  Face face
+    (ptr_lib::make_shared<MicroForwarderTransport>(),
+     ptr_lib::make_shared<MicroForwarderTransport::ConnectionInfo>(&forwarder));
+  int nData = 0;
+  thread::id callbackThreadId;
+  face.expressInterest
+    (Interest(Name("/a/b")).setCanBePrefix(false),
+     [&](const ptr_lib::shared_ptr<const Interest>&,
+         const ptr_lib::shared_ptr<Data>&) {
+       ++nData;
+       callbackThreadId = this_thread::get_id();
+     });
+  ASSERT_EQ(1, producer->takeSentPackets().size());
+
+  // Reply from another thread, as a face thread would.
+  thread replyThread([&]() { producer->receive(makeData("/a/b")); });
+  replyThread.join();
+  // The Data is queued until the application calls processEvents.
+  ASSERT_EQ(0, nData);
+
+  face.processEvents();
+  ASSERT_EQ(1, nData);
+  ASSERT_EQ(this_thread::get_id(), callbackThreadId);
+
+  forwarder.stopFaceThreads();
+}
+
+TEST_F(TestMicroForwarder, FaceThreadSendsQueuedPackets)
+{
+  MicroForwarder forwarder;
+  ptr_lib::shared_ptr<InMemoryTransport> consumer, producer;
+  addFace(forwarder, consumer);
+  int producerFaceId = addFace(forwarder, producer);
+  forwarder.addRoute("/a", producerFaceId);
+  // Allow one Interest per 50 milliseconds with no burst.
+  size_t interestSize = makeInterest("/a/0", 0).size();
+  forwarder.setFaceRateLimit(producerFaceId, interestSize * 20.0, interestSize);
+  // Use a long sleep time to check that the face thread is woken when tokens
+  // are added, not polled.
+  forwarder.startFaceThreads(seconds(10));
+
+  for (int i = 0; i < 3; ++i)
+    consumer->receive(makeInterest(Name("/a").append(to_string(i)), i));
+  size_t nSent = producer->takeSentPackets().size();
+  ASSERT_GT(3, nSent);
+
+  // The face thread sends the queued Interests as tokens are added, without
+  // a call to processEvents.
+  for (int i = 0; i < 100 && nSent < 3; ++i) {
+    this_thread::sleep_for(milliseconds(10));
+    nSent += producer->takeSentPackets().size();
+  }
+  ASSERT_EQ(3, nSent);
+
+  forwarder.stopFaceThreads();
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
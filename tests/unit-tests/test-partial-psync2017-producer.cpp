@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-ind/sync/partial-psync2017-producer.hpp>
+#include "../../src/sync/detail/bloom-filter.hpp"
+#include "../../src/sync/detail/invertible-bloom-lookup-table.hpp"
+#include "in-memory-storage-face.hpp"
+
+using namespace std;
+using namespace ndn;
+
+class TestPartialPSync2017Producer : public ::testing::Test {
+public:
+  TestPartialPSync2017Producer()
+  : keyChain_("pib-memory:", "tpm-memory:"),
+    face_(&storage_),
+    syncPrefix_("/psync"),
+    userPrefix_("/testUser")
+  {
+    keyChain_.createIdentityV2(Name("/producer"));
+    producer_.reset(new PartialPSync2017Producer
+      (40, face_, syncPrefix_, userPrefix_, keyChain_));
+  }
+
+  /**
+   * Make a sync Interest with the Bloom filter components and an empty IBLT.
+   */
+  ptr_lib::shared_ptr<Interest>
+  makeSyncInterest
+    (const Name::Component& expectedNEntries,
+     const Name::Component& falsePositiveProbability,
+     const Name::Component& table)
+  {
+    Name name(syncPrefix_);
+    name.append("sync").append(expectedNEntries)
+      .append(falsePositiveProbability).append(table)
+      .append(InvertibleBloomLookupTable(40).encode());
+    return ptr_lib::make_shared<Interest>(name);
+  }
+
+  KeyChain keyChain_;
+  InMemoryStorageRetaining storage_;
+  InMemoryStorageFace face_;
+  Name syncPrefix_;
+  Name userPrefix_;
+  ptr_lib::shared_ptr<PartialPSync2017Producer> producer_;
+};
+
+TEST_F(TestPartialPSync2017Producer, HostileBloomFilter)
+{
+  producer_->publishName(userPrefix_);
+  Name::Component table(Blob(vector<uint8_t>(8, 0xff)));
+
+  // An expected number of entries which would overflow the table size.
+  face_.receive(makeSyncInterest
+    (Name::Component::fromNumber(0xffffffffffffffffULL),
+     Name::Component::fromNumber(1), table));
+  // A large but allowed number of entries with a table which doesn't match.
+  face_.receive(makeSyncInterest
+    (Name::Component::fromNumber(BloomFilter::MAX_EXPECTED_N_ENTRIES),
+     Name::Component::fromNumber(1), table));
+  // A false positive probability which is not less than 1.
+  face_.receive(makeSyncInterest
+    (Name::Component::fromNumber(10), Name::Component::fromNumber(5000),
+     table));
+  // Components which are not numbers.
+  face_.receive(makeSyncInterest
+    (Name::Component("x"), Name::Component("y"), table));
+  // The producer drops the Interests without a reply.
+  ASSERT_EQ(0, face_.sentData_.size());
+
+  // The producer still answers a valid sync Interest.
+  BloomFilter bloomFilter(40, 0.001);
+  bloomFilter.insert(userPrefix_);
+  Name bloomFilterName;
+  bloomFilter.appendToName(bloomFilterName);
+  face_.receive(makeSyncInterest
+    (bloomFilterName.get(0), bloomFilterName.get(1), bloomFilterName.get(2)));
+  ASSERT_EQ(1, face_.sentData_.size());
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -122,6 +122,9 @@ public:
   TearDown()
   {
     remove(pibSqlite3Fixture.databaseFilePath.c_str());
+    // Remove the write-ahead log files.
+    remove((pibSqlite3Fixture.databaseFilePath + "-wal").c_str());
+    remove((pibSqlite3Fixture.databaseFilePath + "-shm").c_str());
   }
 };
 
@@ -435,6 +438,49 @@ TEST_F(TestPibImpl, DefaultsManagement)
   }
 }
 
+TEST_F(TestPibImpl, Sqlite3DefaultsCache)
+{
+  PibDataFixture& fixture = pibSqlite3Fixture;
+  PibImpl& pib = *fixture.pib;
+
+  pib.addCertificate(*fixture.id1Key1Cert1);
+  pib.addCertificate(*fixture.id1Key1Cert2);
+  pib.addCertificate(*fixture.id1Key2Cert1);
+  pib.addCertificate(*fixture.id2Key1Cert1);
+
+  // Read the defaults twice so that the second read is from the cache.
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(fixture.id1, pib.getDefaultIdentity());
+    ASSERT_EQ(fixture.id1Key1Name, pib.getDefaultKeyOfIdentity(fixture.id1));
+    ASSERT_EQ(fixture.id1Key1Cert1->getName(),
+              pib.getDefaultCertificateOfKey(fixture.id1Key1Name)->getName());
+  }
+
+  // Changing the returned certificate doesn't change the cached one.
+  pib.getDefaultCertificateOfKey(fixture.id1Key1Name)->setName(Name("/changed"));
+  ASSERT_EQ(fixture.id1Key1Cert1->getName(),
+            pib.getDefaultCertificateOfKey(fixture.id1Key1Name)->getName());
+
+  // Changing the defaults updates the cache.
+  pib.setDefaultIdentity(fixture.id2);
+  ASSERT_EQ(fixture.id2, pib.getDefaultIdentity());
+  pib.setDefaultKeyOfIdentity(fixture.id1, fixture.id1Key2Name);
+  ASSERT_EQ(fixture.id1Key2Name, pib.getDefaultKeyOfIdentity(fixture.id1));
+  pib.setDefaultCertificateOfKey
+    (fixture.id1Key1Name, fixture.id1Key1Cert2->getName());
+  ASSERT_EQ(fixture.id1Key1Cert2->getName(),
+            pib.getDefaultCertificateOfKey(fixture.id1Key1Name)->getName());
+
+  // Removing an identity removes its cached defaults.
+  pib.removeIdentity(fixture.id1);
+  ASSERT_THROW(pib.getDefaultKeyOfIdentity(fixture.id1), Pib::Error);
+  ASSERT_THROW(pib.getDefaultCertificateOfKey(fixture.id1Key1Name), Pib::Error);
+  ASSERT_EQ(fixture.id2, pib.getDefaultIdentity());
+
+  pib.clearIdentities();
+  ASSERT_THROW(pib.getDefaultIdentity(), Pib::Error);
+}
+
 TEST_F(TestPibImpl, Overwrite)
 {
   for (size_t i = 0; i < sizeof(pibImpls) / sizeof(pibImpls[0]); ++i) {
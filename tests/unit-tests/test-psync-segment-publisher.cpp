@@ -0,0 +1,198 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include "../../src/sync/detail/psync-segment-publisher.hpp"
+#include "in-memory-storage-face.hpp"
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn;
+
+// This is the segment size in psync-segment-publisher.cpp.
+static const size_t SEGMENT_SIZE = MAX_NDN_PACKET_SIZE / 2;
+
+class TestPSyncSegmentPublisher : public ::testing::Test {
+public:
+  TestPSyncSegmentPublisher()
+  : keyChain_("pib-memory:", "tpm-memory:"),
+    face_(&storage_),
+    publisher_(face_, keyChain_),
+    interestName_("/psync/sync/iblt"),
+    dataName_(Name(interestName_).appendNumber(1))
+  {
+    keyChain_.createIdentityV2(Name("/producer"));
+  }
+
+  /**
+   * Make a content Blob of the size where each byte is its offset modulo 256.
+   */
+  static Blob
+  makeContent(size_t size)
+  {
+    ptr_lib::shared_ptr<vector<uint8_t> > content(new vector<uint8_t>(size));
+    for (size_t i = 0; i < size; ++i)
+      (*content)[i] = (uint8_t)i;
+    return Blob(content, false);
+  }
+
+  KeyChain keyChain_;
+  InMemoryStorageRetaining storage_;
+  InMemoryStorageFace face_;
+  PSyncSegmentPublisher publisher_;
+  Name interestName_;
+  Name dataName_;
+};
+
+TEST_F(TestPSyncSegmentPublisher, Segments)
+{
+  // The content size is an exact multiple of the segment size.
+  Blob content = makeContent(2 * SEGMENT_SIZE);
+  publisher_.publish(interestName_, dataName_, content, seconds(1));
+
+  // Only segment 0 is sent.
+  ASSERT_EQ(1, face_.sentData_.size());
+  const Data& segment0 = *face_.sentData_[0];
+  ASSERT_EQ(dataName_.size() + 2, segment0.getName().size());
+  ASSERT_TRUE(dataName_.isPrefixOf(segment0.getName()));
+  ASSERT_TRUE(segment0.getName()[-2].isVersion());
+  ASSERT_EQ(0, segment0.getName()[-1].toSegment());
+  ASSERT_EQ(1, segment0.getMetaInfo().getFinalBlockId().toSegment());
+  ASSERT_EQ(SEGMENT_SIZE, segment0.getContent().size());
+  ASSERT_TRUE(seconds(1) == segment0.getMetaInfo().getFreshnessPeriod());
+
+  Name segmentPrefix = segment0.getName().getPrefix(-1);
+  ASSERT_TRUE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(1)));
+  ASSERT_EQ(2, face_.sentData_.size());
+  const Data& segment1 = *face_.sentData_[1];
+  ASSERT_EQ(1, segment1.getName()[-1].toSegment());
+  ASSERT_EQ(1, segment1.getMetaInfo().getFinalBlockId().toSegment());
+  // The last segment is full, not empty.
+  ASSERT_EQ(SEGMENT_SIZE, segment1.getContent().size());
+  ASSERT_TRUE(Blob(content.buf() + SEGMENT_SIZE, SEGMENT_SIZE).equals
+    (segment1.getContent()));
+
+  // There is no segment 2.
+  ASSERT_FALSE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(2)));
+  ASSERT_EQ(2, face_.sentData_.size());
+
+  // A segment is signed once and the same Data packet is sent again.
+  ASSERT_TRUE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(1)));
+  ASSERT_EQ(3, face_.sentData_.size());
+  ASSERT_TRUE(segment1.wireEncode().equals(face_.sentData_[2]->wireEncode()));
+
+  // An Interest without a segment gets segment 0.
+  ASSERT_TRUE(publisher_.replyFromStore(interestName_));
+  ASSERT_EQ(4, face_.sentData_.size());
+  ASSERT_TRUE(segment0.wireEncode().equals(face_.sentData_[3]->wireEncode()));
+}
+
+TEST_F(TestPSyncSegmentPublisher, PartialAndEmptySegments)
+{
+  publisher_.publish
+    (interestName_, dataName_, makeContent(SEGMENT_SIZE + 1), seconds(1));
+  ASSERT_EQ(1, face_.sentData_.size());
+  Name segmentPrefix = face_.sentData_[0]->getName().getPrefix(-1);
+  ASSERT_EQ
+    (1, face_.sentData_[0]->getMetaInfo().getFinalBlockId().toSegment());
+  ASSERT_TRUE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(1)));
+  ASSERT_EQ(1, face_.sentData_[1]->getContent().size());
+
+  // Empty content has one empty segment.
+  Name emptyInterestName("/psync/sync/empty");
+  publisher_.publish
+    (emptyInterestName, Name(emptyInterestName).appendNumber(1), Blob(),
+     seconds(1));
+  ASSERT_EQ(3, face_.sentData_.size());
+  ASSERT_EQ(0, face_.sentData_[2]->getName()[-1].toSegment());
+  ASSERT_EQ
+    (0, face_.sentData_[2]->getMetaInfo().getFinalBlockId().toSegment());
+  ASSERT_EQ(0, face_.sentData_[2]->getContent().size());
+}
+
+TEST_F(TestPSyncSegmentPublisher, InterestForSegment)
+{
+  // An Interest for segment 1 immediately gets segment 1.
+  publisher_.publish
+    (Name(dataName_).appendSegment(1), dataName_,
+     makeContent(2 * SEGMENT_SIZE), seconds(1));
+  ASSERT_EQ(1, face_.sentData_.size());
+  ASSERT_EQ(1, face_.sentData_[0]->getName()[-1].toSegment());
+
+  // An Interest for a segment past the end gets nothing.
+  publisher_.publish
+    (Name(dataName_).appendSegment(5), dataName_,
+     makeContent(2 * SEGMENT_SIZE), seconds(1));
+  ASSERT_EQ(1, face_.sentData_.size());
+}
+
+TEST_F(TestPSyncSegmentPublisher, LazySigning)
+{
+  ptr_lib::shared_ptr<PibIdentity> identity =
+    keyChain_.createIdentityV2(Name("/signer"));
+  publisher_.publish
+    (interestName_, dataName_, makeContent(2 * SEGMENT_SIZE), seconds(1),
+     SigningInfo(identity));
+  Name segmentPrefix = face_.sentData_[0]->getName().getPrefix(-1);
+
+  // Segment 1 is not signed until it is requested, so it can't be signed
+  // after the identity is deleted. Segment 0 was already signed.
+  keyChain_.deleteIdentity(*identity);
+  ASSERT_ANY_THROW(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(1)));
+  // The failed segment is not saved unsigned.
+  ASSERT_ANY_THROW(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(1)));
+  ASSERT_TRUE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(0)));
+  ASSERT_EQ(2, face_.sentData_.size());
+}
+
+TEST_F(TestPSyncSegmentPublisher, Expiration)
+{
+  publisher_.publish
+    (interestName_, dataName_, makeContent(2 * SEGMENT_SIZE), seconds(1));
+  Name segmentPrefix = face_.sentData_[0]->getName().getPrefix(-1);
+
+  face_.delayedCallTable_.setNowOffset_(milliseconds(500));
+  face_.processEvents();
+  ASSERT_TRUE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(1)));
+
+  // One timer removes all the segments after the freshness period.
+  face_.delayedCallTable_.setNowOffset_(milliseconds(1500));
+  face_.processEvents();
+  ASSERT_FALSE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(0)));
+  ASSERT_FALSE(publisher_.replyFromStore
+    (Name(segmentPrefix).appendSegment(1)));
+  ASSERT_FALSE(publisher_.replyFromStore(interestName_));
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -26,6 +26,7 @@
 #include "../../src/util/regex/ndn-regex-repeat-matcher.hpp"
 #include "../../src/util/regex/ndn-regex-pattern-list-matcher.hpp"
 #include "../../src/util/regex/ndn-regex-top-matcher.hpp"
+#include "../../src/util/regex/ndn-regex-compiled-matcher.hpp"
 #include "gtest/gtest.h"
 
 using namespace std;
@@ -453,6 +454,65 @@ TEST_F(TestRegex, TopMatcherAdvanced)
   ASSERT_EQ(Name("/ndn/edu/ucla/yingdi/mac/"), cm->expand());
 }
 
+TEST_F(TestRegex, CompiledMatcher)
+{
+  // Compare with the backtracking matchers.
+  const char* exprs[] = {
+    "<a><b>", "<a>*<b>", "<a>+", "<>?<a>", "<a>{2}", "<a>{1,2}", "<a>{,2}",
+    "<a>{2,}", "[<a><b>]+", "[^<a><b>]<>*", "(<a>(<b>)?)*", "<c(.*)>(<>*)"
+  };
+  const char* uris[] = {
+    "/", "/a", "/b", "/a/b", "/a/a", "/a/a/a", "/b/a", "/c/a", "/cx/b/a",
+    "/a/b/a", "/c"
+  };
+  for (size_t i = 0; i < sizeof(exprs) / sizeof(exprs[0]); ++i) {
+    ptr_lib::shared_ptr<NdnRegexBackrefManager> backrefManager =
+      ptr_lib::make_shared<NdnRegexBackrefManager>();
+    NdnRegexPatternListMatcher patternList(exprs[i], backrefManager);
+    NdnRegexCompiledMatcher compiled(exprs[i]);
+    ASSERT_EQ(backrefManager->size(), compiled.getBackrefCount()) << exprs[i];
+
+    for (size_t j = 0; j < sizeof(uris) / sizeof(uris[0]); ++j) {
+      Name name(uris[j]);
+      ASSERT_EQ(patternList.match(name, 0, name.size()), compiled.match(name))
+        << exprs[i] << " " << uris[j];
+    }
+  }
+
+  // Capture groups of a component regex follow the groups before them.
+  NdnRegexCompiledMatcher compiled("(<a>)<(.*)\\.(.*)>(<>*)");
+  vector<vector<Name::Component> > backrefs;
+  ASSERT_TRUE(compiled.match(Name("/a/ucla.edu/x/y"), &backrefs));
+  ASSERT_EQ(4, backrefs.size());
+  ASSERT_EQ(Name("/a"), Name(backrefs[0]));
+  ASSERT_EQ(Name("/ucla"), Name(backrefs[1]));
+  ASSERT_EQ(Name("/edu"), Name(backrefs[2]));
+  ASSERT_EQ(Name("/x/y"), Name(backrefs[3]));
+
+  // A group which is not in the matched path is empty.
+  compiled = NdnRegexCompiledMatcher("(<a>)?<>");
+  ASSERT_TRUE(compiled.match(Name("/a"), &backrefs));
+  ASSERT_EQ(0, backrefs[0].size());
+
+  // This takes exponential time with the backtracking matchers.
+  Name name;
+  for (int i = 0; i < 100; ++i)
+    name.append("a");
+  compiled = NdnRegexCompiledMatcher("<a>*<a>*<a>*<a>*<a>*<b>");
+  ASSERT_FALSE(compiled.match(name));
+  name.append("b");
+  ASSERT_TRUE(compiled.match(name));
+
+  // NdnRegexTopMatcher uses the backtracking matchers for a large program.
+  ASSERT_THROW(NdnRegexCompiledMatcher("<a>{5000}"), NdnRegexMatcherBase::Error);
+  NdnRegexTopMatcher top("^<a>{5000}$");
+  ASSERT_FALSE(top.match(Name("/a")));
+
+  ASSERT_THROW(NdnRegexCompiledMatcher("<a>{40000}"), NdnRegexMatcherBase::Error);
+  ASSERT_THROW(NdnRegexCompiledMatcher("<a"), NdnRegexMatcherBase::Error);
+  ASSERT_THROW(NdnRegexCompiledMatcher("a"), NdnRegexMatcherBase::Error);
+}
+
 int
 main(int argc, char **argv)
 {
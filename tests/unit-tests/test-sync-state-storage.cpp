@@ -0,0 +1,188 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+#include <ndn-ind/sync/sync-state-sqlite3.hpp>
+
+using namespace std;
+using namespace ndn;
+
+static bool
+fileExists(const string& filePath)
+{
+  ifstream stream(filePath.c_str());
+  bool result = (bool)stream;
+  stream.close();
+  return result;
+}
+
+static string
+getPolicyConfigDirectory()
+{
+  string policyConfigDirectory = "policy_config";
+  // Check if expected files are in this directory.
+  if (!fileExists(policyConfigDirectory + "/regex_ruleset.conf")) {
+    // Maybe we are running "make check" from the ndn-ind root.
+    policyConfigDirectory = "tests/unit-tests/policy_config";
+
+    if(!fileExists(policyConfigDirectory + "/regex_ruleset.conf"))
+      throw runtime_error("Cannot find the directory for policy-config");
+  }
+
+  return policyConfigDirectory;
+}
+
+class TestSyncStateStorage : public ::testing::Test {
+public:
+  TestSyncStateStorage()
+  : databaseDirectoryPath(getPolicyConfigDirectory()),
+    databaseFilename("test-sync-state.db"),
+    databaseFilePath(databaseDirectoryPath + "/" + databaseFilename)
+  {
+    removeDatabase();
+  }
+
+  virtual void
+  TearDown()
+  {
+    removeDatabase();
+  }
+
+  void
+  removeDatabase()
+  {
+    remove(databaseFilePath.c_str());
+    remove((databaseFilePath + "-wal").c_str());
+    remove((databaseFilePath + "-shm").c_str());
+  }
+
+  string databaseDirectoryPath;
+  string databaseFilename;
+  string databaseFilePath;
+};
+
+TEST_F(TestSyncStateStorage, PSyncNames)
+{
+  Name syncPrefix1("/sync/one");
+  Name syncPrefix2("/sync/two");
+  vector<Name> names;
+
+  {
+    SyncStateSqlite3 storage(databaseDirectoryPath, databaseFilename);
+    storage.getPSyncNames(syncPrefix1, names);
+    ASSERT_EQ(0, names.size());
+
+    vector<Name> added;
+    for (int i = 0; i < 10; ++i)
+      added.push_back(Name("/user/a").appendNumber(i));
+    storage.addPSyncNames(syncPrefix1, added);
+    // Adding a stored name again does nothing.
+    storage.addPSyncNames(syncPrefix1, vector<Name>(1, added[0]));
+    storage.addPSyncNames(syncPrefix2, vector<Name>(1, Name("/user/b/1")));
+    storage.removePSyncName(syncPrefix1, added[3]);
+    // Removing a name which is not stored does nothing.
+    storage.removePSyncName(syncPrefix1, Name("/user/c/1"));
+  }
+
+  // Reopen the database to check that the names were saved.
+  SyncStateSqlite3 storage(databaseDirectoryPath, databaseFilename);
+  storage.getPSyncNames(syncPrefix1, names);
+  ASSERT_EQ(9, names.size());
+  for (int i = 0; i < 10; ++i) {
+    bool found = find(names.begin(), names.end(),
+      Name("/user/a").appendNumber(i)) != names.end();
+    ASSERT_EQ(i != 3, found);
+  }
+
+  storage.getPSyncNames(syncPrefix2, names);
+  ASSERT_EQ(1, names.size());
+  ASSERT_TRUE(names[0].equals(Name("/user/b/1")));
+}
+
+TEST_F(TestSyncStateStorage, ChronoSyncSequenceNos)
+{
+  Name broadcastPrefix1("/ndn/broadcast/chat/room1");
+  Name broadcastPrefix2("/ndn/broadcast/chat/room2");
+  vector<ChronoSync2013::SyncState> syncStates;
+
+  {
+    SyncStateSqlite3 storage(databaseDirectoryPath, databaseFilename);
+    storage.getChronoSyncSequenceNos(broadcastPrefix1, syncStates);
+    ASSERT_EQ(0, syncStates.size());
+
+    vector<ChronoSync2013::SyncState> updates;
+    updates.push_back(ChronoSync2013::SyncState("/alice", 1, 5, Blob()));
+    updates.push_back(ChronoSync2013::SyncState("/bob", 1, 2, Blob()));
+    storage.setChronoSyncSequenceNos(broadcastPrefix1, updates);
+
+    updates.clear();
+    // A new sequence number replaces the old one.
+    updates.push_back(ChronoSync2013::SyncState("/alice", 1, 6, Blob()));
+    // A different session is a separate entry.
+    updates.push_back(ChronoSync2013::SyncState("/alice", 2, 1, Blob()));
+    // The last entry for the same producer in one batch is stored.
+    updates.push_back(ChronoSync2013::SyncState("/alice", 2, 0, Blob()));
+    storage.setChronoSyncSequenceNos(broadcastPrefix1, updates);
+
+    storage.setChronoSyncSequenceNos
+      (broadcastPrefix2, vector<ChronoSync2013::SyncState>
+       (1, ChronoSync2013::SyncState("/carol", 1, 9, Blob())));
+    // An empty batch does nothing.
+    storage.setChronoSyncSequenceNos
+      (broadcastPrefix2, vector<ChronoSync2013::SyncState>());
+  }
+
+  SyncStateSqlite3 storage(databaseDirectoryPath, databaseFilename);
+  storage.getChronoSyncSequenceNos(broadcastPrefix1, syncStates);
+  ASSERT_EQ(3, syncStates.size());
+  int nFound = 0;
+  for (size_t i = 0; i < syncStates.size(); ++i) {
+    const ChronoSync2013::SyncState& state = syncStates[i];
+    ASSERT_TRUE(state.getApplicationInfo().isNull());
+    if (state.getDataPrefix() == "/alice" && state.getSessionNo() == 1) {
+      ASSERT_EQ(6, state.getSequenceNo());
+      ++nFound;
+    }
+    else if (state.getDataPrefix() == "/alice" && state.getSessionNo() == 2) {
+      ASSERT_EQ(0, state.getSequenceNo());
+      ++nFound;
+    }
+    else if (state.getDataPrefix() == "/bob" && state.getSessionNo() == 1) {
+      ASSERT_EQ(2, state.getSequenceNo());
+      ++nFound;
+    }
+  }
+  ASSERT_EQ(3, nFound);
+
+  storage.getChronoSyncSequenceNos(broadcastPrefix2, syncStates);
+  ASSERT_EQ(1, syncStates.size());
+  ASSERT_EQ("/carol", syncStates[0].getDataPrefix());
+  ASSERT_EQ(9, syncStates[0].getSequenceNo());
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
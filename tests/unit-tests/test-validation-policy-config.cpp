@@ -309,6 +309,107 @@ TEST_F(TestValidationPolicyConfig, HyperRelation)
   ASSERT_TRUE(result.calledFailure_ && !result.calledContinue_);
 }
 
+TEST_F(TestValidationPolicyConfig, RuleOrder)
+{
+  // Check that the first matching rule is used, where the rules have
+  // overlapping name prefixes and the last rule has no prefix. The checker of
+  // the second rule fails.
+  ptr_lib::shared_ptr<CertificateFetcher> fetcher(new CertificateFetcherOffline());
+  ValidatorConfig validator(fetcher);
+  validator.load
+    ("validator\n"
+     "{\n"
+     "  rule\n"
+     "  {\n"
+     "    id \"First\"\n"
+     "    for data\n"
+     "    filter\n"
+     "    {\n"
+     "      type name\n"
+     "      regex \"^<Test><A>\"\n"
+     "    }\n"
+     "    checker\n"
+     "    {\n"
+     "      type customized\n"
+     "      sig-type rsa-sha256\n"
+     "      key-locator\n"
+     "      {\n"
+     "        type name\n"
+     "        name /\n"
+     "        relation is-prefix-of\n"
+     "      }\n"
+     "    }\n"
+     "  }\n"
+     "  rule\n"
+     "  {\n"
+     "    id \"Prefix\"\n"
+     "    for data\n"
+     "    filter\n"
+     "    {\n"
+     "      type name\n"
+     "      name /Test\n"
+     "      relation is-prefix-of\n"
+     "    }\n"
+     "    checker\n"
+     "    {\n"
+     "      type customized\n"
+     "      sig-type rsa-sha256\n"
+     "      key-locator\n"
+     "      {\n"
+     "        type name\n"
+     "        name /Other\n"
+     "        relation is-prefix-of\n"
+     "      }\n"
+     "    }\n"
+     "  }\n"
+     "  rule\n"
+     "  {\n"
+     "    id \"Anywhere\"\n"
+     "    for data\n"
+     "    filter\n"
+     "    {\n"
+     "      type name\n"
+     "      regex \"<A>$\"\n"
+     "    }\n"
+     "    checker\n"
+     "    {\n"
+     "      type customized\n"
+     "      sig-type rsa-sha256\n"
+     "      key-locator\n"
+     "      {\n"
+     "        type name\n"
+     "        name /\n"
+     "        relation is-prefix-of\n"
+     "      }\n"
+     "    }\n"
+     "  }\n"
+     "}\n", "RuleOrder");
+
+  Data data;
+  KeyLocator::getFromSignature(data.getSignature()).setType(ndn_KeyLocatorType_KEYNAME);
+  KeyLocator::getFromSignature(data.getSignature()).setKeyName
+    (Name("/SecurityTestSecRule/KEY/123"));
+  TestValidationResult result(data);
+
+  // The first rule matches before the second rule.
+  data.setName(Name("/Test/A/B"));
+  result.checkPolicy(validator);
+  ASSERT_TRUE(result.calledContinue_ && !result.calledFailure_);
+
+  // The second rule matches before the third rule.
+  data.setName(Name("/Test/B/A"));
+  result.checkPolicy(validator);
+  ASSERT_TRUE(result.calledFailure_ && !result.calledContinue_);
+
+  data.setName(Name("/Other/A"));
+  result.checkPolicy(validator);
+  ASSERT_TRUE(result.calledContinue_ && !result.calledFailure_);
+
+  data.setName(Name("/Other/B"));
+  result.checkPolicy(validator);
+  ASSERT_TRUE(result.calledFailure_ && !result.calledContinue_);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -36,6 +36,7 @@
 #include "gtest/gtest.h"
 #include "validator-fixture.hpp"
 #include <ndn-ind/security/v2/validation-policy-simple-hierarchy.hpp>
+#include <ndn-ind/security/v2/parallel-validator.hpp>
 
 using namespace std;
 using namespace std::chrono;
@@ -44,8 +45,10 @@ using namespace ndn::func_lib;
 
 class TestValidator : public ::testing::Test {
 public:
-  TestValidator()
-  : fixture_(ptr_lib::make_shared<ValidationPolicySimpleHierarchy>())
+  TestValidator
+    (const ptr_lib::shared_ptr<ValidationPolicy>& policy =
+       ptr_lib::make_shared<ValidationPolicySimpleHierarchy>())
+  : fixture_(policy)
   {
   }
 
@@ -228,6 +231,104 @@ processInterestWithCertificate
     originalProcessInterest(interest, onData, onTimeout, onNetworkNack);
 }
 
+static void
+processInterestLater
+  (const ndn::Interest& interest, const ndn::OnData& onData,
+   const ndn::OnTimeout& onTimeout, const ndn::OnNetworkNack& onNetworkNack,
+   const ValidatorFixture::TestFace::ProcessInterest originalProcessInterest,
+   vector<func_lib::function<void()> >* pendingResponses)
+{
+  pendingResponses->push_back(bind
+    (originalProcessInterest, interest, onData, onTimeout, onNetworkNack));
+}
+
+static void
+countSuccess(const Data& data, int* nSuccesses)
+{
+  ++(*nSuccesses);
+}
+
+TEST_F(TestValidator, CoalescedCertificateFetch)
+{
+  vector<func_lib::function<void()> > pendingResponses;
+  fixture_.face_.processInterest_ = bind
+    (&processInterestLater, _1, _2, _3, _4, fixture_.face_.processInterest_,
+     &pendingResponses);
+
+  Data data1(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data1"));
+  fixture_.keyChain_.sign(data1, SigningInfo(fixture_.subIdentity_));
+  Data data2(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data2"));
+  fixture_.keyChain_.sign(data2, SigningInfo(fixture_.subIdentity_));
+
+  int nSuccesses = 0;
+  fixture_.validator_.validate
+    (data1, bind(&countSuccess, _1, &nSuccesses),
+     bind(&TestValidator::dataShouldNotFail, this, _1, _2,
+          "Should get accepted after the certificate is fetched"));
+  fixture_.validator_.validate
+    (data2, bind(&countSuccess, _1, &nSuccesses),
+     bind(&TestValidator::dataShouldNotFail, this, _1, _2,
+          "Should get accepted after the certificate is fetched"));
+
+  // Both validations wait for the same certificate Interest.
+  ASSERT_EQ(1, fixture_.face_.sentInterests_.size());
+  ASSERT_EQ(1, pendingResponses.size());
+  ASSERT_EQ(0, nSuccesses);
+
+  pendingResponses[0]();
+  ASSERT_EQ(2, nSuccesses);
+  ASSERT_EQ(1, fixture_.face_.sentInterests_.size());
+}
+
+#ifdef NDN_IND_HAVE_BOOST_ASIO
+static void
+countParallelResult
+  (bool isSuccess, int* nSuccesses, int* nResults, int nExpected,
+   boost::asio::io_service* ioService)
+{
+  if (isSuccess)
+    ++(*nSuccesses);
+  if (++(*nResults) == nExpected)
+    ioService->stop();
+}
+
+TEST_F(TestValidator, ParallelValidator)
+{
+  boost::asio::io_service ioService;
+  ParallelValidator validator
+    (ptr_lib::make_shared<ValidationPolicySimpleHierarchy>(),
+     ptr_lib::make_shared<CertificateFetcherFromNetwork>(fixture_.face_),
+     ioService, 4);
+  ASSERT_EQ(4, validator.getThreadCount());
+  validator.loadAnchor
+    ("", CertificateV2
+     (*fixture_.identity_->getDefaultKey()->getDefaultCertificate()));
+
+  int nSuccesses = 0;
+  int nResults = 0;
+  const int nData = 20;
+  for (int i = 0; i < nData; ++i) {
+    Data data(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data").appendNumber(i));
+    fixture_.keyChain_.sign(data, SigningInfo(fixture_.subIdentity_));
+    if (i % 5 == 4)
+      // Make the signature invalid.
+      data.setContent(Blob((const uint8_t*)"x", 1));
+
+    validator.validate
+      (data,
+       bind(&countParallelResult, true, &nSuccesses, &nResults, nData, &ioService),
+       bind(&countParallelResult, false, &nSuccesses, &nResults, nData, &ioService));
+  }
+
+  // The callbacks are only called on the io_service thread.
+  ASSERT_EQ(0, nResults);
+  boost::asio::io_service::work work(ioService);
+  ioService.run();
+  ASSERT_EQ(nData, nResults);
+  ASSERT_EQ(nData - nData / 5, nSuccesses);
+}
+#endif
+
 TEST_F(TestValidator, MalformedCertificate)
 {
   // Copy the default certificate.
@@ -398,6 +499,157 @@ TEST_F(TestValidator, LoopedCertificateChain)
   ASSERT_EQ(3, fixture_.face_.sentInterests_.size());
 }
 
+class ValidationPolicySimpleHierarchyWithCount
+  : public ValidationPolicySimpleHierarchy
+{
+public:
+  ValidationPolicySimpleHierarchyWithCount()
+  : nDataChecks_(0)
+  {
+  }
+
+  using ValidationPolicySimpleHierarchy::checkPolicy;
+
+  void
+  checkPolicy
+    (const Data& data, const ptr_lib::shared_ptr<ValidationState>& state,
+     const ValidationContinuation& continueValidation)
+  {
+    ++nDataChecks_;
+    ValidationPolicySimpleHierarchy::checkPolicy(data, state, continueValidation);
+  }
+
+  int nDataChecks_;
+};
+
+class TestValidatedDataCache : public TestValidator {
+public:
+  TestValidatedDataCache()
+  : TestValidator(ptr_lib::make_shared<ValidationPolicySimpleHierarchyWithCount>())
+  {
+    fixture_.validator_.setValidatedDataCacheCapacity(2);
+  }
+
+  int
+  getNDataChecks()
+  {
+    return dynamic_cast<ValidationPolicySimpleHierarchyWithCount&>
+      (fixture_.validator_.getPolicy()).nDataChecks_;
+  }
+};
+
+TEST_F(TestValidatedDataCache, Basic)
+{
+  Data data(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data"));
+  fixture_.keyChain_.sign(data, SigningInfo(fixture_.subIdentity_));
+
+  validateExpectSuccess
+    (data, "Should get accepted, as signed by the policy-compliant certificate");
+  ASSERT_EQ(1, fixture_.validator_.getValidatedDataCacheSize());
+  // The policy also checks the retrieved certificate.
+  int nDataChecks = getNDataChecks();
+
+  validateExpectSuccess(data, "Should get accepted from the validated data cache");
+  ASSERT_EQ(nDataChecks, getNDataChecks());
+
+  // A Data packet with a different digest is not in the cache.
+  Data data2(data);
+  data2.setContent(Blob((const uint8_t*)"2", 1));
+  fixture_.keyChain_.sign(data2, SigningInfo(fixture_.subIdentity_));
+  validateExpectSuccess(data2, "Should get accepted after checking the policy");
+  ASSERT_EQ(++nDataChecks, getNDataChecks());
+
+  // Use data so that data2 is the least recently used and is removed.
+  validateExpectSuccess(data, "Should get accepted from the validated data cache");
+  ASSERT_EQ(nDataChecks, getNDataChecks());
+  Data data3(data);
+  data3.setContent(Blob((const uint8_t*)"3", 1));
+  fixture_.keyChain_.sign(data3, SigningInfo(fixture_.subIdentity_));
+  validateExpectSuccess(data3, "Should get accepted after checking the policy");
+  ASSERT_EQ(++nDataChecks, getNDataChecks());
+  ASSERT_EQ(2, fixture_.validator_.getValidatedDataCacheSize());
+  validateExpectSuccess(data, "Should get accepted from the validated data cache");
+  ASSERT_EQ(nDataChecks, getNDataChecks());
+  validateExpectSuccess(data2, "Should get accepted after checking the policy");
+  ASSERT_EQ(++nDataChecks, getNDataChecks());
+
+  // Resetting the verified certificates also clears the cache.
+  fixture_.validator_.resetVerifiedCertificates();
+  ASSERT_EQ(0, fixture_.validator_.getValidatedDataCacheSize());
+}
+
+TEST_F(TestValidatedDataCache, Expiration)
+{
+  Data data(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data"));
+  fixture_.keyChain_.sign(data, SigningInfo(fixture_.subIdentity_));
+  validateExpectSuccess
+    (data, "Should get accepted, as signed by the policy-compliant certificate");
+  int nDataChecks = getNDataChecks();
+
+  // Disable responses from the simulated Face.
+  fixture_.face_.processInterest_ = 0;
+
+  // Make the caches simulate a time 2 hours later, after expiration.
+  fixture_.validator_.setCacheNowOffset_(hours(2));
+
+  validateExpectFailure(data, "Should try and fail to retrieve certificates");
+  ASSERT_EQ(nDataChecks + 1, getNDataChecks());
+  ASSERT_EQ(0, fixture_.validator_.getValidatedDataCacheSize());
+}
+
+TEST_F(TestValidatedDataCache, CoalescedFetchChecksEachWaiter)
+{
+  vector<func_lib::function<void()> > pendingResponses;
+  fixture_.face_.processInterest_ = bind
+    (&processInterestLater, _1, _2, _3, _4, fixture_.face_.processInterest_,
+     &pendingResponses);
+
+  Data data1(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data1"));
+  fixture_.keyChain_.sign(data1, SigningInfo(fixture_.subIdentity_));
+  Data data2(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data2"));
+  fixture_.keyChain_.sign(data2, SigningInfo(fixture_.subIdentity_));
+
+  validateExpectSuccess(data1, "Should get accepted after the fetch");
+  validateExpectSuccess(data2, "Should get accepted after the fetch");
+  ASSERT_EQ(1, pendingResponses.size());
+  ASSERT_EQ(2, getNDataChecks());
+
+  // Each waiter checks the policy for the fetched certificate.
+  pendingResponses[0]();
+  ASSERT_EQ(4, getNDataChecks());
+  ASSERT_EQ(1, fixture_.face_.sentInterests_.size());
+}
+
+TEST_F(TestValidatedDataCache, VerifiedCertificateRemoved)
+{
+  Data data(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data"));
+  fixture_.keyChain_.sign(data, SigningInfo(fixture_.subIdentity_));
+  validateExpectSuccess
+    (data, "Should get accepted, as signed by the policy-compliant certificate");
+
+  // Disable responses from the simulated Face.
+  fixture_.face_.processInterest_ = 0;
+
+  // 50 minutes later, validate data2 from the certificate in the verified
+  // certificate cache. Its validated Data cache entry has a later removal
+  // time than the cached certificate.
+  fixture_.validator_.setCacheNowOffset_(minutes(50));
+  Data data2(data);
+  data2.setContent(Blob((const uint8_t*)"2", 1));
+  fixture_.keyChain_.sign(data2, SigningInfo(fixture_.subIdentity_));
+  validateExpectSuccess
+    (data2, "Should get accepted, based on the cached trusted certificate");
+  int nDataChecks = getNDataChecks();
+  validateExpectSuccess(data2, "Should get accepted from the validated data cache");
+  ASSERT_EQ(nDataChecks, getNDataChecks());
+
+  // After the certificate is removed from the verified certificate cache,
+  // data2 is not accepted from the validated data cache.
+  fixture_.validator_.setCacheNowOffset_(minutes(65));
+  validateExpectFailure(data2, "Should try and fail to retrieve certificates");
+  ASSERT_EQ(nDataChecks + 1, getNDataChecks());
+}
+
 class ValidationPolicySimpleHierarchyForInterestOnly
   : public ValidationPolicySimpleHierarchy
 {
@@ -0,0 +1,221 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2021 Operant Networks, Incorporated.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-ind/security/certificate/x509-certificate-info.hpp>
+#include <ndn-ind/security/v2/x509-crl-cache.hpp>
+#include "../../src/encoding/der/der-node.hpp"
+
+using namespace std;
+using namespace std::chrono;
+using namespace ndn;
+
+typedef DerNode::DerSequence DerSequence;
+
+/**
+ * Make an encoded X.509 CRL from the issuer with the given values. The
+ * signature value is not a real signature since X509CrlCache doesn't check it.
+ * @param issuerCommonName The common name of the issuer.
+ * @param thisUpdate The thisUpdate time.
+ * @param nextUpdate The nextUpdate time.
+ * @param serialNumbers The serial number of each revoked certificate entry.
+ * @param revocationDates The revocation date of each revoked certificate
+ * entry, the same size as serialNumbers.
+ * @return The X509CrlInfo decoded from the encoded CRL.
+ */
+static X509CrlInfo
+makeCrl
+  (const string& issuerCommonName, system_clock::time_point thisUpdate,
+   system_clock::time_point nextUpdate, const vector<Blob>& serialNumbers,
+   const vector<system_clock::time_point>& revocationDates)
+{
+  ptr_lib::shared_ptr<DerSequence> algorithm(new DerSequence());
+  algorithm->addChild(ptr_lib::make_shared<DerNode::DerOid>
+    ("1.2.840.113549.1.1.11"));
+  algorithm->addChild(ptr_lib::make_shared<DerNode::DerNull>());
+
+  ptr_lib::shared_ptr<DerSequence> revokedCertificates(new DerSequence());
+  for (size_t i = 0; i < serialNumbers.size(); ++i) {
+    ptr_lib::shared_ptr<DerSequence> revokedCertificate(new DerSequence());
+    revokedCertificate->addChild(ptr_lib::make_shared<DerNode::DerInteger>
+      (serialNumbers[i].buf(), serialNumbers[i].size()));
+    revokedCertificate->addChild(ptr_lib::make_shared<DerNode::DerUtcTime>
+      (revocationDates[i]));
+    revokedCertificates->addChild(revokedCertificate);
+  }
+
+  ptr_lib::shared_ptr<DerSequence> tbsCertList(new DerSequence());
+  tbsCertList->addChild(ptr_lib::make_shared<DerNode::DerInteger>(1));
+  tbsCertList->addChild(algorithm);
+  tbsCertList->addChild(DerNode::parse
+    (X509CertificateInfo::makeX509NameOfCommonName(issuerCommonName)));
+  tbsCertList->addChild(ptr_lib::make_shared<DerNode::DerUtcTime>(thisUpdate));
+  tbsCertList->addChild(ptr_lib::make_shared<DerNode::DerUtcTime>(nextUpdate));
+  tbsCertList->addChild(revokedCertificates);
+
+  // Repeat the algorithm since a node can only have one parent.
+  ptr_lib::shared_ptr<DerSequence> signatureAlgorithm(new DerSequence());
+  signatureAlgorithm->addChild(ptr_lib::make_shared<DerNode::DerOid>
+    ("1.2.840.113549.1.1.11"));
+  signatureAlgorithm->addChild(ptr_lib::make_shared<DerNode::DerNull>());
+
+  const uint8_t signatureValue[] = { 1, 2, 3, 4 };
+  ptr_lib::shared_ptr<DerSequence> root(new DerSequence());
+  root->addChild(tbsCertList);
+  root->addChild(signatureAlgorithm);
+  root->addChild(ptr_lib::make_shared<DerNode::DerBitString>
+    (signatureValue, sizeof(signatureValue), 0));
+
+  return X509CrlInfo(root->encode());
+}
+
+/**
+ * Make a serial number Blob with one byte.
+ */
+static Blob
+makeSerialNumber(uint8_t value)
+{
+  return Blob(&value, 1);
+}
+
+class TestX509CrlCache : public ::testing::Test {
+public:
+  TestX509CrlCache()
+  : now_(system_clock::now()),
+    // DerUtcTime has a resolution of seconds.
+    thisUpdate_(time_point_cast<seconds>(now_ - hours(1))),
+    nextUpdate_(time_point_cast<seconds>(now_ + hours(1)))
+  {
+  }
+
+  system_clock::time_point now_;
+  system_clock::time_point thisUpdate_;
+  system_clock::time_point nextUpdate_;
+  X509CrlCache crlCache_;
+};
+
+TEST_F(TestX509CrlCache, FindRevokedCertificate)
+{
+  vector<Blob> serialNumbers;
+  vector<system_clock::time_point> revocationDates;
+  serialNumbers.push_back(makeSerialNumber(1));
+  revocationDates.push_back(thisUpdate_ - hours(3));
+  serialNumbers.push_back(makeSerialNumber(2));
+  revocationDates.push_back(thisUpdate_ - hours(2));
+  // A duplicate serial number.
+  serialNumbers.push_back(makeSerialNumber(1));
+  revocationDates.push_back(thisUpdate_ - hours(1));
+  X509CrlInfo crlInfo = makeCrl
+    ("issuer", thisUpdate_, nextUpdate_, serialNumbers, revocationDates);
+  const Name& issuerName = crlInfo.getIssuerName();
+  ASSERT_EQ(3, crlInfo.getRevokedCertificateCount());
+
+  ASSERT_TRUE(crlCache_.insert(crlInfo));
+
+  // Use a copy of the serial number so that the lookup compares the bytes.
+  const X509CrlInfo::RevokedCertificate* revoked =
+    crlCache_.findRevokedCertificate(issuerName, makeSerialNumber(2));
+  ASSERT_TRUE(revoked != 0);
+  ASSERT_TRUE(makeSerialNumber(2).equals(revoked->getSerialNumber()));
+  ASSERT_TRUE(thisUpdate_ - hours(2) == revoked->getRevocationDate());
+
+  // A duplicate serial number finds the first entry.
+  revoked = crlCache_.findRevokedCertificate(issuerName, makeSerialNumber(1));
+  ASSERT_TRUE(revoked != 0);
+  ASSERT_TRUE(thisUpdate_ - hours(3) == revoked->getRevocationDate());
+
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (issuerName, makeSerialNumber(3)));
+  // A serial number with the same value but a different encoding doesn't match.
+  const uint8_t serialNumber02[] = { 0, 2 };
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (issuerName, Blob(serialNumber02, sizeof(serialNumber02))));
+  // An empty serial number doesn't match.
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate(issuerName, Blob()));
+
+  X509CrlInfo otherCrlInfo = makeCrl
+    ("other", thisUpdate_, nextUpdate_, vector<Blob>(),
+     vector<system_clock::time_point>());
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (otherCrlInfo.getIssuerName(), makeSerialNumber(2)));
+
+  crlCache_.clear();
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (issuerName, makeSerialNumber(2)));
+}
+
+TEST_F(TestX509CrlCache, ReplaceCrl)
+{
+  vector<Blob> serialNumbers(1, makeSerialNumber(1));
+  vector<system_clock::time_point> revocationDates(1, thisUpdate_ - hours(1));
+  X509CrlInfo crlInfo1 = makeCrl
+    ("issuer", thisUpdate_, nextUpdate_, serialNumbers, revocationDates);
+  const Name& issuerName = crlInfo1.getIssuerName();
+  ASSERT_TRUE(crlCache_.insert(crlInfo1));
+
+  // A newer CRL from the same issuer replaces the index of serial numbers.
+  serialNumbers[0] = makeSerialNumber(2);
+  X509CrlInfo crlInfo2 = makeCrl
+    ("issuer", thisUpdate_ + minutes(1), nextUpdate_, serialNumbers,
+     revocationDates);
+  ASSERT_TRUE(crlCache_.insert(crlInfo2));
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (issuerName, makeSerialNumber(1)));
+  const X509CrlInfo::RevokedCertificate* revoked =
+    crlCache_.findRevokedCertificate(issuerName, makeSerialNumber(2));
+  ASSERT_TRUE(revoked != 0);
+  ASSERT_TRUE(revoked == &crlCache_.find(issuerName)->getRevokedCertificate(0));
+
+  // An older CRL doesn't replace the newer one.
+  ASSERT_FALSE(crlCache_.insert(crlInfo1));
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (issuerName, makeSerialNumber(1)));
+  ASSERT_TRUE(crlCache_.findRevokedCertificate
+    (issuerName, makeSerialNumber(2)) != 0);
+
+  // A CRL with no revoked certificates clears the index.
+  X509CrlInfo crlInfo3 = makeCrl
+    ("issuer", thisUpdate_ + minutes(2), nextUpdate_, vector<Blob>(),
+     vector<system_clock::time_point>());
+  ASSERT_TRUE(crlCache_.insert(crlInfo3));
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (issuerName, makeSerialNumber(2)));
+}
+
+TEST_F(TestX509CrlCache, ExpiredCrl)
+{
+  vector<Blob> serialNumbers(1, makeSerialNumber(1));
+  vector<system_clock::time_point> revocationDates(1, thisUpdate_ - hours(1));
+  X509CrlInfo crlInfo = makeCrl
+    ("issuer", thisUpdate_ - hours(2), thisUpdate_, serialNumbers,
+     revocationDates);
+
+  // An expired CRL is not inserted, so its serial numbers are not found.
+  ASSERT_FALSE(crlCache_.insert(crlInfo));
+  ASSERT_TRUE(!crlCache_.findRevokedCertificate
+    (crlInfo.getIssuerName(), makeSerialNumber(1)));
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -39,7 +39,8 @@ MicroForwarderTransport::MicroForwarderTransport()
 : elementBuffer_(1000),
   elementReader_(0, &elementBuffer_),
   isLocal_(true),
-  outFaceId_(-1)
+  outFaceId_(-1),
+  isReceiveQueued_(true)
 {
 }
 
@@ -98,6 +99,32 @@ MicroForwarderTransport::processEvents()
 {
   if (connectionInfo_.getForwarder())
     connectionInfo_.getForwarder()->processEvents();
+
+  deque<Blob> receivedPackets;
+  {
+    lock_guard<mutex> lock(receivedPacketsMutex_);
+    receivedPackets.swap(receivedPackets_);
+  }
+
+  // Call the Face in this thread without holding the lock, since the Face
+  // may send a reply.
+  for (size_t i = 0; i < receivedPackets.size(); ++i)
+    elementReader_.onReceivedData
+      (receivedPackets[i].buf(), receivedPackets[i].size());
+}
+
+void
+MicroForwarderTransport::receiveFromForwarder
+  (const uint8_t *data, size_t dataLength)
+{
+  if (!isReceiveQueued_) {
+    elementReader_.onReceivedData(data, dataLength);
+    return;
+  }
+
+  // The data buffer is only valid during this call, so copy.
+  lock_guard<mutex> lock(receivedPacketsMutex_);
+  receivedPackets_.push_back(Blob(data, dataLength));
 }
 
 bool
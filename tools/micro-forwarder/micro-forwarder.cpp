@@ -19,16 +19,17 @@
  * A copy of the GNU Lesser General Public License is in the file COPYING.
  */
 
-#include <set>
 #include <ndn-ind/util/logging.hpp>
 #include <ndn-ind/encoding/tlv-wire-format.hpp>
 #include <ndn-ind/lite/encoding/tlv-0_3-wire-format-lite.hpp>
 #include <ndn-ind/lite/lp/lp-packet-lite.hpp>
+#include <ndn-ind/lite/network-nack-lite.hpp>
+#include <ndn-ind/lite/util/crypto-lite.hpp>
 #include <ndn-ind/transport/tcp-transport.hpp>
-#include <ndn-ind/network-nack.hpp>
 #include <ndn-ind/control-parameters.hpp>
 #include <ndn-ind/control-response.hpp>
-#include "../../src/lp/lp-packet.hpp"
+#include "../../src/c/encoding/tlv/tlv-decoder.h"
+#include "../../src/encoding/tlv-encoder.hpp"
 #include <ndn-ind-tools/micro-forwarder/micro-forwarder-transport.hpp>
 #include <ndn-ind-tools/micro-forwarder/micro-forwarder.hpp>
 
@@ -41,6 +42,234 @@ INIT_LOGGER("ndntools.MicroForwarder");
 
 namespace ndntools {
 
+/**
+ * The MulticastStrategy forwards to all next hops. A Nack is only returned
+ * downstream when all upstreams return a Nack.
+ */
+class MicroForwarder::MulticastStrategy : public MicroForwarder::ForwardingStrategy {
+public:
+  bool
+  usesAllMatchingFibEntries() override { return true; }
+
+  void
+  afterReceiveInterest
+    (const vector<NextHopRecord*>& nextHops, system_clock::time_point now,
+     vector<ForwarderFace*>& outFaces) override
+  {
+    for (size_t i = 0; i < nextHops.size(); ++i)
+      outFaces.push_back(nextHops[i]->getFace());
+  }
+
+  ForwarderFace*
+  afterReceiveNack(const vector<NextHopRecord*>& nextHops) override
+  {
+    // All next hops were already tried.
+    return 0;
+  }
+};
+
+/**
+ * The BestRouteStrategy forwards to the next hop with the lowest cost. After a
+ * Nack, it tries the untried next hop with the lowest cost.
+ */
+class MicroForwarder::BestRouteStrategy : public MicroForwarder::ForwardingStrategy {
+public:
+  void
+  afterReceiveInterest
+    (const vector<NextHopRecord*>& nextHops, system_clock::time_point now,
+     vector<ForwarderFace*>& outFaces) override
+  {
+    outFaces.push_back(getLowestCost(nextHops));
+  }
+
+  ForwarderFace*
+  afterReceiveNack(const vector<NextHopRecord*>& nextHops) override
+  {
+    return getLowestCost(nextHops);
+  }
+
+  static ForwarderFace*
+  getLowestCost(const vector<NextHopRecord*>& nextHops)
+  {
+    // If costs are equal, prefer the first added route.
+    NextHopRecord* best = nextHops[0];
+    for (size_t i = 1; i < nextHops.size(); ++i) {
+      if (nextHops[i]->getCost() < best->getCost())
+        best = nextHops[i];
+    }
+
+    return best->getFace();
+  }
+};
+
+/**
+ * The RoundRobinStrategy forwards each new Interest to one next hop, rotating
+ * through the next hops to spread the load. After a Nack, it tries the next one
+ * in the rotation.
+ */
+class MicroForwarder::RoundRobinStrategy : public MicroForwarder::ForwardingStrategy {
+public:
+  RoundRobinStrategy()
+  : counter_(0)
+  {
+  }
+
+  void
+  afterReceiveInterest
+    (const vector<NextHopRecord*>& nextHops, system_clock::time_point now,
+     vector<ForwarderFace*>& outFaces) override
+  {
+    outFaces.push_back(nextHops[counter_++ % nextHops.size()]->getFace());
+  }
+
+  ForwarderFace*
+  afterReceiveNack(const vector<NextHopRecord*>& nextHops) override
+  {
+    return nextHops[counter_++ % nextHops.size()]->getFace();
+  }
+
+private:
+  // This is atomic since the strategy can be called from multiple shards.
+  atomic<size_t> counter_;
+};
+
+/**
+ * The AsfStrategy (adaptive SRTT-based forwarding) forwards to the next hop
+ * with the best rank, using the RTT measurements in each ForwarderFace. Faces
+ * with a measurement are ranked by smoothed RTT, followed by faces without a
+ * measurement (ranked by cost), followed by faces whose last Interests timed
+ * out. Once each probing interval it also sends the Interest to the best-ranked
+ * other face, so that a face which has recovered or has not been measured can
+ * be discovered.
+ */
+class MicroForwarder::AsfStrategy : public MicroForwarder::ForwardingStrategy {
+public:
+  AsfStrategy()
+  : probingInterval_(seconds(60))
+  {
+  }
+
+  void
+  afterReceiveInterest
+    (const vector<NextHopRecord*>& nextHops, system_clock::time_point now,
+     vector<ForwarderFace*>& outFaces) override
+  {
+    ForwarderFace* best = getBest(nextHops, 0);
+    outFaces.push_back(best);
+
+    if (nextHops.size() > 1) {
+      {
+        // The strategy can be called from multiple shards.
+        lock_guard<mutex> lock(mutex_);
+        if (now < nextProbeTime_)
+          return;
+        nextProbeTime_ = now + duration_cast<system_clock::duration>(probingInterval_);
+      }
+
+      ForwarderFace* probeFace = getBest(nextHops, best);
+      _LOG_DEBUG("ASF probing face " << probeFace->getFaceId());
+      outFaces.push_back(probeFace);
+    }
+  }
+
+  ForwarderFace*
+  afterReceiveNack(const vector<NextHopRecord*>& nextHops) override
+  {
+    return getBest(nextHops, 0);
+  }
+
+private:
+  /**
+   * Get the face in nextHops with the best rank.
+   * @param nextHops The next hops, which is not empty.
+   * @param exclude If not null, exclude this face. If it is the only face, then
+   * return it anyway.
+   * @return The best face.
+   */
+  static ForwarderFace*
+  getBest(const vector<NextHopRecord*>& nextHops, ForwarderFace* exclude)
+  {
+    NextHopRecord* best = 0;
+    for (size_t i = 0; i < nextHops.size(); ++i) {
+      if (nextHops[i]->getFace() == exclude)
+        continue;
+      if (!best || isBetter(*nextHops[i], *best))
+        best = nextHops[i];
+    }
+
+    return best ? best->getFace() : nextHops[0]->getFace();
+  }
+
+  /**
+   * Check if nextHop a has a better rank than b.
+   */
+  static bool
+  isBetter(NextHopRecord& a, NextHopRecord& b)
+  {
+    int aTier = getTier(*a.getFace());
+    int bTier = getTier(*b.getFace());
+    if (aTier != bTier)
+      return aTier < bTier;
+
+    if (aTier == 0)
+      return a.getFace()->getSmoothedRtt() < b.getFace()->getSmoothedRtt();
+    else if (aTier == 1)
+      return a.getCost() < b.getCost();
+    else
+      return a.getFace()->getConsecutiveTimeoutCount() <
+             b.getFace()->getConsecutiveTimeoutCount();
+  }
+
+  /**
+   * Get the ranking tier of the face: 0 for measured, 1 for not measured, 2
+   * for timed out.
+   */
+  static int
+  getTier(ForwarderFace& face)
+  {
+    if (face.getConsecutiveTimeoutCount() > 0)
+      return 2;
+    return face.hasRttMeasurement() ? 0 : 1;
+  }
+
+  nanoseconds probingInterval_;
+  mutex mutex_;
+  system_clock::time_point nextProbeTime_;
+};
+
+MicroForwarder::MicroForwarder(int nShards, int nShardNameComponents)
+: nShardNameComponents_(nShardNameComponents), isFaceThreadsStarted_(false),
+  contentStoreCapacity_(0),
+  minPitEntryLifetime_(minutes(1)),
+  localhostNamePrefix("/localhost"),
+  localhopNamePrefix("/localhop"),
+  registerNamePrefix("/localhost/nfd/rib/register"),
+  strategyChoiceSetNamePrefix("/localhost/nfd/strategy-choice/set"),
+  strategyNamePrefix("/localhost/nfd/strategy"),
+  broadcastNamePrefix("/ndn/broadcast"),
+  localhostPrefixValue(encodeNameValue(localhostNamePrefix)),
+  localhopPrefixValue(encodeNameValue(localhopNamePrefix)),
+  broadcastPrefixValue(encodeNameValue(broadcastNamePrefix))
+{
+  if (nShards < 1)
+    nShards = 1;
+  if (nShardNameComponents_ < 0)
+    nShardNameComponents_ = 0;
+  for (int i = 0; i < nShards; ++i)
+    shards_.push_back(ptr_lib::make_shared<Shard>());
+
+  strategyChoice_.push_back(ptr_lib::make_shared<StrategyChoiceEntry>
+    (Name(), encodeNameValue(Name()),
+     ptr_lib::make_shared<MulticastStrategy>()));
+}
+
+MicroForwarder::~MicroForwarder()
+{
+  stopFaceThreads();
+}
+
+MicroForwarder::ForwardingStrategy::~ForwardingStrategy() {}
+
 int
 MicroForwarder::addFace
   (const string& uri, const ptr_lib::shared_ptr<Transport>& transport,
@@ -49,7 +278,13 @@ MicroForwarder::addFace
   auto face = ptr_lib::make_shared<ForwarderFace>(this, uri, transport);
 
   transport->connect(*connectionInfo, *face, Transport::OnConnected());
-  faces_.push_back(face);
+  {
+    lock_guard<mutex> lock(facesMutex_);
+    faces_.push_back(face);
+    if (isFaceThreadsStarted_)
+      face->startThread
+        (faceThreadSleepTime_, isPolledTransport(face->getTransport()));
+  }
 
   int faceId = face->getFaceId();
   _LOG_INFO("Created face " << faceId << ": " << uri);
@@ -74,6 +309,7 @@ MicroForwarder::addRoute(const Name& name, int faceId, int cost)
     return false;
   }
 
+  lock_guard<shared_timed_mutex> lock(fibMutex_);
   // Check for a FIB entry for the name and add the face.
   for (int i = 0; i < FIB_.size(); ++i) {
     FibEntry& fibEntry = *FIB_[i];
@@ -94,7 +330,7 @@ MicroForwarder::addRoute(const Name& name, int faceId, int cost)
   }
 
   // Make a new FIB entry.
-  auto fibEntry = ptr_lib::make_shared<FibEntry>(name);
+  auto fibEntry = ptr_lib::make_shared<FibEntry>(name, encodeNameValue(name));
   fibEntry->addNextHop(ptr_lib::make_shared<NextHopRecord>(nextHopFace, cost));
   FIB_.push_back(fibEntry);
 
@@ -103,6 +339,112 @@ MicroForwarder::addRoute(const Name& name, int faceId, int cost)
   return true;
 }
 
+bool
+MicroForwarder::setStrategy(const Name& prefix, const Name& strategyName)
+{
+  if (!(strategyName.size() > strategyNamePrefix.size() &&
+        strategyNamePrefix.match(strategyName))) {
+    _LOG_INFO("setStrategy: Unrecognized strategy " << strategyName);
+    return false;
+  }
+
+  string type = strategyName.get(strategyNamePrefix.size()).toEscapedString();
+  ptr_lib::shared_ptr<ForwardingStrategy> strategy;
+  if (type == "multicast")
+    strategy = ptr_lib::make_shared<MulticastStrategy>();
+  else if (type == "best-route")
+    strategy = ptr_lib::make_shared<BestRouteStrategy>();
+  else if (type == "round-robin")
+    strategy = ptr_lib::make_shared<RoundRobinStrategy>();
+  else if (type == "asf")
+    strategy = ptr_lib::make_shared<AsfStrategy>();
+  else {
+    _LOG_INFO("setStrategy: Unrecognized strategy " << strategyName);
+    return false;
+  }
+
+  {
+    lock_guard<shared_timed_mutex> lock(fibMutex_);
+    bool isFound = false;
+    for (size_t i = 0; i < strategyChoice_.size(); ++i) {
+      if (strategyChoice_[i]->getPrefix().equals(prefix)) {
+        strategyChoice_[i]->setStrategy(strategy);
+        isFound = true;
+        break;
+      }
+    }
+
+    if (!isFound)
+      strategyChoice_.push_back(ptr_lib::make_shared<StrategyChoiceEntry>
+        (prefix, encodeNameValue(prefix), strategy));
+  }
+  _LOG_INFO("setStrategy: Set strategy " << type << " for " << prefix);
+  return true;
+}
+
+void
+MicroForwarder::setContentStoreCapacity(size_t capacity)
+{
+  contentStoreCapacity_ = capacity;
+
+  // Evict the least recently used entries to fit the new capacity.
+  for (size_t i = 0; i < shards_.size(); ++i) {
+    lock_guard<mutex> lock(shards_[i]->getMutex());
+    shards_[i]->evictContentStore(capacity / shards_.size());
+  }
+}
+
+size_t
+MicroForwarder::getContentStoreSize()
+{
+  size_t size = 0;
+  for (size_t i = 0; i < shards_.size(); ++i) {
+    lock_guard<mutex> lock(shards_[i]->getMutex());
+    size += shards_[i]->getContentStoreSize();
+  }
+
+  return size;
+}
+
+bool
+MicroForwarder::setFaceRateLimit
+  (int faceId, double bytesPerSecond, size_t burstSize)
+{
+  ForwarderFace* face = findFace(faceId);
+  if (!face) {
+    _LOG_INFO("setFaceRateLimit: Unrecognized face id " << faceId);
+    return false;
+  }
+
+  face->setRateLimit(bytesPerSecond, burstSize);
+  return true;
+}
+
+bool
+MicroForwarder::setFaceQueueLimits
+  (int faceId, size_t maxQueueSize, size_t congestionMarkThreshold)
+{
+  ForwarderFace* face = findFace(faceId);
+  if (!face) {
+    _LOG_INFO("setFaceQueueLimits: Unrecognized face id " << faceId);
+    return false;
+  }
+
+  face->setQueueLimits(maxQueueSize, congestionMarkThreshold);
+  return true;
+}
+
+bool
+MicroForwarder::getFaceQueueCounters(int faceId, QueueCounters& counters)
+{
+  ForwarderFace* face = findFace(faceId);
+  if (!face)
+    return false;
+
+  face->getQueueCounters(counters);
+  return true;
+}
+
 void
 MicroForwarder::remoteRegisterPrefix
   (int faceId, const Name& prefix, KeyChain& commandKeyChain,
@@ -119,6 +461,9 @@ MicroForwarder::remoteRegisterPrefix
   transport->isLocal_ = false;
   // Set the outFaceId_ so that the registration Interest will only go that face.
   transport->outFaceId_ = faceId;
+  // The application doesn't call processEvents() for the registrationFace, so
+  // deliver the response when the forwarder sends it.
+  transport->isReceiveQueued_ = false;
 
   ptr_lib::shared_ptr<Face> registrationFace(new Face
     (transport, ptr_lib::make_shared<MicroForwarderTransport::ConnectionInfo>(this)));
@@ -140,13 +485,292 @@ MicroForwarder::remoteRegisterPrefix
 void
 MicroForwarder::processEvents()
 {
-  for (int i = 0; i < faces_.size(); ++i) {
-    faces_[i]->processEvents();
+  vector<ptr_lib::shared_ptr<ForwarderFace> > faces;
+  {
+    lock_guard<mutex> lock(facesMutex_);
+    if (isFaceThreadsStarted_)
+      // The face threads process events.
+      return;
+    faces = faces_;
+  }
+
+  for (int i = 0; i < faces.size(); ++i) {
+    faces[i]->processEvents();
   }
 }
 
 void
-MicroForwarder::ForwarderFace::send(const uint8_t *data, size_t dataLength)
+MicroForwarder::startFaceThreads(nanoseconds sleepTime)
+{
+  lock_guard<mutex> lock(facesMutex_);
+  if (isFaceThreadsStarted_)
+    return;
+
+  isFaceThreadsStarted_ = true;
+  faceThreadSleepTime_ = sleepTime;
+  for (int i = 0; i < faces_.size(); ++i)
+    faces_[i]->startThread
+      (sleepTime, isPolledTransport(faces_[i]->getTransport()));
+}
+
+void
+MicroForwarder::stopFaceThreads()
+{
+  vector<ptr_lib::shared_ptr<ForwarderFace> > faces;
+  {
+    lock_guard<mutex> lock(facesMutex_);
+    if (!isFaceThreadsStarted_)
+      return;
+    isFaceThreadsStarted_ = false;
+    faces = faces_;
+  }
+
+  // Join without holding the lock, since a face thread may call findFace.
+  for (int i = 0; i < faces.size(); ++i)
+    faces[i]->stopThread();
+}
+
+MicroForwarder::ForwarderFace::~ForwarderFace()
+{
+  stopThread();
+}
+
+bool
+MicroForwarder::isPolledTransport(Transport* transport)
+{
+  // The Endpoint of a MicroForwarderTransport receives a packet when the
+  // application sends it.
+  return !dynamic_cast<MicroForwarderTransport::Endpoint*>(transport);
+}
+
+void
+MicroForwarder::ForwarderFace::startThread(nanoseconds sleepTime, bool isPolled)
+{
+  if (thread_.joinable())
+    return;
+
+  isThreadStopping_ = false;
+  thread_ = thread([this, sleepTime, isPolled]() {
+    unique_lock<mutex> lock(sendMutex_);
+    while (!isThreadStopping_) {
+      lock.unlock();
+      try {
+        if (isPolled && transport_)
+          transport_->processEvents();
+        sendQueuedPackets();
+      } catch (const std::exception& ex) {
+        _LOG_ERROR("MicroForwarder: Error in face " << faceId_ <<
+          " processEvents: " << ex.what());
+      }
+      lock.lock();
+
+      if (isThreadStopping_)
+        break;
+      bool hasWaitTime = isPolled;
+      nanoseconds waitTime = sleepTime;
+      if (activeFlows_.size() > 0 && !isSending_) {
+        if (rateLimit_ <= 0)
+          // The rate limit was removed, so send now.
+          continue;
+
+        // Wait until the token bucket has a token for the queued packets.
+        nanoseconds tokenWaitTime = duration_cast<nanoseconds>
+          (duration<double>((1 - tokens_) / rateLimit_));
+        if (!hasWaitTime || tokenWaitTime < waitTime)
+          waitTime = tokenWaitTime;
+        hasWaitTime = true;
+      }
+
+      // send() and stopThread() notify when there is something to do.
+      if (hasWaitTime)
+        threadCondition_.wait_for(lock, waitTime);
+      else
+        threadCondition_.wait(lock);
+    }
+  });
+}
+
+void
+MicroForwarder::ForwarderFace::stopThread()
+{
+  if (!thread_.joinable())
+    return;
+
+  {
+    lock_guard<mutex> lock(sendMutex_);
+    isThreadStopping_ = true;
+  }
+  threadCondition_.notify_all();
+  if (thread_.get_id() == this_thread::get_id())
+    // Called from the face thread itself, so it will exit on its own.
+    thread_.detach();
+  else
+    thread_.join();
+}
+
+/**
+ * This is called by writeNestedTlv to write the TLVs in the body of an
+ * LpPacket with a CongestionMark and the fragment.
+ * @param context A pointer to the ndn_Blob of the fragment.
+ */
+static void
+encodeCongestionMarkLpValue(const void *context, TlvEncoder &encoder)
+{
+  struct ndn_Blob fragment = *(const struct ndn_Blob *)context;
+
+  encoder.writeNonNegativeIntegerTlv(ndn_Tlv_LpPacket_CongestionMark, 1);
+  encoder.writeBlobTlv(ndn_Tlv_LpPacket_Fragment, &fragment);
+}
+
+void
+MicroForwarder::ForwarderFace::send
+  (const uint8_t *data, size_t dataLength, int inFaceId, const Blob& blob)
+{
+  unique_lock<mutex> lock(sendMutex_);
+  if (rateLimit_ <= 0 && queueCounters_.getNQueuedPackets() == 0 && !isSending_) {
+    // There is no rate limit, so send immediately. The lock is not held while
+    // sending since the transport may deliver the packet to an application
+    // which sends a reply on another face, whose thread may be sending to
+    // this face.
+    isSending_ = true;
+    queueCounters_.setNSentPackets(queueCounters_.getNSentPackets() + 1);
+    lock.unlock();
+    sendToTransport(data, dataLength);
+    lock.lock();
+    isSending_ = false;
+    if (queueCounters_.getNQueuedPackets() == 0)
+      return;
+
+    // Send the packets which another thread queued while sending.
+    lock.unlock();
+    sendQueuedPackets();
+    return;
+  }
+
+  if (maxQueueSize_ > 0 &&
+      queueCounters_.getNQueuedBytes() + dataLength > maxQueueSize_) {
+    _LOG_DEBUG("Dropped packet for the full output queue of face " << faceId_);
+    queueCounters_.setNDroppedPackets(queueCounters_.getNDroppedPackets() + 1);
+    return;
+  }
+
+  Blob packet;
+  if (congestionMarkThreshold_ > 0 &&
+      queueCounters_.getNQueuedBytes() >= congestionMarkThreshold_ &&
+      (data[0] == ndn_Tlv_Interest || data[0] == ndn_Tlv_Data)) {
+    // Put the packet in an LpPacket with the CongestionMark. (Don't change a
+    // packet which is already an LpPacket, such as a Nack.)
+    struct ndn_Blob fragment;
+    ndn_Blob_initialize(&fragment, data, dataLength);
+    TlvEncoder encoder(dataLength + 16);
+    encoder.writeNestedTlv
+      (ndn_Tlv_LpPacket_LpPacket, encodeCongestionMarkLpValue, &fragment);
+    packet = encoder.finish();
+    queueCounters_.setNCongestionMarkedPackets
+      (queueCounters_.getNCongestionMarkedPackets() + 1);
+  }
+  else if (blob.buf() == data && blob.size() == dataLength)
+    packet = blob;
+  else
+    // The data buffer may only be valid during this call, so copy.
+    packet = Blob(data, dataLength);
+
+  FlowQueue& flowQueue = flowQueues_[inFaceId];
+  if (flowQueue.getPackets().size() == 0)
+    activeFlows_.push_back(inFaceId);
+  flowQueue.getPackets().push_back(packet);
+  queueCounters_.setNQueuedPackets(queueCounters_.getNQueuedPackets() + 1);
+  queueCounters_.setNQueuedBytes(queueCounters_.getNQueuedBytes() + packet.size());
+
+  lock.unlock();
+  // Wake the face thread to wait for the token bucket.
+  threadCondition_.notify_one();
+  sendQueuedPackets();
+}
+
+void
+MicroForwarder::ForwarderFace::setRateLimit
+  (double bytesPerSecond, size_t burstSize)
+{
+  lock_guard<mutex> lock(sendMutex_);
+  rateLimit_ = bytesPerSecond;
+  burstSize_ = burstSize;
+  // Start with a full bucket.
+  tokens_ = burstSize;
+  lastTokenTime_ = steady_clock::now();
+  threadCondition_.notify_one();
+}
+
+void
+MicroForwarder::ForwarderFace::sendQueuedPackets()
+{
+  unique_lock<mutex> lock(sendMutex_);
+  if (queueCounters_.getNQueuedPackets() == 0 || isSending_)
+    // Nothing to send, or another call (possibly a reentrant call from
+    // sendToTransport) is sending and will continue with the queued packets.
+    return;
+  isSending_ = true;
+
+  if (rateLimit_ > 0) {
+    // Add the tokens for the elapsed time, up to the burst size.
+    auto now = steady_clock::now();
+    tokens_ = min
+      ((double)burstSize_,
+       tokens_ + rateLimit_ * duration<double>(now - lastTokenTime_).count());
+    lastTokenTime_ = now;
+  }
+
+  // In each round, each incoming face's queue gets a quantum of bytes to
+  // send. A packet larger than the quantum waits for more rounds.
+  const size_t quantum = 512;
+  // Allow the tokens to go negative for the last packet, so that a packet
+  // larger than the burst size can still be sent.
+  while (activeFlows_.size() > 0 && (rateLimit_ <= 0 || tokens_ > 0)) {
+    int flowId = activeFlows_.front();
+    FlowQueue& flowQueue = flowQueues_[flowId];
+    if (!isQuantumAdded_) {
+      flowQueue.setDeficit(flowQueue.getDeficit() + quantum);
+      isQuantumAdded_ = true;
+    }
+
+    size_t packetSize = flowQueue.getPackets().front().size();
+    if (packetSize > flowQueue.getDeficit()) {
+      // Move to the next incoming face in the round.
+      activeFlows_.splice(activeFlows_.end(), activeFlows_, activeFlows_.begin());
+      isQuantumAdded_ = false;
+      continue;
+    }
+
+    Blob packet = flowQueue.getPackets().front();
+    flowQueue.getPackets().pop_front();
+    flowQueue.setDeficit(flowQueue.getDeficit() - packetSize);
+    queueCounters_.setNQueuedPackets(queueCounters_.getNQueuedPackets() - 1);
+    queueCounters_.setNQueuedBytes(queueCounters_.getNQueuedBytes() - packetSize);
+    if (flowQueue.getPackets().size() == 0) {
+      // An idle queue doesn't keep its deficit.
+      flowQueues_.erase(flowId);
+      activeFlows_.pop_front();
+      isQuantumAdded_ = false;
+    }
+    if (rateLimit_ > 0)
+      tokens_ -= packetSize;
+    queueCounters_.setNSentPackets(queueCounters_.getNSentPackets() + 1);
+
+    // Don't hold the lock while sending. (See send.)
+    lock.unlock();
+    sendToTransport(packet.buf(), packet.size());
+    lock.lock();
+  }
+
+  isSending_ = false;
+  if (activeFlows_.size() > 0)
+    // Let the face thread wait for the token bucket.
+    threadCondition_.notify_one();
+}
+
+void
+MicroForwarder::ForwarderFace::sendToTransport
+  (const uint8_t *data, size_t dataLength)
 {
   if (transport_) {
     try {
@@ -159,6 +783,27 @@ MicroForwarder::ForwarderFace::send(const uint8_t *data, size_t dataLength)
   }
 }
 
+void
+MicroForwarder::ForwarderFace::addRttMeasurement(nanoseconds rtt)
+{
+  lock_guard<mutex> lock(rttMutex_);
+  if (!hasRttMeasurement_) {
+    smoothedRtt_ = rtt;
+    rttVariation_ = rtt / 2;
+    hasRttMeasurement_ = true;
+  }
+  else {
+    // Use alpha = 1/8 and beta = 1/4 as in RFC 6298.
+    nanoseconds difference = smoothedRtt_ - rtt;
+    if (difference.count() < 0)
+      difference = -difference;
+    rttVariation_ = (3 * rttVariation_ + difference) / 4;
+    smoothedRtt_ = (7 * smoothedRtt_ + rtt) / 8;
+  }
+
+  nConsecutiveTimeouts_ = 0;
+}
+
 void
 MicroForwarder::ForwarderFace::onReceivedElement
   (const uint8_t *element, size_t elementLength)
@@ -170,244 +815,829 @@ void
 MicroForwarder::onReceivedElement
   (ForwarderFace* face, const uint8_t *element, size_t elementLength)
 {
-  const int Tlv_Interest = 5;
-  const int Tlv_Data = 6;
   const int Tlv_LpPacket_LpPacket = 100;
   const uint8_t *interestOrData = element;
   size_t interestOrDataLength = elementLength;
-  ptr_lib::shared_ptr<LpPacket> lpPacket;
+  // Use LpPacketLite to avoid copying the fragment.
+  struct ndn_LpPacketHeaderField headerFields[5];
+  LpPacketLite lpPacketLite
+    (headerFields, sizeof(headerFields) / sizeof(headerFields[0]));
+  const NetworkNackLite* networkNack = 0;
   if (element[0] == Tlv_LpPacket_LpPacket) {
     // Decode the LpPacket and replace element with the fragment.
-    // Use LpPacketLite to avoid copying the fragment.
-    struct ndn_LpPacketHeaderField headerFields[5];
-    LpPacketLite lpPacketLite
-      (headerFields, sizeof(headerFields) / sizeof(headerFields[0]));
-
     ndn_Error error;
     if ((error = Tlv0_3WireFormatLite::decodeLpPacket
          (lpPacketLite, element, elementLength)))
       throw runtime_error(ndn_getErrorString(error));
     interestOrData = lpPacketLite.getFragmentWireEncoding().buf();
     interestOrDataLength = lpPacketLite.getFragmentWireEncoding().size();
-    // We have saved the wire encoding, so clear to copy it to lpPacket.
-    lpPacketLite.setFragmentWireEncoding(BlobLite());
+    networkNack = NetworkNackLite::getFirstHeader(lpPacketLite);
+  }
+
+  // Peek at the fields of the Interest or Data without decoding.
+  if (interestOrDataLength == 0 ||
+      !(interestOrData[0] == ndn_Tlv_Interest || interestOrData[0] == ndn_Tlv_Data))
+    return;
+  PacketFields packet;
+  ndn_Error error;
+  if ((error = packet.peek(interestOrData, interestOrDataLength)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  if (networkNack && !packet.isInterest())
+    // We got a Nack but not for an Interest, so drop the packet.
+    return;
+
+  MicroForwarderTransport* microForwarderTransport = 0;
+  if (packet.isInterest() && !networkNack) {
+    _LOG_DEBUG("Received Interest on face " << face->getFaceId() << ": " <<
+       packet.getName());
 
-    lpPacket.reset(new LpPacket());
-    lpPacket->set(lpPacketLite);
+    if (dynamic_cast<MicroForwarderTransport::Endpoint*>(face->getTransport()))
+      // The incoming face uses a MicroForwarderTransport.
+      microForwarderTransport = ((MicroForwarderTransport::Endpoint*)face->getTransport())->transport_;
+
+    if (packet.nameHasPrefix(localhostPrefixValue)) {
+      onReceivedLocalhostInterest(face, packet);
+      return;
+    }
+
+    if (packet.nameHasPrefix(localhopPrefixValue) &&
+        !(microForwarderTransport && !microForwarderTransport->isLocal_))
+      // Ignore localhop unless the MicroForwarderTransport has been set as not local.
+      return;
   }
 
-  // First, decode as Interest or Data.
-  ptr_lib::shared_ptr<Interest> interest;
-  ptr_lib::shared_ptr<Data> data;
+  auto now = system_clock::now();
+  // Collect the packets to send after releasing the lock.
+  vector<OutgoingPacket> outgoing;
+  if (packet.isInterest()) {
+    // The name without an implicit digest has the same first components as
+    // the Data name.
+    size_t nameValueLength = packet.endsWithImplicitDigest() ?
+      packet.getNameValueLengthWithoutLastComponent() : packet.getNameValueLength();
+    Shard& shard = getShard
+      (packet.getNameValue(), getPrefixValueLength
+       (packet.getNameValue(), nameValueLength, nShardNameComponents_));
+    lock_guard<mutex> lock(shard.getMutex());
+    removeExpiredPitEntries(shard, now);
 
-  if (interestOrData[0] == Tlv_Interest) {
-    interest.reset(new Interest());
-    interest->wireDecode(interestOrData, interestOrDataLength, *TlvWireFormat::get());
+    if (networkNack) {
+      _LOG_DEBUG("Received Nack on face " << face->getFaceId() <<
+        ", reason code " << networkNack->getReason() << ": " << packet.getName());
+      onReceivedNack(face, packet, element, elementLength, now, shard, outgoing);
+    }
+    else
+      onReceivedInterest
+        (face, packet, element, elementLength, microForwarderTransport, now,
+         shard, outgoing);
   }
-  else if (interestOrData[0] == Tlv_Data) {
-    data.reset(new Data());
-    data->wireDecode(interestOrData, interestOrDataLength, *TlvWireFormat::get());
+  else {
+    // A pending Interest with CanBePrefix can have fewer name components than
+    // are used to select the shard, so check the shard of each shorter prefix,
+    // ending with the shard of the full prefix which has the Content Store.
+    bool isRttMeasured = false;
+    bool isSatisfied = false;
+    Shard* shard;
+    size_t prefixValueLength = 0;
+    for (int i = 0; ; ++i) {
+      shard = &getShard(packet.getNameValue(), prefixValueLength);
+      bool isFullPrefix = (i >= nShardNameComponents_ ||
+                           prefixValueLength >= packet.getNameValueLength());
+      if (isFullPrefix || shard->hasShortPrefixPitEntries()) {
+        lock_guard<mutex> lock(shard->getMutex());
+        removeExpiredPitEntries(*shard, now);
+        if (onReceivedData
+            (face, packet, element, elementLength, now, *shard, isRttMeasured,
+             outgoing))
+          isSatisfied = true;
+      }
+
+      if (isFullPrefix)
+        break;
+      prefixValueLength = getPrefixValueLength
+        (packet.getNameValue(), packet.getNameValueLength(), i + 1);
+    }
+
+    // Only cache Data which satisfied an Interest.
+    size_t contentStoreCapacity = contentStoreCapacity_;
+    if (isSatisfied && contentStoreCapacity > 0) {
+      // The element buffer is only valid during this call, so copy the Data
+      // packet for the Content Store.
+      Blob dataEncoding(interestOrData, interestOrDataLength);
+      packet.setEncoding(dataEncoding.buf());
+      lock_guard<mutex> lock(shard->getMutex());
+      shard->insertIntoContentStore
+        (dataEncoding, packet, contentStoreCapacity / shards_.size(), now);
+    }
   }
 
-  auto now = system_clock::now();
-  // Remove timed-out PIT entries
+  for (size_t i = 0; i < outgoing.size(); ++i)
+    outgoing[i].send();
+}
+
+void
+MicroForwarder::removeExpiredPitEntries(Shard& shard, system_clock::time_point now)
+{
+  vector<ptr_lib::shared_ptr<PitEntry> >& PIT = shard.getPit();
+
   // Iterate backwards so we can remove the entry and keep iterating.
-  for (int i = PIT_.size() - 1; i >= 0; --i) {
-    PitEntry& entry = *PIT_[i];
+  for (int i = PIT.size() - 1; i >= 0; --i) {
+    PitEntry& entry = *PIT[i];
     // For removal, we also check the timeoutEndTime in case it is greater
     // than entryEndTime.
     if (now >= entry.getEntryEndTime() && now >= entry.getTimeoutEndTime())
-      removePitEntry(i);
-    else if (now >= entry.getTimeoutEndTime())
+      shard.removePitEntry(i);
+    else if (now >= entry.getTimeoutEndTime()) {
+      if (entry.getInFace()) {
+        // The Interest was not satisfied, so record the timeout on the
+        // upstream faces for the RTT-based strategy.
+        for (size_t j = 0; j < entry.getOutRecords().size(); ++j) {
+          OutRecord& outRecord = entry.getOutRecords()[j];
+          if (!outRecord.getIsNacked())
+            outRecord.getFace()->recordTimeout();
+        }
+      }
+
       // Timed out, so set inFace_ null which prevents using the PIT entry to
       // return a Data packet, but we keep the PIT entry to check for a
       // duplicate nonce. (If a fresh Interest arrives with the same name, a
       // new PIT entry will be created.)
       entry.clearInFace();
+    }
   }
+}
 
-  if (lpPacket) {
-    ptr_lib::shared_ptr<NetworkNack> networkNack =
-      NetworkNack::getFirstHeader(*lpPacket);
-    if (networkNack) {
-      if (!interest)
-        // We got a Nack but not for an Interest, so drop the packet.
+void
+MicroForwarder::onReceivedInterest
+  (ForwarderFace* face, const PacketFields& interest,
+   const uint8_t *element, size_t elementLength,
+   MicroForwarderTransport* microForwarderTransport, system_clock::time_point now,
+   Shard& shard, vector<OutgoingPacket>& outgoing)
+{
+  vector<ptr_lib::shared_ptr<PitEntry> >& PIT = shard.getPit();
+
+  // First check for a duplicate nonce on any face.
+  if (interest.getNonceLength() > 0) {
+    for (int i = 0; i < PIT.size(); ++i) {
+      const PacketFields& entryInterest = PIT[i]->getInterest();
+      if (entryInterest.getNonceLength() == interest.getNonceLength() &&
+          memcmp(entryInterest.getNonce(), interest.getNonce(),
+                 interest.getNonceLength()) == 0) {
+        _LOG_DEBUG("Dropped Interest with duplicate nonce " <<
+          Blob(interest.getNonce(), interest.getNonceLength()).toHex() << ": " <<
+          interest.getName());
         return;
+      }
+    }
+  }
 
-      // All prefixes have multicast strategy by default, so drop the Nack so
-      // that it doesn't consume the PIT entry.
-      _LOG_DEBUG("Dropped Interest with Nack on face " << face->getFaceId() <<
-        ", reason code " << networkNack->getReason() << ": " << interest->getName());
+  size_t contentStoreCapacity = contentStoreCapacity_;
+  if (contentStoreCapacity > 0) {
+    ContentStoreEntry* contentStoreEntry = shard.findInContentStore(interest, now);
+    if (contentStoreEntry) {
+      _LOG_DEBUG("Replied from the Content Store to face " << face->getFaceId()
+        << ": " << contentStoreEntry->getData().getName());
+      outgoing.push_back(OutgoingPacket
+        (face, 0, contentStoreEntry->getEncoding().buf(),
+         contentStoreEntry->getEncoding().size(), contentStoreEntry->getEncoding()));
       return;
     }
   }
 
-  // Now process as Interest or Data.
-  if (interest) {
-    _LOG_DEBUG("Received Interest on face " << face->getFaceId() << ": " <<
-       interest->getName());
+  // Check for a duplicate Interest.
+  system_clock::time_point timeoutEndTime;
+  if (interest.getInterestLifetime().count() >= 0)
+    timeoutEndTime = now + 
+      duration_cast<system_clock::duration>(interest.getInterestLifetime());
+  else
+    // Use a default timeout.
+    timeoutEndTime = now + seconds(4);
+  system_clock::time_point entryEndTime = 
+    now + duration_cast<system_clock::duration>(minPitEntryLifetime_);
+  bool isDuplicateInterest = false;
+  for (int i = 0; i < PIT.size(); ++i) {
+    PitEntry& entry = *PIT[i];
+    // TODO: Check interest equality of appropriate selectors.
+    if (entry.getInterest().nameEquals(interest)) {
+      // Duplicate interest. If it's a new face, then we'll create a PIT entry,
+      // but won't forward.
+      isDuplicateInterest = true;
 
-    MicroForwarderTransport* microForwarderTransport = 0;
-    if (dynamic_cast<MicroForwarderTransport::Endpoint*>(face->getTransport()))
-      // The incoming face uses a MicroForwarderTransport.
-      microForwarderTransport = ((MicroForwarderTransport::Endpoint*)face->getTransport())->transport_;
+      if (entry.getInFace() == face) {
+        // Update the interest timeout.
+        if (timeoutEndTime > entry.getTimeoutEndTime())
+          entry.setTimeoutEndTime(timeoutEndTime);
+        // Also update the PIT entry timeout.
+        entry.setEntryEndTime(entryEndTime);
+
+        _LOG_DEBUG("Duplicate Interest on same face " << face->getFaceId() << ": "
+          << interest.getName());
+        return;
+      }
+    }
+  }
 
-    if (localhostNamePrefix.match(interest->getName())) {
-      onReceivedLocalhostInterest(face, interest);
+  // Add to the PIT. The element buffer is only valid during this call, so the
+  // PIT entry keeps a copy of the Interest.
+  auto pitEntry = ptr_lib::make_shared<PitEntry>
+    (Blob(interest.getEncoding(), interest.getEncodingLength()), interest, face,
+     timeoutEndTime, entryEndTime);
+  if (interest.getCanBePrefix() && nShardNameComponents_ > 0 &&
+      getPrefixValueLength
+        (interest.getNameValue(), interest.getNameValueLength(),
+         nShardNameComponents_ - 1) == interest.getNameValueLength())
+    // Data with a longer name is processed in another shard.
+    pitEntry->setIsShortPrefix();
+  shard.addPitEntry(pitEntry);
+  _LOG_DEBUG("Added PIT entry for Interest: " << interest.getName());
+
+  if (interest.nameHasPrefix(broadcastPrefixValue)) {
+    // Special case: broadcast to all faces.
+    vector<ptr_lib::shared_ptr<ForwarderFace> > faces;
+    getFaces(faces);
+    for (int i = 0; i < faces.size(); ++i) {
+      ForwarderFace* outFace = faces[i].get();
+      // Don't send the interest back to where it came from.
+      if (outFace != face) {
+        _LOG_DEBUG("Broadcasted Interest to face " << outFace->getFaceId() << ": "
+          << interest.getName());
+        // Forward the full element including any LP header.
+        pitEntry->addOutRecord(outFace, now);
+        outgoing.push_back(OutgoingPacket(outFace, face, element, elementLength));
+      }
+    }
+  }
+  else {
+    if (microForwarderTransport && microForwarderTransport->outFaceId_ >= 0) {
+      // Special case. The transport specifies the outgoing face to use.
+      // remoteRegisterPrefix uses this to send the registration Interest only to the target.
+      ForwarderFace* outFace = findFace(microForwarderTransport->outFaceId_);
+      if (!outFace) {
+        // We don't expect this since remoteRegisterPrefix already checked it.
+        _LOG_INFO("Unrecognized outFaceId_ " << microForwarderTransport->outFaceId_);
+        return;
+      }
+
+      _LOG_DEBUG("Forwarded Interest to specified face " <<
+        microForwarderTransport->outFaceId_ << ": " << interest.getName());
+      // Forward the full element including any LP header.
+      pitEntry->addOutRecord(outFace, now);
+      outgoing.push_back(OutgoingPacket(outFace, face, element, elementLength));
       return;
     }
 
-    if (localhopNamePrefix.match(interest->getName()) &&
-        !(microForwarderTransport && !microForwarderTransport->isLocal_))
-      // Ignore localhop unless the MicroForwarderTransport has been set as not local.
+    // Let the strategy select from the next hops in matching FIB entries.
+    shared_lock<shared_timed_mutex> fibLock(fibMutex_);
+    ForwardingStrategy& strategy = findStrategy(interest);
+    vector<NextHopRecord*> nextHops;
+    getNextHops(interest, strategy, face, 0, nextHops);
+    if (nextHops.size() == 0)
       return;
 
-    // First check for a duplicate nonce on any face.
-    for (int i = 0; i < PIT_.size(); ++i) {
-      PitEntry& entry = *PIT_[i];
-      if (entry.getInterest()->getNonce().equals(interest->getNonce())) {
-        _LOG_DEBUG("Dropped Interest with duplicate nonce " << interest->getNonce().toHex()
-          << ": " << interest->getName());
-        return;
+    vector<ForwarderFace*> outFaces;
+    strategy.afterReceiveInterest(nextHops, now, outFaces);
+    for (size_t i = 0; i < outFaces.size(); ++i) {
+      ForwarderFace* outFace = outFaces[i];
+      _LOG_DEBUG("Forwarded Interest to face " << outFace->getFaceId() << ": "
+        << interest.getName());
+      // Forward the full element including any LP header.
+      pitEntry->addOutRecord(outFace, now);
+      outgoing.push_back(OutgoingPacket(outFace, face, element, elementLength));
+    }
+  }
+}
+
+bool
+MicroForwarder::onReceivedData
+  (ForwarderFace* face, PacketFields& data, const uint8_t *element,
+   size_t elementLength, system_clock::time_point now, Shard& shard,
+   bool& isRttMeasured, vector<OutgoingPacket>& outgoing)
+{
+  _LOG_DEBUG("Received Data on face " << face->getFaceId() << ": " << data.getName());
+  vector<ptr_lib::shared_ptr<PitEntry> >& PIT = shard.getPit();
+
+  // Send the data packet to the face for each matching PIT entry.
+  bool isSatisfied = false;
+  for (int i = 0; i < PIT.size(); ++i) {
+    PitEntry& entry = *PIT[i];
+    if (entry.getInFace() && entry.getInterest().matchesData(data)) {
+      if (!isRttMeasured) {
+        OutRecord* outRecord = entry.findOutRecord(face);
+        if (outRecord) {
+          face->addRttMeasurement
+            (duration_cast<nanoseconds>(now - outRecord->getSendTime()));
+          isRttMeasured = true;
+        }
       }
+
+      _LOG_DEBUG("Forwarded Data to face " << entry.getInFace()->getFaceId()
+        << ": " << data.getName());
+      // Forward the full element including any LP header.
+      outgoing.push_back
+        (OutgoingPacket(entry.getInFace(), face, element, elementLength));
+
+      // The PIT entry is consumed, so set clear the inFace_ which prevents
+      // using it to return another Data packet, but we keep the PIT entry to
+      // check for a duplicate nonce. It will be deleted after entryEndTime.
+      // (If a fresh Interest arrives with the same name, a new PIT entry will
+      // be created.)
+      entry.clearInFace();
+      isSatisfied = true;
     }
+  }
+
+  return isSatisfied;
+}
+
+void
+MicroForwarder::onReceivedNack
+  (ForwarderFace* face, const PacketFields& interest, const uint8_t *element,
+   size_t elementLength, system_clock::time_point now, Shard& shard,
+   vector<OutgoingPacket>& outgoing)
+{
+  vector<ptr_lib::shared_ptr<PitEntry> >& PIT = shard.getPit();
+
+  // Find the PIT entry of the Interest which was forwarded to the face.
+  for (int i = 0; i < PIT.size(); ++i) {
+    PitEntry& entry = *PIT[i];
+    const PacketFields& entryInterest = entry.getInterest();
+    if (!entry.getInFace() ||
+        entryInterest.getNonceLength() != interest.getNonceLength() ||
+        memcmp(entryInterest.getNonce(), interest.getNonce(),
+               interest.getNonceLength()) != 0 ||
+        !entryInterest.nameEquals(interest))
+      continue;
+    OutRecord* outRecord = entry.findOutRecord(face);
+    if (!outRecord)
+      continue;
+
+    outRecord->setIsNacked();
+
+    // Ask the strategy for a next hop which was not already tried.
+    shared_lock<shared_timed_mutex> fibLock(fibMutex_);
+    ForwardingStrategy& strategy = findStrategy(interest);
+    vector<NextHopRecord*> nextHops;
+    getNextHops(interest, strategy, entry.getInFace(), &entry, nextHops);
+    ForwarderFace* retryFace = 0;
+    if (nextHops.size() > 0)
+      retryFace = strategy.afterReceiveNack(nextHops);
 
-    // Check for a duplicate Interest.
-    system_clock::time_point timeoutEndTime;
-    if (interest->getInterestLifetime().count() >= 0)
-      timeoutEndTime = now + 
-        duration_cast<system_clock::duration>(interest->getInterestLifetime());
+    if (retryFace) {
+      _LOG_DEBUG("Retried Interest after Nack to face " << retryFace->getFaceId()
+        << ": " << interest.getName());
+      // Forward the Interest without the Nack header.
+      entry.addOutRecord(retryFace, now);
+      outgoing.push_back(OutgoingPacket
+        (retryFace, entry.getInFace(), interest.getEncoding(),
+         interest.getEncodingLength()));
+    }
+    else if (entry.isAllNacked()) {
+      _LOG_DEBUG("Forwarded Nack to face " << entry.getInFace()->getFaceId()
+        << ": " << interest.getName());
+      // The Nack has the same nonce as the Interest from the downstream.
+      outgoing.push_back
+        (OutgoingPacket(entry.getInFace(), face, element, elementLength));
+      entry.clearInFace();
+    }
     else
-      // Use a default timeout.
-      timeoutEndTime = now + seconds(4);
-    system_clock::time_point entryEndTime = 
-      now + duration_cast<system_clock::duration>(minPitEntryLifetime_);
-    bool isDuplicateInterest = false;
-    for (int i = 0; i < PIT_.size(); ++i) {
-      PitEntry& entry = *PIT_[i];
-      // TODO: Check interest equality of appropriate selectors.
-      if (entry.getInterest()->getName().equals(interest->getName())) {
-        // Duplicate interest. If it's a new face, then we'll create a PIT entry,
-        // but won't forward.
-        isDuplicateInterest = true;
-
-        if (entry.getInFace() == face) {
-          // Update the interest timeout.
-          if (timeoutEndTime > entry.getTimeoutEndTime())
-            entry.setTimeoutEndTime(timeoutEndTime);
-          // Also update the PIT entry timeout.
-          entry.setEntryEndTime(entryEndTime);
-
-          _LOG_DEBUG("Duplicate Interest on same face " << face->getFaceId() << ": "
-            << interest->getName());
-          return;
+      // Wait for the other upstreams.
+      _LOG_DEBUG("Dropped Nack while waiting for other upstreams: " <<
+        interest.getName());
+
+    return;
+  }
+
+  _LOG_DEBUG("Dropped Nack with no PIT entry on face " << face->getFaceId() <<
+    ": " << interest.getName());
+}
+
+void
+MicroForwarder::getNextHops
+  (const PacketFields& interest, ForwardingStrategy& strategy,
+   ForwarderFace* inFace, PitEntry* pitEntry, vector<NextHopRecord*>& nextHops)
+{
+  nextHops.clear();
+
+  // Among the prefixes of a name, the longer encoding has more components.
+  FibEntry* longestMatch = 0;
+  if (!strategy.usesAllMatchingFibEntries()) {
+    for (int i = 0; i < FIB_.size(); ++i) {
+      FibEntry& fibEntry = *FIB_[i];
+      if (interest.nameHasPrefix(fibEntry.getNameValue()) &&
+          (!longestMatch ||
+           fibEntry.getNameValue().size() > longestMatch->getNameValue().size()))
+        longestMatch = &fibEntry;
+    }
+  }
+
+  for (int i = 0; i < FIB_.size(); ++i) {
+    FibEntry& fibEntry = *FIB_[i];
+    if (longestMatch) {
+      if (&fibEntry != longestMatch)
+        continue;
+    }
+    else if (!interest.nameHasPrefix(fibEntry.getNameValue()))
+      continue;
+
+    for (int j = 0; j < fibEntry.getNextHopCount(); ++j) {
+      NextHopRecord& nextHop = fibEntry.getNextHop(j);
+      ForwarderFace* outFace = nextHop.getFace();
+
+      // Don't send the interest back to where it came from or to a face already tried.
+      if (outFace == inFace || !outFace->isEnabled() ||
+          (pitEntry && pitEntry->findOutRecord(outFace)))
+        continue;
+
+      // Keep one NextHopRecord per face, with the lowest cost.
+      bool isFound = false;
+      for (size_t k = 0; k < nextHops.size(); ++k) {
+        if (nextHops[k]->getFace() == outFace) {
+          if (nextHop.getCost() < nextHops[k]->getCost())
+            nextHops[k] = &nextHop;
+          isFound = true;
+          break;
         }
       }
+      if (!isFound)
+        nextHops.push_back(&nextHop);
     }
+  }
+}
 
-    // Add to the PIT.
-    auto pitEntry = ptr_lib::make_shared<PitEntry>
-      (interest, face, timeoutEndTime, entryEndTime);
-    PIT_.push_back(pitEntry);
-    _LOG_DEBUG("Added PIT entry for Interest: " << interest->getName());
-
-    if (broadcastNamePrefix.match(interest->getName())) {
-      // Special case: broadcast to all faces.
-      for (int i = 0; i < faces_.size(); ++i) {
-        ForwarderFace* outFace = faces_[i].get();
-        // Don't send the interest back to where it came from.
-        if (outFace != face) {
-          _LOG_DEBUG("Broadcasted Interest to face " << outFace->getFaceId() << ": "
-            << interest->getName());
-          // Forward the full element including any LP header.
-          outFace->send(element, elementLength);
-        }
+MicroForwarder::ContentStoreEntry*
+MicroForwarder::Shard::findInContentStore
+  (const PacketFields& interest, system_clock::time_point now)
+{
+  BlobLite nameValue(interest.getNameValue(), interest.getNameValueLength());
+  auto found = contentStore_.end();
+
+  if (interest.getCanBePrefix()) {
+    // The names which have the prefix follow it in the map.
+    for (auto entry = contentStore_.lower_bound(nameValue);
+         entry != contentStore_.end() &&
+         (*entry->second)->getData().nameHasPrefix
+           (nameValue.buf(), nameValue.size());
+         ++entry) {
+      ContentStoreEntry& contentStoreEntry = **entry->second;
+      if ((!interest.getMustBeFresh() || contentStoreEntry.isFresh(now)) &&
+          interest.matchesData(contentStoreEntry.getData())) {
+        found = entry;
+        break;
       }
     }
-    else {
-      if (microForwarderTransport && microForwarderTransport->outFaceId_ >= 0) {
-        // Special case. The transport specifies the outgoing face to use.
-        // remoteRegisterPrefix uses this to send the registration Interest only to the target.
-        ForwarderFace* outFace = findFace(microForwarderTransport->outFaceId_);
-        if (!outFace) {
-          // We don't expect this since remoteRegisterPrefix already checked it.
-          _LOG_INFO("Unrecognized outFaceId_ " << microForwarderTransport->outFaceId_);
-          return;
-        }
-        
-        _LOG_DEBUG("Forwarded Interest to specified face " <<
-          microForwarderTransport->outFaceId_ << ": " << interest->getName());
-        // Forward the full element including any LP header.
-        outFace->send(element, elementLength);
-        return;
+  }
+  else {
+    // The Data name is the Interest name, or the Interest name without the
+    // implicit digest.
+    found = contentStore_.find(nameValue);
+    if (found == contentStore_.end() && interest.endsWithImplicitDigest())
+      found = contentStore_.find(BlobLite
+        (interest.getNameValue(), interest.getNameValueLengthWithoutLastComponent()));
+
+    if (found != contentStore_.end()) {
+      ContentStoreEntry& contentStoreEntry = **found->second;
+      if ((interest.getMustBeFresh() && !contentStoreEntry.isFresh(now)) ||
+          !interest.matchesData(contentStoreEntry.getData()))
+        found = contentStore_.end();
+    }
+  }
+
+  if (found == contentStore_.end())
+    return 0;
+
+  // Move to the front as the most recently used.
+  contentStoreLru_.splice
+    (contentStoreLru_.begin(), contentStoreLru_, found->second);
+  return found->second->get();
+}
+
+void
+MicroForwarder::Shard::insertIntoContentStore
+  (const Blob& encoding, const PacketFields& data, size_t capacity,
+   system_clock::time_point now)
+{
+  if (encoding.size() > capacity)
+    // It would evict everything and still not fit.
+    return;
+
+  eraseFromContentStore
+    (BlobLite(data.getNameValue(), data.getNameValueLength()));
+
+  system_clock::time_point staleTime = now;
+  if (data.getFreshnessPeriod().count() > 0)
+    staleTime += duration_cast<system_clock::duration>(data.getFreshnessPeriod());
+
+  contentStoreLru_.push_front
+    (ptr_lib::make_shared<ContentStoreEntry>(encoding, data, staleTime));
+  // The key refers to the encoding in the new entry.
+  contentStore_[contentStoreLru_.front()->getNameValue()] = contentStoreLru_.begin();
+  contentStoreSize_ += encoding.size();
+  _LOG_DEBUG("Added to the Content Store: " << data.getName());
+
+  evictContentStore(capacity);
+}
+
+void
+MicroForwarder::Shard::evictContentStore(size_t capacity)
+{
+  while (contentStoreSize_ > capacity)
+    eraseFromContentStore(contentStoreLru_.back()->getNameValue());
+}
+
+void
+MicroForwarder::Shard::eraseFromContentStore(const BlobLite& nameValue)
+{
+  auto found = contentStore_.find(nameValue);
+  if (found == contentStore_.end())
+    return;
+
+  // Erase the map entry before the list entry which holds the key's bytes.
+  ContentStoreList::iterator entry = found->second;
+  contentStoreSize_ -= (*entry)->getEncoding().size();
+  contentStore_.erase(found);
+  contentStoreLru_.erase(entry);
+}
+
+MicroForwarder::Shard&
+MicroForwarder::getShard(const uint8_t *prefixValue, size_t prefixValueLength)
+{
+  if (shards_.size() == 1)
+    return *shards_[0];
+
+  return *shards_
+    [CryptoLite::murmurHash3(0, prefixValue, prefixValueLength) % shards_.size()];
+}
+
+size_t
+MicroForwarder::getPrefixValueLength
+  (const uint8_t *nameValue, size_t nameValueLength, int nComponents)
+{
+  // The name was already checked by PacketFields::peek.
+  struct ndn_TlvDecoder decoder;
+  ndn_TlvDecoder_initialize(&decoder, nameValue, nameValueLength);
+  for (int i = 0; i < nComponents && decoder.offset < nameValueLength; ++i) {
+    uint64_t type;
+    uint64_t length;
+    if (ndn_TlvDecoder_readVarNumber(&decoder, &type) ||
+        ndn_TlvDecoder_readVarNumber(&decoder, &length))
+      return nameValueLength;
+    decoder.offset += length;
+  }
+
+  return decoder.offset < nameValueLength ? decoder.offset : nameValueLength;
+}
+
+MicroForwarder::ForwardingStrategy&
+MicroForwarder::findStrategy(const PacketFields& interest)
+{
+  // The constructor adds the entry for the empty prefix, which always matches.
+  StrategyChoiceEntry* longestMatch = strategyChoice_[0].get();
+  for (size_t i = 1; i < strategyChoice_.size(); ++i) {
+    StrategyChoiceEntry& entry = *strategyChoice_[i];
+    if (entry.getPrefixValue().size() > longestMatch->getPrefixValue().size() &&
+        interest.nameHasPrefix(entry.getPrefixValue()))
+      longestMatch = &entry;
+  }
+
+  return longestMatch->getStrategy();
+}
+
+Blob
+MicroForwarder::encodeNameValue(const Name& name)
+{
+  Blob encoding = name.wireEncode();
+
+  struct ndn_TlvDecoder decoder;
+  ndn_TlvDecoder_initialize(&decoder, encoding.buf(), encoding.size());
+  size_t length;
+  ndn_Error error;
+  if ((error = ndn_TlvDecoder_readTypeAndLength(&decoder, ndn_Tlv_Name, &length)))
+    // We don't expect this since we just encoded it.
+    throw runtime_error(ndn_getErrorString(error));
+
+  return Blob(encoding.buf() + decoder.offset, length);
+}
+
+/**
+ * Read the type and length of the TLV at the decoder's offset, and make sure
+ * that it does not go past endOffset. Update the decoder offset to the value.
+ * @param decoder A pointer to the ndn_TlvDecoder struct.
+ * @param endOffset The offset of the end of the parent TLV.
+ * @param type Return the TLV type.
+ * @param length Return the TLV length.
+ * @return 0 for success, else an error code.
+ */
+static ndn_Error
+readTypeAndLength
+  (struct ndn_TlvDecoder *decoder, size_t endOffset, uint64_t *type,
+   size_t *length)
+{
+  ndn_Error error;
+  uint64_t lengthVarNumber;
+  if ((error = ndn_TlvDecoder_readVarNumber(decoder, type)))
+    return error;
+  if ((error = ndn_TlvDecoder_readVarNumber(decoder, &lengthVarNumber)))
+    return error;
+
+  // The type and length VAR-NUMBERs may already be past endOffset. Check this
+  // first so that the subtraction can't wrap around. Also check the input
+  // length in case endOffset came from a bad length in the caller.
+  if (decoder->offset > endOffset ||
+      lengthVarNumber > endOffset - decoder->offset ||
+      lengthVarNumber > decoder->inputLength - decoder->offset)
+    return NDN_ERROR_TLV_length_exceeds_buffer_length;
+  *length = (size_t)lengthVarNumber;
+
+  return NDN_ERROR_success;
+}
+
+ndn_Error
+MicroForwarder::PacketFields::peek
+  (const uint8_t *encoding, size_t encodingLength)
+{
+  *this = PacketFields();
+  encoding_ = encoding;
+  encodingLength_ = encodingLength;
+
+  ndn_Error error;
+  struct ndn_TlvDecoder decoder;
+  ndn_TlvDecoder_initialize(&decoder, encoding, encodingLength);
+  uint64_t type;
+  size_t length;
+  if ((error = readTypeAndLength(&decoder, encodingLength, &type, &length)))
+    return error;
+  if (type != ndn_Tlv_Interest && type != ndn_Tlv_Data)
+    return NDN_ERROR_did_not_get_the_expected_TLV_type;
+  isInterest_ = (type == ndn_Tlv_Interest);
+  size_t endOffset = decoder.offset + length;
+
+  // The Name is the first TLV in an Interest or Data packet.
+  nameOffset_ = decoder.offset;
+  if ((error = readTypeAndLength(&decoder, endOffset, &type, &length)))
+    return error;
+  if (type != ndn_Tlv_Name)
+    return NDN_ERROR_did_not_get_the_expected_TLV_type;
+  nameValueOffset_ = decoder.offset;
+  nameValueLength_ = length;
+  size_t nameEndOffset = decoder.offset + length;
+  lastComponentOffset_ = nameValueLength_;
+  while (decoder.offset < nameEndOffset) {
+    size_t componentOffset = decoder.offset;
+    if ((error = readTypeAndLength(&decoder, nameEndOffset, &type, &length)))
+      return error;
+
+    lastComponentOffset_ = componentOffset - nameValueOffset_;
+    lastComponentType_ = (int)type;
+    lastComponentValueOffset_ = decoder.offset;
+    lastComponentValueLength_ = length;
+    decoder.offset += length;
+  }
+
+  // Scan the remaining TLVs for the fields we use and skip the others.
+  while (decoder.offset < endOffset) {
+    if ((error = readTypeAndLength(&decoder, endOffset, &type, &length)))
+      return error;
+    size_t valueEndOffset = decoder.offset + length;
+
+    if (isInterest_) {
+      if (type == ndn_Tlv_CanBePrefix)
+        canBePrefix_ = true;
+      else if (type == ndn_Tlv_MustBeFresh)
+        mustBeFresh_ = true;
+      else if (type == ndn_Tlv_Nonce) {
+        nonceOffset_ = decoder.offset;
+        nonceLength_ = length;
       }
+      else if (type == ndn_Tlv_InterestLifetime) {
+        uint64_t value;
+        if ((error = ndn_TlvDecoder_readNonNegativeInteger(&decoder, length, &value)))
+          return error;
+        interestLifetime_ = std::chrono::milliseconds(value);
+      }
+      else if (type == ndn_Tlv_Selectors) {
+        // NDN-TLV v0.2 where CanBePrefix is true unless MaxSuffixComponents is 1.
+        canBePrefix_ = true;
+        while (decoder.offset < valueEndOffset) {
+          if ((error = readTypeAndLength(&decoder, valueEndOffset, &type, &length)))
+            return error;
 
-      // Send the interest to the faces in matching FIB entries.
-      set<int> sentFaceIds;
-      for (int i = 0; i < FIB_.size(); ++i) {
-        FibEntry& fibEntry = *FIB_[i];
-
-        // This behavior is multicast.
-        // TODO: Need to allow for "best route" and longest prefix match?
-        if (fibEntry.getName().match(interest->getName())) {
-          for (int j = 0; j < fibEntry.getNextHopCount(); ++j) {
-            ForwarderFace* outFace = fibEntry.getNextHop(j).getFace();
-
-            // Don't send the interest back to where it came from or to the same face again.
-            if (outFace != face && sentFaceIds.count(outFace->getFaceId()) == 0) {
-              _LOG_DEBUG("Forwarded Interest to face " << outFace->getFaceId() << ": "
-                << interest->getName());
-              // Forward the full element including any LP header.
-              sentFaceIds.insert(outFace->getFaceId());
-              outFace->send(element, elementLength);
-            }
+          if (type == ndn_Tlv_MustBeFresh)
+            mustBeFresh_ = true;
+          else if (type == ndn_Tlv_MaxSuffixComponents) {
+            uint64_t value;
+            if ((error = ndn_TlvDecoder_readNonNegativeInteger
+                 (&decoder, length, &value)))
+              return error;
+            canBePrefix_ = (value != 1);
+            continue;
           }
+          decoder.offset += length;
         }
       }
     }
-  }
-  else if (data) {
-    _LOG_DEBUG("Received Data on face " << face->getFaceId() << ": " << data->getName());
+    else if (type == ndn_Tlv_MetaInfo) {
+      while (decoder.offset < valueEndOffset) {
+        if ((error = readTypeAndLength(&decoder, valueEndOffset, &type, &length)))
+          return error;
 
-    // Send the data packet to the face for each matching PIT entry.
-    for (int i = 0; i < PIT_.size(); ++i) {
-      PitEntry& entry = *PIT_[i];
-      if (entry.getInFace() && entry.getInterest()->matchesData(*data)) {
-        _LOG_DEBUG("Forwarded Data to face " << entry.getInFace()->getFaceId()
-          << ": " << data->getName());
-        // Forward the full element including any LP header.
-        entry.getInFace()->send(element, elementLength);
-
-        // The PIT entry is consumed, so set clear the inFace_ which prevents
-        // using it to return another Data packet, but we keep the PIT entry to
-        // check for a duplicate nonce. It will be deleted after entryEndTime.
-        // (If a fresh Interest arrives with the same name, a new PIT entry will
-        // be created.)
-        entry.clearInFace();
+        if (type == ndn_Tlv_FreshnessPeriod) {
+          uint64_t value;
+          if ((error = ndn_TlvDecoder_readNonNegativeInteger
+               (&decoder, length, &value)))
+            return error;
+          freshnessPeriod_ = std::chrono::milliseconds(value);
+          continue;
+        }
+        decoder.offset += length;
       }
     }
+
+    decoder.offset = valueEndOffset;
+  }
+
+  return NDN_ERROR_success;
+}
+
+bool
+MicroForwarder::PacketFields::matchesData(PacketFields& data) const
+{
+  // Imitate Interest::matchesData.
+  if (endsWithImplicitDigest() &&
+      lastComponentOffset_ == data.nameValueLength_ &&
+      memcmp(getNameValue(), data.getNameValue(), lastComponentOffset_) == 0)
+    // The Interest name is the Data full name if the digest matches.
+    return lastComponentValueLength_ == ndn_SHA256_DIGEST_SIZE &&
+      memcmp(encoding_ + lastComponentValueOffset_, data.getImplicitDigest(),
+             ndn_SHA256_DIGEST_SIZE) == 0;
+
+  if (!data.nameHasPrefix(getNameValue(), nameValueLength_))
+    return false;
+  // Without CanBePrefix, the Interest name must be the Data name.
+  return canBePrefix_ || nameValueLength_ == data.nameValueLength_;
+}
+
+const uint8_t*
+MicroForwarder::PacketFields::getImplicitDigest()
+{
+  if (!hasImplicitDigest_) {
+    CryptoLite::digestSha256(encoding_, encodingLength_, implicitDigest_);
+    hasImplicitDigest_ = true;
   }
+
+  return implicitDigest_;
+}
+
+Name
+MicroForwarder::PacketFields::getName() const
+{
+  Name name;
+  name.wireDecode
+    (encoding_ + nameOffset_, nameValueOffset_ + nameValueLength_ - nameOffset_);
+  return name;
 }
 
 void
 MicroForwarder::onReceivedLocalhostInterest
-  (ForwarderFace* face, const ptr_lib::shared_ptr<Interest>& interest)
+  (ForwarderFace* face, const PacketFields& interestFields)
 {
-  if (registerNamePrefix.match(interest->getName())) {
+  // Only a localhost command is fully decoded.
+  auto interest = ptr_lib::make_shared<Interest>();
+  try {
+    interest->wireDecode
+      (interestFields.getEncoding(), interestFields.getEncodingLength(),
+       *TlvWireFormat::get());
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("Error decoding localhost interest " << ex.what());
+    return;
+  }
+
+  bool isRegister = registerNamePrefix.match(interest->getName());
+  bool isStrategyChoiceSet = strategyChoiceSetNamePrefix.match(interest->getName());
+  if (isRegister || isStrategyChoiceSet) {
     // Decode the ControlParameters.
     ControlParameters controlParameters;
     try {
       controlParameters.wireDecode(interest->getName().get(4).getValue());
     } catch (const std::exception& ex) {
-      _LOG_ERROR("Error decoding registration interest ControlParameters " << ex.what());
+      _LOG_ERROR("Error decoding localhost interest ControlParameters " << ex.what());
       return;
     }
 
-    _LOG_INFO("Received register prefix request for " << controlParameters.getName());
+    if (isRegister) {
+      _LOG_INFO("Received register prefix request for " << controlParameters.getName());
 
-    if (!addRoute(controlParameters.getName(), face->getFaceId()))
-      // TODO: Send error reply?
-      return;
+      if (!addRoute(controlParameters.getName(), face->getFaceId()))
+        // TODO: Send error reply?
+        return;
+    }
+    else {
+      _LOG_INFO("Received strategy choice request for " << controlParameters.getName());
+
+      if (!setStrategy
+          (controlParameters.getName(), controlParameters.getStrategy()))
+        // TODO: Send error reply?
+        return;
+    }
 
     // Send the ControlResponse.
     ControlResponse controlResponse;
@@ -427,6 +1657,7 @@ MicroForwarder::onReceivedLocalhostInterest
 MicroForwarder::ForwarderFace*
 MicroForwarder::findFace(int faceId)
 {
+  lock_guard<mutex> lock(facesMutex_);
   for (int i = 0; i < faces_.size(); ++i) {
     if (faces_[i]->getFaceId() == faceId)
       return faces_[i].get();
@@ -435,7 +1666,21 @@ MicroForwarder::findFace(int faceId)
   return 0;
 }
 
-int MicroForwarder::ForwarderFace::lastFaceId_ = 0;
-MicroForwarder* MicroForwarder::instance_ = 0;
+void
+MicroForwarder::getFaces(vector<ptr_lib::shared_ptr<ForwarderFace> >& faces)
+{
+  lock_guard<mutex> lock(facesMutex_);
+  faces = faces_;
+}
+
+MicroForwarder*
+MicroForwarder::get()
+{
+  // C++11 guarantees thread-safe initialization of a static local variable.
+  static MicroForwarder* instance = new MicroForwarder();
+  return instance;
+}
+
+atomic<int> MicroForwarder::ForwarderFace::lastFaceId_(0);
 
 }
@@ -0,0 +1,720 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: content-meta-info.proto
+
+#include "content-meta-info.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ndn_message {
+PROTOBUF_CONSTEXPR ContentMetaInfoMessage_ContentMetaInfo::ContentMetaInfoMessage_ContentMetaInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.content_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.other_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.has_segments_)*/false} {}
+struct ContentMetaInfoMessage_ContentMetaInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ContentMetaInfoMessage_ContentMetaInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ContentMetaInfoMessage_ContentMetaInfoDefaultTypeInternal() {}
+  union {
+    ContentMetaInfoMessage_ContentMetaInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContentMetaInfoMessage_ContentMetaInfoDefaultTypeInternal _ContentMetaInfoMessage_ContentMetaInfo_default_instance_;
+PROTOBUF_CONSTEXPR ContentMetaInfoMessage::ContentMetaInfoMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.content_meta_info_)*/nullptr} {}
+struct ContentMetaInfoMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ContentMetaInfoMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ContentMetaInfoMessageDefaultTypeInternal() {}
+  union {
+    ContentMetaInfoMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContentMetaInfoMessageDefaultTypeInternal _ContentMetaInfoMessage_default_instance_;
+}  // namespace ndn_message
+static ::_pb::Metadata file_level_metadata_content_2dmeta_2dinfo_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_content_2dmeta_2dinfo_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_content_2dmeta_2dinfo_2eproto = nullptr;
+
+const uint32_t TableStruct_content_2dmeta_2dinfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo, _impl_.content_type_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo, _impl_.has_segments_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo, _impl_.other_),
+  0,
+  2,
+  3,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ContentMetaInfoMessage, _impl_.content_meta_info_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo)},
+  { 14, 21, -1, sizeof(::ndn_message::ContentMetaInfoMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ndn_message::_ContentMetaInfoMessage_ContentMetaInfo_default_instance_._instance,
+  &::ndn_message::_ContentMetaInfoMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_content_2dmeta_2dinfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027content-meta-info.proto\022\013ndn_message\"\316"
+  "\001\n\026ContentMetaInfoMessage\022O\n\021content_met"
+  "a_info\030\200\001 \002(\01323.ndn_message.ContentMetaI"
+  "nfoMessage.ContentMetaInfo\032c\n\017ContentMet"
+  "aInfo\022\025\n\014content_type\030\201\001 \002(\t\022\022\n\ttimestam"
+  "p\030\202\001 \002(\004\022\025\n\014has_segments\030\203\001 \002(\010\022\016\n\005other"
+  "\030\204\001 \001(\014"
+  ;
+static ::_pbi::once_flag descriptor_table_content_2dmeta_2dinfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_content_2dmeta_2dinfo_2eproto = {
+    false, false, 247, descriptor_table_protodef_content_2dmeta_2dinfo_2eproto,
+    "content-meta-info.proto",
+    &descriptor_table_content_2dmeta_2dinfo_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_content_2dmeta_2dinfo_2eproto::offsets,
+    file_level_metadata_content_2dmeta_2dinfo_2eproto, file_level_enum_descriptors_content_2dmeta_2dinfo_2eproto,
+    file_level_service_descriptors_content_2dmeta_2dinfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_content_2dmeta_2dinfo_2eproto_getter() {
+  return &descriptor_table_content_2dmeta_2dinfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_content_2dmeta_2dinfo_2eproto(&descriptor_table_content_2dmeta_2dinfo_2eproto);
+namespace ndn_message {
+
+// ===================================================================
+
+class ContentMetaInfoMessage_ContentMetaInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ContentMetaInfoMessage_ContentMetaInfo>()._impl_._has_bits_);
+  static void set_has_content_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_has_segments(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_other(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000d) ^ 0x0000000d) != 0;
+  }
+};
+
+ContentMetaInfoMessage_ContentMetaInfo::ContentMetaInfoMessage_ContentMetaInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+}
+ContentMetaInfoMessage_ContentMetaInfo::ContentMetaInfoMessage_ContentMetaInfo(const ContentMetaInfoMessage_ContentMetaInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ContentMetaInfoMessage_ContentMetaInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_type_){}
+    , decltype(_impl_.other_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.has_segments_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.content_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content_type()) {
+    _this->_impl_.content_type_.Set(from._internal_content_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.other_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.other_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_other()) {
+    _this->_impl_.other_.Set(from._internal_other(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.has_segments_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.has_segments_));
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+}
+
+inline void ContentMetaInfoMessage_ContentMetaInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_type_){}
+    , decltype(_impl_.other_){}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.has_segments_){false}
+  };
+  _impl_.content_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.other_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.other_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ContentMetaInfoMessage_ContentMetaInfo::~ContentMetaInfoMessage_ContentMetaInfo() {
+  // @@protoc_insertion_point(destructor:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ContentMetaInfoMessage_ContentMetaInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.content_type_.Destroy();
+  _impl_.other_.Destroy();
+}
+
+void ContentMetaInfoMessage_ContentMetaInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ContentMetaInfoMessage_ContentMetaInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.content_type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.other_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.has_segments_) -
+        reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.has_segments_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ContentMetaInfoMessage_ContentMetaInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string content_type = 129;
+      case 129:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_content_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 timestamp = 130;
+      case 130:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_timestamp(&has_bits);
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool has_segments = 131;
+      case 131:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_has_segments(&has_bits);
+          _impl_.has_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes other = 132;
+      case 132:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_other();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ContentMetaInfoMessage_ContentMetaInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string content_type = 129;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_content_type().data(), static_cast<int>(this->_internal_content_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_type");
+    target = stream->WriteStringMaybeAliased(
+        129, this->_internal_content_type(), target);
+  }
+
+  // required uint64 timestamp = 130;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(130, this->_internal_timestamp(), target);
+  }
+
+  // required bool has_segments = 131;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(131, this->_internal_has_segments(), target);
+  }
+
+  // optional bytes other = 132;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        132, this->_internal_other(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  return target;
+}
+
+size_t ContentMetaInfoMessage_ContentMetaInfo::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  size_t total_size = 0;
+
+  if (_internal_has_content_type()) {
+    // required string content_type = 129;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content_type());
+  }
+
+  if (_internal_has_timestamp()) {
+    // required uint64 timestamp = 130;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_timestamp());
+  }
+
+  if (_internal_has_has_segments()) {
+    // required bool has_segments = 131;
+    total_size += 2 + 1;
+  }
+
+  return total_size;
+}
+size_t ContentMetaInfoMessage_ContentMetaInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000d) ^ 0x0000000d) == 0) {  // All required fields are present.
+    // required string content_type = 129;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content_type());
+
+    // required uint64 timestamp = 130;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_timestamp());
+
+    // required bool has_segments = 131;
+    total_size += 2 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes other = 132;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_other());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ContentMetaInfoMessage_ContentMetaInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ContentMetaInfoMessage_ContentMetaInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ContentMetaInfoMessage_ContentMetaInfo::GetClassData() const { return &_class_data_; }
+
+
+void ContentMetaInfoMessage_ContentMetaInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ContentMetaInfoMessage_ContentMetaInfo*>(&to_msg);
+  auto& from = static_cast<const ContentMetaInfoMessage_ContentMetaInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_content_type(from._internal_content_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_other(from._internal_other());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.timestamp_ = from._impl_.timestamp_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.has_segments_ = from._impl_.has_segments_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ContentMetaInfoMessage_ContentMetaInfo::CopyFrom(const ContentMetaInfoMessage_ContentMetaInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ContentMetaInfoMessage_ContentMetaInfo::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ContentMetaInfoMessage_ContentMetaInfo::InternalSwap(ContentMetaInfoMessage_ContentMetaInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_type_, lhs_arena,
+      &other->_impl_.content_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.other_, lhs_arena,
+      &other->_impl_.other_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ContentMetaInfoMessage_ContentMetaInfo, _impl_.has_segments_)
+      + sizeof(ContentMetaInfoMessage_ContentMetaInfo::_impl_.has_segments_)
+      - PROTOBUF_FIELD_OFFSET(ContentMetaInfoMessage_ContentMetaInfo, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ContentMetaInfoMessage_ContentMetaInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_content_2dmeta_2dinfo_2eproto_getter, &descriptor_table_content_2dmeta_2dinfo_2eproto_once,
+      file_level_metadata_content_2dmeta_2dinfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class ContentMetaInfoMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ContentMetaInfoMessage>()._impl_._has_bits_);
+  static const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo& content_meta_info(const ContentMetaInfoMessage* msg);
+  static void set_has_content_meta_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo&
+ContentMetaInfoMessage::_Internal::content_meta_info(const ContentMetaInfoMessage* msg) {
+  return *msg->_impl_.content_meta_info_;
+}
+ContentMetaInfoMessage::ContentMetaInfoMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ContentMetaInfoMessage)
+}
+ContentMetaInfoMessage::ContentMetaInfoMessage(const ContentMetaInfoMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ContentMetaInfoMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_meta_info_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_content_meta_info()) {
+    _this->_impl_.content_meta_info_ = new ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo(*from._impl_.content_meta_info_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ContentMetaInfoMessage)
+}
+
+inline void ContentMetaInfoMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_meta_info_){nullptr}
+  };
+}
+
+ContentMetaInfoMessage::~ContentMetaInfoMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.ContentMetaInfoMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ContentMetaInfoMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.content_meta_info_;
+}
+
+void ContentMetaInfoMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ContentMetaInfoMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ContentMetaInfoMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.content_meta_info_ != nullptr);
+    _impl_.content_meta_info_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ContentMetaInfoMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ndn_message.ContentMetaInfoMessage.ContentMetaInfo content_meta_info = 128;
+      case 128:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr = ctx->ParseMessage(_internal_mutable_content_meta_info(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ContentMetaInfoMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ContentMetaInfoMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ndn_message.ContentMetaInfoMessage.ContentMetaInfo content_meta_info = 128;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(128, _Internal::content_meta_info(this),
+        _Internal::content_meta_info(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ContentMetaInfoMessage)
+  return target;
+}
+
+size_t ContentMetaInfoMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ContentMetaInfoMessage)
+  size_t total_size = 0;
+
+  // required .ndn_message.ContentMetaInfoMessage.ContentMetaInfo content_meta_info = 128;
+  if (_internal_has_content_meta_info()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.content_meta_info_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ContentMetaInfoMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ContentMetaInfoMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ContentMetaInfoMessage::GetClassData() const { return &_class_data_; }
+
+
+void ContentMetaInfoMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ContentMetaInfoMessage*>(&to_msg);
+  auto& from = static_cast<const ContentMetaInfoMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ContentMetaInfoMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_content_meta_info()) {
+    _this->_internal_mutable_content_meta_info()->::ndn_message::ContentMetaInfoMessage_ContentMetaInfo::MergeFrom(
+        from._internal_content_meta_info());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ContentMetaInfoMessage::CopyFrom(const ContentMetaInfoMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ContentMetaInfoMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ContentMetaInfoMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_content_meta_info()) {
+    if (!_impl_.content_meta_info_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ContentMetaInfoMessage::InternalSwap(ContentMetaInfoMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.content_meta_info_, other->_impl_.content_meta_info_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ContentMetaInfoMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_content_2dmeta_2dinfo_2eproto_getter, &descriptor_table_content_2dmeta_2dinfo_2eproto_once,
+      file_level_metadata_content_2dmeta_2dinfo_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo*
+Arena::CreateMaybeMessage< ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ContentMetaInfoMessage*
+Arena::CreateMaybeMessage< ::ndn_message::ContentMetaInfoMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ContentMetaInfoMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>